@@ -0,0 +1,489 @@
+/************************************************************************************//**
+* \file         benchmarks.c
+* \brief        Benchmarks source file.
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+#include "benchmarks.h"                          /* Benchmarks header                  */
+#include <stdio.h>                               /* Standard I/O functions             */
+#if defined(__linux__)
+#include <pthread.h>                             /* Posix thread utilities             */
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#if (TBX_PORT_CYCLE_COUNTER == 0U)
+#error "The benchmarks require a port with a cycle counter."
+#endif
+
+/** \brief Number of allocate and release pairs per memory pool benchmark. */
+#define BENCH_MEMPOOL_ITERATIONS       (10000U)
+
+/** \brief Number of blocks that each benchmarked memory pool holds. */
+#define BENCH_MEMPOOL_NUM_BLOCKS       (16U)
+
+/** \brief Number of threads for the multi-threaded memory pool benchmark. */
+#define BENCH_MEMPOOL_NUM_THREADS      (4U)
+
+/** \brief Largest number of items in the linked list benchmarks. */
+#define BENCH_LIST_MAX_SIZE            (1024U)
+
+/** \brief Number of bytes in the data buffer of the checksum and cryptography
+ *         benchmarks.
+ */
+#define BENCH_DATA_SIZE                (1024U)
+
+/** \brief Number of times that the data buffer is processed per checksum and cryptography
+ *         benchmark.
+ */
+#define BENCH_DATA_ITERATIONS          (64U)
+
+/** \brief Number of random numbers per random number benchmark. */
+#define BENCH_RANDOM_ITERATIONS        (10000U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void    benchStart(void);
+
+static void    benchReport(char const * name,
+                           size_t       size,
+                           size_t       count);
+
+static void    benchMemPool(void);
+
+static void    benchList(void);
+
+static void    benchChecksum(void);
+
+static void    benchCrypto(void);
+
+static void    benchRandom(void);
+
+static uint8_t benchListCompareItems(void const * item1,
+                                     void const * item2);
+
+#if defined(__linux__)
+static void    benchMemPoolThreaded(void);
+
+static void  * benchMemPoolThread(void * arg);
+#endif
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Value of the cycle counter at the start of the current benchmark. */
+static uint32_t benchStartTicks;
+
+/** \brief Values that the linked list benchmarks store in the lists. */
+static uint32_t benchListValues[BENCH_LIST_MAX_SIZE];
+
+/** \brief Data buffer for the checksum and cryptography benchmarks. */
+static uint8_t  benchData[BENCH_DATA_SIZE];
+
+/** \brief 256-bit key for the cryptography benchmarks. */
+static const uint8_t benchCryptoKey[32] =
+{
+  0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE, 0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D,
+  0x77, 0x81, 0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7, 0x2D, 0x98, 0x10, 0xA3,
+  0x09, 0x14, 0xDF, 0xF4
+};
+
+/** \brief Initialization vector for the cryptography benchmarks. */
+static const uint8_t benchCryptoIv[16] =
+{
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+  0x0E, 0x0F
+};
+
+
+/************************************************************************************//**
+** \brief     Handles the running of the benchmarks. The results are printed as comma
+**            separated values, one line per benchmark, after a header line:
+**              name,size,count,ticks
+**            Element size is the number of items or bytes that the benchmark works on
+**            and count is the number of operations or bytes that it processed. Element
+**            ticks is the time it took, in ticks of the cycle counter of the port.
+** \return    0 if all benchmarks ran, 1 otherwise.
+**
+****************************************************************************************/
+int runBenchmarks(void)
+{
+  /* Print the header line. */
+  (void)printf("name,size,count,ticks\n");
+  /* Run the benchmarks of the individual modules. */
+  benchMemPool();
+#if defined(__linux__)
+  benchMemPoolThreaded();
+#endif
+  benchList();
+  benchChecksum();
+  benchCrypto();
+  benchRandom();
+  return 0;
+} /*** end of runBenchmarks ***/
+
+
+/************************************************************************************//**
+** \brief     Initialization before running the benchmarks.
+**
+****************************************************************************************/
+void initializeBenchmarks(void)
+{
+  tTbxRandomCtx rndCtx;
+  size_t        idx;
+
+  /* Use the same values in each run, such that results can be compared. */
+  TbxRandomCtxInit(&rndCtx, 12345U);
+  for (idx = 0U; idx < BENCH_LIST_MAX_SIZE; idx++)
+  {
+    benchListValues[idx] = TbxRandomCtxNumberGet(&rndCtx);
+  }
+  TbxRandomCtxFill(&rndCtx, benchData, sizeof(benchData));
+} /*** end of initializeBenchmarks ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the time measurement of a benchmark.
+**
+****************************************************************************************/
+static void benchStart(void)
+{
+  benchStartTicks = TbxPortCycleCounterGet();
+} /*** end of benchStart ***/
+
+
+/************************************************************************************//**
+** \brief     Stops the time measurement of a benchmark and prints its result.
+** \param     name Name of the benchmark.
+** \param     size Number of items or bytes that the benchmark works on.
+** \param     count Number of operations or bytes that the benchmark processed.
+**
+****************************************************************************************/
+static void benchReport(char const * name,
+                        size_t       size,
+                        size_t       count)
+{
+  uint32_t ticks;
+
+  ticks = TbxPortCycleCounterGet() - benchStartTicks;
+  (void)printf("%s,%lu,%lu,%lu\n", name, (unsigned long)size, (unsigned long)count,
+               (unsigned long)ticks);
+} /*** end of benchReport ***/
+
+
+/************************************************************************************//**
+** \brief     Benchmarks allocating a block from a memory pool and releasing it again, for
+**            several block sizes. Each memory pool is created before the measurement.
+**
+****************************************************************************************/
+static void benchMemPool(void)
+{
+  static const size_t blockSizes[] = { 16U, 64U, 256U };
+  size_t              sizeIdx;
+  size_t              idx;
+  void              * blockPtr;
+
+  for (sizeIdx = 0U; sizeIdx < (sizeof(blockSizes)/sizeof(blockSizes[0])); sizeIdx++)
+  {
+    if (TbxMemPoolCreate(BENCH_MEMPOOL_NUM_BLOCKS, blockSizes[sizeIdx]) == TBX_OK)
+    {
+      benchStart();
+      for (idx = 0U; idx < BENCH_MEMPOOL_ITERATIONS; idx++)
+      {
+        blockPtr = TbxMemPoolAllocate(blockSizes[sizeIdx]);
+        TbxMemPoolRelease(blockPtr);
+      }
+      benchReport("mempool_alloc_release", blockSizes[sizeIdx],
+                  BENCH_MEMPOOL_ITERATIONS);
+    }
+    else
+    {
+      (void)printf("# mempool benchmark with size %lu skipped: out of memory\n",
+                   (unsigned long)blockSizes[sizeIdx]);
+    }
+  }
+} /*** end of benchMemPool ***/
+
+
+#if defined(__linux__)
+/************************************************************************************//**
+** \brief     Benchmarks allocating a block from a memory pool and releasing it again, by
+**            several threads at the same time.
+**
+****************************************************************************************/
+static void benchMemPoolThreaded(void)
+{
+  pthread_t threads[BENCH_MEMPOOL_NUM_THREADS];
+  size_t    idx;
+
+  if (TbxMemPoolCreate(BENCH_MEMPOOL_NUM_BLOCKS, 32U) == TBX_OK)
+  {
+    benchStart();
+    for (idx = 0U; idx < BENCH_MEMPOOL_NUM_THREADS; idx++)
+    {
+      (void)pthread_create(&threads[idx], NULL, benchMemPoolThread, NULL);
+    }
+    for (idx = 0U; idx < BENCH_MEMPOOL_NUM_THREADS; idx++)
+    {
+      (void)pthread_join(threads[idx], NULL);
+    }
+    benchReport("mempool_alloc_release_threads", BENCH_MEMPOOL_NUM_THREADS,
+                BENCH_MEMPOOL_NUM_THREADS * BENCH_MEMPOOL_ITERATIONS);
+  }
+  else
+  {
+    (void)printf("# mempool benchmark with %lu threads skipped: out of memory\n",
+                 (unsigned long)BENCH_MEMPOOL_NUM_THREADS);
+  }
+} /*** end of benchMemPoolThreaded ***/
+
+
+/************************************************************************************//**
+** \brief     Thread function of the multi-threaded memory pool benchmark.
+** \param     arg Unused.
+** \return    Unused.
+**
+****************************************************************************************/
+static void * benchMemPoolThread(void * arg)
+{
+  size_t   idx;
+  void   * blockPtr;
+
+  TBX_UNUSED_ARG(arg);
+  for (idx = 0U; idx < BENCH_MEMPOOL_ITERATIONS; idx++)
+  {
+    blockPtr = TbxMemPoolAllocate(32U);
+    TbxMemPoolRelease(blockPtr);
+  }
+  return NULL;
+} /*** end of benchMemPoolThread ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Benchmarks inserting items at the back of a linked list, iterating over
+**            them and sorting them, for several list sizes. Sizes for which the heap is
+**            too small are skipped.
+**
+****************************************************************************************/
+static void benchList(void)
+{
+  static const size_t listSizes[] = { 16U, 128U, BENCH_LIST_MAX_SIZE };
+  size_t              sizeIdx;
+  size_t              idx;
+  tTbxList          * list;
+  uint8_t             insertResult;
+  uint32_t const    * item;
+  uint32_t            sum = 0U;
+
+  for (sizeIdx = 0U; sizeIdx < (sizeof(listSizes)/sizeof(listSizes[0])); sizeIdx++)
+  {
+    list = TbxListCreate();
+    if (list != NULL)
+    {
+      /* Reserve the nodes up front, so that only inserting is measured. */
+      insertResult = TbxListReserve(list, listSizes[sizeIdx]);
+      if (insertResult == TBX_OK)
+      {
+        benchStart();
+        for (idx = 0U; (idx < listSizes[sizeIdx]) && (insertResult == TBX_OK); idx++)
+        {
+          insertResult = TbxListInsertItemBack(list, &benchListValues[idx]);
+        }
+        benchReport("list_insert", listSizes[sizeIdx], listSizes[sizeIdx]);
+      }
+      if (insertResult == TBX_OK)
+      {
+        benchStart();
+        item = TbxListGetFirstItem(list);
+        while (item != NULL)
+        {
+          sum += *item;
+          item = TbxListGetNextItem(list, item);
+        }
+        benchReport("list_iterate", listSizes[sizeIdx], listSizes[sizeIdx]);
+        benchStart();
+        TbxListSortItems(list, benchListCompareItems);
+        benchReport("list_sort", listSizes[sizeIdx], listSizes[sizeIdx]);
+      }
+      else
+      {
+        (void)printf("# list benchmarks with size %lu skipped: out of memory\n",
+                     (unsigned long)listSizes[sizeIdx]);
+      }
+      TbxListDelete(list);
+    }
+  }
+  /* Use the sum, such that the compiler cannot optimize the iteration away. */
+  (void)printf("# list checksum %lu\n", (unsigned long)sum);
+} /*** end of benchList ***/
+
+
+/************************************************************************************//**
+** \brief     Compares two items of the linked list benchmarks, for sorting them in
+**            ascending order.
+** \param     item1 Pointer to the first item.
+** \param     item2 Pointer to the second item.
+** \return    TBX_TRUE if the value of item1 is greater than the one of item2, TBX_FALSE
+**            otherwise.
+**
+****************************************************************************************/
+static uint8_t benchListCompareItems(void const * item1,
+                                     void const * item2)
+{
+  uint8_t result = TBX_FALSE;
+
+  if (*(uint32_t const *)item1 > *(uint32_t const *)item2)
+  {
+    result = TBX_TRUE;
+  }
+  return result;
+} /*** end of benchListCompareItems ***/
+
+
+/************************************************************************************//**
+** \brief     Benchmarks the throughput of the 16-bit and 32-bit CRC calculations.
+**
+****************************************************************************************/
+static void benchChecksum(void)
+{
+  size_t   idx;
+  uint32_t crc = 0U;
+
+  benchStart();
+  for (idx = 0U; idx < BENCH_DATA_ITERATIONS; idx++)
+  {
+    crc += TbxChecksumCrc16Calculate(benchData, sizeof(benchData));
+  }
+  benchReport("crc16", sizeof(benchData), BENCH_DATA_ITERATIONS * sizeof(benchData));
+  benchStart();
+  for (idx = 0U; idx < BENCH_DATA_ITERATIONS; idx++)
+  {
+    crc += TbxChecksumCrc32Calculate(benchData, sizeof(benchData));
+  }
+  benchReport("crc32", sizeof(benchData), BENCH_DATA_ITERATIONS * sizeof(benchData));
+  /* Use the CRC values, such that the compiler cannot optimize the calculations away. */
+  (void)printf("# crc checksum %lu\n", (unsigned long)crc);
+} /*** end of benchChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Benchmarks the throughput of AES256 encryption and decryption in the
+**            different modes of operation.
+**
+****************************************************************************************/
+static void benchCrypto(void)
+{
+  static const uint8_t modes[] =
+  {
+    TBX_CRYPTO_AES256_MODE_ECB, TBX_CRYPTO_AES256_MODE_CBC, TBX_CRYPTO_AES256_MODE_CTR
+  };
+  static char const * const encryptNames[] =
+  {
+    "aes256_ecb_encrypt", "aes256_cbc_encrypt", "aes256_ctr_encrypt"
+  };
+  static char const * const decryptNames[] =
+  {
+    "aes256_ecb_decrypt", "aes256_cbc_decrypt", "aes256_ctr_decrypt"
+  };
+  tTbxCryptoAes256Ctx ctx;
+  size_t              modeIdx;
+  size_t              idx;
+
+  for (modeIdx = 0U; modeIdx < sizeof(modes); modeIdx++)
+  {
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], benchCryptoKey, benchCryptoIv);
+    benchStart();
+    for (idx = 0U; idx < BENCH_DATA_ITERATIONS; idx++)
+    {
+      TbxCryptoAes256EncryptUpdate(&ctx, benchData, sizeof(benchData));
+    }
+    benchReport(encryptNames[modeIdx], sizeof(benchData),
+                BENCH_DATA_ITERATIONS * sizeof(benchData));
+    TbxCryptoAes256Done(&ctx);
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], benchCryptoKey, benchCryptoIv);
+    benchStart();
+    for (idx = 0U; idx < BENCH_DATA_ITERATIONS; idx++)
+    {
+      TbxCryptoAes256DecryptUpdate(&ctx, benchData, sizeof(benchData));
+    }
+    benchReport(decryptNames[modeIdx], sizeof(benchData),
+                BENCH_DATA_ITERATIONS * sizeof(benchData));
+    TbxCryptoAes256Done(&ctx);
+  }
+} /*** end of benchCrypto ***/
+
+
+/************************************************************************************//**
+** \brief     Benchmarks the rate of the random number generators.
+**
+****************************************************************************************/
+static void benchRandom(void)
+{
+  tTbxRandomCtx rndCtx;
+  size_t        idx;
+  uint32_t      sum = 0U;
+
+  benchStart();
+  for (idx = 0U; idx < BENCH_RANDOM_ITERATIONS; idx++)
+  {
+    sum += TbxRandomNumberGet();
+  }
+  benchReport("random_number", 1U, BENCH_RANDOM_ITERATIONS);
+  benchStart();
+  for (idx = 0U; idx < BENCH_DATA_ITERATIONS; idx++)
+  {
+    TbxRandomFill(benchData, sizeof(benchData));
+  }
+  benchReport("random_fill", sizeof(benchData),
+              BENCH_DATA_ITERATIONS * sizeof(benchData));
+  TbxRandomCtxInit(&rndCtx, 12345U);
+  benchStart();
+  for (idx = 0U; idx < BENCH_RANDOM_ITERATIONS; idx++)
+  {
+    sum += TbxRandomCtxNumberGet(&rndCtx);
+  }
+  benchReport("random_ctx_number", 1U, BENCH_RANDOM_ITERATIONS);
+  /* Use the random numbers, such that the compiler cannot optimize them away. */
+  (void)printf("# random checksum %lu\n", (unsigned long)sum);
+} /*** end of benchRandom ***/
+
+
+/*********************************** end of benchmarks.c *******************************/
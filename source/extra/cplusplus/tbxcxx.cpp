@@ -59,7 +59,8 @@
  * memory allocation and release using memory pools automatically. That's the purpose of
  * this file. By compiling and linking this source file with your project, the global new
  * and delete operators are overloaded, such that they by default always use the memory
- * pools module of MicroTBX.
+ * pools module of MicroTBX. Alternatively, they can use the default TLSF allocator of
+ * MicroTBX, by setting TBX_CONF_CXX_HEAP_TLSF to 1.
  */
 
 
@@ -67,9 +68,29 @@
 * Include files
 ****************************************************************************************/
 #include <cstdlib>
+#include <cstddef>
 #include "microtbx.h"
 
 
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_CXX_HEAP_TLSF
+/** \brief Configure the allocator behind the global new and delete operators. When set
+ *         to 0, the memory pools are used. A memory pool is then created or extended on
+ *         demand for each requested size. When set to 1, the default TLSF allocator is
+ *         used, which better suits many allocations of different sizes that live long.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_CXX_HEAP_TLSF                   (0U)
+#endif
+
+#if (TBX_CONF_CXX_HEAP_TLSF > 0U) && (TBX_CONF_TLSF_HEAP_SIZE == 0U)
+#error "TBX_CONF_CXX_HEAP_TLSF requires TBX_CONF_TLSF_HEAP_SIZE to be larger than 0."
+#endif
+
+
 /************************************************************************************//**
 ** \brief     Overloading global new operator.
 ** \param     size Size of the memory to allocate.
@@ -79,6 +100,10 @@ void * operator new(size_t size)
 {
   void * result;
   
+#if (TBX_CONF_CXX_HEAP_TLSF > 0U)
+  /* Allocate the memory with the default TLSF allocator. */
+  result = TbxTlsfAllocate(nullptr, size);
+#else
   /* Attempt to allocate a block from the best fitting memory pool. */
   result = TbxMemPoolAllocate(size);
   /* Was the allocation not successful? */
@@ -93,13 +118,19 @@ void * operator new(size_t size)
      * attempt to allocate again right afterwards. We can catch the error
      * there in case the allocation fails.
      */
-    (void)TbxMemPoolCreate(1U, size);
+    /* Create or extend the memory pool of the size class that the requested size
+     * belongs to, instead of one for the exact size. This keeps the number of memory
+     * pools small and makes its released blocks reusable for nearby sizes as well.
+     */
+    size_t classSize = TbxMemPoolGetSizeClass(size);
+    (void)TbxMemPoolCreate(1U, classSize);
 
     /* Assuming sufficient heap was available, the memory pool was extended.
      * Attempt to allocate the block again.
      */
-    result = TbxMemPoolAllocate(size);
+    result = TbxMemPoolAllocate(classSize);
   }
+#endif
   /* Verify the allocation result. */
   if (result == nullptr)
   {
@@ -120,10 +151,14 @@ void * operator new(size_t size)
 ****************************************************************************************/
 void operator delete(void * mem)
 {
-  /* Give the block back to the memory pool. */
+  /* Give the block back to the memory pool or the default TLSF allocator. */
   if (mem != nullptr)
   {
+#if (TBX_CONF_CXX_HEAP_TLSF > 0U)
+    TbxTlsfRelease(nullptr, mem);
+#else
     TbxMemPoolRelease(mem);
+#endif
   }
 } /*** end of operator delete ***/
 
@@ -134,13 +169,26 @@ void operator delete(void * mem)
 ** \param     size Size of the block.
 **
 ****************************************************************************************/
-void operator delete(void * mem, unsigned int size)
+void operator delete(void * mem, std::size_t size)
 {
-  /* Memory pool manager already knows the size of the block. */
+  /* The size cannot be used to locate the memory pool, because the block did not
+   * necessarily come from the memory pool that best fits this size. For example when
+   * a better fitting memory pool was created after the allocation. The memory pool
+   * manager reads the block size from the block itself.
+   */
   TBX_UNUSED_ARG(size);
-  
-  /* Give the block back to the memory pool. */
-  return ::operator delete(mem);
+
+  /* Give the block back to the memory pool or the default TLSF allocator. Directly,
+   * instead of through the unsized delete operator, to save a call.
+   */
+  if (mem != nullptr)
+  {
+#if (TBX_CONF_CXX_HEAP_TLSF > 0U)
+    TbxTlsfRelease(nullptr, mem);
+#else
+    TbxMemPoolRelease(mem);
+#endif
+  }
 } /*** end of operator delete ***/
 
 
@@ -174,13 +222,10 @@ void operator delete[](void * mem)
 ** \param     size Size of the block.
 **
 ****************************************************************************************/
-void operator delete[](void * mem, unsigned int size)
+void operator delete[](void * mem, std::size_t size)
 {
-  /* Memory pool manager already knows the size of the block. */
-  TBX_UNUSED_ARG(size);
-
   /* Give the block back to the memory pool. */
-  return ::operator delete(mem);
+  return ::operator delete(mem, size);
 } /*** end of operator delete[] ***/
 
 
@@ -0,0 +1,216 @@
+/************************************************************************************//**
+* \file         tbxcxx.hpp
+* \brief        STL compatible memory pool allocator header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBXCXX_HPP
+#define TBXCXX_HPP
+
+/*
+ * The overloaded global new and delete operators in tbxcxx.cpp select the best fitting
+ * memory pool for each allocation. Containers such as std::map and std::list allocate
+ * and release a node for each element, so this search happens for every insertion.
+ *
+ * TbxPoolAllocator binds a container to a lock-free fixed-size memory pool instead. The
+ * memory pool for the node type is selected at compile time, through the template
+ * parameters, and it is created upon the first allocation. Example:
+ *
+ *   std::map<uint32_t, uint32_t, std::less<uint32_t>,
+ *            TbxPoolAllocator<std::pair<const uint32_t, uint32_t>>> myMap;
+ *
+ * Allocations of more than one element, such as the storage of a std::vector, do not
+ * fit in a block of the fixed-size memory pool. These are allocated from the regular
+ * memory pools, just like the overloaded new operator does.
+ */
+
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <cstdlib>
+#include <cstddef>
+#include "microtbx.h"
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief STL compatible allocator that allocates single elements from a lock-free
+ *         fixed-size memory pool, with a block size equal to the size of the element.
+ *         All allocators with the same element type and number of blocks share the
+ *         same memory pool.
+ * \tparam T Type of the elements to allocate.
+ * \tparam NumBlocks Number of blocks in the fixed-size memory pool.
+ */
+template <typename T, std::size_t NumBlocks = 32U>
+class TbxPoolAllocator
+{
+public:
+  /** \brief Type of the elements to allocate. */
+  using value_type = T;
+
+  /** \brief Converts this allocator type to one for another element type. */
+  template <typename U>
+  struct rebind
+  {
+    /** \brief Allocator type for elements of type U. */
+    using other = TbxPoolAllocator<U, NumBlocks>;
+  };
+
+  /** \brief Default constructor. */
+  TbxPoolAllocator() noexcept = default;
+
+  /** \brief Converting constructor from an allocator for another element type.
+   *  \param other The allocator to convert from.
+   */
+  template <typename U>
+  TbxPoolAllocator(TbxPoolAllocator<U, NumBlocks> const & other) noexcept
+  {
+    TBX_UNUSED_ARG(other);
+  }
+
+  /**********************************************************************************//**
+  ** \brief     Allocates memory for the specified number of elements. A single element
+  **            is allocated from the fixed-size memory pool. If the fixed-size memory
+  **            pool has no more free blocks, or for more than one element, the memory
+  **            is allocated from the best fitting regular memory pool.
+  ** \param     n Number of elements to allocate memory for.
+  ** \return    Pointer to the allocated memory.
+  **
+  **************************************************************************************/
+  T * allocate(std::size_t n)
+  {
+    void * result = nullptr;
+
+    /* Allocate a single element from the fixed-size memory pool, if possible. */
+    if (n == 1U)
+    {
+      tTbxMemPoolFixed * pool = getPool();
+      if (pool != nullptr)
+      {
+        result = TbxMemPoolFixedAllocate(pool);
+      }
+    }
+    /* Fall back to the regular memory pools. */
+    if (result == nullptr)
+    {
+      result = TbxMemPoolAllocate(n * sizeof(T));
+      /* Was the allocation not successful? */
+      if (result == nullptr)
+      {
+        /* Create or extend the memory pool of the size class that this size belongs
+         * to and try again.
+         */
+        std::size_t classSize = TbxMemPoolGetSizeClass(n * sizeof(T));
+        (void)TbxMemPoolCreate(1U, classSize);
+        result = TbxMemPoolAllocate(classSize);
+      }
+    }
+    /* Verify the allocation result. */
+    if (result == nullptr)
+    {
+      /* Since exceptions aren't used, call abort directly to indicate an abnormal end
+       * to the program, since allocate is not allowed to return a nullptr.
+       */
+      std::abort();
+    }
+    /* Give the result back to the caller. */
+    return static_cast<T *>(result);
+  } /*** end of allocate ***/
+
+  /**********************************************************************************//**
+  ** \brief     Releases memory that was previously allocated with allocate(). Note that
+  **            TbxMemPoolRelease() automatically detects if the block belongs to the
+  **            fixed-size memory pool and then releases it without locking.
+  ** \param     ptr Pointer to the memory to release.
+  ** \param     n Number of elements, as specified when the memory was allocated.
+  **
+  **************************************************************************************/
+  void deallocate(T * ptr, std::size_t n) noexcept
+  {
+    TBX_UNUSED_ARG(n);
+
+    /* Give the block back to the memory pool. */
+    if (ptr != nullptr)
+    {
+      TbxMemPoolRelease(ptr);
+    }
+  } /*** end of deallocate ***/
+
+private:
+  /**********************************************************************************//**
+  ** \brief     Obtains the fixed-size memory pool of this allocator type. It is created
+  **            upon the first call.
+  ** \return    Handle to the fixed-size memory pool, nullptr if it could not be created.
+  **
+  **************************************************************************************/
+  static tTbxMemPoolFixed * getPool()
+  {
+    static tTbxMemPoolFixed * const pool = TbxMemPoolFixedCreate(NumBlocks, sizeof(T));
+
+    /* Give the result back to the caller. */
+    return pool;
+  } /*** end of getPool ***/
+};
+
+
+/************************************************************************************//**
+** \brief     Compares two allocators. Memory allocated by one of them can always be
+**            released by the other one.
+** \return    Always true.
+**
+****************************************************************************************/
+template <typename T, typename U, std::size_t NumBlocks>
+bool operator==(TbxPoolAllocator<T, NumBlocks> const &,
+                TbxPoolAllocator<U, NumBlocks> const &) noexcept
+{
+  return true;
+} /*** end of operator== ***/
+
+
+/************************************************************************************//**
+** \brief     Compares two allocators. Memory allocated by one of them can always be
+**            released by the other one.
+** \return    Always false.
+**
+****************************************************************************************/
+template <typename T, typename U, std::size_t NumBlocks>
+bool operator!=(TbxPoolAllocator<T, NumBlocks> const &,
+                TbxPoolAllocator<U, NumBlocks> const &) noexcept
+{
+  return false;
+} /*** end of operator!= ***/
+
+
+#endif /* TBXCXX_HPP */
+/*********************************** end of tbxcxx.hpp *********************************/
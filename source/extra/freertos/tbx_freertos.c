@@ -37,6 +37,8 @@
 /*
  * An implementation of pvPortMalloc() and vPortFree() based on the memory pools module
  * of MicroTBX. Note that this implementation allows allocated memory to be freed again.
+ * Alternatively, the default TLSF allocator of MicroTBX can be used instead of the
+ * memory pools, by setting TBX_CONF_FREERTOS_HEAP_TLSF to 1.
  *
  * See heap_1.c, heap_2.c, heap_3.c and heap_4.c for alternative implementations, and the
  * memory management pages of http://www.FreeRTOS.org for more information.
@@ -68,6 +70,21 @@
  */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/****************************************************************************************
+* Configuration macros
+***************************************************************************************/
+#ifndef TBX_CONF_FREERTOS_HEAP_TLSF
+/** \brief Configure the allocator behind pvPortMalloc() and vPortFree(). When set to 0,
+ *         the memory pools are used. A memory pool is then created or extended on demand
+ *         for each requested size. When set to 1, the default TLSF allocator is used,
+ *         which better suits many allocations of different sizes that live long. Note
+ *         that it is possible to override this value by adding this macro definition to
+ *         the configuration header file.
+ */
+#define TBX_CONF_FREERTOS_HEAP_TLSF              (0U)
+#endif
+
+
 /****************************************************************************************
 * Configuration check
 ***************************************************************************************/
@@ -75,6 +92,10 @@
 #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+#if (TBX_CONF_FREERTOS_HEAP_TLSF > 0U) && (TBX_CONF_TLSF_HEAP_SIZE == 0U)
+#error TBX_CONF_FREERTOS_HEAP_TLSF requires TBX_CONF_TLSF_HEAP_SIZE to be larger than 0
+#endif
+
 
 /****************************************************************************************
 * External function prototype
@@ -93,6 +114,10 @@ void * pvPortMalloc(size_t xWantedSize)
   /* Prevent the scheduler from performing a context switch, while allocating memory. */
   vTaskSuspendAll();
 
+#if (TBX_CONF_FREERTOS_HEAP_TLSF > 0U)
+  /* Allocate the memory with the default TLSF allocator. */
+  result = TbxTlsfAllocate(NULL, xWantedSize);
+#else
   /* Attempt to allocate a block from the best fitting memory pool. */
   result = TbxMemPoolAllocate(xWantedSize);
   /* Was the allocation not successful? */
@@ -107,13 +132,19 @@ void * pvPortMalloc(size_t xWantedSize)
       * attempts to allocate again right afterwards. We can catch the error
       * there in case the allocation fails.
       */
-    (void)TbxMemPoolCreate(1U, xWantedSize);
+    /* Create or extend the memory pool of the size class that the requested size
+     * belongs to, instead of one for the exact size. This keeps the number of memory
+     * pools small and makes its released blocks reusable for nearby sizes as well.
+     */
+    size_t classSize = TbxMemPoolGetSizeClass(xWantedSize);
+    (void)TbxMemPoolCreate(1U, classSize);
 
     /* Assuming sufficient heap was available, the memory pool was extended.
      * Attempt to allocate the block again.
      */
-    result = TbxMemPoolAllocate(xWantedSize);
+    result = TbxMemPoolAllocate(classSize);
   }
+#endif
   /* Allow memory allocation tracing. */
   traceMALLOC( result, xWantedSize );
 
@@ -125,7 +156,8 @@ void * pvPortMalloc(size_t xWantedSize)
   if( result == NULL )
   {
     /* Inform the application about this problem. Try increasing the heap size to
-     * prevent this from happining. It's macro TBX_CONF_HEAP_SIZE in tbx_conf.h.
+     * prevent this from happining. It's macro TBX_CONF_HEAP_SIZE in tbx_conf.h, or
+     * TBX_CONF_TLSF_HEAP_SIZE when the default TLSF allocator is used.
      */
     vApplicationMallocFailedHook();
   }
@@ -144,8 +176,16 @@ void * pvPortMalloc(size_t xWantedSize)
 ****************************************************************************************/
 void vPortFree(void * pv)
 {
+#if (TBX_CONF_FREERTOS_HEAP_TLSF > 0U)
+  /* Give the memory back to the default TLSF allocator. */
+  if (pv != NULL)
+  {
+    TbxTlsfRelease(NULL, pv);
+  }
+#else
   /* Give the block back to the memory pool. */
   TbxMemPoolRelease(pv);
+#endif
 } /*** end of vPortFree ***/
 
 
@@ -0,0 +1,679 @@
+/************************************************************************************//**
+* \file         tbx_queue.c
+* \brief        Lock-free message queue with FreeRTOS blocking source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/*
+ * A bounded multi-producer multi-consumer message queue for passing items by pointer,
+ * typically blocks allocated from the MicroTBX memory pools. Each slot has a sequence
+ * number, which makes it possible to store and take items without a lock. Only when the
+ * message queue is full or empty, a task blocks with the help of a FreeRTOS task
+ * notification, until another task or an interrupt service routine takes or stores an
+ * item. Note that this uses the notification value of the waiting task.
+ */
+
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "tbx_queue.h"                           /* Message queue                      */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Half the range of the free running positions. A sequence number that is less
+ *         than this distance behind a position, is considered to be behind it.
+ */
+#define TBX_QUEUE_POS_HALF_RANGE                 (0x80000000UL)
+
+/** \brief Maximum capacity of a message queue. Needs to be well below half the range of
+ *         the free running positions.
+ */
+#define TBX_QUEUE_CAPACITY_MAX                   (0x40000000UL)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a task that waits in one of the lists with waiting tasks. It is
+ *         located on the stack of the waiting task.
+ */
+typedef struct
+{
+  /** \brief Handle of the waiting task. */
+  TaskHandle_t       taskHandle;
+  /** \brief TBX_TRUE while in the list, TBX_FALSE once removed by the notifier. */
+  volatile uint8_t   waiting;
+  /** \brief Intrusive linked list node for the list with waiting tasks. */
+  tTbxIListNode      node;
+} tTbxQueueWaiter;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t   TbxQueueTryEnqueue(tTbxQueue         * queue,
+                                    void              * item);
+
+static void    * TbxQueueTryDequeue(tTbxQueue         * queue);
+
+static void      TbxQueueWaitBegin (tTbxIList         * waitList,
+                                    uint32_t volatile * waitCount,
+                                    tTbxQueueWaiter   * waiter);
+
+static uint8_t   TbxQueueWaitEnd   (tTbxIList         * waitList,
+                                    uint32_t volatile * waitCount,
+                                    tTbxQueueWaiter   * waiter);
+
+static void      TbxQueueWakeOne   (tTbxIList         * waitList,
+                                    uint32_t volatile * waitCount,
+                                    uint8_t             fromIsr,
+                                    BaseType_t        * higherPriorityTaskWoken);
+
+
+/************************************************************************************//**
+** \brief     Creates a new and empty message queue and returns its pointer. Make sure to
+**            store the pointer because it serves as a handle to the message queue, which
+**            is needed when calling the other API functions in this module. The memory
+**            for the message queue is taken from the heap.
+** \param     capacity Maximum number of items that the message queue can hold. It must
+**            be a power of two and at least two.
+** \return    Pointer to the created message queue or NULL in case of an error.
+**
+****************************************************************************************/
+tTbxQueue * TbxQueueCreate(size_t capacity)
+{
+  tTbxQueue     * result = NULL;
+  tTbxQueue     * queuePtr;
+  tTbxQueueSlot * slotsPtr = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT( (capacity >= 2U) && ((capacity & (capacity - 1U)) == 0U) &&
+              (capacity <= TBX_QUEUE_CAPACITY_MAX) );
+
+  /* Only continue if the parameter is valid. */
+  if ( (capacity >= 2U) && ((capacity & (capacity - 1U)) == 0U) &&
+       (capacity <= TBX_QUEUE_CAPACITY_MAX) )
+  {
+    /* Create the message queue object and its slots. */
+    queuePtr = TbxHeapAllocate(sizeof(tTbxQueue));
+    if (queuePtr != NULL)
+    {
+      slotsPtr = TbxHeapAllocate(capacity * sizeof(tTbxQueueSlot));
+    }
+    /* Only continue if the memory allocations were successful. */
+    if (slotsPtr != NULL)
+    {
+      /* Each slot starts out free for the producer at the position of its index. */
+      for (uint32_t idx = 0U; idx < (uint32_t)capacity; idx++)
+      {
+        slotsPtr[idx].sequence = idx;
+        slotsPtr[idx].itemPtr = NULL;
+      }
+      /* Initialize the message queue. By default it is empty. */
+      queuePtr->slotsPtr = slotsPtr;
+      queuePtr->indexMask = (uint32_t)capacity - 1U;
+      queuePtr->enqueuePos = 0U;
+      queuePtr->dequeuePos = 0U;
+      TbxIListInit(&queuePtr->sendWaitList);
+      queuePtr->sendWaitCount = 0U;
+      TbxIListInit(&queuePtr->receiveWaitList);
+      queuePtr->receiveWaitCount = 0U;
+      /* Update the result for success. */
+      result = queuePtr;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of items that are currently stored in the message queue.
+**            Note that the value can already be outdated when the function returns, if
+**            another task accessed the message queue in the meantime.
+** \param     queue Pointer to a previously created message queue.
+** \return    Number of items in the message queue.
+**
+****************************************************************************************/
+size_t TbxQueueGetCount(tTbxQueue const * queue)
+{
+  size_t   result = 0U;
+  uint32_t dequeuePos;
+  uint32_t enqueuePos;
+
+  /* Verify parameters. */
+  TBX_ASSERT(queue != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (queue != NULL)
+  {
+    /* Read the dequeue position first. Otherwise it could pass the enqueue position. */
+    dequeuePos = queue->dequeuePos;
+    TbxPortMemoryBarrier();
+    enqueuePos = queue->enqueuePos;
+    /* The positions are free running, so their difference is the number of items. It
+     * includes items of which the producer is still in the process of storing them.
+     */
+    result = (size_t)(enqueuePos - dequeuePos);
+    if (result > ((size_t)queue->indexMask + 1U))
+    {
+      result = (size_t)queue->indexMask + 1U;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Stores an item in the message queue. Only the pointer to the item is stored,
+**            the item itself is not copied. If the message queue is full, the calling
+**            task blocks until another task takes an item or until the timeout expires.
+**            May only be called from a task.
+** \param     queue Pointer to a previously created message queue.
+** \param     item Pointer to the item. Cannot be NULL.
+** \param     ticksToWait Maximum number of ticks to wait for a free slot. Zero to not
+**            wait at all.
+** \return    TBX_OK if the item was stored, TBX_ERROR otherwise, for example when the
+**            message queue stayed full.
+**
+****************************************************************************************/
+uint8_t TbxQueueSend(tTbxQueue  * queue,
+                     void       * item,
+                     TickType_t   ticksToWait)
+{
+  uint8_t         result = TBX_ERROR;
+  uint8_t         timedOut = TBX_FALSE;
+  uint8_t         notified;
+  tTbxQueueWaiter waiter;
+  TimeOut_t       timeOut;
+
+  /* Verify parameters. */
+  TBX_ASSERT((queue != NULL) && (item != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((queue != NULL) && (item != NULL))
+  {
+    /* Attempt to store the item, without blocking. */
+    result = TbxQueueTryEnqueue(queue, item);
+    /* Block if the message queue is full and the caller is willing to wait. */
+    if ((result != TBX_OK) && (ticksToWait > 0U))
+    {
+      vTaskSetTimeOutState(&timeOut);
+      waiter.taskHandle = xTaskGetCurrentTaskHandle();
+      while ((result != TBX_OK) && (timedOut == TBX_FALSE))
+      {
+        /* Register as a waiting task before trying again. This way, a receiver that
+         * frees a slot right after this attempt is sure to notify this task.
+         */
+        TbxQueueWaitBegin(&queue->sendWaitList, &queue->sendWaitCount, &waiter);
+        result = TbxQueueTryEnqueue(queue, item);
+        if (result != TBX_OK)
+        {
+          (void)ulTaskNotifyTake(pdTRUE, ticksToWait);
+          if (xTaskCheckForTimeOut(&timeOut, &ticksToWait) != pdFALSE)
+          {
+            timedOut = TBX_TRUE;
+          }
+        }
+        notified = TbxQueueWaitEnd(&queue->sendWaitList, &queue->sendWaitCount,
+                                   &waiter);
+        /* Pass a notification about a free slot on to the next waiting sender, if this
+         * task no longer tries again.
+         */
+        if ((notified == TBX_TRUE) && ((result == TBX_OK) || (timedOut == TBX_TRUE)))
+        {
+          TbxQueueWakeOne(&queue->sendWaitList, &queue->sendWaitCount, TBX_FALSE, NULL);
+        }
+      }
+    }
+    /* Notify a task that waits for an item, if the item was stored. */
+    if (result == TBX_OK)
+    {
+      TbxQueueWakeOne(&queue->receiveWaitList, &queue->receiveWaitCount, TBX_FALSE,
+                      NULL);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueSend ***/
+
+
+/************************************************************************************//**
+** \brief     Takes the oldest item from the message queue. If the message queue is
+**            empty, the calling task blocks until another task stores an item or until
+**            the timeout expires. May only be called from a task.
+** \param     queue Pointer to a previously created message queue.
+** \param     ticksToWait Maximum number of ticks to wait for an item. Zero to not wait
+**            at all.
+** \return    Pointer to the item if successful, NULL otherwise, for example when the
+**            message queue stayed empty.
+**
+****************************************************************************************/
+void * TbxQueueReceive(tTbxQueue  * queue,
+                       TickType_t   ticksToWait)
+{
+  void          * result = NULL;
+  uint8_t         timedOut = TBX_FALSE;
+  uint8_t         notified;
+  tTbxQueueWaiter waiter;
+  TimeOut_t       timeOut;
+
+  /* Verify parameters. */
+  TBX_ASSERT(queue != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (queue != NULL)
+  {
+    /* Attempt to take an item, without blocking. */
+    result = TbxQueueTryDequeue(queue);
+    /* Block if the message queue is empty and the caller is willing to wait. */
+    if ((result == NULL) && (ticksToWait > 0U))
+    {
+      vTaskSetTimeOutState(&timeOut);
+      waiter.taskHandle = xTaskGetCurrentTaskHandle();
+      while ((result == NULL) && (timedOut == TBX_FALSE))
+      {
+        /* Register as a waiting task before trying again. This way, a sender that
+         * stores an item right after this attempt is sure to notify this task.
+         */
+        TbxQueueWaitBegin(&queue->receiveWaitList, &queue->receiveWaitCount, &waiter);
+        result = TbxQueueTryDequeue(queue);
+        if (result == NULL)
+        {
+          (void)ulTaskNotifyTake(pdTRUE, ticksToWait);
+          if (xTaskCheckForTimeOut(&timeOut, &ticksToWait) != pdFALSE)
+          {
+            timedOut = TBX_TRUE;
+          }
+        }
+        notified = TbxQueueWaitEnd(&queue->receiveWaitList, &queue->receiveWaitCount,
+                                   &waiter);
+        /* Pass a notification about a stored item on to the next waiting receiver, if
+         * this task no longer tries again.
+         */
+        if ((notified == TBX_TRUE) && ((result != NULL) || (timedOut == TBX_TRUE)))
+        {
+          TbxQueueWakeOne(&queue->receiveWaitList, &queue->receiveWaitCount, TBX_FALSE,
+                          NULL);
+        }
+      }
+    }
+    /* Notify a task that waits for a free slot, if an item was taken. */
+    if (result != NULL)
+    {
+      TbxQueueWakeOne(&queue->sendWaitList, &queue->sendWaitCount, TBX_FALSE, NULL);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueReceive ***/
+
+
+/************************************************************************************//**
+** \brief     Stores an item in the message queue, without blocking. Only the pointer to
+**            the item is stored, the item itself is not copied. May only be called from
+**            an interrupt service routine.
+** \param     queue Pointer to a previously created message queue.
+** \param     item Pointer to the item. Cannot be NULL.
+** \param     higherPriorityTaskWoken Set to pdTRUE, if this woke up a task with a higher
+**            priority than the one that was interrupted. In this case, request a context
+**            switch before leaving the interrupt service routine. Can be NULL.
+** \return    TBX_OK if the item was stored, TBX_ERROR otherwise, for example when the
+**            message queue was full.
+**
+****************************************************************************************/
+uint8_t TbxQueueSendFromISR(tTbxQueue  * queue,
+                            void       * item,
+                            BaseType_t * higherPriorityTaskWoken)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameters. */
+  TBX_ASSERT((queue != NULL) && (item != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((queue != NULL) && (item != NULL))
+  {
+    /* Attempt to store the item. */
+    result = TbxQueueTryEnqueue(queue, item);
+    /* Notify a task that waits for an item, if the item was stored. */
+    if (result == TBX_OK)
+    {
+      TbxQueueWakeOne(&queue->receiveWaitList, &queue->receiveWaitCount, TBX_TRUE,
+                      higherPriorityTaskWoken);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueSendFromISR ***/
+
+
+/************************************************************************************//**
+** \brief     Takes the oldest item from the message queue, without blocking. May only be
+**            called from an interrupt service routine.
+** \param     queue Pointer to a previously created message queue.
+** \param     higherPriorityTaskWoken Set to pdTRUE, if this woke up a task with a higher
+**            priority than the one that was interrupted. In this case, request a context
+**            switch before leaving the interrupt service routine. Can be NULL.
+** \return    Pointer to the item if successful, NULL otherwise, for example when the
+**            message queue was empty.
+**
+****************************************************************************************/
+void * TbxQueueReceiveFromISR(tTbxQueue  * queue,
+                              BaseType_t * higherPriorityTaskWoken)
+{
+  void * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(queue != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (queue != NULL)
+  {
+    /* Attempt to take an item. */
+    result = TbxQueueTryDequeue(queue);
+    /* Notify a task that waits for a free slot, if an item was taken. */
+    if (result != NULL)
+    {
+      TbxQueueWakeOne(&queue->sendWaitList, &queue->sendWaitCount, TBX_TRUE,
+                      higherPriorityTaskWoken);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueReceiveFromISR ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to store an item in the message queue, without locking. A producer
+**            claims the slot at the enqueue position by moving the enqueue position with
+**            a compare-and-exchange. Afterwards, it stores the item and updates the
+**            sequence number of the slot, to hand it over to the consumers.
+** \param     queue Pointer to a previously created message queue.
+** \param     item Pointer to the item.
+** \return    TBX_OK if the item was stored, TBX_ERROR if the message queue was full.
+**
+****************************************************************************************/
+static uint8_t TbxQueueTryEnqueue(tTbxQueue * queue,
+                                  void      * item)
+{
+  uint8_t         result = TBX_ERROR;
+  uint8_t         done = TBX_FALSE;
+  tTbxQueueSlot * slotPtr = NULL;
+  uint32_t        pos;
+  uint32_t        posPrev;
+  uint32_t        sequence;
+
+  /* Keep trying until a slot was claimed or until the message queue turned out full. */
+  pos = queue->enqueuePos;
+  while (done == TBX_FALSE)
+  {
+    slotPtr = &queue->slotsPtr[pos & queue->indexMask];
+    sequence = slotPtr->sequence;
+    TbxPortMemoryBarrier();
+    /* Is the slot free for a producer at this position? */
+    if (sequence == pos)
+    {
+      /* Attempt to claim the slot. This fails if another producer was faster. */
+      posPrev = TbxPortAtomicCompareExchange32(&queue->enqueuePos, pos, pos + 1U);
+      if (posPrev == pos)
+      {
+        result = TBX_OK;
+        done = TBX_TRUE;
+      }
+      else
+      {
+        pos = posPrev;
+      }
+    }
+    /* Does the slot still hold an item from the previous round? */
+    else if ((pos - sequence) < TBX_QUEUE_POS_HALF_RANGE)
+    {
+      /* The message queue is full. */
+      done = TBX_TRUE;
+    }
+    /* Another producer already claimed the slot. */
+    else
+    {
+      pos = queue->enqueuePos;
+    }
+  }
+
+  /* Store the item and hand the slot over to the consumers, if it was claimed. */
+  if (result == TBX_OK)
+  {
+    slotPtr->itemPtr = item;
+    TbxPortMemoryBarrier();
+    slotPtr->sequence = pos + 1U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueTryEnqueue ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to take the oldest item from the message queue, without locking. A
+**            consumer claims the slot at the dequeue position by moving the dequeue
+**            position with a compare-and-exchange. Afterwards, it takes the item and
+**            updates the sequence number of the slot, to hand it over to the producers
+**            for the next round.
+** \param     queue Pointer to a previously created message queue.
+** \return    Pointer to the item if successful, NULL if the message queue was empty.
+**
+****************************************************************************************/
+static void * TbxQueueTryDequeue(tTbxQueue * queue)
+{
+  void          * result = NULL;
+  uint8_t         done = TBX_FALSE;
+  uint8_t         claimed = TBX_FALSE;
+  tTbxQueueSlot * slotPtr = NULL;
+  uint32_t        pos;
+  uint32_t        posPrev;
+  uint32_t        sequence;
+
+  /* Keep trying until a slot was claimed or until the message queue turned out empty. */
+  pos = queue->dequeuePos;
+  while (done == TBX_FALSE)
+  {
+    slotPtr = &queue->slotsPtr[pos & queue->indexMask];
+    sequence = slotPtr->sequence;
+    TbxPortMemoryBarrier();
+    /* Does the slot hold an item for a consumer at this position? */
+    if (sequence == (pos + 1U))
+    {
+      /* Attempt to claim the slot. This fails if another consumer was faster. */
+      posPrev = TbxPortAtomicCompareExchange32(&queue->dequeuePos, pos, pos + 1U);
+      if (posPrev == pos)
+      {
+        claimed = TBX_TRUE;
+        done = TBX_TRUE;
+      }
+      else
+      {
+        pos = posPrev;
+      }
+    }
+    /* Is the slot still waiting for an item from a producer? */
+    else if (((pos + 1U) - sequence) < TBX_QUEUE_POS_HALF_RANGE)
+    {
+      /* The message queue is empty. */
+      done = TBX_TRUE;
+    }
+    /* Another consumer already claimed the slot. */
+    else
+    {
+      pos = queue->dequeuePos;
+    }
+  }
+
+  /* Take the item and hand the slot over to the producers, if it was claimed. */
+  if (claimed == TBX_TRUE)
+  {
+    result = slotPtr->itemPtr;
+    TbxPortMemoryBarrier();
+    slotPtr->sequence = pos + queue->indexMask + 1U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueTryDequeue ***/
+
+
+/************************************************************************************//**
+** \brief     Adds the calling task to a list with waiting tasks.
+** \param     waitList Pointer to the list with waiting tasks.
+** \param     waitCount Pointer to the number of tasks in the list.
+** \param     waiter Pointer to the waiting task.
+**
+****************************************************************************************/
+static void TbxQueueWaitBegin(tTbxIList         * waitList,
+                              uint32_t volatile * waitCount,
+                              tTbxQueueWaiter   * waiter)
+{
+  /* Add the task to the end of the list. The critical section makes sure that the
+   * waiting flag always matches the presence in the list.
+   */
+  TbxCriticalSectionEnter();
+  waiter->waiting = TBX_TRUE;
+  TbxIListInsertNodeBack(waitList, &waiter->node);
+  *waitCount = *waitCount + 1U;
+  TbxCriticalSectionExit();
+  /* Make sure the other side can see the task in the list, before this task checks the
+   * message queue again.
+   */
+  TbxPortMemoryBarrier();
+} /*** end of TbxQueueWaitBegin ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the calling task from a list with waiting tasks, unless the other
+**            side already removed it when notifying this task.
+** \param     waitList Pointer to the list with waiting tasks.
+** \param     waitCount Pointer to the number of tasks in the list.
+** \param     waiter Pointer to the waiting task.
+** \return    TBX_TRUE if the other side removed the task from the list to notify it,
+**            TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t TbxQueueWaitEnd(tTbxIList         * waitList,
+                               uint32_t volatile * waitCount,
+                               tTbxQueueWaiter   * waiter)
+{
+  uint8_t result = TBX_TRUE;
+
+  /* Only remove the task, if it is still in the list. */
+  TbxCriticalSectionEnter();
+  if (waiter->waiting == TBX_TRUE)
+  {
+    TbxIListRemoveNode(waitList, &waiter->node);
+    *waitCount = *waitCount - 1U;
+    waiter->waiting = TBX_FALSE;
+    result = TBX_FALSE;
+  }
+  TbxCriticalSectionExit();
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxQueueWaitEnd ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the task that waits the longest from a list with waiting tasks and
+**            notifies it. On the fast path, there is no waiting task and this function
+**            does not enter a critical section.
+** \param     waitList Pointer to the list with waiting tasks.
+** \param     waitCount Pointer to the number of tasks in the list.
+** \param     fromIsr TBX_TRUE if called from an interrupt service routine, TBX_FALSE if
+**            called from a task.
+** \param     higherPriorityTaskWoken Only used when called from an interrupt service
+**            routine. Set to pdTRUE if the notified task has a higher priority than the
+**            interrupted one. Can be NULL.
+**
+****************************************************************************************/
+static void TbxQueueWakeOne(tTbxIList         * waitList,
+                            uint32_t volatile * waitCount,
+                            uint8_t             fromIsr,
+                            BaseType_t        * higherPriorityTaskWoken)
+{
+  tTbxIListNode   * nodePtr;
+  tTbxQueueWaiter * waiterPtr;
+  TaskHandle_t      taskHandle = NULL;
+
+  /* Make sure the stored or taken item is visible, before checking for waiting tasks.
+   * This pairs with the memory barrier in TbxQueueWaitBegin().
+   */
+  TbxPortMemoryBarrier();
+  /* Only continue if a task waits. */
+  if (*waitCount > 0U)
+  {
+    /* Remove the task that waits the longest from the list. */
+    TbxCriticalSectionEnter();
+    nodePtr = TbxIListRemoveFirstNode(waitList);
+    if (nodePtr != NULL)
+    {
+      waiterPtr = TBX_ILIST_GET_ITEM(nodePtr, tTbxQueueWaiter, node);
+      taskHandle = waiterPtr->taskHandle;
+      waiterPtr->waiting = TBX_FALSE;
+      *waitCount = *waitCount - 1U;
+    }
+    TbxCriticalSectionExit();
+    /* Notify the task outside of the critical section. Its waiter object can already
+     * be gone by now, which is why its task handle was copied.
+     */
+    if (taskHandle != NULL)
+    {
+      if (fromIsr == TBX_TRUE)
+      {
+        vTaskNotifyGiveFromISR(taskHandle, higherPriorityTaskWoken);
+      }
+      else
+      {
+        (void)xTaskNotifyGive(taskHandle);
+      }
+    }
+  }
+} /*** end of TbxQueueWakeOne ***/
+
+
+/*********************************** end of tbx_queue.c ********************************/
@@ -0,0 +1,119 @@
+/************************************************************************************//**
+* \file         tbx_queue.h
+* \brief        Lock-free message queue with FreeRTOS blocking header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_QUEUE_H
+#define TBX_QUEUE_H
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a slot in the message queue. The sequence number tells if the slot
+ *         is free for the producer at this position, or if it holds an item for the
+ *         consumer at this position. Note that its elements should be considered private
+ *         and only be accessed internally by this message queue module.
+ */
+typedef struct
+{
+  /** \brief Sequence number of the slot. */
+  volatile uint32_t   sequence;
+  /** \brief Pointer to the item that is stored in the slot. */
+  void    * volatile  itemPtr;
+} tTbxQueueSlot;
+
+/** \brief Layout of a bounded multi-producer multi-consumer message queue. Its pointer
+ *         serves as the handle to the message queue, which is obtained after creation of
+ *         the message queue and which is needed in the other functions of this module.
+ *         Note that its elements should be considered private and only be accessed
+ *         internally by this message queue module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the array with slots. */
+  tTbxQueueSlot     * slotsPtr;
+  /** \brief Capacity of the message queue in items minus one. */
+  uint32_t            indexMask;
+  /** \brief Free running position where the next item is stored. */
+  volatile uint32_t   enqueuePos;
+  /** \brief Free running position from where the next item is taken. */
+  volatile uint32_t   dequeuePos;
+  /** \brief Tasks that wait for a free slot, because the message queue was full. */
+  tTbxIList           sendWaitList;
+  /** \brief Number of tasks in the list with tasks that wait for a free slot. */
+  volatile uint32_t   sendWaitCount;
+  /** \brief Tasks that wait for an item, because the message queue was empty. */
+  tTbxIList           receiveWaitList;
+  /** \brief Number of tasks in the list with tasks that wait for an item. */
+  volatile uint32_t   receiveWaitCount;
+} tTbxQueue;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxQueue * TbxQueueCreate         (size_t              capacity);
+
+size_t      TbxQueueGetCount       (tTbxQueue   const * queue);
+
+uint8_t     TbxQueueSend           (tTbxQueue         * queue,
+                                    void              * item,
+                                    TickType_t          ticksToWait);
+
+void      * TbxQueueReceive        (tTbxQueue         * queue,
+                                    TickType_t          ticksToWait);
+
+uint8_t     TbxQueueSendFromISR    (tTbxQueue         * queue,
+                                    void              * item,
+                                    BaseType_t        * higherPriorityTaskWoken);
+
+void      * TbxQueueReceiveFromISR (tTbxQueue         * queue,
+                                    BaseType_t        * higherPriorityTaskWoken);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_QUEUE_H */
+/*********************************** end of tbx_queue.h ********************************/
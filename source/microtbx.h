@@ -58,7 +58,13 @@
 #include "tbx_critsect.h"                   /* Critical sections                       */
 #include "tbx_heap.h"                       /* Heap memory allocation                  */
 #include "tbx_list.h"                       /* Linked lists                            */
+#include "tbx_ilist.h"                      /* Intrusive linked lists                  */
+#include "tbx_ringbuf.h"                    /* Lock-free ring buffers                  */
+#include "tbx_hashmap.h"                    /* Hash maps                               */
+#include "tbx_timer.h"                      /* Software timers                         */
 #include "tbx_mempool.h"                    /* Pool based heap memory manager          */
+#include "tbx_tlsf.h"                       /* TLSF memory allocator                   */
+#include "tbx_channel.h"                    /* Cross-core channel                      */
 #include "tbx_random.h"                     /* Random number generator                 */
 #include "tbx_checksum.h"                   /* Checksum module                         */
 #include "tbx_crypto.h"                     /* Cryptography module                     */
@@ -45,7 +45,9 @@
 ** \brief     Stores the current state of the CPU status register and then disables the
 **            generation of global interrupts. The status register contains information
 **            about the interrupts being disable/enabled before they get disabled. This
-**            is needed to later on restore the state. 
+**            is needed to later on restore the state. When
+**            TBX_CONF_PORT_MAX_SYSCALL_PRIORITY is configured, the BASEPRI version in
+**            tbx_port.c overrides this weak function.
 **            Prototype: 
 **              tTbxPortCpuSR TbxPortInterruptsDisable(void);
 ** \return    The current value of the CPU status register.
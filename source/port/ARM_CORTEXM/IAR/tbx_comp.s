@@ -43,6 +43,8 @@
         THUMB
 
         
+        ; Both functions are weak. When TBX_CONF_PORT_MAX_SYSCALL_PRIORITY is configured,
+        ; the BASEPRI versions in tbx_port.c override them.
         PUBWEAK TbxPortInterruptsDisable
 TbxPortInterruptsDisable
         ; Store state of the currently enabled/disabled interrupts in register 0. On the 
@@ -40,13 +40,326 @@
 #include "microtbx.h"                            /* MicroTBX global header             */
 
 
-/* At this point nothing is implemented here. The TbxPortInterruptsXxx functions were
- * implemented in assembly for MISRA compliance. MISRA requires that where assembly
- * language instructions are required, it is recommended that they be encapsulated and
- * isolated in either: (a) assembler functions, (b) C functions or (c) macros.
- * Recommendation (a) was chosen for the TbxPortInterruptsXxx functions. They are located
- * in the compiler specific part of the port.
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+/** \brief Debug exception and monitor control register. */
+#define TBX_PORT_DEMCR_REG             (*((volatile uint32_t *)(0xE000EDFCUL)))
+
+/** \brief Bit in the DEMCR register that enables the DWT unit. */
+#define TBX_PORT_DEMCR_TRCENA_BIT      (0x01000000UL)
+
+/** \brief Control register of the DWT unit. */
+#define TBX_PORT_DWT_CTRL_REG          (*((volatile uint32_t *)(0xE0001000UL)))
+
+/** \brief Bit in the DWT control register that enables the cycle counter. */
+#define TBX_PORT_DWT_CYCCNTENA_BIT     (0x00000001UL)
+
+/** \brief Cycle counter register of the DWT unit. */
+#define TBX_PORT_DWT_CYCCNT_REG        (*((volatile uint32_t *)(0xE0001004UL)))
+
+/** \brief Lock access register of the DWT unit. Only implemented on the Cortex-M7. */
+#define TBX_PORT_DWT_LAR_REG           (*((volatile uint32_t *)(0xE0001FB0UL)))
+
+/** \brief Value to write to the lock access register, to unlock the DWT unit. */
+#define TBX_PORT_DWT_LAR_UNLOCK_KEY    (0xC5ACCE55UL)
+#endif
+
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Number of lock entries, summed over all lock objects, that were not yet
+ *         exited.
+ */
+static uint32_t      tbxPortLockNesting = 0U;
+
+/** \brief Copy of the CPU status register from right before the first lock was entered.
+ *         It is kept globally instead of per lock object. This way the interrupts are
+ *         only restored once all locks were exited, regardless of the order in which
+ *         they are exited.
+ */
+static tTbxPortCpuSR tbxPortLockCpuSR = 0U;
+#endif
+
+
+/* The TbxPortInterruptsXxx functions were implemented in assembly for MISRA compliance.
+ * MISRA requires that where assembly language instructions are required, it is
+ * recommended that they be encapsulated and isolated in either: (a) assembler functions,
+ * (b) C functions or (c) macros. Recommendation (a) was chosen for the
+ * TbxPortInterruptsXxx functions. They are located in the compiler specific part of the
+ * port. The functions in this file build on top of them. The assembly functions block
+ * all interrupts with PRIMASK and are weak. When TBX_CONF_PORT_MAX_SYSCALL_PRIORITY is
+ * configured, the C functions in this file replace them, to only block interrupts up to
+ * that priority with BASEPRI. This leaves the assembly files the same for all cores.
  */
 
 
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (TBX_CONF_PORT_MAX_SYSCALL_PRIORITY > 0U)
+#if !defined(__ARM_ARCH_ISA_THUMB) || (__ARM_ARCH_ISA_THUMB != 2)
+#error "TBX_CONF_PORT_MAX_SYSCALL_PRIORITY requires a core with BASEPRI."
+#endif
+#if (TBX_CONF_PORT_MAX_SYSCALL_PRIORITY > 255U)
+#error "TBX_CONF_PORT_MAX_SYSCALL_PRIORITY is invalid."
+#endif
+#if !defined(__GNUC__) && !defined(__ICCARM__)
+#error "TBX_CONF_PORT_MAX_SYSCALL_PRIORITY is not supported with this compiler."
+#endif
+#endif
+
+
+#if (TBX_CONF_PORT_MAX_SYSCALL_PRIORITY > 0U)
+/************************************************************************************//**
+** \brief     Stores the current value of the BASEPRI register and then blocks all
+**            interrupts with a priority value of at least
+**            TBX_CONF_PORT_MAX_SYSCALL_PRIORITY. Interrupts with a higher priority stay
+**            enabled. Writing to BASEPRI_MAX only ever raises the masking, so a nested
+**            call never lowers it. This function replaces the weak assembly function
+**            that uses PRIMASK.
+** \return    The previous value of the BASEPRI register.
+**
+****************************************************************************************/
+tTbxPortCpuSR TbxPortInterruptsDisable(void)
+{
+  tTbxPortCpuSR result;
+
+  /* Store the current value of BASEPRI and raise it to the configured priority. The
+   * instruction synchronization barrier makes sure that the new masking is in effect
+   * before the next instruction executes.
+   */
+  __asm volatile ("mrs %0, basepri" : "=r" (result) : : "memory");
+  __asm volatile ("msr basepri_max, %0\n"
+                  "isb" : : "r" (TBX_CONF_PORT_MAX_SYSCALL_PRIORITY) : "memory");
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortInterruptsDisable ***/
+
+
+/************************************************************************************//**
+** \brief     Restores the BASEPRI register to the value it had when function
+**            TbxPortInterruptsDisable() was previously called. This function replaces
+**            the weak assembly function that uses PRIMASK.
+** \param     prevCpuSr The previous value of the BASEPRI register, as returned by
+**            function TbxPortInterruptsDisable().
+**
+****************************************************************************************/
+void TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr)
+{
+  /* Restore the previous value of BASEPRI. */
+  __asm volatile ("msr basepri, %0" : : "r" (prevCpuSr) : "memory");
+} /*** end of TbxPortInterruptsRestore ***/
+
+
+#endif /* (TBX_CONF_PORT_MAX_SYSCALL_PRIORITY > 0U) */
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the value at the target address with the expected
+**            value and, only if they are equal, writes the desired value to the target
+**            address. On Cortex-M cores that
+**            support exclusive accesses (ARMv7-M and newer), this is done with the
+**            LDREX/STREX instructions, without disabling the interrupts. On other cores,
+**            such as the Cortex-M0(+), the interrupts are disabled for the duration of
+**            the operation. Note that the inline assembly is encapsulated in this C
+**            function for MISRA compliance.
+** \param     target Pointer to the 32-bit value to operate on.
+** \param     expected The value that the target is expected to have.
+** \param     desired The value to write to the target, if it has the expected value.
+** \return    The value that the target had, right before the operation. The desired
+**            value was written if this equals the expected value.
+**
+****************************************************************************************/
+uint32_t TbxPortAtomicCompareExchange32(uint32_t volatile * target,
+                                        uint32_t            expected,
+                                        uint32_t            desired)
+{
+  uint32_t      result;
+#if defined(__GNUC__) && defined(__ARM_FEATURE_LDREX) && ((__ARM_FEATURE_LDREX & 4) != 0)
+  uint32_t      strexFailed = 1U;
+
+  /* Keep trying until the exclusive store succeeded or until the target turned out not
+   * to have the expected value. The exclusive store fails if an interrupt occurred in
+   * between the exclusive load and store.
+   */
+  while (strexFailed != 0U)
+  {
+    /* Read the current value and mark the target for exclusive access. */
+    __asm__ volatile ("ldrex %0, [%1]" : "=r" (result) : "r" (target) : "memory");
+    /* Only write the desired value if the target has the expected value. */
+    if (result != expected)
+    {
+      /* Clear the exclusive access mark and stop trying. */
+      __asm__ volatile ("clrex" ::: "memory");
+      break;
+    }
+    /* Attempt to write the desired value. */
+    __asm__ volatile ("strex %0, %2, [%1]" : "=&r" (strexFailed)
+                                           : "r" (target), "r" (desired) : "memory");
+  }
+#else
+  tTbxPortCpuSR cpuSR;
+
+  /* Disable the interrupts for the short moment it takes to compare and write. */
+  cpuSR = TbxPortInterruptsDisable();
+  /* Read the current value and only write the desired value if it is the expected one. */
+  result = *target;
+  if (result == expected)
+  {
+    *target = desired;
+  }
+  /* Restore the interrupts. */
+  TbxPortInterruptsRestore(cpuSR);
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicCompareExchange32 ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the pointer at the target address with the expected
+**            pointer and, only if they are equal, writes the desired pointer to the
+**            target address. Pointers are 32-bit on the Cortex-M, so the request is
+**            passed on to TbxPortAtomicCompareExchange32().
+** \param     target Pointer to the pointer to operate on.
+** \param     expected The pointer that the target is expected to have.
+** \param     desired The pointer to write to the target, if it has the expected pointer.
+** \return    The pointer that the target had, right before the operation. The desired
+**            pointer was written if this equals the expected pointer.
+**
+****************************************************************************************/
+void * TbxPortAtomicCompareExchangePtr(void * volatile * target,
+                                       void           * expected,
+                                       void           * desired)
+{
+  uint32_t result;
+
+  /* Pass the request on to the 32-bit compare and exchange operation. */
+  result = TbxPortAtomicCompareExchange32((uint32_t volatile *)(void *)target,
+                                          (uint32_t)(uintptr_t)expected,
+                                          (uint32_t)(uintptr_t)desired);
+
+  /* Give the result back to the caller. */
+  return (void *)(uintptr_t)result;
+} /*** end of TbxPortAtomicCompareExchangePtr ***/
+
+
+/************************************************************************************//**
+** \brief     Makes sure that all memory accesses before this function call are completed
+**            before any memory access after this function call is performed. This
+**            ordering is needed by lock-free data structures in which one context
+**            publishes data to another context, for example a ring buffer shared by an
+**            interrupt service routine and the main loop. On Cortex-M, this is done
+**            with the DMB instruction. Note that the inline assembly is encapsulated in
+**            this C function for MISRA compliance.
+**
+****************************************************************************************/
+void TbxPortMemoryBarrier(void)
+{
+#if defined(__GNUC__)
+  /* Insert a data memory barrier, which also serves as a compiler barrier. */
+  __asm__ volatile ("dmb" ::: "memory");
+#else
+  /* Cortex-M cores do not reorder memory accesses as observed by the same core. With
+   * only a single core, it is sufficient that the compiler cannot move memory accesses
+   * across the call of this function, which is implemented in a separate module.
+   */
+#endif
+} /*** end of TbxPortMemoryBarrier ***/
+
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Initializes a lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockInit(tTbxPortLock * lock)
+{
+  /* The lock is not yet entered. */
+  lock->nestingCounter = 0U;
+} /*** end of TbxPortLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the resource that is protected by the
+**            lock object. This is a single core microcontroller, so it is sufficient to
+**            disable the interrupts.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockEnter(tTbxPortLock * lock)
+{
+  tTbxPortCpuSR cpuSR;
+
+  /* Disable the interrupts and store the CPU status register value in a local variable.
+   * The lock object itself should only be accessed with interrupts disabled.
+   */
+  cpuSR = TbxPortInterruptsDisable();
+  /* Only store the CPU status register value upon the first entry of any lock. */
+  if (tbxPortLockNesting == 0U)
+  {
+    tbxPortLockCpuSR = cpuSR;
+  }
+  /* Increment the nesting counters. */
+  tbxPortLockNesting++;
+  lock->nestingCounter++;
+} /*** end of TbxPortLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the resource that is protected by the
+**            lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockExit(tTbxPortLock * lock)
+{
+  /* Only continue if the lock was actually entered. */
+  if (lock->nestingCounter > 0U)
+  {
+    /* Decrement the nesting counters. */
+    lock->nestingCounter--;
+    tbxPortLockNesting--;
+    /* Restore the interrupt status once all locks were exited. */
+    if (tbxPortLockNesting == 0U)
+    {
+      TbxPortInterruptsRestore(tbxPortLockCpuSR);
+    }
+  }
+} /*** end of TbxPortLockExit ***/
+#endif /* (TBX_CONF_LOCK_ENABLE > 0U) */
+
+
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+/************************************************************************************//**
+** \brief     Obtains the value of the free running cycle counter. On Cortex-M this is
+**            the CYCCNT register of the DWT unit, which counts CPU clock cycles. The
+**            cycle counter is enabled upon the first call of this function. The time
+**            between two readings is the difference of their values. Note that a
+**            debugger can also use the DWT unit and reset the cycle counter.
+** \return    Current value of the cycle counter.
+**
+****************************************************************************************/
+uint32_t TbxPortCycleCounterGet(void)
+{
+  /* Enable the cycle counter, if this was not yet done. */
+  if ((TBX_PORT_DWT_CTRL_REG & TBX_PORT_DWT_CYCCNTENA_BIT) == 0U)
+  {
+    TBX_PORT_DEMCR_REG |= TBX_PORT_DEMCR_TRCENA_BIT;
+    TBX_PORT_DWT_LAR_REG = TBX_PORT_DWT_LAR_UNLOCK_KEY;
+    TBX_PORT_DWT_CYCCNT_REG = 0U;
+    TBX_PORT_DWT_CTRL_REG |= TBX_PORT_DWT_CYCCNTENA_BIT;
+  }
+  /* Read the cycle counter. */
+  return TBX_PORT_DWT_CYCCNT_REG;
+} /*** end of TbxPortCycleCounterGet ***/
+#endif /* (TBX_PORT_CYCLE_COUNTER > 0U) */
+
+
 /*********************************** end of tbx_port.c *********************************/
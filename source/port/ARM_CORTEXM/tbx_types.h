@@ -39,6 +39,43 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_PORT_MAX_SYSCALL_PRIORITY
+/** \brief Configure how the critical section and the lock objects block interrupts. When
+ *         set to 0, all interrupts are blocked with PRIMASK. Otherwise, only interrupts
+ *         with a priority value of at least this value are blocked with BASEPRI.
+ *         Interrupts with a higher priority, so a lower priority value, are then not
+ *         delayed by MicroTBX, but must not call MicroTBX functions. The value is written
+ *         to BASEPRI as is, so it is already shifted to the implemented priority bits,
+ *         just like configMAX_SYSCALL_INTERRUPT_PRIORITY of FreeRTOS. Only supported on
+ *         ARMv7-M and ARMv8-M mainline cores, such as the Cortex-M3, M4, M7 and M33.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_PORT_MAX_SYSCALL_PRIORITY       (0U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Initializer for a statically allocated port specific lock object. */
+#define TBX_PORT_LOCK_INIT                       { 0U }
+
+#if defined(__ARM_ARCH_ISA_THUMB) && (__ARM_ARCH_ISA_THUMB == 2)
+#ifndef TBX_PORT_CYCLE_COUNTER
+/** \brief This port offers a cycle counter on the Cortex-M3 and newer mainline cores,
+ *         through the CYCCNT register of their DWT unit. It counts CPU clock cycles. Note
+ *         that it is possible to disable this by setting this macro to 0 in the
+ *         configuration header file.
+ */
+#define TBX_PORT_CYCLE_COUNTER                   (1U)
+#endif
+#endif
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -49,6 +86,17 @@ extern "C" {
  */
 typedef uint32_t tTbxPortCpuSR;
 
+/** \brief Layout of a lock object. On a single core microcontroller, masking the
+ *         interrupts is sufficient for obtaining mutual exclusive access. The lock object
+ *         therefore only needs to keep track of its nesting. The CPU status register is
+ *         stored globally, so that the locks can be exited in any order.
+ */
+typedef struct
+{
+  /** \brief Number of times the lock was entered, without being exited yet. */
+  uint32_t      nestingCounter;
+} tTbxPortLock;
+
 
 #ifdef __cplusplus
 }
@@ -41,6 +41,24 @@
 #include "microtbx.h"                            /* MicroTBX global header             */
 
 
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Number of lock entries, summed over all lock objects, that were not yet
+ *         exited.
+ */
+static uint8_t       tbxPortLockNesting = 0U;
+
+/** \brief Copy of the CPU status register from right before the first lock was entered.
+ *         It is kept globally instead of per lock object. This way the interrupts are
+ *         only restored once all locks were exited, regardless of the order in which
+ *         they are exited.
+ */
+static tTbxPortCpuSR tbxPortLockCpuSR = 0U;
+#endif
+
+
 /************************************************************************************//**
 ** \brief     Stores the current state of the CPU status register and then disables the
 **            generation of global interrupts. The status register contains information
@@ -84,4 +102,155 @@ void TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr)
 } /*** end of TbxPortInterruptsRestore ***/
 
 
+/************************************************************************************//**
+** \brief     Atomically compares the value at the target address with the expected
+**            value and, only if they are equal, writes the desired value to the target
+**            address. This 8-bit microcontroller
+**            does not support atomic 32-bit operations, so the interrupts are disabled
+**            for the duration of the operation.
+** \param     target Pointer to the 32-bit value to operate on.
+** \param     expected The value that the target is expected to have.
+** \param     desired The value to write to the target, if it has the expected value.
+** \return    The value that the target had, right before the operation. The desired
+**            value was written if this equals the expected value.
+**
+****************************************************************************************/
+uint32_t TbxPortAtomicCompareExchange32(uint32_t volatile * target,
+                                        uint32_t            expected,
+                                        uint32_t            desired)
+{
+  uint32_t      result;
+  tTbxPortCpuSR cpuSR;
+
+  /* Disable the interrupts for the short moment it takes to compare and write. */
+  cpuSR = TbxPortInterruptsDisable();
+  /* Read the current value and only write the desired value if it is the expected one. */
+  result = *target;
+  if (result == expected)
+  {
+    *target = desired;
+  }
+  /* Restore the interrupts. */
+  TbxPortInterruptsRestore(cpuSR);
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicCompareExchange32 ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the pointer at the target address with the expected
+**            pointer and, only if they are equal, writes the desired pointer to the
+**            target address. A 16-bit pointer is not written atomically by this 8-bit
+**            microcontroller, so the interrupts are disabled for the duration of the
+**            operation.
+** \param     target Pointer to the pointer to operate on.
+** \param     expected The pointer that the target is expected to have.
+** \param     desired The pointer to write to the target, if it has the expected pointer.
+** \return    The pointer that the target had, right before the operation. The desired
+**            pointer was written if this equals the expected pointer.
+**
+****************************************************************************************/
+void * TbxPortAtomicCompareExchangePtr(void * volatile * target,
+                                       void           * expected,
+                                       void           * desired)
+{
+  void        * result;
+  tTbxPortCpuSR cpuSR;
+
+  /* Disable the interrupts for the short moment it takes to compare and write. */
+  cpuSR = TbxPortInterruptsDisable();
+  /* Read the current value and only write the desired value if it is the expected one. */
+  result = *target;
+  if (result == expected)
+  {
+    *target = desired;
+  }
+  /* Restore the interrupts. */
+  TbxPortInterruptsRestore(cpuSR);
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicCompareExchangePtr ***/
+
+
+/************************************************************************************//**
+** \brief     Makes sure that all memory accesses before this function call are completed
+**            before any memory access after this function call is performed. This
+**            ordering is needed by lock-free data structures in which one context
+**            publishes data to another context, for example a ring buffer shared by an
+**            interrupt service routine and the main loop. The AVR core does not reorder
+**            memory accesses, so it is sufficient to prevent the compiler from doing so.
+**
+****************************************************************************************/
+void TbxPortMemoryBarrier(void)
+{
+  /* Insert a compiler barrier. */
+  __asm__ __volatile__ ("" ::: "memory");
+} /*** end of TbxPortMemoryBarrier ***/
+
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Initializes a lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockInit(tTbxPortLock * lock)
+{
+  /* The lock is not yet entered. */
+  lock->nestingCounter = 0U;
+} /*** end of TbxPortLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the resource that is protected by the
+**            lock object. This is a single core microcontroller, so it is sufficient to
+**            disable the interrupts.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockEnter(tTbxPortLock * lock)
+{
+  tTbxPortCpuSR cpuSR;
+
+  /* Disable the interrupts and store the CPU status register value in a local variable.
+   * The lock object itself should only be accessed with interrupts disabled.
+   */
+  cpuSR = TbxPortInterruptsDisable();
+  /* Only store the CPU status register value upon the first entry of any lock. */
+  if (tbxPortLockNesting == 0U)
+  {
+    tbxPortLockCpuSR = cpuSR;
+  }
+  /* Increment the nesting counters. */
+  tbxPortLockNesting++;
+  lock->nestingCounter++;
+} /*** end of TbxPortLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the resource that is protected by the
+**            lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockExit(tTbxPortLock * lock)
+{
+  /* Only continue if the lock was actually entered. */
+  if (lock->nestingCounter > 0U)
+  {
+    /* Decrement the nesting counters. */
+    lock->nestingCounter--;
+    tbxPortLockNesting--;
+    /* Restore the interrupt status once all locks were exited. */
+    if (tbxPortLockNesting == 0U)
+    {
+      TbxPortInterruptsRestore(tbxPortLockCpuSR);
+    }
+  }
+} /*** end of TbxPortLockExit ***/
+#endif /* (TBX_CONF_LOCK_ENABLE > 0U) */
+
+
 /*********************************** end of tbx_port.c *********************************/
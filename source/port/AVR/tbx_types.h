@@ -39,6 +39,13 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Initializer for a statically allocated port specific lock object. */
+#define TBX_PORT_LOCK_INIT                       { 0U }
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -49,6 +56,17 @@ extern "C" {
  */
 typedef uint8_t tTbxPortCpuSR;
 
+/** \brief Layout of a lock object. On a single core microcontroller, masking the
+ *         interrupts is sufficient for obtaining mutual exclusive access. The lock object
+ *         therefore only needs to keep track of its nesting. The CPU status register is
+ *         stored globally, so that the locks can be exited in any order.
+ */
+typedef struct
+{
+  /** \brief Number of times the lock was entered, without being exited yet. */
+  uint8_t       nestingCounter;
+} tTbxPortLock;
+
 
 #ifdef __cplusplus
 }
@@ -41,6 +41,26 @@
 #include <pthread.h>                             /* Posix thread utilities             */
 #include <stdbool.h>                             /* Boolean definitions                */
 #include <stdatomic.h>                           /* Atomic operations                  */
+#include <string.h>                              /* String utilities                   */
+#include <unistd.h>                              /* Posix system calls                 */
+#include <sys/syscall.h>                         /* System call numbers                */
+#include <linux/futex.h>                         /* Fast user-space mutexes            */
+#if (TBX_PORT_ENTROPY > 0U)
+#include <errno.h>                               /* Error numbers                      */
+#include <sys/random.h>                          /* Kernel random number generator     */
+#endif
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+#include <time.h>                                /* Time functions                     */
+#endif
+#if (TBX_PORT_CRC_ACCEL > 0U) || (TBX_PORT_AES_ACCEL > 0U)
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>                           /* x86 intrinsics                     */
+#elif defined(__aarch64__)
+#include <arm_acle.h>                            /* ARM C language extensions          */
+#include <arm_neon.h>                            /* ARM NEON and AES intrinsics        */
+#include <sys/auxv.h>                            /* Auxiliary vector with CPU features */
+#endif
+#endif
 
 
 /****************************************************************************************
@@ -51,17 +71,229 @@
  */
 #define TBX_PORT_CPU_SR_IRQ_EN    (1U)
 
+/** \brief State of an unlocked futex lock. */
+#define TBX_PORT_FUTEX_UNLOCKED   (0U)
+
+/** \brief State of a locked futex lock, without sleeping threads. */
+#define TBX_PORT_FUTEX_LOCKED     (1U)
+
+/** \brief State of a locked futex lock, with possibly sleeping threads. */
+#define TBX_PORT_FUTEX_CONTENDED  (2U)
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+/** \brief Flag that indicates that the CPU supports carry-less multiplication. */
+#define TBX_PORT_CRC_FEAT_CLMUL   (0x01U)
+
+/** \brief Flag that indicates that the CPU has an instruction for the CRC32C. */
+#define TBX_PORT_CRC_FEAT_CRC32C  (0x02U)
+
+/** \brief Flag that indicates that the CPU has an instruction for the CRC32 of Ethernet
+ *         and zlib.
+ */
+#define TBX_PORT_CRC_FEAT_CRC32   (0x04U)
+
+/** \brief Polynomial of the CRC32C, which is also known as CRC32-ISCSI. */
+#define TBX_PORT_CRC32C_POLYNOM   (0x1EDC6F41UL)
+
+/** \brief Polynomial of the CRC32 of Ethernet and zlib. */
+#define TBX_PORT_CRC32_POLYNOM    (0x04C11DB7UL)
+
+/** \brief Minimum number of bytes, for which folding with carry-less multiplications is
+ *         faster than the table-driven calculation. Folding needs to reduce its final
+ *         128-bit value one bit at a time.
+ */
+#define TBX_PORT_CRC_FOLD_MIN_LEN (256U)
+
+/** \brief Number of bytes that folding with carry-less multiplications processes at a
+ *         time.
+ */
+#define TBX_PORT_CRC_FOLD_BLOCK   (16U)
+#endif
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+/** \brief Number of round keys of AES256, which is one more than its number of rounds. */
+#define TBX_PORT_AES_NUM_ROUNDS   (15U)
+
+/** \brief Number of 32-bit words in a round key. */
+#define TBX_PORT_AES_ROUND_KEY_WORDS (4U)
+
+/** \brief Number of blocks that are encrypted or decrypted at the same time. The AES
+ *         instructions of both x86 and ARMv8 CPUs have a latency of several cycles, but
+ *         a throughput of up to one or two each cycle.
+ */
+#define TBX_PORT_AES_PIPELINE     (8U)
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+#if (TBX_PORT_CRC_ACCEL > 0U)
+/** \brief Constants for folding the data of a CRC algorithm with carry-less
+ *         multiplications. Calculating them takes some time, so they are kept for the
+ *         last CRC algorithm that a thread used.
+ */
+typedef struct
+{
+  /** \brief Polynomial of the CRC algorithm. */
+  uint64_t polynom;
+  /** \brief Width of the CRC in bits. Zero if the constants are not yet calculated. */
+  uint8_t  numBits;
+  /** \brief TBX_TRUE if the CRC algorithm reflects its input, TBX_FALSE otherwise. */
+  uint8_t  reflect;
+  /** \brief Constants for folding a 128-bit value into the next 16 data bytes. */
+  uint64_t fold128[2];
+  /** \brief Constants for folding a 128-bit value into the data bytes that are 64 bytes
+   *         further.
+   */
+  uint64_t fold512[2];
+} tTbxPortCrcFoldConsts;
+#endif
+
 
 /****************************************************************************************
 * Local data declarations
 ****************************************************************************************/
-/** \brief Flag that simulates the global interrupt enabled/disabled state. Assume
- *         enabled by default.
+/** \brief State of the futex lock that simulates disabling the global interrupts, by
+ *         locking out the other threads.
+ */
+static uint32_t        critSectLockState = TBX_PORT_FUTEX_UNLOCKED;
+
+/** \brief Flag that simulates the global interrupt enabled/disabled state of the calling
+ *         thread. It is TBX_TRUE while the thread holds the critical section lock.
+ */
+static _Thread_local uint8_t critSectLockOwned = TBX_FALSE;
+
+/** \brief Mutexes that provide exclusive access to each cache slot. */
+static pthread_mutex_t cacheSlotMutex[TBX_PORT_CACHE_NUM_SLOTS];
+
+/** \brief Once-control for initializing the cache slot mutexes. */
+static pthread_once_t  cacheSlotInitOnce = PTHREAD_ONCE_INIT;
+
+/** \brief Counter for assigning the cache slots to threads in a round-robin manner. */
+static atomic_uint     cacheSlotNext = ATOMIC_VAR_INIT(0U);
+
+/** \brief Cache slot that is assigned to the calling thread. The value of
+ *         TBX_PORT_CACHE_NUM_SLOTS means that no cache slot was assigned yet.
  */
-static atomic_bool     interruptsDisabledFlag = ATOMIC_VAR_INIT(false);
+static _Thread_local uint8_t cacheSlotIdx = TBX_PORT_CACHE_NUM_SLOTS;
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/** \brief Thread local variable. Its address uniquely identifies the calling thread. */
+static _Thread_local uint8_t lockThreadMarker;
+#endif
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+/** \brief Flags with the CRC related features that the CPU supports. */
+static uint8_t         crcFeatures;
+
+/** \brief Once-control for detecting the CRC related features of the CPU. */
+static pthread_once_t  crcFeaturesInitOnce = PTHREAD_ONCE_INIT;
+
+/** \brief Folding constants of the CRC algorithm that the calling thread used last. */
+static _Thread_local tTbxPortCrcFoldConsts crcFoldConsts;
+#endif
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+/** \brief TBX_TRUE if the CPU supports the AES instructions, TBX_FALSE otherwise. */
+static uint8_t         aesSupported;
+
+/** \brief Once-control for detecting if the CPU supports the AES instructions. */
+static pthread_once_t  aesFeaturesInitOnce = PTHREAD_ONCE_INIT;
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TbxPortCacheSlotInit(void);
+
+static void TbxPortFutexLockEnter(uint32_t * state);
+
+static void TbxPortFutexLockExit (uint32_t * state);
+
+static void TbxPortCpuRelax      (void);
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+static size_t   TbxPortCrcProcess     (uint64_t      * crc,
+                                       uint64_t        polynom,
+                                       uint8_t         numBits,
+                                       uint8_t         reflect,
+                                       uint8_t const * data,
+                                       size_t          len);
+
+static void     TbxPortCrcFeaturesInit(void);
+
+static uint64_t TbxPortCrcReflect     (uint64_t        value,
+                                       uint8_t         numBits);
+
+static uint64_t TbxPortCrcPowerMod    (uint32_t        exponent,
+                                       uint64_t        polynom,
+                                       uint8_t         numBits);
+
+static tTbxPortCrcFoldConsts const * TbxPortCrcFoldConstsGet(uint64_t polynom,
+                                                             uint8_t  numBits,
+                                                             uint8_t  reflect);
+
+static uint64_t TbxPortCrcFoldReduce  (tTbxPortCrcFoldConsts const * consts,
+                                       uint64_t const              * value);
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("pclmul,ssse3")))
+static uint64_t TbxPortCrcFoldClmul   (uint64_t                      crc,
+                                       tTbxPortCrcFoldConsts const * consts,
+                                       uint8_t               const * data,
+                                       size_t                        numBlocks);
+
+__attribute__((target("sse4.2")))
+static uint32_t TbxPortCrc32cSse42    (uint32_t        crc,
+                                       uint8_t const * data,
+                                       size_t          len);
+#elif defined(__aarch64__)
+__attribute__((target("+crc")))
+static uint32_t TbxPortCrc32Armv8     (uint32_t        crc,
+                                       uint8_t         castagnoli,
+                                       uint8_t const * data,
+                                       size_t          len);
+#endif
+#endif
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+static void     TbxPortAesFeaturesInit (void);
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+static void     TbxPortAesExpandKey    (tTbxPortAesCtx       * ctx,
+                                        uint8_t        const * key);
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("aes,sse2")))
+static uint32_t TbxPortAesSubWord      (uint32_t               word);
+
+__attribute__((target("aes,sse2")))
+static void     TbxPortAesInvMixColumns(uint8_t              * dst,
+                                        uint8_t        const * src);
 
-/** \brief Critial section mutex. */
-static pthread_mutex_t critSectMutex = PTHREAD_MUTEX_INITIALIZER;
+__attribute__((target("aes,sse2")))
+static void     TbxPortAesNiProcess    (uint8_t        const * roundKeys,
+                                        uint8_t                encrypt,
+                                        uint8_t              * data,
+                                        size_t                 numBlocks);
+#elif defined(__aarch64__)
+__attribute__((target("+crypto")))
+static uint32_t TbxPortAesSubWord      (uint32_t               word);
+
+__attribute__((target("+crypto")))
+static void     TbxPortAesInvMixColumns(uint8_t              * dst,
+                                        uint8_t        const * src);
+
+__attribute__((target("+crypto")))
+static void     TbxPortAesArmv8Process (uint8_t        const * roundKeys,
+                                        uint8_t                encrypt,
+                                        uint8_t              * data,
+                                        size_t                 numBlocks);
+#endif
+#endif
 
 
 /************************************************************************************//**
@@ -76,14 +308,15 @@ tTbxPortCpuSR TbxPortInterruptsDisable(void)
 {
   tTbxPortCpuSR result = 0U;
 
-  /* Disable the simulated global interrupts by setting its flag to true, and store its
-   * previous flag value. Were the simulated global interrupts actually enabled, before
-   * we just disabled them? 
+  /* Were the simulated global interrupts enabled for the calling thread? Each thread has
+   * its own flag, such that other threads always wait for the lock, while only a nested
+   * call by the owning thread skips it.
    */
-  if (atomic_flag_test_and_set(&interruptsDisabledFlag) == false)
+  if (critSectLockOwned == TBX_FALSE)
   {
     /* Simulate disabling the global interrupts by locking out other threads. */
-    (void)pthread_mutex_lock(&critSectMutex);
+    TbxPortFutexLockEnter(&critSectLockState);
+    critSectLockOwned = TBX_TRUE;
     /* Update the result accordingly. */
     result = TBX_PORT_CPU_SR_IRQ_EN;
   }
@@ -107,12 +340,1297 @@ void TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr)
   /* Should the simulated global interrupts be restored to the enabled state? */
   if (prevCpuSr == TBX_PORT_CPU_SR_IRQ_EN)
   {
-    /* Simulate enabling the global interrupts by no longer locking out other threads. */
-    (void)pthread_mutex_unlock(&critSectMutex);
     /* Enable the simulated global interrupts by setting its flag to false. */
-    atomic_flag_clear(&interruptsDisabledFlag);
+    critSectLockOwned = TBX_FALSE;
+    /* Simulate enabling the global interrupts by no longer locking out other threads. */
+    TbxPortFutexLockExit(&critSectLockState);
   }
 } /*** end of TbxPortInterruptsRestore ***/
 
 
+/************************************************************************************//**
+** \brief     Atomically compares the value at the target address with the expected
+**            value and, only if they are equal, writes the desired value to the target
+**            address. Implemented with the atomic
+**            compare and exchange operation of the compiler, which follows the C11
+**            memory model.
+** \param     target Pointer to the 32-bit value to operate on.
+** \param     expected The value that the target is expected to have.
+** \param     desired The value to write to the target, if it has the expected value.
+** \return    The value that the target had, right before the operation. The desired
+**            value was written if this equals the expected value.
+**
+****************************************************************************************/
+uint32_t TbxPortAtomicCompareExchange32(uint32_t volatile * target,
+                                        uint32_t            expected,
+                                        uint32_t            desired)
+{
+  /* Perform the atomic compare and exchange operation. Note that this function stores
+   * the value that the target had in the expected parameter, if it was not the expected
+   * value.
+   */
+  (void)__atomic_compare_exchange_n(target, &expected, desired, false, __ATOMIC_SEQ_CST,
+                                    __ATOMIC_SEQ_CST);
+
+  /* Give the result back to the caller. */
+  return expected;
+} /*** end of TbxPortAtomicCompareExchange32 ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the pointer at the target address with the expected
+**            pointer and, only if they are equal, writes the desired pointer to the
+**            target address. Implemented with the atomic compare and exchange operation
+**            of the compiler, which follows the C11 memory model.
+** \param     target Pointer to the pointer to operate on.
+** \param     expected The pointer that the target is expected to have.
+** \param     desired The pointer to write to the target, if it has the expected pointer.
+** \return    The pointer that the target had, right before the operation. The desired
+**            pointer was written if this equals the expected pointer.
+**
+****************************************************************************************/
+void * TbxPortAtomicCompareExchangePtr(void * volatile * target,
+                                       void           * expected,
+                                       void           * desired)
+{
+  /* Perform the atomic compare and exchange operation. Note that this function stores
+   * the value that the target had in the expected parameter, if it was not the expected
+   * value.
+   */
+  (void)__atomic_compare_exchange_n(target, &expected, desired, false, __ATOMIC_SEQ_CST,
+                                    __ATOMIC_SEQ_CST);
+
+  /* Give the result back to the caller. */
+  return expected;
+} /*** end of TbxPortAtomicCompareExchangePtr ***/
+
+
+/************************************************************************************//**
+** \brief     Makes sure that all memory accesses before this function call are completed
+**            before any memory access after this function call is performed. This
+**            ordering is needed by lock-free data structures in which one context
+**            publishes data to another context, for example a ring buffer shared by an
+**            interrupt service routine and the main loop. On Linux, this is done with a
+**            sequentially consistent memory fence.
+**
+****************************************************************************************/
+void TbxPortMemoryBarrier(void)
+{
+  /* Insert a full memory fence. */
+  atomic_thread_fence(memory_order_seq_cst);
+} /*** end of TbxPortMemoryBarrier ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains exclusive access to the cache slot of the calling thread. A thread is
+**            assigned to a cache slot the first time it calls this function. Threads
+**            only need to wait for each other, if they are assigned to the same cache
+**            slot. Which only happens if there are more threads than cache slots.
+** \return    Index of the cache slot of the calling thread. Its value is always less than
+**            TBX_PORT_CACHE_NUM_SLOTS.
+**
+****************************************************************************************/
+uint8_t TbxPortCacheSlotEnter(void)
+{
+  /* Make sure the cache slot mutexes are initialized. */
+  (void)pthread_once(&cacheSlotInitOnce, TbxPortCacheSlotInit);
+  /* Assign a cache slot to the calling thread, if not yet done so. */
+  if (cacheSlotIdx >= TBX_PORT_CACHE_NUM_SLOTS)
+  {
+    cacheSlotIdx = (uint8_t)(atomic_fetch_add(&cacheSlotNext, 1U) % 
+                             TBX_PORT_CACHE_NUM_SLOTS);
+  }
+  /* Lock out other threads that are assigned to the same cache slot. */
+  (void)pthread_mutex_lock(&cacheSlotMutex[cacheSlotIdx]);
+  /* Give the result back to the caller. */
+  return cacheSlotIdx;
+} /*** end of TbxPortCacheSlotEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases exclusive access to the cache slot that was previously obtained
+**            with function TbxPortCacheSlotEnter().
+** \param     slotIdx Index of the cache slot, as returned by TbxPortCacheSlotEnter().
+**
+****************************************************************************************/
+void TbxPortCacheSlotExit(uint8_t slotIdx)
+{
+  /* Only continue with a valid cache slot index. */
+  if (slotIdx < TBX_PORT_CACHE_NUM_SLOTS)
+  {
+    /* No longer lock out other threads that are assigned to the same cache slot. */
+    (void)pthread_mutex_unlock(&cacheSlotMutex[slotIdx]);
+  }
+} /*** end of TbxPortCacheSlotExit ***/
+
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Initializes a lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockInit(tTbxPortLock * lock)
+{
+  /* Unlock the futex and set the lock to not being owned by any thread. */
+  lock->state = TBX_PORT_FUTEX_UNLOCKED;
+  lock->ownerThread = 0U;
+  lock->nestingCounter = 0U;
+} /*** end of TbxPortLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the resource that is protected by the
+**            lock object. Only threads that access the same lock object wait for each
+**            other. Together with TBX_CONF_LOCK_ENABLE, this gives each MicroTBX resource
+**            its own lock, such that threads on different CPU cores rarely wait for each
+**            other.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockEnter(tTbxPortLock * lock)
+{
+  uintptr_t threadId = (uintptr_t)&lockThreadMarker;
+
+  /* Does the calling thread already own the lock? Note that it is safe to check this
+   * without locking the mutex. Only the calling thread itself sets the owner to its own
+   * identifier, and it clears it again before unlocking the mutex.
+   */
+  if (__atomic_load_n(&lock->ownerThread, __ATOMIC_RELAXED) == threadId)
+  {
+    /* Nested entry, so just increment the nesting counter. */
+    lock->nestingCounter++;
+  }
+  else
+  {
+    /* Lock out other threads and take ownership of the lock. */
+    TbxPortFutexLockEnter(&lock->state);
+    __atomic_store_n(&lock->ownerThread, threadId, __ATOMIC_RELAXED);
+    lock->nestingCounter = 1U;
+  }
+} /*** end of TbxPortLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the resource that is protected by the
+**            lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockExit(tTbxPortLock * lock)
+{
+  /* Only continue if the calling thread actually owns the lock. */
+  if (__atomic_load_n(&lock->ownerThread, __ATOMIC_RELAXED) == 
+      (uintptr_t)&lockThreadMarker)
+  {
+    /* Decrement the nesting counter. */
+    lock->nestingCounter--;
+    /* Give up ownership and no longer lock out other threads upon the final exit. */
+    if (lock->nestingCounter == 0U)
+    {
+      __atomic_store_n(&lock->ownerThread, 0U, __ATOMIC_RELAXED);
+      TbxPortFutexLockExit(&lock->state);
+    }
+  }
+} /*** end of TbxPortLockExit ***/
+#endif /* (TBX_CONF_LOCK_ENABLE > 0U) */
+
+
+/************************************************************************************//**
+** \brief     Obtains a futex lock. The lock is typically held for a short time, so the
+**            calling thread first spins for a while, until the lock is released. Only
+**            if that takes too long, it marks the lock as contended and goes to sleep in
+**            the kernel, until the owning thread wakes it up. This avoids the system
+**            calls of a mutex in the common case.
+** \param     state Pointer to the state of the futex lock.
+**
+****************************************************************************************/
+static void TbxPortFutexLockEnter(uint32_t * state)
+{
+  uint32_t expected;
+  uint32_t spinCount;
+  uint8_t  locked = TBX_FALSE;
+
+  /* Try to obtain the lock by spinning. Only attempt the atomic operation when the lock
+   * appears to be unlocked, such that the cache line is not written to while waiting.
+   */
+  for (spinCount = 0U; (spinCount <= TBX_PORT_LOCK_SPIN_COUNT) && (locked == TBX_FALSE);
+       spinCount++)
+  {
+    expected = TBX_PORT_FUTEX_UNLOCKED;
+    if ( (__atomic_load_n(state, __ATOMIC_RELAXED) == TBX_PORT_FUTEX_UNLOCKED) &&
+         (__atomic_compare_exchange_n(state, &expected, TBX_PORT_FUTEX_LOCKED, false,
+                                      __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) )
+    {
+      locked = TBX_TRUE;
+    }
+    else
+    {
+      TbxPortCpuRelax();
+    }
+  }
+  /* Go to sleep until the lock is released, if spinning did not obtain it. The lock is
+   * then marked as contended, such that the thread that releases it, wakes up a
+   * sleeping thread. Also when the lock is obtained this way, because there might be
+   * more sleeping threads.
+   */
+  if (locked == TBX_FALSE)
+  {
+    while (__atomic_exchange_n(state, TBX_PORT_FUTEX_CONTENDED, __ATOMIC_ACQUIRE) !=
+           TBX_PORT_FUTEX_UNLOCKED)
+    {
+      (void)syscall(SYS_futex, state, FUTEX_WAIT_PRIVATE, TBX_PORT_FUTEX_CONTENDED,
+                    NULL, NULL, 0);
+    }
+  }
+} /*** end of TbxPortFutexLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a futex lock that was obtained with TbxPortFutexLockEnter(). A
+**            system call is only made if threads might be sleeping on the lock.
+** \param     state Pointer to the state of the futex lock.
+**
+****************************************************************************************/
+static void TbxPortFutexLockExit(uint32_t * state)
+{
+  /* Unlock and wake up one sleeping thread, if the lock was contended. */
+  if (__atomic_exchange_n(state, TBX_PORT_FUTEX_UNLOCKED, __ATOMIC_RELEASE) ==
+      TBX_PORT_FUTEX_CONTENDED)
+  {
+    (void)syscall(SYS_futex, state, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+  }
+} /*** end of TbxPortFutexLockExit ***/
+
+
+/************************************************************************************//**
+** \brief     Informs the CPU that the calling thread is spinning, while it waits for a
+**            lock. This lowers the power consumption and frees resources for the other
+**            hardware thread of the same CPU core.
+**
+****************************************************************************************/
+static void TbxPortCpuRelax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ volatile ("yield" ::: "memory");
+#else
+  /* Only prevent the compiler from optimizing the spin loop away. */
+  __asm__ volatile ("" ::: "memory");
+#endif
+} /*** end of TbxPortCpuRelax ***/
+
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+/************************************************************************************//**
+** \brief     Processes the leading bytes of the data with a 16-bit CRC, using the CRC
+**            related instructions of the CPU. The caller processes the remaining bytes
+**            in software.
+** \param     crc Pointer to the current 16-bit CRC remainder, which is updated. It holds
+**            the remainder of a calculation that starts with the highest bit, also if
+**            the input is reflected.
+** \param     polynom Polynomial of the CRC algorithm.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \return    Number of leading bytes that were processed. Zero if the CPU offers no
+**            acceleration for this CRC algorithm or amount of data.
+**
+****************************************************************************************/
+size_t TbxPortCrc16Process(uint16_t      * crc,
+                           uint16_t        polynom,
+                           uint8_t         reflect,
+                           uint8_t const * data,
+                           size_t          len)
+{
+  size_t   result = 0U;
+  uint64_t remainder;
+
+  /* Only continue with valid parameters. */
+  if ( (crc != NULL) && (data != NULL) )
+  {
+    remainder = *crc;
+    result = TbxPortCrcProcess(&remainder, polynom, 16U, reflect, data, len);
+    *crc = (uint16_t)remainder;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCrc16Process ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the leading bytes of the data with a 32-bit CRC, using the CRC
+**            related instructions of the CPU. The caller processes the remaining bytes
+**            in software.
+** \param     crc Pointer to the current 32-bit CRC remainder, which is updated. It holds
+**            the remainder of a calculation that starts with the highest bit, also if
+**            the input is reflected.
+** \param     polynom Polynomial of the CRC algorithm.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \return    Number of leading bytes that were processed. Zero if the CPU offers no
+**            acceleration for this CRC algorithm or amount of data.
+**
+****************************************************************************************/
+size_t TbxPortCrc32Process(uint32_t      * crc,
+                           uint32_t        polynom,
+                           uint8_t         reflect,
+                           uint8_t const * data,
+                           size_t          len)
+{
+  size_t   result = 0U;
+  uint64_t remainder;
+
+  /* Only continue with valid parameters. */
+  if ( (crc != NULL) && (data != NULL) )
+  {
+    remainder = *crc;
+    result = TbxPortCrcProcess(&remainder, polynom, 32U, reflect, data, len);
+    *crc = (uint32_t)remainder;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCrc32Process ***/
+#endif /* (TBX_PORT_CRC_ACCEL > 0U) */
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+/************************************************************************************//**
+** \brief     Expands the 256-bit key into the round keys of the port specific AES256
+**            context, if the CPU supports the AES instructions.
+** \param     ctx Pointer to the port specific AES256 context.
+** \param     key The 256-bit key as a array of 32 bytes.
+** \return    TBX_TRUE if the CPU supports the AES instructions, such that the context
+**            can be used for encrypting and decrypting data. TBX_FALSE otherwise, in
+**            which case the caller should fall back to the software implementation.
+**
+****************************************************************************************/
+uint8_t TbxPortAes256Init(tTbxPortAesCtx       * ctx,
+                          uint8_t        const * key)
+{
+  uint8_t result = TBX_FALSE;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(key != NULL);
+
+  /* Detect the features of the CPU, if not yet done. */
+  (void)pthread_once(&aesFeaturesInitOnce, TbxPortAesFeaturesInit);
+
+  /* Only continue if the parameters are valid and the CPU has the AES instructions. */
+  if ( (ctx != NULL) && (key != NULL) && (aesSupported != TBX_FALSE) )
+  {
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+    TbxPortAesExpandKey(ctx, key);
+    result = TBX_TRUE;
+#endif
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAes256Init ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts a number of 16-byte blocks, each on its own. Multiple blocks are
+**            processed at the same time, to make full use of the pipeline of the CPU.
+** \param     ctx Pointer to the port specific AES256 context.
+** \param     data Pointer to the byte array with the blocks to encrypt. The encrypted
+**            blocks are stored in the same array.
+** \param     numBlocks Number of 16-byte blocks to encrypt.
+**
+****************************************************************************************/
+void TbxPortAes256EncryptBlocks(tTbxPortAesCtx const * ctx,
+                                uint8_t              * data,
+                                size_t                 numBlocks)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (data != NULL) )
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    TbxPortAesNiProcess(ctx->encKeys, TBX_TRUE, data, numBlocks);
+#elif defined(__aarch64__)
+    TbxPortAesArmv8Process(ctx->encKeys, TBX_TRUE, data, numBlocks);
+#else
+    TBX_UNUSED_ARG(numBlocks);
+#endif
+  }
+} /*** end of TbxPortAes256EncryptBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Decrypts a number of 16-byte blocks, each on its own. Multiple blocks are
+**            processed at the same time, to make full use of the pipeline of the CPU.
+** \param     ctx Pointer to the port specific AES256 context.
+** \param     data Pointer to the byte array with the blocks to decrypt. The decrypted
+**            blocks are stored in the same array.
+** \param     numBlocks Number of 16-byte blocks to decrypt.
+**
+****************************************************************************************/
+void TbxPortAes256DecryptBlocks(tTbxPortAesCtx const * ctx,
+                                uint8_t              * data,
+                                size_t                 numBlocks)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (data != NULL) )
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    TbxPortAesNiProcess(ctx->decKeys, TBX_FALSE, data, numBlocks);
+#elif defined(__aarch64__)
+    TbxPortAesArmv8Process(ctx->decKeys, TBX_FALSE, data, numBlocks);
+#else
+    TBX_UNUSED_ARG(numBlocks);
+#endif
+  }
+} /*** end of TbxPortAes256DecryptBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Clears the round keys from the port specific AES256 context.
+** \param     ctx Pointer to the port specific AES256 context.
+**
+****************************************************************************************/
+void TbxPortAes256Done(tTbxPortAesCtx * ctx)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (ctx != NULL)
+  {
+    (void)memset(ctx, 0, sizeof(tTbxPortAesCtx));
+  }
+} /*** end of TbxPortAes256Done ***/
+#endif /* (TBX_PORT_AES_ACCEL > 0U) */
+
+#if (TBX_PORT_ENTROPY > 0U)
+/************************************************************************************//**
+** \brief     Obtains random bytes from the random number generator of the kernel. The
+**            kernel mixes in the output of the hardware random number generator of the
+**            CPU, if it has one, together with other sources of entropy. This function
+**            does not block. It only returns fewer bytes than requested, if the kernel
+**            did not gather enough entropy yet since the system booted.
+** \param     buf Pointer to the byte array to store the random bytes in.
+** \param     len Number of random bytes to obtain.
+** \return    Number of random bytes that were actually stored in the byte array.
+**
+****************************************************************************************/
+size_t TbxPortEntropyGet(uint8_t * buf,
+                         size_t    len)
+{
+  size_t  result = 0U;
+  ssize_t numBytes;
+
+  /* Verify parameters. */
+  TBX_ASSERT(buf != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (buf != NULL)
+  {
+    while (result < len)
+    {
+      numBytes = getrandom(&buf[result], len - result, GRND_NONBLOCK);
+      /* Stop upon an error, other than being interrupted by a signal. */
+      if (numBytes < 0)
+      {
+        if (errno != EINTR)
+        {
+          break;
+        }
+      }
+      else
+      {
+        result += (size_t)numBytes;
+      }
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortEntropyGet ***/
+#endif /* (TBX_PORT_ENTROPY > 0U) */
+
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+/************************************************************************************//**
+** \brief     Obtains the value of the free running cycle counter. On Linux it counts
+**            nanoseconds of the monotonic clock. Only the lower 32 bits are returned, so
+**            the counter wraps around after a little more than four seconds. The time
+**            between two readings is the difference of their values.
+** \return    Current value of the cycle counter.
+**
+****************************************************************************************/
+uint32_t TbxPortCycleCounterGet(void)
+{
+  struct timespec now = { 0 };
+
+  /* Read the monotonic clock, which the vDSO does without entering the kernel. */
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  /* Combine the seconds and nanoseconds into nanoseconds. */
+  return ((uint32_t)now.tv_sec * 1000000000UL) + (uint32_t)now.tv_nsec;
+} /*** end of TbxPortCycleCounterGet ***/
+#endif /* (TBX_PORT_CYCLE_COUNTER > 0U) */
+
+
+
+/************************************************************************************//**
+** \brief     Initializes the mutexes of the cache slots. Called once, upon the first
+**            call of TbxPortCacheSlotEnter().
+**
+****************************************************************************************/
+static void TbxPortCacheSlotInit(void)
+{
+  /* Initialize the mutex of each cache slot. */
+  for (uint8_t slotIdx = 0U; slotIdx < TBX_PORT_CACHE_NUM_SLOTS; slotIdx++)
+  {
+    (void)pthread_mutex_init(&cacheSlotMutex[slotIdx], NULL);
+  }
+} /*** end of TbxPortCacheSlotInit ***/
+
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+/************************************************************************************//**
+** \brief     Selects the fastest CRC related instructions that the CPU supports for the
+**            CRC algorithm, and processes the leading bytes of the data with them.
+** \param     crc Pointer to the current CRC remainder, which is updated.
+** \param     polynom Polynomial of the CRC algorithm.
+** \param     numBits Width of the CRC in bits. Either 16 or 32.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \return    Number of leading bytes that were processed.
+**
+****************************************************************************************/
+static size_t TbxPortCrcProcess(uint64_t      * crc,
+                                uint64_t        polynom,
+                                uint8_t         numBits,
+                                uint8_t         reflect,
+                                uint8_t const * data,
+                                size_t          len)
+{
+  size_t result = 0U;
+
+  /* Find out what the CPU supports, if not yet done so. */
+  (void)pthread_once(&crcFeaturesInitOnce, TbxPortCrcFeaturesInit);
+#if defined(__x86_64__) || defined(__i386__)
+  /* The CRC32C has its own instruction, which processes all bytes. */
+  if ( (numBits == 32U) && (reflect != TBX_FALSE) &&
+       (polynom == TBX_PORT_CRC32C_POLYNOM) &&
+       ((crcFeatures & TBX_PORT_CRC_FEAT_CRC32C) != 0U) )
+  {
+    *crc = TbxPortCrc32cSse42((uint32_t)*crc, data, len);
+    result = len;
+  }
+  /* Other CRC algorithms are folded with carry-less multiplications. This only pays off
+   * for larger amounts of data. The remaining bytes of a partial block are left to the
+   * caller.
+   */
+  else if ( (len >= TBX_PORT_CRC_FOLD_MIN_LEN) &&
+            ((crcFeatures & TBX_PORT_CRC_FEAT_CLMUL) != 0U) )
+  {
+    *crc = TbxPortCrcFoldClmul(*crc, TbxPortCrcFoldConstsGet(polynom, numBits, reflect),
+                               data, len / TBX_PORT_CRC_FOLD_BLOCK);
+    result = len - (len % TBX_PORT_CRC_FOLD_BLOCK);
+  }
+  else
+  {
+    /* No acceleration available. */
+  }
+#elif defined(__aarch64__)
+  /* The CPU only has instructions for the reflected CRC32 and CRC32C. */
+  if ( (numBits == 32U) && (reflect != TBX_FALSE) &&
+       ((crcFeatures & TBX_PORT_CRC_FEAT_CRC32) != 0U) &&
+       ((polynom == TBX_PORT_CRC32_POLYNOM) || (polynom == TBX_PORT_CRC32C_POLYNOM)) )
+  {
+    *crc = TbxPortCrc32Armv8((uint32_t)*crc,
+                             (polynom == TBX_PORT_CRC32C_POLYNOM) ? TBX_TRUE : TBX_FALSE,
+                             data, len);
+    result = len;
+  }
+#else
+  /* No acceleration available on this CPU architecture. */
+  TBX_UNUSED_ARG(crc);
+  TBX_UNUSED_ARG(polynom);
+  TBX_UNUSED_ARG(numBits);
+  TBX_UNUSED_ARG(reflect);
+  TBX_UNUSED_ARG(data);
+  TBX_UNUSED_ARG(len);
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCrcProcess ***/
+
+
+/************************************************************************************//**
+** \brief     Detects which CRC related instructions the CPU supports. Called once, upon
+**            the first CRC calculation.
+**
+****************************************************************************************/
+static void TbxPortCrcFeaturesInit(void)
+{
+  uint8_t features = 0U;
+
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if ( (__builtin_cpu_supports("pclmul") != 0) && (__builtin_cpu_supports("ssse3") != 0) )
+  {
+    features |= TBX_PORT_CRC_FEAT_CLMUL;
+  }
+  if (__builtin_cpu_supports("sse4.2") != 0)
+  {
+    features |= TBX_PORT_CRC_FEAT_CRC32C;
+  }
+#elif defined(__aarch64__)
+  /* The CRC32 extension covers both the CRC32 and CRC32C instructions. */
+  if ((getauxval(AT_HWCAP) & HWCAP_CRC32) != 0U)
+  {
+    features |= TBX_PORT_CRC_FEAT_CRC32 | TBX_PORT_CRC_FEAT_CRC32C;
+  }
+#endif
+  crcFeatures = features;
+} /*** end of TbxPortCrcFeaturesInit ***/
+
+
+/************************************************************************************//**
+** \brief     Reverses the order of the lowest bits of a value.
+** \param     value The value to reflect.
+** \param     numBits Number of low bits to reverse.
+** \return    The reflected value.
+**
+****************************************************************************************/
+static uint64_t TbxPortCrcReflect(uint64_t value,
+                                  uint8_t  numBits)
+{
+  uint64_t result = 0U;
+
+  /* Move the bits one at a time, from the low end of the value to the low end of the
+   * result.
+   */
+  for (uint8_t bitIdx = 0U; bitIdx < numBits; bitIdx++)
+  {
+    result = (result << 1U) | ((value >> bitIdx) & 0x01U);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCrcReflect ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates x^exponent modulo the polynomial of a CRC algorithm.
+** \param     exponent The exponent.
+** \param     polynom Polynomial of the CRC algorithm, without its highest bit.
+** \param     numBits Width of the CRC in bits.
+** \return    The remainder, which has less than numBits bits.
+**
+****************************************************************************************/
+static uint64_t TbxPortCrcPowerMod(uint32_t exponent,
+                                   uint64_t polynom,
+                                   uint8_t  numBits)
+{
+  uint64_t result = 1U;
+  uint64_t topBit = 1ULL << (numBits - 1U);
+  uint64_t mask = (topBit << 1U) - 1U;
+
+  /* Multiply by x, one exponent at a time, dividing each time the remainder would get
+   * the same degree as the polynomial.
+   */
+  for (uint32_t idx = 0U; idx < exponent; idx++)
+  {
+    if ((result & topBit) != 0U)
+    {
+      result = ((result << 1U) & mask) ^ polynom;
+    }
+    else
+    {
+      result = result << 1U;
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCrcPowerMod ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the folding constants for a CRC algorithm. They are only calculated
+**            if the calling thread used a different CRC algorithm before.
+**
+**            To fold a 128-bit value that is d bits before the data, its upper and lower
+**            halves are multiplied by x^(d+64) and x^d modulo the polynomial. When the
+**            input is reflected, the 128-bit value and the constants are reflected as
+**            well. The carry-less multiplication of reflected values results in a
+**            reflected product that is shifted one bit further. The constants compensate
+**            for this. They are reflected over one bit more than their width, and use
+**            x^(d+w) and x^(d-64+w) instead, where w is the width of the CRC.
+** \param     polynom Polynomial of the CRC algorithm.
+** \param     numBits Width of the CRC in bits.
+** \param     reflect TBX_TRUE if the CRC algorithm reflects its input, TBX_FALSE
+**            otherwise.
+** \return    Pointer to the folding constants.
+**
+****************************************************************************************/
+static tTbxPortCrcFoldConsts const * TbxPortCrcFoldConstsGet(uint64_t polynom,
+                                                             uint8_t  numBits,
+                                                             uint8_t  reflect)
+{
+  /* Only calculate the constants if the CRC algorithm is not the same as last time. */
+  if ( (crcFoldConsts.numBits != numBits) || (crcFoldConsts.polynom != polynom) ||
+       (crcFoldConsts.reflect != reflect) )
+  {
+    crcFoldConsts.polynom = polynom;
+    crcFoldConsts.numBits = numBits;
+    crcFoldConsts.reflect = reflect;
+    if (reflect == TBX_FALSE)
+    {
+      crcFoldConsts.fold128[0] = TbxPortCrcPowerMod(128U, polynom, numBits);
+      crcFoldConsts.fold128[1] = TbxPortCrcPowerMod(192U, polynom, numBits);
+      crcFoldConsts.fold512[0] = TbxPortCrcPowerMod(512U, polynom, numBits);
+      crcFoldConsts.fold512[1] = TbxPortCrcPowerMod(576U, polynom, numBits);
+    }
+    else
+    {
+      crcFoldConsts.fold128[0] = TbxPortCrcReflect(
+        TbxPortCrcPowerMod(128U + numBits, polynom, numBits), numBits + 1U);
+      crcFoldConsts.fold128[1] = TbxPortCrcReflect(
+        TbxPortCrcPowerMod(64U + numBits, polynom, numBits), numBits + 1U);
+      crcFoldConsts.fold512[0] = TbxPortCrcReflect(
+        TbxPortCrcPowerMod(512U + numBits, polynom, numBits), numBits + 1U);
+      crcFoldConsts.fold512[1] = TbxPortCrcReflect(
+        TbxPortCrcPowerMod(448U + numBits, polynom, numBits), numBits + 1U);
+    }
+  }
+  /* Give the result back to the caller. */
+  return &crcFoldConsts;
+} /*** end of TbxPortCrcFoldConstsGet ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the CRC remainder of the 128-bit value that results from folding
+**            the data, one bit at a time.
+** \param     consts Pointer to the folding constants of the CRC algorithm.
+** \param     value The 128-bit value, with its lower 64 bits in the first element.
+** \return    The CRC remainder.
+**
+****************************************************************************************/
+static uint64_t TbxPortCrcFoldReduce(tTbxPortCrcFoldConsts const * consts,
+                                     uint64_t              const * value)
+{
+  uint64_t result = 0U;
+  uint64_t mask = (1ULL << consts->numBits) - 1U;
+  uint64_t dataBit;
+
+  /* Process the bits, starting with the one that represents the highest power of x.
+   * That is the highest bit, or the lowest bit if the value is reflected.
+   */
+  for (uint8_t bitIdx = 0U; bitIdx < 128U; bitIdx++)
+  {
+    if (consts->reflect == TBX_FALSE)
+    {
+      dataBit = value[1U - (bitIdx / 64U)] >> (63U - (bitIdx % 64U));
+    }
+    else
+    {
+      dataBit = value[bitIdx / 64U] >> (bitIdx % 64U);
+    }
+    /* Attempt to divide the current bit. */
+    if ((((result >> (consts->numBits - 1U)) ^ dataBit) & 0x01U) != 0U)
+    {
+      result = ((result << 1U) & mask) ^ consts->polynom;
+    }
+    else
+    {
+      result = (result << 1U) & mask;
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCrcFoldReduce ***/
+
+
+#if defined(__x86_64__) || defined(__i386__)
+/************************************************************************************//**
+** \brief     Processes blocks of 16 data bytes with a CRC, by folding them with
+**            carry-less multiplications. Four blocks are folded at a time in parallel,
+**            for as long as possible.
+** \param     crc The current CRC remainder.
+** \param     consts Pointer to the folding constants of the CRC algorithm.
+** \param     data Array with bytes to process.
+** \param     numBlocks Number of 16 byte blocks in the data array. At least one.
+** \return    The updated CRC remainder.
+**
+****************************************************************************************/
+__attribute__((target("pclmul,ssse3")))
+static uint64_t TbxPortCrcFoldClmul(uint64_t                      crc,
+                                    tTbxPortCrcFoldConsts const * consts,
+                                    uint8_t               const * data,
+                                    size_t                        numBlocks)
+{
+  const __m128i byteSwap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                        8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i k128 = _mm_loadu_si128((__m128i const *)consts->fold128);
+  const __m128i k512 = _mm_loadu_si128((__m128i const *)consts->fold512);
+  __m128i       lanes[4];
+  __m128i       initial;
+  __m128i       value;
+  uint64_t      valueHalves[2];
+  size_t        blockIdx;
+
+/* Loads the 128-bit value of the data block with the specified index. The first data
+ * bit is the highest bit, which requires swapping the bytes. Unless the input is
+ * reflected. Then the first data bit is the lowest bit.
+ */
+#define TBX_PORT_CRC_LOAD(idx) \
+  ((consts->reflect != TBX_FALSE) ? \
+   _mm_loadu_si128((__m128i const *)&data[(idx) * TBX_PORT_CRC_FOLD_BLOCK]) : \
+   _mm_shuffle_epi8(_mm_loadu_si128((__m128i const *)&data[(idx) * \
+                                                          TBX_PORT_CRC_FOLD_BLOCK]), \
+                    byteSwap))
+/* Folds a 128-bit value with the specified constants. */
+#define TBX_PORT_CRC_FOLD(v, k) \
+  _mm_xor_si128(_mm_clmulepi64_si128((v), (k), 0x00), \
+                _mm_clmulepi64_si128((v), (k), 0x11))
+
+  /* The current CRC remainder is added to the first data bits. */
+  if (consts->reflect == TBX_FALSE)
+  {
+    initial = _mm_set_epi64x((long long)(crc << (64U - consts->numBits)), 0);
+  }
+  else
+  {
+    initial = _mm_set_epi64x(0, (long long)TbxPortCrcReflect(crc, consts->numBits));
+  }
+  /* Fold four blocks at a time in parallel, if there are enough blocks. */
+  if (numBlocks >= 8U)
+  {
+    for (blockIdx = 0U; blockIdx < 4U; blockIdx++)
+    {
+      lanes[blockIdx] = TBX_PORT_CRC_LOAD(blockIdx);
+    }
+    lanes[0] = _mm_xor_si128(lanes[0], initial);
+    for (; (numBlocks - blockIdx) >= 4U; blockIdx += 4U)
+    {
+      for (size_t laneIdx = 0U; laneIdx < 4U; laneIdx++)
+      {
+        lanes[laneIdx] = _mm_xor_si128(TBX_PORT_CRC_FOLD(lanes[laneIdx], k512),
+                                       TBX_PORT_CRC_LOAD(blockIdx + laneIdx));
+      }
+    }
+    /* Combine the four lanes into one. */
+    value = lanes[0];
+    for (size_t laneIdx = 1U; laneIdx < 4U; laneIdx++)
+    {
+      value = _mm_xor_si128(TBX_PORT_CRC_FOLD(value, k128), lanes[laneIdx]);
+    }
+  }
+  else
+  {
+    value = _mm_xor_si128(TBX_PORT_CRC_LOAD(0U), initial);
+    blockIdx = 1U;
+  }
+  /* Fold the remaining blocks one at a time. */
+  for (; blockIdx < numBlocks; blockIdx++)
+  {
+    value = _mm_xor_si128(TBX_PORT_CRC_FOLD(value, k128), TBX_PORT_CRC_LOAD(blockIdx));
+  }
+#undef TBX_PORT_CRC_LOAD
+#undef TBX_PORT_CRC_FOLD
+
+  /* Calculate the CRC remainder of the folded value and give it back to the caller. */
+  _mm_storeu_si128((__m128i *)valueHalves, value);
+  return TbxPortCrcFoldReduce(consts, valueHalves);
+} /*** end of TbxPortCrcFoldClmul ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the data with the CRC32C, using the instruction of SSE4.2. This
+**            instruction keeps its remainder reflected.
+** \param     crc The current CRC remainder, which is not reflected.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \return    The updated CRC remainder, which is not reflected.
+**
+****************************************************************************************/
+__attribute__((target("sse4.2")))
+static uint32_t TbxPortCrc32cSse42(uint32_t        crc,
+                                   uint8_t const * data,
+                                   size_t          len)
+{
+  uint32_t remainder = (uint32_t)TbxPortCrcReflect(crc, 32U);
+  size_t   byteIdx = 0U;
+#if defined(__x86_64__)
+  uint64_t dataWord;
+  uint64_t remainder64 = remainder;
+
+  /* Process eight bytes at a time. */
+  for (; (len - byteIdx) >= sizeof(dataWord); byteIdx += sizeof(dataWord))
+  {
+    (void)memcpy(&dataWord, &data[byteIdx], sizeof(dataWord));
+    remainder64 = _mm_crc32_u64(remainder64, dataWord);
+  }
+  remainder = (uint32_t)remainder64;
+#else
+  uint32_t dataWord;
+
+  /* Process four bytes at a time. */
+  for (; (len - byteIdx) >= sizeof(dataWord); byteIdx += sizeof(dataWord))
+  {
+    (void)memcpy(&dataWord, &data[byteIdx], sizeof(dataWord));
+    remainder = _mm_crc32_u32(remainder, dataWord);
+  }
+#endif
+  /* Process the remaining bytes one at a time. */
+  for (; byteIdx < len; byteIdx++)
+  {
+    remainder = _mm_crc32_u8(remainder, data[byteIdx]);
+  }
+  /* Give the result back to the caller. */
+  return (uint32_t)TbxPortCrcReflect(remainder, 32U);
+} /*** end of TbxPortCrc32cSse42 ***/
+
+
+#elif defined(__aarch64__)
+/************************************************************************************//**
+** \brief     Processes the data with the CRC32 or CRC32C, using the instructions of the
+**            ARMv8 CRC32 extension. These instructions keep their remainder reflected.
+** \param     crc The current CRC remainder, which is not reflected.
+** \param     castagnoli TBX_TRUE for the CRC32C, TBX_FALSE for the CRC32.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \return    The updated CRC remainder, which is not reflected.
+**
+****************************************************************************************/
+__attribute__((target("+crc")))
+static uint32_t TbxPortCrc32Armv8(uint32_t        crc,
+                                  uint8_t         castagnoli,
+                                  uint8_t const * data,
+                                  size_t          len)
+{
+  uint32_t remainder = (uint32_t)TbxPortCrcReflect(crc, 32U);
+  uint64_t dataWord;
+  size_t   byteIdx = 0U;
+
+  /* Process eight bytes at a time. */
+  for (; (len - byteIdx) >= sizeof(dataWord); byteIdx += sizeof(dataWord))
+  {
+    (void)memcpy(&dataWord, &data[byteIdx], sizeof(dataWord));
+    remainder = (castagnoli != TBX_FALSE) ? __crc32cd(remainder, dataWord) :
+                                            __crc32d(remainder, dataWord);
+  }
+  /* Process the remaining bytes one at a time. */
+  for (; byteIdx < len; byteIdx++)
+  {
+    remainder = (castagnoli != TBX_FALSE) ? __crc32cb(remainder, data[byteIdx]) :
+                                            __crc32b(remainder, data[byteIdx]);
+  }
+  /* Give the result back to the caller. */
+  return (uint32_t)TbxPortCrcReflect(remainder, 32U);
+} /*** end of TbxPortCrc32Armv8 ***/
+#endif
+#endif /* (TBX_PORT_CRC_ACCEL > 0U) */
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+/************************************************************************************//**
+** \brief     Detects if the CPU supports the AES instructions. Called once, upon the
+**            first initialization of a port specific AES256 context.
+**
+****************************************************************************************/
+static void TbxPortAesFeaturesInit(void)
+{
+  uint8_t supported = TBX_FALSE;
+
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if ( (__builtin_cpu_supports("aes") != 0) && (__builtin_cpu_supports("sse2") != 0) )
+  {
+    supported = TBX_TRUE;
+  }
+#elif defined(__aarch64__)
+  if ((getauxval(AT_HWCAP) & HWCAP_AES) != 0U)
+  {
+    supported = TBX_TRUE;
+  }
+#endif
+  aesSupported = supported;
+} /*** end of TbxPortAesFeaturesInit ***/
+
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+/************************************************************************************//**
+** \brief     Expands the 256-bit key into the round keys for encryption and the round
+**            keys for decryption with the equivalent inverse cipher. The 32-bit words
+**            of the key schedule are stored in little endian format, which matches the
+**            byte order of the round keys that the CPUs expect.
+** \param     ctx Pointer to the port specific AES256 context.
+** \param     key The 256-bit key as a array of 32 bytes.
+**
+****************************************************************************************/
+static void TbxPortAesExpandKey(tTbxPortAesCtx       * ctx,
+                                uint8_t        const * key)
+{
+  uint32_t words[TBX_PORT_AES_NUM_ROUNDS * TBX_PORT_AES_ROUND_KEY_WORDS];
+  uint32_t temp;
+  uint8_t  rcon = 1U;
+  uint8_t  idx;
+
+  /* The first two round keys are the key itself. */
+  (void)memcpy(words, key, 32U);
+  /* Calculate the words of the other round keys. */
+  for (idx = 8U; idx < (TBX_PORT_AES_NUM_ROUNDS * TBX_PORT_AES_ROUND_KEY_WORDS); idx++)
+  {
+    temp = words[idx - 1U];
+    if ((idx % 8U) == 0U)
+    {
+      /* Rotate the bytes, substitute them and add the round constant. */
+      temp = TbxPortAesSubWord((temp >> 8U) | (temp << 24U)) ^ rcon;
+      rcon = (uint8_t)((rcon << 1U) ^ (((rcon & 0x80U) != 0U) ? 0x1BU : 0x00U));
+    }
+    else if ((idx % 8U) == 4U)
+    {
+      temp = TbxPortAesSubWord(temp);
+    }
+    else
+    {
+      /* Nothing to do for the other words. */
+    }
+    words[idx] = words[idx - 8U] ^ temp;
+  }
+  (void)memcpy(ctx->encKeys, words, sizeof(ctx->encKeys));
+
+  /* The round keys for decryption are the same ones in reverse order, with the inverse
+   * column mixing applied to all but the first and the last one.
+   */
+  for (idx = 0U; idx < TBX_PORT_AES_NUM_ROUNDS; idx++)
+  {
+    uint8_t const * encKey = &ctx->encKeys[(TBX_PORT_AES_NUM_ROUNDS - 1U - idx) * 16U];
+    uint8_t       * decKey = &ctx->decKeys[idx * 16U];
+
+    if ((idx == 0U) || (idx == (TBX_PORT_AES_NUM_ROUNDS - 1U)))
+    {
+      (void)memcpy(decKey, encKey, 16U);
+    }
+    else
+    {
+      TbxPortAesInvMixColumns(decKey, encKey);
+    }
+  }
+  /* Do not leave the key schedule behind on the stack. */
+  (void)memset(words, 0, sizeof(words));
+} /*** end of TbxPortAesExpandKey ***/
+#endif
+
+
+#if defined(__x86_64__) || defined(__i386__)
+/************************************************************************************//**
+** \brief     Substitutes the bytes of a 32-bit word with the AES S-box. This uses the
+**            last round instruction on a block with the same word in all four columns,
+**            such that the row shifting has no effect.
+** \param     word The word.
+** \return    The word with substituted bytes.
+**
+****************************************************************************************/
+static uint32_t TbxPortAesSubWord(uint32_t word)
+{
+  __m128i block;
+
+  block = _mm_aesenclast_si128(_mm_set1_epi32((int)word), _mm_setzero_si128());
+  /* Give the result back to the caller. */
+  return (uint32_t)_mm_cvtsi128_si32(block);
+} /*** end of TbxPortAesSubWord ***/
+
+
+/************************************************************************************//**
+** \brief     Applies the inverse column mixing to a round key.
+** \param     dst Pointer to the 16-byte array to store the resulting round key in.
+** \param     src Pointer to the 16-byte array with the round key.
+**
+****************************************************************************************/
+static void TbxPortAesInvMixColumns(uint8_t       * dst,
+                                    uint8_t const * src)
+{
+  __m128i roundKey = _mm_loadu_si128((__m128i const *)src);
+
+  _mm_storeu_si128((__m128i *)dst, _mm_aesimc_si128(roundKey));
+} /*** end of TbxPortAesInvMixColumns ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts or decrypts a number of 16-byte blocks with the AES-NI
+**            instructions. Up to TBX_PORT_AES_PIPELINE blocks are processed at the same
+**            time. Each AES instruction takes several cycles to complete, but the CPU
+**            can start a new one each cycle, as long as it does not depend on the
+**            previous one.
+** \param     roundKeys Pointer to the 15 round keys for encryption or decryption.
+** \param     encrypt TBX_TRUE to encrypt, TBX_FALSE to decrypt.
+** \param     data Pointer to the byte array with the blocks. The results are stored in
+**            the same array.
+** \param     numBlocks Number of 16-byte blocks to process.
+**
+****************************************************************************************/
+static void TbxPortAesNiProcess(uint8_t const * roundKeys,
+                                uint8_t         encrypt,
+                                uint8_t       * data,
+                                size_t          numBlocks)
+{
+  __m128i   keys[TBX_PORT_AES_NUM_ROUNDS];
+  __m128i   blocks[TBX_PORT_AES_PIPELINE];
+  __m128i * ptr = (__m128i *)data;
+  size_t    remaining = numBlocks;
+  uint8_t   round;
+  uint8_t   idx;
+
+  /* Load the round keys into registers. */
+  for (round = 0U; round < TBX_PORT_AES_NUM_ROUNDS; round++)
+  {
+    keys[round] = _mm_loadu_si128((__m128i const *)&roundKeys[round * 16U]);
+  }
+  /* Process the full batches of blocks. The loops over the blocks have a fixed number
+   * of iterations, such that the compiler keeps all blocks in registers.
+   */
+  while (remaining >= TBX_PORT_AES_PIPELINE)
+  {
+    for (idx = 0U; idx < TBX_PORT_AES_PIPELINE; idx++)
+    {
+      blocks[idx] = _mm_xor_si128(_mm_loadu_si128(&ptr[idx]), keys[0]);
+    }
+    for (round = 1U; round < (TBX_PORT_AES_NUM_ROUNDS - 1U); round++)
+    {
+      for (idx = 0U; idx < TBX_PORT_AES_PIPELINE; idx++)
+      {
+        blocks[idx] = (encrypt != TBX_FALSE) ? _mm_aesenc_si128(blocks[idx], keys[round])
+                                             : _mm_aesdec_si128(blocks[idx], keys[round]);
+      }
+    }
+    for (idx = 0U; idx < TBX_PORT_AES_PIPELINE; idx++)
+    {
+      blocks[idx] = (encrypt != TBX_FALSE) ?
+                    _mm_aesenclast_si128(blocks[idx], keys[TBX_PORT_AES_NUM_ROUNDS - 1U]) :
+                    _mm_aesdeclast_si128(blocks[idx], keys[TBX_PORT_AES_NUM_ROUNDS - 1U]);
+      _mm_storeu_si128(&ptr[idx], blocks[idx]);
+    }
+    ptr = &ptr[TBX_PORT_AES_PIPELINE];
+    remaining -= TBX_PORT_AES_PIPELINE;
+  }
+  /* Process the remaining blocks one at a time. */
+  for (; remaining > 0U; remaining--)
+  {
+    blocks[0] = _mm_xor_si128(_mm_loadu_si128(ptr), keys[0]);
+    for (round = 1U; round < (TBX_PORT_AES_NUM_ROUNDS - 1U); round++)
+    {
+      blocks[0] = (encrypt != TBX_FALSE) ? _mm_aesenc_si128(blocks[0], keys[round])
+                                         : _mm_aesdec_si128(blocks[0], keys[round]);
+    }
+    blocks[0] = (encrypt != TBX_FALSE) ?
+                _mm_aesenclast_si128(blocks[0], keys[TBX_PORT_AES_NUM_ROUNDS - 1U]) :
+                _mm_aesdeclast_si128(blocks[0], keys[TBX_PORT_AES_NUM_ROUNDS - 1U]);
+    _mm_storeu_si128(ptr, blocks[0]);
+    ptr = &ptr[1];
+  }
+} /*** end of TbxPortAesNiProcess ***/
+
+
+#elif defined(__aarch64__)
+/************************************************************************************//**
+** \brief     Substitutes the bytes of a 32-bit word with the AES S-box. This uses the
+**            AESE instruction with an all zero round key on a block with the same word
+**            in all four columns, such that the row shifting has no effect.
+** \param     word The word.
+** \return    The word with substituted bytes.
+**
+****************************************************************************************/
+static uint32_t TbxPortAesSubWord(uint32_t word)
+{
+  uint8x16_t block;
+
+  block = vaeseq_u8(vreinterpretq_u8_u32(vdupq_n_u32(word)), vdupq_n_u8(0U));
+  /* Give the result back to the caller. */
+  return vgetq_lane_u32(vreinterpretq_u32_u8(block), 0);
+} /*** end of TbxPortAesSubWord ***/
+
+
+/************************************************************************************//**
+** \brief     Applies the inverse column mixing to a round key.
+** \param     dst Pointer to the 16-byte array to store the resulting round key in.
+** \param     src Pointer to the 16-byte array with the round key.
+**
+****************************************************************************************/
+static void TbxPortAesInvMixColumns(uint8_t       * dst,
+                                    uint8_t const * src)
+{
+  vst1q_u8(dst, vaesimcq_u8(vld1q_u8(src)));
+} /*** end of TbxPortAesInvMixColumns ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts or decrypts a number of 16-byte blocks with the ARMv8 Cryptography
+**            Extensions. Up to TBX_PORT_AES_PIPELINE blocks are processed at the same
+**            time, such that the CPU can overlap the execution of the AES instructions.
+**            Note that AESE and AESD add the round key before the substitution, so the
+**            last round key is added separately.
+** \param     roundKeys Pointer to the 15 round keys for encryption or decryption.
+** \param     encrypt TBX_TRUE to encrypt, TBX_FALSE to decrypt.
+** \param     data Pointer to the byte array with the blocks. The results are stored in
+**            the same array.
+** \param     numBlocks Number of 16-byte blocks to process.
+**
+****************************************************************************************/
+static void TbxPortAesArmv8Process(uint8_t const * roundKeys,
+                                   uint8_t         encrypt,
+                                   uint8_t       * data,
+                                   size_t          numBlocks)
+{
+  uint8x16_t keys[TBX_PORT_AES_NUM_ROUNDS];
+  uint8x16_t blocks[TBX_PORT_AES_PIPELINE];
+  uint8_t  * ptr = data;
+  size_t     remaining = numBlocks;
+  size_t     batch;
+  uint8_t    round;
+  uint8_t    idx;
+
+  /* Load the round keys into registers. */
+  for (round = 0U; round < TBX_PORT_AES_NUM_ROUNDS; round++)
+  {
+    keys[round] = vld1q_u8(&roundKeys[round * 16U]);
+  }
+  /* Process the blocks in batches. */
+  while (remaining > 0U)
+  {
+    batch = (remaining < TBX_PORT_AES_PIPELINE) ? remaining : TBX_PORT_AES_PIPELINE;
+    for (idx = 0U; idx < batch; idx++)
+    {
+      blocks[idx] = vld1q_u8(&ptr[idx * 16U]);
+    }
+    for (round = 0U; round < (TBX_PORT_AES_NUM_ROUNDS - 2U); round++)
+    {
+      for (idx = 0U; idx < batch; idx++)
+      {
+        blocks[idx] = (encrypt != TBX_FALSE) ?
+                      vaesmcq_u8(vaeseq_u8(blocks[idx], keys[round])) :
+                      vaesimcq_u8(vaesdq_u8(blocks[idx], keys[round]));
+      }
+    }
+    for (idx = 0U; idx < batch; idx++)
+    {
+      blocks[idx] = (encrypt != TBX_FALSE) ?
+                    vaeseq_u8(blocks[idx], keys[TBX_PORT_AES_NUM_ROUNDS - 2U]) :
+                    vaesdq_u8(blocks[idx], keys[TBX_PORT_AES_NUM_ROUNDS - 2U]);
+      blocks[idx] = veorq_u8(blocks[idx], keys[TBX_PORT_AES_NUM_ROUNDS - 1U]);
+      vst1q_u8(&ptr[idx * 16U], blocks[idx]);
+    }
+    ptr = &ptr[batch * 16U];
+    remaining -= batch;
+  }
+} /*** end of TbxPortAesArmv8Process ***/
+#endif
+#endif /* (TBX_PORT_AES_ACCEL > 0U) */
+
+
+
 /*********************************** end of tbx_port.c *********************************/
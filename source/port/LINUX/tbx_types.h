@@ -39,6 +39,73 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <pthread.h>                             /* Posix thread utilities             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#ifndef TBX_PORT_CACHE_NUM_SLOTS
+/** \brief Number of cache slots that this port supports. Each thread is assigned to one
+ *         of the cache slots in a round-robin manner, the first time it accesses a cache.
+ *         Threads only share a cache slot if there are more threads than cache slots.
+ *         Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_PORT_CACHE_NUM_SLOTS                 (8U)
+#endif
+
+#ifndef TBX_PORT_LOCK_SPIN_COUNT
+/** \brief Number of times that a thread tries to obtain a held lock by spinning, before
+ *         it goes to sleep in the kernel. The critical section and the lock objects are
+ *         typically held for a short time, so spinning for a while avoids the overhead
+ *         of the system calls. Note that it is possible to override this value by adding
+ *         this macro definition to the configuration header file.
+ */
+#define TBX_PORT_LOCK_SPIN_COUNT                 (100U)
+#endif
+
+#ifndef TBX_PORT_CRC_ACCEL
+/** \brief This port offers hardware accelerated CRC calculations. At run-time it checks
+ *         which instructions the CPU supports and only uses those. Note that it is
+ *         possible to disable this by setting this macro to 0 in the configuration
+ *         header file.
+ */
+#define TBX_PORT_CRC_ACCEL                       (1U)
+#endif
+
+#ifndef TBX_PORT_AES_ACCEL
+/** \brief This port offers hardware accelerated AES256 encryption and decryption, if
+ *         the CPU supports the AES instructions. This is checked at run-time. Note that
+ *         it is possible to disable this by setting this macro to 0 in the
+ *         configuration header file.
+ */
+#define TBX_PORT_AES_ACCEL                       (1U)
+#endif
+
+#ifndef TBX_PORT_ENTROPY
+/** \brief This port offers a hardware entropy source, through the random number
+ *         generator of the kernel. Note that it is possible to disable this by setting
+ *         this macro to 0 in the configuration header file.
+ */
+#define TBX_PORT_ENTROPY                         (1U)
+#endif
+
+#ifndef TBX_PORT_CYCLE_COUNTER
+/** \brief This port offers a cycle counter, through the monotonic clock of the kernel.
+ *         It counts nanoseconds. Note that it is possible to disable this by setting
+ *         this macro to 0 in the configuration header file.
+ */
+#define TBX_PORT_CYCLE_COUNTER                   (1U)
+#endif
+
+/** \brief Initializer for a statically allocated port specific lock object. */
+#define TBX_PORT_LOCK_INIT                       { 0U, 0U, 0U }
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -49,6 +116,35 @@ extern "C" {
  */
 typedef uint32_t tTbxPortCpuSR;
 
+/** \brief Layout of a lock object. It is an adaptive lock that first spins and then
+ *         sleeps on a futex, which the owning thread is allowed to lock again. Needed for
+ *         supporting nested calls.
+ */
+typedef struct
+{
+  /** \brief State of the futex that locks out the other threads: 0 when unlocked, 1 when
+   *         locked and 2 when locked with possibly sleeping threads.
+   */
+  uint32_t           state;
+  /** \brief Identifier of the thread that owns the lock, or zero if not owned. */
+  volatile uintptr_t ownerThread;
+  /** \brief Number of times the lock was entered, without being exited yet. */
+  uint32_t           nestingCounter;
+} tTbxPortLock;
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+/** \brief Layout of the port specific AES256 context. It holds the 15 round keys of the
+ *         expanded key, for both encryption and decryption.
+ */
+typedef struct
+{
+  /** \brief Round keys for encryption. */
+  uint8_t encKeys[15U * 16U];
+  /** \brief Round keys for decryption with the equivalent inverse cipher. */
+  uint8_t decKeys[15U * 16U];
+} tTbxPortAesCtx;
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -39,12 +39,33 @@
 ****************************************************************************************/
 #include <hardware/sync.h>                       /* Hardware synchronzation library    */
 #include "microtbx.h"                            /* MicroTBX global header             */
+#if (TBX_PORT_ENTROPY > 0U)
+#include <hardware/structs/rosc.h>               /* Ring oscillator registers          */
+#endif
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+#include <hardware/structs/timer.h>              /* Timer registers                    */
+#endif
+#if (TBX_PORT_CORE_FIFO > 0U)
+#include <hardware/structs/sio.h>                /* Single-cycle IO registers          */
+#endif
 
 /* Only use this port on the Raspberry PI Pico (RP2040) microcontroller, if you actually
  * use multiple cores in your firmware. If you only use one core, the ARM_CORTEXM port is
  * the better choice from a run-time performance perspective.
  */
 
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#if (TBX_PORT_ENTROPY > 0U)
+/** \brief Maximum number of pairs of ring oscillator bits that are sampled for one
+ *         random bit. Makes sure that TbxPortEntropyGet() cannot hang, in case the ring
+ *         oscillator is not running.
+ */
+#define TBX_PORT_ENTROPY_MAX_TRIES     (64U)
+#endif
+
+
 /****************************************************************************************
 * Local data declarations
 ****************************************************************************************/
@@ -54,6 +75,23 @@ static volatile spin_lock_t * spinLock = NULL;
 /** \brief Flags to keep track if a specific core has the spin lock. */
 static volatile uint8_t       coreHasLock[NUM_CORES] = { 0 };
 
+/** \brief Interrupt state of each core, from right before it obtained its cache slot. */
+static uint32_t               coreCacheSlotIrqState[NUM_CORES] = { 0 };
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/** \brief Number of lock entries of each core, summed over all lock objects, that were
+ *         not yet exited.
+ */
+static uint32_t               coreLockNesting[NUM_CORES] = { 0 };
+
+/** \brief Interrupt state of each core, from right before it entered its first lock. It
+ *         is kept per core instead of per lock object. This way the interrupts are only
+ *         restored, once the core exited all its locks, regardless of the order in which
+ *         it exits them.
+ */
+static uint32_t               coreLockIrqState[NUM_CORES] = { 0 };
+#endif
+
 
 /************************************************************************************//**
 ** \brief     Stores the current state of the CPU status register and then disables the
@@ -147,4 +185,367 @@ void TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr)
 } /*** end of TbxPortInterruptsRestore ***/
 
 
+/************************************************************************************//**
+** \brief     Atomically compares the value at the target address with the expected
+**            value and, only if they are equal, writes the desired value to the target
+**            address. The Cortex-M0+ cores of
+**            the RP2040 do not support exclusive accesses. Instead, a hardware spin lock
+**            locks out the other core and the interrupts on the calling core are
+**            disabled, only for the duration of the operation.
+** \param     target Pointer to the 32-bit value to operate on.
+** \param     expected The value that the target is expected to have.
+** \param     desired The value to write to the target, if it has the expected value.
+** \return    The value that the target had, right before the operation. The desired
+**            value was written if this equals the expected value.
+**
+****************************************************************************************/
+uint32_t TbxPortAtomicCompareExchange32(uint32_t volatile * target,
+                                        uint32_t            expected,
+                                        uint32_t            desired)
+{
+  uint32_t      result;
+  spin_lock_t * spinLock;
+  uint32_t      irqState;
+
+  /* Get the handle of the hardware spin lock that guards the atomic operations. */
+  spinLock = spin_lock_instance(PICO_SPINLOCK_ID_STRIPED_FIRST);
+  /* Lock out the other core and disable the interrupts on the calling core. */
+  irqState = spin_lock_blocking(spinLock);
+  /* Read the current value and only write the desired value if it is the expected one. */
+  result = *target;
+  if (result == expected)
+  {
+    *target = desired;
+  }
+  /* Release the spin lock and restore the interrupts on the calling core. */
+  spin_unlock(spinLock, irqState);
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortAtomicCompareExchange32 ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically compares the pointer at the target address with the expected
+**            pointer and, only if they are equal, writes the desired pointer to the
+**            target address. Pointers are 32-bit on the RP2040, so the request is passed
+**            on to TbxPortAtomicCompareExchange32().
+** \param     target Pointer to the pointer to operate on.
+** \param     expected The pointer that the target is expected to have.
+** \param     desired The pointer to write to the target, if it has the expected pointer.
+** \return    The pointer that the target had, right before the operation. The desired
+**            pointer was written if this equals the expected pointer.
+**
+****************************************************************************************/
+void * TbxPortAtomicCompareExchangePtr(void * volatile * target,
+                                       void           * expected,
+                                       void           * desired)
+{
+  uint32_t result;
+
+  /* Pass the request on to the 32-bit compare and exchange operation. */
+  result = TbxPortAtomicCompareExchange32((uint32_t volatile *)(void *)target,
+                                          (uint32_t)(uintptr_t)expected,
+                                          (uint32_t)(uintptr_t)desired);
+
+  /* Give the result back to the caller. */
+  return (void *)(uintptr_t)result;
+} /*** end of TbxPortAtomicCompareExchangePtr ***/
+
+
+/************************************************************************************//**
+** \brief     Makes sure that all memory accesses before this function call are completed
+**            before any memory access after this function call is performed. This
+**            ordering is needed by lock-free data structures in which one context
+**            publishes data to another context, for example a ring buffer shared by an
+**            interrupt service routine and the main loop. On the RP2040, this is done with
+**            the DMB instruction, which also orders memory accesses between the cores.
+**
+****************************************************************************************/
+void TbxPortMemoryBarrier(void)
+{
+  /* Insert a data memory barrier. */
+  __dmb();
+} /*** end of TbxPortMemoryBarrier ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains exclusive access to the cache slot of the calling core. Each core has
+**            its own cache slot, so there is no need to lock out the other core. It is
+**            sufficient to disable the interrupts on the calling core.
+** \return    Index of the cache slot of the calling core. Its value is always less than
+**            TBX_PORT_CACHE_NUM_SLOTS.
+**
+****************************************************************************************/
+uint8_t TbxPortCacheSlotEnter(void)
+{
+  uint8_t  result;
+  uint32_t irqState;
+
+  /* Disable the interrupts on the calling core, while storing their current state. */
+  irqState = save_and_disable_interrupts();
+  /* The cache slot index equals the core number. */
+  result = (uint8_t)get_core_num();
+  /* Store the interrupt state, such that it can be restored when exiting. */
+  coreCacheSlotIrqState[result] = irqState;
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCacheSlotEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases exclusive access to the cache slot that was previously obtained
+**            with function TbxPortCacheSlotEnter().
+** \param     slotIdx Index of the cache slot, as returned by TbxPortCacheSlotEnter().
+**
+****************************************************************************************/
+void TbxPortCacheSlotExit(uint8_t slotIdx)
+{
+  /* Only continue with a valid cache slot index. */
+  if (slotIdx < TBX_PORT_CACHE_NUM_SLOTS)
+  {
+    /* Restore the interrupts on the calling core. */
+    restore_interrupts(coreCacheSlotIrqState[slotIdx]);
+  }
+} /*** end of TbxPortCacheSlotExit ***/
+
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Initializes a lock object. Lock objects are spread over the striped hardware
+**            spin locks of the Pico SDK.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockInit(tTbxPortLock * lock)
+{
+  /* Select the hardware spin lock that guards the owner. */
+  lock->spinLockNum = next_striped_spin_lock_num();
+  /* Set the lock to not being owned by any core. */
+  lock->ownerCore = 0U;
+  lock->nestingCounter = 0U;
+} /*** end of TbxPortLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the resource that is protected by the
+**            lock object. The interrupts on the calling core are disabled, while it owns
+**            the lock. The other core only waits if it accesses the same lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockEnter(tTbxPortLock * lock)
+{
+  uint32_t       coreIdx = get_core_num();
+  uint32_t       coreId = coreIdx + 1U;
+  uint32_t       irqState;
+  uint8_t        lockObtained = TBX_FALSE;
+  spin_lock_t  * spinLock;
+
+  /* Disable the interrupts on the calling core, while storing their current state. */
+  irqState = save_and_disable_interrupts();
+  /* Only store the interrupt state upon the first lock entry of the calling core. */
+  if (coreLockNesting[coreIdx] == 0U)
+  {
+    coreLockIrqState[coreIdx] = irqState;
+  }
+  coreLockNesting[coreIdx]++;
+  /* Does the calling core already own the lock? Note that it is safe to check this
+   * without the spin lock. Only the calling core itself sets the owner to its own
+   * identifier.
+   */
+  if (lock->ownerCore == coreId)
+  {
+    /* Nested entry, so just increment the nesting counter. */
+    lock->nestingCounter++;
+  }
+  else
+  {
+    /* Get the handle of the hardware spin lock that guards the owner. */
+    spinLock = spin_lock_instance(lock->spinLockNum);
+    /* Wait until the other core no longer owns the lock. */
+    while (lockObtained == TBX_FALSE)
+    {
+      spin_lock_unsafe_blocking(spinLock);
+      /* Take ownership of the lock, if it is not owned. */
+      if (lock->ownerCore == 0U)
+      {
+        lock->ownerCore = coreId;
+        lockObtained = TBX_TRUE;
+      }
+      spin_unlock_unsafe(spinLock);
+    }
+    lock->nestingCounter = 1U;
+  }
+} /*** end of TbxPortLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the resource that is protected by the
+**            lock object.
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxPortLockExit(tTbxPortLock * lock)
+{
+  uint32_t       coreIdx = get_core_num();
+  spin_lock_t  * spinLock;
+
+  /* Only continue if the calling core actually owns the lock. */
+  if (lock->ownerCore == (coreIdx + 1U))
+  {
+    /* Decrement the nesting counter. */
+    lock->nestingCounter--;
+    /* Give up ownership upon the final exit. */
+    if (lock->nestingCounter == 0U)
+    {
+      spinLock = spin_lock_instance(lock->spinLockNum);
+      spin_lock_unsafe_blocking(spinLock);
+      lock->ownerCore = 0U;
+      spin_unlock_unsafe(spinLock);
+    }
+    /* Restore the interrupts once the calling core exited all its locks. */
+    coreLockNesting[coreIdx]--;
+    if (coreLockNesting[coreIdx] == 0U)
+    {
+      restore_interrupts(coreLockIrqState[coreIdx]);
+    }
+  }
+} /*** end of TbxPortLockExit ***/
+#endif /* (TBX_CONF_LOCK_ENABLE > 0U) */
+
+#if (TBX_PORT_ENTROPY > 0U)
+/************************************************************************************//**
+** \brief     Obtains random bytes from the random bit of the ring oscillator. Its
+**            successive bits are not evenly distributed, so each random bit is
+**            extracted from pairs of bits with the von Neumann method: a pair of
+**            different bits gives the first bit and a pair of equal bits is discarded.
+**            This takes a few microseconds per byte, so it is best to obtain the bytes
+**            in the background with TbxRandomEntropyCollect().
+** \param     buf Pointer to the byte array to store the random bytes in.
+** \param     len Number of random bytes to obtain.
+** \return    Number of random bytes that were actually stored in the byte array. Fewer
+**            than requested if the ring oscillator does not produce varying bits.
+**
+****************************************************************************************/
+size_t TbxPortEntropyGet(uint8_t * buf,
+                         size_t    len)
+{
+  size_t   result = 0U;
+  uint8_t  byteValue;
+  uint8_t  bitIdx;
+  uint8_t  tries;
+  uint32_t firstBit;
+  uint32_t secondBit;
+  uint8_t  failed = TBX_FALSE;
+
+  /* Verify parameters. */
+  TBX_ASSERT(buf != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (buf != NULL)
+  {
+    while ( (result < len) && (failed == TBX_FALSE) )
+    {
+      byteValue = 0U;
+      for (bitIdx = 0U; (bitIdx < 8U) && (failed == TBX_FALSE); bitIdx++)
+      {
+        /* Sample pairs of bits, until they differ. */
+        failed = TBX_TRUE;
+        for (tries = 0U; tries < TBX_PORT_ENTROPY_MAX_TRIES; tries++)
+        {
+          firstBit = rosc_hw->randombit & 1U;
+          secondBit = rosc_hw->randombit & 1U;
+          if (firstBit != secondBit)
+          {
+            byteValue = (uint8_t)((byteValue << 1U) | firstBit);
+            failed = TBX_FALSE;
+            break;
+          }
+        }
+      }
+      /* Only store the byte if all its bits were obtained. */
+      if (failed == TBX_FALSE)
+      {
+        buf[result] = byteValue;
+        result++;
+      }
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortEntropyGet ***/
+#endif /* (TBX_PORT_ENTROPY > 0U) */
+
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+/************************************************************************************//**
+** \brief     Obtains the value of the free running cycle counter. On the RP2040 these
+**            are the lower 32 bits of the microsecond timer. Reading them does not latch
+**            the upper 32 bits, so both cores can read them at any time. The time
+**            between two readings is the difference of their values.
+** \return    Current value of the cycle counter.
+**
+****************************************************************************************/
+uint32_t TbxPortCycleCounterGet(void)
+{
+  /* Read the raw lower 32 bits of the timer. */
+  return timer_hw->timerawl;
+} /*** end of TbxPortCycleCounterGet ***/
+#endif /* (TBX_PORT_CYCLE_COUNTER > 0U) */
+
+#if (TBX_PORT_CORE_FIFO > 0U)
+/************************************************************************************//**
+** \brief     Writes a value to the inter-core FIFO of the calling core, which makes it
+**            available to the other core. The FIFO write raises the SIO interrupt of
+**            the other core, if enabled, and the SEV instruction wakes it up, in case
+**            it waits for an event.
+** \param     value The value to write.
+** \return    TBX_OK if successful, TBX_ERROR if the FIFO is full.
+**
+****************************************************************************************/
+uint8_t TbxPortCoreFifoPush(uintptr_t value)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Only write the value if the FIFO is not full. */
+  if ((sio_hw->fifo_st & SIO_FIFO_ST_RDY_BITS) != 0U)
+  {
+    sio_hw->fifo_wr = (uint32_t)value;
+    /* Signal the other core. */
+    __sev();
+    result = TBX_OK;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCoreFifoPush ***/
+
+
+/************************************************************************************//**
+** \brief     Reads a value, that the other core wrote, from the inter-core FIFO of the
+**            calling core.
+** \param     value Pointer to where the read value is written to.
+** \return    TBX_OK if successful, TBX_ERROR if the FIFO is empty.
+**
+****************************************************************************************/
+uint8_t TbxPortCoreFifoPop(uintptr_t * value)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(value != NULL);
+
+  /* Only continue if the parameter is valid and the FIFO holds a value. */
+  if ( (value != NULL) && ((sio_hw->fifo_st & SIO_FIFO_ST_VLD_BITS) != 0U) )
+  {
+    *value = (uintptr_t)sio_hw->fifo_rd;
+    result = TBX_OK;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxPortCoreFifoPop ***/
+#endif /* (TBX_PORT_CORE_FIFO > 0U) */
+
+
 /*********************************** end of tbx_port.c *********************************/
@@ -39,6 +39,51 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <hardware/sync.h>                       /* Hardware synchronzation library    */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of cache slots that this port supports. One for each core. */
+#define TBX_PORT_CACHE_NUM_SLOTS                 (2U)
+
+#ifndef TBX_PORT_ENTROPY
+/** \brief This port offers a hardware entropy source, through the random bit of the ring
+ *         oscillator. Note that it is possible to disable this by setting this macro to
+ *         0 in the configuration header file.
+ */
+#define TBX_PORT_ENTROPY                         (1U)
+#endif
+
+#ifndef TBX_PORT_CYCLE_COUNTER
+/** \brief This port offers a cycle counter, through the lower 32 bits of the free
+ *         running timer. It counts microseconds and is the same for both cores. Note
+ *         that it is possible to disable this by setting this macro to 0 in the
+ *         configuration header file.
+ */
+#define TBX_PORT_CYCLE_COUNTER                   (1U)
+#endif
+
+#ifndef TBX_PORT_CORE_FIFO
+/** \brief This port offers a FIFO between the cores, through the inter-core FIFOs of the
+ *         single-cycle IO block (SIO). Note that it is possible to disable this by
+ *         setting this macro to 0 in the configuration header file, for example when the
+ *         FIFOs are used for something else.
+ */
+#define TBX_PORT_CORE_FIFO                       (1U)
+#endif
+
+/** \brief Initializer for a statically allocated port specific lock object. All these
+ *         lock objects share the first striped hardware spin lock of the Pico SDK.
+ */
+#define TBX_PORT_LOCK_INIT                       { PICO_SPINLOCK_ID_STRIPED_FIRST, 0U, \
+                                                   0U }
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -49,6 +94,23 @@ extern "C" {
  */
 typedef uint32_t tTbxPortCpuSR;
 
+/** \brief Layout of a lock object. The owner of the lock is guarded by a hardware spin
+ *         lock. The spin lock is only held for the short moment it takes to update the
+ *         owner. This makes it possible for multiple lock objects to share the same
+ *         hardware spin lock. While a core owns the lock, its interrupts are disabled.
+ *         The interrupt state is stored per core, instead of in the lock object, so that
+ *         the locks can be exited in any order.
+ */
+typedef struct
+{
+  /** \brief Number of the hardware spin lock that guards the owner. */
+  uint32_t          spinLockNum;
+  /** \brief Number of the core that owns the lock plus one, or zero if not owned. */
+  volatile uint32_t ownerCore;
+  /** \brief Number of times the lock was entered, without being exited yet. */
+  uint32_t          nestingCounter;
+} tTbxPortLock;
+
 
 #ifdef __cplusplus
 }
@@ -1,6 +1,7 @@
 /*
 *   Byte-oriented AES-256 implementation.
 *   All lookup tables replaced with 'on the fly' calculations.
+*   Optional 32-bit table based engine with a precomputed key schedule.
 *
 *   Copyright (c) 2007-2011 Ilya O. Levin, www.literatecode.com
 *   Other contributors: Hal Finney, Frank Voorburg (MISRA compliance)
@@ -18,11 +19,19 @@
 *   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 #include <stdint.h>                         /* for standard integer types              */
+#include "microtbx.h"                       /* for the configuration macros            */
 #include "tbx_aes256.h"
 
 static uint8_t rj_sbox(uint8_t x);
 static uint8_t rj_sbox_inv(uint8_t x);
 static uint8_t rj_xtime(uint8_t x);
+#if (TBX_CONF_CRYPTO_AES256_METHOD == TBX_CRYPTO_AES256_TTABLE)
+static uint32_t aes_load32(uint8_t const *buf);
+static void aes_store32(uint8_t *buf, uint32_t w);
+static uint32_t aes_subWord(uint32_t w);
+static uint32_t aes_subWord_inv(uint32_t w);
+static uint32_t aes_mixColumn_inv(uint32_t w);
+#else
 static void aes_subBytes(uint8_t *buf);
 static void aes_subBytes_inv(uint8_t *buf);
 static void aes_addRoundKey(uint8_t *buf, uint8_t const *key);
@@ -33,6 +42,7 @@ static void aes_mixColumns(uint8_t *buf);
 static void aes_mixColumns_inv(uint8_t *buf);
 static void aes_expandEncKey(uint8_t *k, uint8_t *rc);
 static void aes_expandDecKey(uint8_t *k, uint8_t *rc);
+#endif
 
 /* -------------------------------------------------------------------------- */
 static uint8_t rj_sbox(uint8_t x)
@@ -138,6 +148,364 @@ static uint8_t rj_xtime(uint8_t x)
     return result;
 } /* rj_xtime */
 
+#if (TBX_CONF_CRYPTO_AES256_METHOD == TBX_CRYPTO_AES256_TTABLE)
+/* Rotates a 32-bit word to the right. */
+#define AES_ROR32(x, n)    ((uint32_t)(((x) >> (n)) | ((x) << (32U - (n)))))
+
+/* Number of 32-bit words in the expanded key schedule of the 14 rounds. */
+#define AES_KEY_WORDS      (60U)
+
+/* Combined SubBytes and MixColumns table. Each entry holds the column that a
+ * byte in the first row contributes: {02}.S[x], S[x], S[x], {03}.S[x]. The
+ * contributions of the other rows are obtained by rotating the entry, which
+ * saves the ROM of three more tables.
+ */
+static const uint32_t aes_te[256] =
+{
+    0xc66363a5UL, 0xf87c7c84UL, 0xee777799UL, 0xf67b7b8dUL,
+    0xfff2f20dUL, 0xd66b6bbdUL, 0xde6f6fb1UL, 0x91c5c554UL,
+    0x60303050UL, 0x02010103UL, 0xce6767a9UL, 0x562b2b7dUL,
+    0xe7fefe19UL, 0xb5d7d762UL, 0x4dababe6UL, 0xec76769aUL,
+    0x8fcaca45UL, 0x1f82829dUL, 0x89c9c940UL, 0xfa7d7d87UL,
+    0xeffafa15UL, 0xb25959ebUL, 0x8e4747c9UL, 0xfbf0f00bUL,
+    0x41adadecUL, 0xb3d4d467UL, 0x5fa2a2fdUL, 0x45afafeaUL,
+    0x239c9cbfUL, 0x53a4a4f7UL, 0xe4727296UL, 0x9bc0c05bUL,
+    0x75b7b7c2UL, 0xe1fdfd1cUL, 0x3d9393aeUL, 0x4c26266aUL,
+    0x6c36365aUL, 0x7e3f3f41UL, 0xf5f7f702UL, 0x83cccc4fUL,
+    0x6834345cUL, 0x51a5a5f4UL, 0xd1e5e534UL, 0xf9f1f108UL,
+    0xe2717193UL, 0xabd8d873UL, 0x62313153UL, 0x2a15153fUL,
+    0x0804040cUL, 0x95c7c752UL, 0x46232365UL, 0x9dc3c35eUL,
+    0x30181828UL, 0x379696a1UL, 0x0a05050fUL, 0x2f9a9ab5UL,
+    0x0e070709UL, 0x24121236UL, 0x1b80809bUL, 0xdfe2e23dUL,
+    0xcdebeb26UL, 0x4e272769UL, 0x7fb2b2cdUL, 0xea75759fUL,
+    0x1209091bUL, 0x1d83839eUL, 0x582c2c74UL, 0x341a1a2eUL,
+    0x361b1b2dUL, 0xdc6e6eb2UL, 0xb45a5aeeUL, 0x5ba0a0fbUL,
+    0xa45252f6UL, 0x763b3b4dUL, 0xb7d6d661UL, 0x7db3b3ceUL,
+    0x5229297bUL, 0xdde3e33eUL, 0x5e2f2f71UL, 0x13848497UL,
+    0xa65353f5UL, 0xb9d1d168UL, 0x00000000UL, 0xc1eded2cUL,
+    0x40202060UL, 0xe3fcfc1fUL, 0x79b1b1c8UL, 0xb65b5bedUL,
+    0xd46a6abeUL, 0x8dcbcb46UL, 0x67bebed9UL, 0x7239394bUL,
+    0x944a4adeUL, 0x984c4cd4UL, 0xb05858e8UL, 0x85cfcf4aUL,
+    0xbbd0d06bUL, 0xc5efef2aUL, 0x4faaaae5UL, 0xedfbfb16UL,
+    0x864343c5UL, 0x9a4d4dd7UL, 0x66333355UL, 0x11858594UL,
+    0x8a4545cfUL, 0xe9f9f910UL, 0x04020206UL, 0xfe7f7f81UL,
+    0xa05050f0UL, 0x783c3c44UL, 0x259f9fbaUL, 0x4ba8a8e3UL,
+    0xa25151f3UL, 0x5da3a3feUL, 0x804040c0UL, 0x058f8f8aUL,
+    0x3f9292adUL, 0x219d9dbcUL, 0x70383848UL, 0xf1f5f504UL,
+    0x63bcbcdfUL, 0x77b6b6c1UL, 0xafdada75UL, 0x42212163UL,
+    0x20101030UL, 0xe5ffff1aUL, 0xfdf3f30eUL, 0xbfd2d26dUL,
+    0x81cdcd4cUL, 0x180c0c14UL, 0x26131335UL, 0xc3ecec2fUL,
+    0xbe5f5fe1UL, 0x359797a2UL, 0x884444ccUL, 0x2e171739UL,
+    0x93c4c457UL, 0x55a7a7f2UL, 0xfc7e7e82UL, 0x7a3d3d47UL,
+    0xc86464acUL, 0xba5d5de7UL, 0x3219192bUL, 0xe6737395UL,
+    0xc06060a0UL, 0x19818198UL, 0x9e4f4fd1UL, 0xa3dcdc7fUL,
+    0x44222266UL, 0x542a2a7eUL, 0x3b9090abUL, 0x0b888883UL,
+    0x8c4646caUL, 0xc7eeee29UL, 0x6bb8b8d3UL, 0x2814143cUL,
+    0xa7dede79UL, 0xbc5e5ee2UL, 0x160b0b1dUL, 0xaddbdb76UL,
+    0xdbe0e03bUL, 0x64323256UL, 0x743a3a4eUL, 0x140a0a1eUL,
+    0x924949dbUL, 0x0c06060aUL, 0x4824246cUL, 0xb85c5ce4UL,
+    0x9fc2c25dUL, 0xbdd3d36eUL, 0x43acacefUL, 0xc46262a6UL,
+    0x399191a8UL, 0x319595a4UL, 0xd3e4e437UL, 0xf279798bUL,
+    0xd5e7e732UL, 0x8bc8c843UL, 0x6e373759UL, 0xda6d6db7UL,
+    0x018d8d8cUL, 0xb1d5d564UL, 0x9c4e4ed2UL, 0x49a9a9e0UL,
+    0xd86c6cb4UL, 0xac5656faUL, 0xf3f4f407UL, 0xcfeaea25UL,
+    0xca6565afUL, 0xf47a7a8eUL, 0x47aeaee9UL, 0x10080818UL,
+    0x6fbabad5UL, 0xf0787888UL, 0x4a25256fUL, 0x5c2e2e72UL,
+    0x381c1c24UL, 0x57a6a6f1UL, 0x73b4b4c7UL, 0x97c6c651UL,
+    0xcbe8e823UL, 0xa1dddd7cUL, 0xe874749cUL, 0x3e1f1f21UL,
+    0x964b4bddUL, 0x61bdbddcUL, 0x0d8b8b86UL, 0x0f8a8a85UL,
+    0xe0707090UL, 0x7c3e3e42UL, 0x71b5b5c4UL, 0xcc6666aaUL,
+    0x904848d8UL, 0x06030305UL, 0xf7f6f601UL, 0x1c0e0e12UL,
+    0xc26161a3UL, 0x6a35355fUL, 0xae5757f9UL, 0x69b9b9d0UL,
+    0x17868691UL, 0x99c1c158UL, 0x3a1d1d27UL, 0x279e9eb9UL,
+    0xd9e1e138UL, 0xebf8f813UL, 0x2b9898b3UL, 0x22111133UL,
+    0xd26969bbUL, 0xa9d9d970UL, 0x078e8e89UL, 0x339494a7UL,
+    0x2d9b9bb6UL, 0x3c1e1e22UL, 0x15878792UL, 0xc9e9e920UL,
+    0x87cece49UL, 0xaa5555ffUL, 0x50282878UL, 0xa5dfdf7aUL,
+    0x038c8c8fUL, 0x59a1a1f8UL, 0x09898980UL, 0x1a0d0d17UL,
+    0x65bfbfdaUL, 0xd7e6e631UL, 0x844242c6UL, 0xd06868b8UL,
+    0x824141c3UL, 0x299999b0UL, 0x5a2d2d77UL, 0x1e0f0f11UL,
+    0x7bb0b0cbUL, 0xa85454fcUL, 0x6dbbbbd6UL, 0x2c16163aUL
+};
+
+/* Combined InvSubBytes and InvMixColumns table. Each entry holds the column
+ * that a byte in the first row contributes: {0e}.Si[x], {09}.Si[x],
+ * {0d}.Si[x], {0b}.Si[x].
+ */
+static const uint32_t aes_td[256] =
+{
+    0x51f4a750UL, 0x7e416553UL, 0x1a17a4c3UL, 0x3a275e96UL,
+    0x3bab6bcbUL, 0x1f9d45f1UL, 0xacfa58abUL, 0x4be30393UL,
+    0x2030fa55UL, 0xad766df6UL, 0x88cc7691UL, 0xf5024c25UL,
+    0x4fe5d7fcUL, 0xc52acbd7UL, 0x26354480UL, 0xb562a38fUL,
+    0xdeb15a49UL, 0x25ba1b67UL, 0x45ea0e98UL, 0x5dfec0e1UL,
+    0xc32f7502UL, 0x814cf012UL, 0x8d4697a3UL, 0x6bd3f9c6UL,
+    0x038f5fe7UL, 0x15929c95UL, 0xbf6d7aebUL, 0x955259daUL,
+    0xd4be832dUL, 0x587421d3UL, 0x49e06929UL, 0x8ec9c844UL,
+    0x75c2896aUL, 0xf48e7978UL, 0x99583e6bUL, 0x27b971ddUL,
+    0xbee14fb6UL, 0xf088ad17UL, 0xc920ac66UL, 0x7dce3ab4UL,
+    0x63df4a18UL, 0xe51a3182UL, 0x97513360UL, 0x62537f45UL,
+    0xb16477e0UL, 0xbb6bae84UL, 0xfe81a01cUL, 0xf9082b94UL,
+    0x70486858UL, 0x8f45fd19UL, 0x94de6c87UL, 0x527bf8b7UL,
+    0xab73d323UL, 0x724b02e2UL, 0xe31f8f57UL, 0x6655ab2aUL,
+    0xb2eb2807UL, 0x2fb5c203UL, 0x86c57b9aUL, 0xd33708a5UL,
+    0x302887f2UL, 0x23bfa5b2UL, 0x02036abaUL, 0xed16825cUL,
+    0x8acf1c2bUL, 0xa779b492UL, 0xf307f2f0UL, 0x4e69e2a1UL,
+    0x65daf4cdUL, 0x0605bed5UL, 0xd134621fUL, 0xc4a6fe8aUL,
+    0x342e539dUL, 0xa2f355a0UL, 0x058ae132UL, 0xa4f6eb75UL,
+    0x0b83ec39UL, 0x4060efaaUL, 0x5e719f06UL, 0xbd6e1051UL,
+    0x3e218af9UL, 0x96dd063dUL, 0xdd3e05aeUL, 0x4de6bd46UL,
+    0x91548db5UL, 0x71c45d05UL, 0x0406d46fUL, 0x605015ffUL,
+    0x1998fb24UL, 0xd6bde997UL, 0x894043ccUL, 0x67d99e77UL,
+    0xb0e842bdUL, 0x07898b88UL, 0xe7195b38UL, 0x79c8eedbUL,
+    0xa17c0a47UL, 0x7c420fe9UL, 0xf8841ec9UL, 0x00000000UL,
+    0x09808683UL, 0x322bed48UL, 0x1e1170acUL, 0x6c5a724eUL,
+    0xfd0efffbUL, 0x0f853856UL, 0x3daed51eUL, 0x362d3927UL,
+    0x0a0fd964UL, 0x685ca621UL, 0x9b5b54d1UL, 0x24362e3aUL,
+    0x0c0a67b1UL, 0x9357e70fUL, 0xb4ee96d2UL, 0x1b9b919eUL,
+    0x80c0c54fUL, 0x61dc20a2UL, 0x5a774b69UL, 0x1c121a16UL,
+    0xe293ba0aUL, 0xc0a02ae5UL, 0x3c22e043UL, 0x121b171dUL,
+    0x0e090d0bUL, 0xf28bc7adUL, 0x2db6a8b9UL, 0x141ea9c8UL,
+    0x57f11985UL, 0xaf75074cUL, 0xee99ddbbUL, 0xa37f60fdUL,
+    0xf701269fUL, 0x5c72f5bcUL, 0x44663bc5UL, 0x5bfb7e34UL,
+    0x8b432976UL, 0xcb23c6dcUL, 0xb6edfc68UL, 0xb8e4f163UL,
+    0xd731dccaUL, 0x42638510UL, 0x13972240UL, 0x84c61120UL,
+    0x854a247dUL, 0xd2bb3df8UL, 0xaef93211UL, 0xc729a16dUL,
+    0x1d9e2f4bUL, 0xdcb230f3UL, 0x0d8652ecUL, 0x77c1e3d0UL,
+    0x2bb3166cUL, 0xa970b999UL, 0x119448faUL, 0x47e96422UL,
+    0xa8fc8cc4UL, 0xa0f03f1aUL, 0x567d2cd8UL, 0x223390efUL,
+    0x87494ec7UL, 0xd938d1c1UL, 0x8ccaa2feUL, 0x98d40b36UL,
+    0xa6f581cfUL, 0xa57ade28UL, 0xdab78e26UL, 0x3fadbfa4UL,
+    0x2c3a9de4UL, 0x5078920dUL, 0x6a5fcc9bUL, 0x547e4662UL,
+    0xf68d13c2UL, 0x90d8b8e8UL, 0x2e39f75eUL, 0x82c3aff5UL,
+    0x9f5d80beUL, 0x69d0937cUL, 0x6fd52da9UL, 0xcf2512b3UL,
+    0xc8ac993bUL, 0x10187da7UL, 0xe89c636eUL, 0xdb3bbb7bUL,
+    0xcd267809UL, 0x6e5918f4UL, 0xec9ab701UL, 0x834f9aa8UL,
+    0xe6956e65UL, 0xaaffe67eUL, 0x21bccf08UL, 0xef15e8e6UL,
+    0xbae79bd9UL, 0x4a6f36ceUL, 0xea9f09d4UL, 0x29b07cd6UL,
+    0x31a4b2afUL, 0x2a3f2331UL, 0xc6a59430UL, 0x35a266c0UL,
+    0x744ebc37UL, 0xfc82caa6UL, 0xe090d0b0UL, 0x33a7d815UL,
+    0xf104984aUL, 0x41ecdaf7UL, 0x7fcd500eUL, 0x1791f62fUL,
+    0x764dd68dUL, 0x43efb04dUL, 0xccaa4d54UL, 0xe49604dfUL,
+    0x9ed1b5e3UL, 0x4c6a881bUL, 0xc12c1fb8UL, 0x4665517fUL,
+    0x9d5eea04UL, 0x018c355dUL, 0xfa877473UL, 0xfb0b412eUL,
+    0xb3671d5aUL, 0x92dbd252UL, 0xe9105633UL, 0x6dd64713UL,
+    0x9ad7618cUL, 0x37a10c7aUL, 0x59f8148eUL, 0xeb133c89UL,
+    0xcea927eeUL, 0xb761c935UL, 0xe11ce5edUL, 0x7a47b13cUL,
+    0x9cd2df59UL, 0x55f2733fUL, 0x1814ce79UL, 0x73c737bfUL,
+    0x53f7cdeaUL, 0x5ffdaa5bUL, 0xdf3d6f14UL, 0x7844db86UL,
+    0xcaaff381UL, 0xb968c43eUL, 0x3824342cUL, 0xc2a3405fUL,
+    0x161dc372UL, 0xbce2250cUL, 0x283c498bUL, 0xff0d9541UL,
+    0x39a80171UL, 0x080cb3deUL, 0xd8b4e49cUL, 0x6456c190UL,
+    0x7bcb8461UL, 0xd532b670UL, 0x486c5c74UL, 0xd0b85742UL
+};
+
+/* -------------------------------------------------------------------------- */
+static uint32_t aes_load32(uint8_t const *buf)
+{
+    return ((uint32_t)buf[0U] << 24U) | ((uint32_t)buf[1U] << 16U) |
+           ((uint32_t)buf[2U] << 8U)  |  (uint32_t)buf[3U];
+} /* aes_load32 */
+
+/* -------------------------------------------------------------------------- */
+static void aes_store32(uint8_t *buf, uint32_t w)
+{
+    buf[0U] = (uint8_t)(w >> 24U);
+    buf[1U] = (uint8_t)(w >> 16U);
+    buf[2U] = (uint8_t)(w >> 8U);
+    buf[3U] = (uint8_t)w;
+} /* aes_store32 */
+
+/* -------------------------------------------------------------------------- */
+static uint32_t aes_subWord(uint32_t w)
+{
+    return ((uint32_t)rj_sbox((uint8_t)(w >> 24U)) << 24U) |
+           ((uint32_t)rj_sbox((uint8_t)(w >> 16U)) << 16U) |
+           ((uint32_t)rj_sbox((uint8_t)(w >> 8U)) << 8U)   |
+            (uint32_t)rj_sbox((uint8_t)w);
+} /* aes_subWord */
+
+/* -------------------------------------------------------------------------- */
+static uint32_t aes_subWord_inv(uint32_t w)
+{
+    return ((uint32_t)rj_sbox_inv((uint8_t)(w >> 24U)) << 24U) |
+           ((uint32_t)rj_sbox_inv((uint8_t)(w >> 16U)) << 16U) |
+           ((uint32_t)rj_sbox_inv((uint8_t)(w >> 8U)) << 8U)   |
+            (uint32_t)rj_sbox_inv((uint8_t)w);
+} /* aes_subWord_inv */
+
+/* -------------------------------------------------------------------------- */
+static uint32_t aes_mixColumn_inv(uint32_t w)
+{
+    /* aes_td[] includes InvSubBytes, so undo it with the forward S-box. */
+    return aes_td[rj_sbox((uint8_t)(w >> 24U))] ^
+           AES_ROR32(aes_td[rj_sbox((uint8_t)(w >> 16U))], 8U) ^
+           AES_ROR32(aes_td[rj_sbox((uint8_t)(w >> 8U))], 16U) ^
+           AES_ROR32(aes_td[rj_sbox((uint8_t)w)], 24U);
+} /* aes_mixColumn_inv */
+
+
+/* -------------------------------------------------------------------------- */
+void tbx_aes256_init(tbx_aes256_context *ctx, uint8_t const *k)
+{
+    uint8_t rcon = 1U;
+    uint32_t temp;
+    uint8_t i;
+    uint8_t j;
+
+    /* Expand the encryption key schedule once. */
+    for (i = 0U; i < 8U; i++)
+    {
+        ctx->enckey[i] = aes_load32(&k[4U * i]);
+    }
+    for (i = 8U; i < AES_KEY_WORDS; i++)
+    {
+        temp = ctx->enckey[i - 1U];
+        if ((i & 7U) == 0U)
+        {
+            temp = aes_subWord(AES_ROR32(temp, 24U)) ^ ((uint32_t)rcon << 24U);
+            rcon = rj_xtime(rcon);
+        }
+        else if ((i & 7U) == 4U)
+        {
+            temp = aes_subWord(temp);
+        }
+        else
+        {
+            /* Nothing to do for the other words. */
+        }
+        ctx->enckey[i] = ctx->enckey[i - 8U] ^ temp;
+    }
+
+    /* Derive the decryption key schedule for the equivalent inverse cipher: the
+     * round keys in reverse order, with InvMixColumns applied to the inner ones.
+     */
+    for (i = 0U; i < AES_KEY_WORDS; i += 4U)
+    {
+        for (j = 0U; j < 4U; j++)
+        {
+            temp = ctx->enckey[(AES_KEY_WORDS - 4U - i) + j];
+            if ((i > 0U) && (i < (AES_KEY_WORDS - 4U)))
+            {
+                temp = aes_mixColumn_inv(temp);
+            }
+            ctx->deckey[i + j] = temp;
+        }
+    }
+} /* tbx_aes256_init */
+
+/* -------------------------------------------------------------------------- */
+void tbx_aes256_done(tbx_aes256_context *ctx)
+{
+    register uint8_t i;
+
+    for (i = 0U; i < AES_KEY_WORDS; i++)
+    {
+        ctx->enckey[i] = 0U;
+        ctx->deckey[i] = 0U;
+    }
+} /* tbx_aes256_done */
+
+/* -------------------------------------------------------------------------- */
+void tbx_aes256_encrypt_ecb(tbx_aes256_context *ctx, uint8_t *buf)
+{
+    uint32_t const *rk = ctx->enckey;
+    uint32_t s0, s1, s2, s3;
+    uint32_t t0, t1, t2, t3;
+    uint8_t i;
+
+    s0 = aes_load32(&buf[0U])  ^ rk[0U];
+    s1 = aes_load32(&buf[4U])  ^ rk[1U];
+    s2 = aes_load32(&buf[8U])  ^ rk[2U];
+    s3 = aes_load32(&buf[12U]) ^ rk[3U];
+
+    for (i = 1U; i < 14U; ++i)
+    {
+        rk = &rk[4U];
+        t0 = aes_te[s0 >> 24U] ^ AES_ROR32(aes_te[(s1 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_te[(s2 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_te[s3 & 0xffU], 24U) ^ rk[0U];
+        t1 = aes_te[s1 >> 24U] ^ AES_ROR32(aes_te[(s2 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_te[(s3 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_te[s0 & 0xffU], 24U) ^ rk[1U];
+        t2 = aes_te[s2 >> 24U] ^ AES_ROR32(aes_te[(s3 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_te[(s0 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_te[s1 & 0xffU], 24U) ^ rk[2U];
+        t3 = aes_te[s3 >> 24U] ^ AES_ROR32(aes_te[(s0 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_te[(s1 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_te[s2 & 0xffU], 24U) ^ rk[3U];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* The last round has no MixColumns. */
+    rk = &rk[4U];
+    aes_store32(&buf[0U],  aes_subWord((s0 & 0xff000000UL) | (s1 & 0x00ff0000UL) |
+                                       (s2 & 0x0000ff00UL) | (s3 & 0x000000ffUL)) ^
+                           rk[0U]);
+    aes_store32(&buf[4U],  aes_subWord((s1 & 0xff000000UL) | (s2 & 0x00ff0000UL) |
+                                       (s3 & 0x0000ff00UL) | (s0 & 0x000000ffUL)) ^
+                           rk[1U]);
+    aes_store32(&buf[8U],  aes_subWord((s2 & 0xff000000UL) | (s3 & 0x00ff0000UL) |
+                                       (s0 & 0x0000ff00UL) | (s1 & 0x000000ffUL)) ^
+                           rk[2U]);
+    aes_store32(&buf[12U], aes_subWord((s3 & 0xff000000UL) | (s0 & 0x00ff0000UL) |
+                                       (s1 & 0x0000ff00UL) | (s2 & 0x000000ffUL)) ^
+                           rk[3U]);
+} /* tbx_aes256_encrypt */
+
+/* -------------------------------------------------------------------------- */
+void tbx_aes256_decrypt_ecb(tbx_aes256_context *ctx, uint8_t *buf)
+{
+    uint32_t const *rk = ctx->deckey;
+    uint32_t s0, s1, s2, s3;
+    uint32_t t0, t1, t2, t3;
+    uint8_t i;
+
+    s0 = aes_load32(&buf[0U])  ^ rk[0U];
+    s1 = aes_load32(&buf[4U])  ^ rk[1U];
+    s2 = aes_load32(&buf[8U])  ^ rk[2U];
+    s3 = aes_load32(&buf[12U]) ^ rk[3U];
+
+    for (i = 1U; i < 14U; ++i)
+    {
+        rk = &rk[4U];
+        t0 = aes_td[s0 >> 24U] ^ AES_ROR32(aes_td[(s3 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_td[(s2 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_td[s1 & 0xffU], 24U) ^ rk[0U];
+        t1 = aes_td[s1 >> 24U] ^ AES_ROR32(aes_td[(s0 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_td[(s3 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_td[s2 & 0xffU], 24U) ^ rk[1U];
+        t2 = aes_td[s2 >> 24U] ^ AES_ROR32(aes_td[(s1 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_td[(s0 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_td[s3 & 0xffU], 24U) ^ rk[2U];
+        t3 = aes_td[s3 >> 24U] ^ AES_ROR32(aes_td[(s2 >> 16U) & 0xffU], 8U) ^
+             AES_ROR32(aes_td[(s1 >> 8U) & 0xffU], 16U) ^
+             AES_ROR32(aes_td[s0 & 0xffU], 24U) ^ rk[3U];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* The last round has no InvMixColumns. */
+    rk = &rk[4U];
+    aes_store32(&buf[0U],  aes_subWord_inv((s0 & 0xff000000UL) | (s3 & 0x00ff0000UL) |
+                                           (s2 & 0x0000ff00UL) | (s1 & 0x000000ffUL)) ^
+                           rk[0U]);
+    aes_store32(&buf[4U],  aes_subWord_inv((s1 & 0xff000000UL) | (s0 & 0x00ff0000UL) |
+                                           (s3 & 0x0000ff00UL) | (s2 & 0x000000ffUL)) ^
+                           rk[1U]);
+    aes_store32(&buf[8U],  aes_subWord_inv((s2 & 0xff000000UL) | (s1 & 0x00ff0000UL) |
+                                           (s0 & 0x0000ff00UL) | (s3 & 0x000000ffUL)) ^
+                           rk[2U]);
+    aes_store32(&buf[12U], aes_subWord_inv((s3 & 0xff000000UL) | (s2 & 0x00ff0000UL) |
+                                           (s1 & 0x0000ff00UL) | (s0 & 0x000000ffUL)) ^
+                           rk[3U]);
+} /* tbx_aes256_decrypt */
+#else
 /* -------------------------------------------------------------------------- */
 static void aes_subBytes(uint8_t *buf)
 {
@@ -327,7 +695,7 @@ static void aes_expandDecKey(uint8_t *k, uint8_t *rc)
     uint8_t i;
     uint8_t mask = 0U;
 
-    for(i = 28U; i > 16U; i -= 4U)
+    for(i = 28U; i > 16U; i = (uint8_t)(i - 4U))
     {
         k[i]      ^= k[i - 4U];
         k[i + 1U] ^= k[i - 3U];
@@ -340,7 +708,7 @@ static void aes_expandDecKey(uint8_t *k, uint8_t *rc)
     k[18U] ^= rj_sbox(k[14U]);
     k[19U] ^= rj_sbox(k[15U]);
 
-    for(i = 12U; i > 0U; i -= 4U)
+    for(i = 12U; i > 0U; i = (uint8_t)(i - 4U))
     {
         k[i] ^= k[i - 4U];
         k[i + 1U] ^= k[i - 3U];
@@ -446,3 +814,4 @@ void tbx_aes256_decrypt_ecb(tbx_aes256_context *ctx, uint8_t *buf)
     }
     aes_addRoundKey( buf, ctx->key);
 } /* tbx_aes256_decrypt */
+#endif
@@ -1,6 +1,7 @@
 /*  
 *   Byte-oriented AES-256 implementation.
 *   All lookup tables replaced with 'on the fly' calculations. 
+*   Optional 32-bit table based engine with a precomputed key schedule.
 *
 *   Copyright (c) 2007-2009 Ilya O. Levin, www.literatecode.com
 *   Other contributors: Hal Finney, Frank Voorburg (MISRA compliance)
@@ -18,15 +19,25 @@
 *   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#ifndef TBX_AES256_H
+#define TBX_AES256_H
+
 #ifdef __cplusplus
 extern "C" { 
 #endif
 
+#if (TBX_CONF_CRYPTO_AES256_METHOD == TBX_CRYPTO_AES256_TTABLE)
+    typedef struct {
+        uint32_t enckey[60];
+        uint32_t deckey[60];
+    } tbx_aes256_context;
+#else
     typedef struct {
         uint8_t key[32]; 
         uint8_t enckey[32]; 
         uint8_t deckey[32];
     } tbx_aes256_context; 
+#endif
 
 
     void tbx_aes256_init(tbx_aes256_context *ctx, uint8_t const *k);
@@ -37,3 +48,5 @@ extern "C" {
 #ifdef __cplusplus
 }
 #endif
+
+#endif /* TBX_AES256_H */
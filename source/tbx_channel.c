@@ -0,0 +1,327 @@
+/************************************************************************************//**
+* \file         tbx_channel.c
+* \brief        Cross-core channel source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+#if (TBX_PORT_CORE_FIFO > 0U)
+#ifndef TBX_PORT_CACHE_NUM_SLOTS
+#error "TBX_PORT_CORE_FIFO requires TBX_PORT_CACHE_NUM_SLOTS with one cache slot per core."
+#endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Flag in a value that is passed through the FIFO, which marks that it points to
+ *         a chain of blocks that are returned to the core that sent them, instead of to
+ *         a block that is sent. The blocks of the memory pools are aligned to the address
+ *         size, so the lowest bit of their address is always zero.
+ */
+#define TBX_CHANNEL_RETURN_FLAG                  ((uintptr_t)1U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of the state of the channel that is kept per core. */
+typedef struct
+{
+  /** \brief Chain with the blocks that the core released, which still need to be
+   *         returned to the other core. The first bytes of the data of each block hold
+   *         the pointer to the next block in the chain.
+   */
+  void   * returnListPtr;
+  /** \brief Number of blocks in the chain. */
+  size_t   returnCount;
+} tTbxChannelCore;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TbxChannelReturn      (tTbxChannelCore * corePtr);
+
+static void TbxChannelReleaseChain(void            * chainPtr);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief State of the channel per core. The cache slot of a core serves as its index. */
+static tTbxChannelCore tbxChannelCore[TBX_PORT_CACHE_NUM_SLOTS] = { 0 };
+
+
+/************************************************************************************//**
+** \brief     Sends a block of memory to the other core, by passing its pointer through
+**            the FIFO between the cores. Only the pointer is passed, so the contents of
+**            the block are not copied. The block must be allocated from a memory pool,
+**            for example with TbxMemPoolAllocate() or TbxMemPoolFixedAllocate(). The
+**            other core obtains it with TbxChannelReceive() and gives it back with
+**            TbxChannelRelease(), once it no longer needs it. The block then returns to
+**            the calling core, where it is released to its memory pool. This function
+**            does not wait for room in the FIFO. It is safe to call from an interrupt
+**            service routine.
+** \param     memPtr Pointer to the block of memory to send.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when the FIFO is full.
+**            In this case the calling core still owns the block.
+**
+****************************************************************************************/
+uint8_t TbxChannelSend(void * memPtr)
+{
+  uint8_t result = TBX_ERROR;
+  uint8_t slotIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(((uintptr_t)memPtr & TBX_CHANNEL_RETURN_FLAG) == 0U);
+
+  /* Only continue if the parameter is valid. */
+  if ( (memPtr != NULL) && (((uintptr_t)memPtr & TBX_CHANNEL_RETURN_FLAG) == 0U) )
+  {
+    /* Make sure that the contents of the block are written, before the other core can
+     * receive its pointer.
+     */
+    TbxPortMemoryBarrier();
+    /* Obtain exclusive access to the FIFO of the calling core. This only locks out the
+     * interrupts of the calling core, not the other core.
+     */
+    slotIdx = TbxPortCacheSlotEnter();
+    /* Pass the pointer to the other core. */
+    result = TbxPortCoreFifoPush((uintptr_t)memPtr);
+    /* Release exclusive access to the FIFO of the calling core. */
+    TbxPortCacheSlotExit(slotIdx);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChannelSend ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the next block of memory that the other core sent with
+**            TbxChannelSend(). Give the block back with TbxChannelRelease(), once it is
+**            no longer needed. Blocks that the other core returns in the meantime, are
+**            released to their memory pool by this function. Call this function when
+**            the SIO interrupt signals that the FIFO holds data, or periodically. It
+**            does not wait for data in the FIFO.
+** \return    Pointer to the received block of memory, or NULL if there is none.
+**
+****************************************************************************************/
+void * TbxChannelReceive(void)
+{
+  void      * result = NULL;
+  uintptr_t   value = 0U;
+  uint8_t     popResult;
+  uint8_t     slotIdx;
+
+  /* Keep reading from the FIFO, until a block is received or the FIFO is empty. */
+  do
+  {
+    /* Obtain exclusive access to the FIFO of the calling core. */
+    slotIdx = TbxPortCacheSlotEnter();
+    /* Attempt to read the next value that the other core wrote to the FIFO. */
+    popResult = TbxPortCoreFifoPop(&value);
+    /* Release exclusive access to the FIFO of the calling core. */
+    TbxPortCacheSlotExit(slotIdx);
+    /* Only continue if a value was read. */
+    if (popResult == TBX_OK)
+    {
+      /* Did the other core return a chain with blocks that this core sent before? */
+      if ((value & TBX_CHANNEL_RETURN_FLAG) != 0U)
+      {
+        /* Release them to their memory pool. */
+        TbxChannelReleaseChain((void *)(value & ~TBX_CHANNEL_RETURN_FLAG));
+      }
+      /* The other core sent a block. */
+      else
+      {
+        result = (void *)value;
+      }
+    }
+  }
+  while ( (popResult == TBX_OK) && (result == NULL) );
+
+  /* Make sure that the contents of the block are read, after its pointer was read. */
+  TbxPortMemoryBarrier();
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChannelReceive ***/
+
+
+/************************************************************************************//**
+** \brief     Gives back a block of memory that was obtained with TbxChannelReceive(),
+**            once it is no longer needed. The block is not released right away. It is
+**            added to a chain with released blocks. Once this chain holds
+**            TBX_CONF_CHANNEL_BATCH_SIZE blocks, the entire chain is returned to the
+**            core that sent the blocks, with one single value in the FIFO. That core
+**            releases them to their memory pool with its next TbxChannelReceive() call.
+**            This way the blocks are always released by the core that allocated them.
+** \param     memPtr Pointer to the block of memory to give back.
+**
+****************************************************************************************/
+void TbxChannelRelease(void * memPtr)
+{
+  tTbxChannelCore  * corePtr;
+  void           * * nextPtrPtr;
+  uint8_t            slotIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (memPtr != NULL)
+  {
+    /* Obtain exclusive access to the channel state of the calling core. */
+    slotIdx = TbxPortCacheSlotEnter();
+    corePtr = &tbxChannelCore[slotIdx];
+    /* Add the block to the start of the chain. Its data holds the pointer to the next
+     * block in the chain.
+     */
+    nextPtrPtr = memPtr;
+    *nextPtrPtr = corePtr->returnListPtr;
+    corePtr->returnListPtr = memPtr;
+    corePtr->returnCount++;
+    /* Return the chain to the other core, once the batch is complete. */
+    if (corePtr->returnCount >= TBX_CONF_CHANNEL_BATCH_SIZE)
+    {
+      TbxChannelReturn(corePtr);
+    }
+    /* Release exclusive access to the channel state of the calling core. */
+    TbxPortCacheSlotExit(slotIdx);
+  }
+} /*** end of TbxChannelRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Returns the blocks that were given back with TbxChannelRelease() to the
+**            core that sent them, without waiting for the batch to be complete. Useful
+**            when the calling core becomes idle, such that the other core can reuse
+**            these blocks.
+**
+****************************************************************************************/
+void TbxChannelFlush(void)
+{
+  tTbxChannelCore * corePtr;
+  uint8_t           slotIdx;
+
+  /* Obtain exclusive access to the channel state of the calling core. */
+  slotIdx = TbxPortCacheSlotEnter();
+  corePtr = &tbxChannelCore[slotIdx];
+  /* Return the chain to the other core, if it holds blocks. */
+  if (corePtr->returnCount > 0U)
+  {
+    TbxChannelReturn(corePtr);
+  }
+  /* Release exclusive access to the channel state of the calling core. */
+  TbxPortCacheSlotExit(slotIdx);
+} /*** end of TbxChannelFlush ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to return the chain with released blocks of the calling core, to
+**            the other core. If the FIFO is full, the blocks stay in the chain. Another
+**            attempt is then made upon the next release or flush. Should be called with
+**            exclusive access to the channel state of the calling core.
+** \param     corePtr Pointer to the channel state of the calling core.
+**
+****************************************************************************************/
+static void TbxChannelReturn(tTbxChannelCore * corePtr)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(corePtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (corePtr != NULL)
+  {
+    /* Make sure that the pointers in the chain are written, before the other core can
+     * receive the chain.
+     */
+    TbxPortMemoryBarrier();
+    /* Pass the pointer to the first block in the chain, flagged as a returned chain. */
+    if (TbxPortCoreFifoPush((uintptr_t)corePtr->returnListPtr |
+                            TBX_CHANNEL_RETURN_FLAG) == TBX_OK)
+    {
+      /* The other core now owns the chain, so start a new one. */
+      corePtr->returnListPtr = NULL;
+      corePtr->returnCount = 0U;
+    }
+  }
+} /*** end of TbxChannelReturn ***/
+
+
+/************************************************************************************//**
+** \brief     Releases the blocks in a chain, which the other core returned, to their
+**            memory pool. This is done in batches of at most TBX_CONF_CHANNEL_BATCH_SIZE
+**            blocks, such that the memory pool is accessed only once per batch.
+** \param     chainPtr Pointer to the first block in the chain.
+**
+****************************************************************************************/
+static void TbxChannelReleaseChain(void * chainPtr)
+{
+  void         * ptrArray[TBX_CONF_CHANNEL_BATCH_SIZE];
+  void         * blockPtr;
+  void * const * nextPtrPtr;
+  size_t         count = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(chainPtr != NULL);
+
+  /* Make sure that the pointers in the chain are read, after the chain was received. */
+  TbxPortMemoryBarrier();
+  /* Walk through the chain, while collecting its blocks. */
+  blockPtr = chainPtr;
+  while (blockPtr != NULL)
+  {
+    ptrArray[count] = blockPtr;
+    count++;
+    /* Read the pointer to the next block, before the block is released. */
+    nextPtrPtr = blockPtr;
+    blockPtr = *nextPtrPtr;
+    /* Release the collected blocks, once the batch is complete or the chain ended. */
+    if ( (count == TBX_CONF_CHANNEL_BATCH_SIZE) || (blockPtr == NULL) )
+    {
+      TbxMemPoolReleaseBatch(ptrArray, count);
+      count = 0U;
+    }
+  }
+} /*** end of TbxChannelReleaseChain ***/
+#endif /* (TBX_PORT_CORE_FIFO > 0U) */
+
+
+/*********************************** end of tbx_channel.c ******************************/
@@ -0,0 +1,80 @@
+/************************************************************************************//**
+* \file         tbx_channel.h
+* \brief        Cross-core channel header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_CHANNEL_H
+#define TBX_CHANNEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_CHANNEL_BATCH_SIZE
+/** \brief Configure the number of released blocks that a core collects, before it
+ *         returns them all at once to the core that sent them. The receiving core then
+ *         releases them with one call to TbxMemPoolReleaseBatch(). Note that this many
+ *         pointers are temporarily stored on the stack, while releasing the returned
+ *         blocks. Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_CHANNEL_BATCH_SIZE              (8U)
+#endif
+
+#if (TBX_CONF_CHANNEL_BATCH_SIZE == 0U)
+#error "TBX_CONF_CHANNEL_BATCH_SIZE must be larger than 0."
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+#if (TBX_PORT_CORE_FIFO > 0U)
+uint8_t   TbxChannelSend   (void * memPtr);
+
+void    * TbxChannelReceive(void);
+
+void      TbxChannelRelease(void * memPtr);
+
+void      TbxChannelFlush  (void);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_CHANNEL_H */
+/*********************************** end of tbx_channel.h ******************************/
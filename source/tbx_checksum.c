@@ -76,6 +76,303 @@
 #define TBX_CONF_CHECKSUM_CRC32_INITIAL          (0xFFFFFFFFUL)
 #endif
 
+#ifndef TBX_CONF_CHECKSUM_CRC16_METHOD
+/** \brief Method for calculating the 16-bit CRC. Determines how much ROM and RAM the
+ *         calculation needs, in exchange for its speed. Supported values are
+ *         TBX_CHECKSUM_CRC_BITWISE, TBX_CHECKSUM_CRC_NIBBLE, TBX_CHECKSUM_CRC_TABLE,
+ *         TBX_CHECKSUM_CRC_SLICING4 and TBX_CHECKSUM_CRC_SLICING8. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_CHECKSUM_CRC16_METHOD           (TBX_CHECKSUM_CRC_BITWISE)
+#endif
+
+#if (TBX_CONF_CHECKSUM_CRC16_METHOD > TBX_CHECKSUM_CRC_SLICING8)
+#error "TBX_CONF_CHECKSUM_CRC16_METHOD is invalid."
+#endif
+
+#ifndef TBX_CONF_CHECKSUM_CRC32_METHOD
+/** \brief Method for calculating the 32-bit CRC. Determines how much ROM and RAM the
+ *         calculation needs, in exchange for its speed. Supported values are
+ *         TBX_CHECKSUM_CRC_BITWISE, TBX_CHECKSUM_CRC_NIBBLE, TBX_CHECKSUM_CRC_TABLE,
+ *         TBX_CHECKSUM_CRC_SLICING4 and TBX_CHECKSUM_CRC_SLICING8. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_CHECKSUM_CRC32_METHOD           (TBX_CHECKSUM_CRC_BITWISE)
+#endif
+
+#if (TBX_CONF_CHECKSUM_CRC32_METHOD > TBX_CHECKSUM_CRC_SLICING8)
+#error "TBX_CONF_CHECKSUM_CRC32_METHOD is invalid."
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/* The CRC tables in ROM are calculated by the compiler, based on the configured
+ * polynomial. The following macros repeat the modulo 2 division per bit for each table
+ * entry. Note that all calculations are done with unsigned long values, which are at
+ * least 32 bits wide.
+ */
+/** \brief Generates a list of 16 table entries, starting at index n, with the help of
+ *         the macro e that generates the entry for one index.
+ */
+#define TBX_CHECKSUM_LIST16(e, n)   e(n), e((n) + 1U), e((n) + 2U), e((n) + 3U), \
+                                    e((n) + 4U), e((n) + 5U), e((n) + 6U), e((n) + 7U), \
+                                    e((n) + 8U), e((n) + 9U), e((n) + 10U), \
+                                    e((n) + 11U), e((n) + 12U), e((n) + 13U), \
+                                    e((n) + 14U), e((n) + 15U)
+
+/** \brief Generates a list of 256 table entries, with the help of the macro e that
+ *         generates the entry for one index.
+ */
+#define TBX_CHECKSUM_LIST256(e)     TBX_CHECKSUM_LIST16(e, 0U), \
+                                    TBX_CHECKSUM_LIST16(e, 16U), \
+                                    TBX_CHECKSUM_LIST16(e, 32U), \
+                                    TBX_CHECKSUM_LIST16(e, 48U), \
+                                    TBX_CHECKSUM_LIST16(e, 64U), \
+                                    TBX_CHECKSUM_LIST16(e, 80U), \
+                                    TBX_CHECKSUM_LIST16(e, 96U), \
+                                    TBX_CHECKSUM_LIST16(e, 112U), \
+                                    TBX_CHECKSUM_LIST16(e, 128U), \
+                                    TBX_CHECKSUM_LIST16(e, 144U), \
+                                    TBX_CHECKSUM_LIST16(e, 160U), \
+                                    TBX_CHECKSUM_LIST16(e, 176U), \
+                                    TBX_CHECKSUM_LIST16(e, 192U), \
+                                    TBX_CHECKSUM_LIST16(e, 208U), \
+                                    TBX_CHECKSUM_LIST16(e, 224U), \
+                                    TBX_CHECKSUM_LIST16(e, 240U)
+
+/** \brief Performs the modulo 2 division of a 16-bit CRC remainder by one bit. */
+#define TBX_CHECKSUM_CRC16_BIT(c)   ((((c) << 1U) & 0xFFFFUL) ^ \
+                                     ((((c) & 0x8000UL) != 0UL) ? \
+                                      (unsigned long)TBX_CONF_CHECKSUM_CRC16_POLYNOM : \
+                                      0UL))
+
+/** \brief Performs the modulo 2 division of a 16-bit CRC remainder by four bits. */
+#define TBX_CHECKSUM_CRC16_BITS4(c) TBX_CHECKSUM_CRC16_BIT(TBX_CHECKSUM_CRC16_BIT( \
+                                    TBX_CHECKSUM_CRC16_BIT(TBX_CHECKSUM_CRC16_BIT(c))))
+
+/** \brief Generates the entry of the 16-bit CRC nibble table for index n. */
+#define TBX_CHECKSUM_CRC16_NIBBLE(n) \
+  ((uint16_t)TBX_CHECKSUM_CRC16_BITS4((unsigned long)(n) << 12U))
+
+/** \brief Generates the entry of the 16-bit CRC byte table for index n. */
+#define TBX_CHECKSUM_CRC16_BYTE(n) \
+  ((uint16_t)TBX_CHECKSUM_CRC16_BITS4(TBX_CHECKSUM_CRC16_BITS4((unsigned long)(n) << 8U)))
+
+/** \brief Performs the modulo 2 division of a 32-bit CRC remainder by one bit. */
+#define TBX_CHECKSUM_CRC32_BIT(c)   ((((c) << 1U) & 0xFFFFFFFFUL) ^ \
+                                     ((((c) & 0x80000000UL) != 0UL) ? \
+                                      (unsigned long)TBX_CONF_CHECKSUM_CRC32_POLYNOM : \
+                                      0UL))
+
+/** \brief Performs the modulo 2 division of a 32-bit CRC remainder by four bits. */
+#define TBX_CHECKSUM_CRC32_BITS4(c) TBX_CHECKSUM_CRC32_BIT(TBX_CHECKSUM_CRC32_BIT( \
+                                    TBX_CHECKSUM_CRC32_BIT(TBX_CHECKSUM_CRC32_BIT(c))))
+
+/** \brief Generates the entry of the 32-bit CRC nibble table for index n. */
+#define TBX_CHECKSUM_CRC32_NIBBLE(n) \
+  ((uint32_t)TBX_CHECKSUM_CRC32_BITS4((unsigned long)(n) << 28U))
+
+/** \brief Generates the entry of the 32-bit CRC byte table for index n. */
+#define TBX_CHECKSUM_CRC32_BYTE(n) \
+  ((uint32_t)TBX_CHECKSUM_CRC32_BITS4( \
+             TBX_CHECKSUM_CRC32_BITS4((unsigned long)(n) << 24U)))
+
+/** \brief Obtains a data byte for processing by the CRC calculation. If the input is
+ *         reflected, the order of its bits is reversed, with the help of a table that
+ *         holds the reversed value of each 4-bit value. This makes it possible to use
+ *         the same calculation for reflected and not reflected algorithms.
+ */
+#define TBX_CHECKSUM_INPUT(b, reflect) \
+  (((reflect) != TBX_FALSE) ? \
+   (uint8_t)((uint8_t)(tbxChecksumReflectNibble[(b) & 0x0FU] << 4U) | \
+             tbxChecksumReflectNibble[(b) >> 4U]) : \
+   (b))
+
+#if (TBX_CONF_CHECKSUM_CRC16_METHOD == TBX_CHECKSUM_CRC_SLICING4)
+/** \brief Number of bytes that the 16-bit CRC calculation processes at a time. */
+#define TBX_CHECKSUM_CRC16_SLICES                (4U)
+#elif (TBX_CONF_CHECKSUM_CRC16_METHOD == TBX_CHECKSUM_CRC_SLICING8)
+/** \brief Number of bytes that the 16-bit CRC calculation processes at a time. */
+#define TBX_CHECKSUM_CRC16_SLICES                (8U)
+#endif
+
+#if (TBX_CONF_CHECKSUM_CRC32_METHOD == TBX_CHECKSUM_CRC_SLICING4)
+/** \brief Number of bytes that the 32-bit CRC calculation processes at a time. */
+#define TBX_CHECKSUM_CRC32_SLICES                (4U)
+#elif (TBX_CONF_CHECKSUM_CRC32_METHOD == TBX_CHECKSUM_CRC_SLICING8)
+/** \brief Number of bytes that the 32-bit CRC calculation processes at a time. */
+#define TBX_CHECKSUM_CRC32_SLICES                (8U)
+#endif
+
+
+
+/** \brief Modulus of the Fletcher-32 checksum sums. */
+#define TBX_CHECKSUM_FLETCHER32_MOD              (65535UL)
+
+/** \brief Maximum number of 16-bit data words that can be added to the Fletcher-32
+ *         sums, before their modulo must be taken to prevent their overflow.
+ */
+#define TBX_CHECKSUM_FLETCHER32_MAX_WORDS        (360U)
+
+/** \brief Modulus of the Adler-32 checksum sums. It is the largest prime below 65536. */
+#define TBX_CHECKSUM_ADLER32_MOD                 (65521UL)
+
+/** \brief Maximum number of data bytes that can be added to the Adler-32 sums, before
+ *         their modulo must be taken to prevent their overflow.
+ */
+#define TBX_CHECKSUM_ADLER32_MAX_BYTES           (5552U)
+
+/** \brief First prime number of the xxHash32 hash calculation. */
+#define TBX_CHECKSUM_XXHASH32_PRIME1             ((uint32_t)2654435761UL)
+
+/** \brief Second prime number of the xxHash32 hash calculation. */
+#define TBX_CHECKSUM_XXHASH32_PRIME2             ((uint32_t)2246822519UL)
+
+/** \brief Third prime number of the xxHash32 hash calculation. */
+#define TBX_CHECKSUM_XXHASH32_PRIME3             ((uint32_t)3266489917UL)
+
+/** \brief Fourth prime number of the xxHash32 hash calculation. */
+#define TBX_CHECKSUM_XXHASH32_PRIME4             ((uint32_t)668265263UL)
+
+/** \brief Fifth prime number of the xxHash32 hash calculation. */
+#define TBX_CHECKSUM_XXHASH32_PRIME5             ((uint32_t)374761393UL)
+
+/** \brief Number of data bytes that the xxHash32 hash calculation processes at a time. */
+#define TBX_CHECKSUM_XXHASH32_STRIPE             (16U)
+
+/** \brief Rotates a 32-bit value to the left by the specified number of bits. */
+#define TBX_CHECKSUM_ROTL32(v, n)                (((v) << (n)) | ((v) >> (32U - (n))))
+
+/** \brief Reads a 16-bit little endian data word. Compilers typically turn this into a
+ *         single load instruction on little endian CPUs that support unaligned access.
+ */
+#define TBX_CHECKSUM_READ16(p) \
+  ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8U))
+
+/** \brief Reads a 32-bit little endian data word. Compilers typically turn this into a
+ *         single load instruction on little endian CPUs that support unaligned access.
+ */
+#define TBX_CHECKSUM_READ32(p) \
+  ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8U) | ((uint32_t)(p)[2] << 16U) | \
+   ((uint32_t)(p)[3] << 24U))
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint16_t TbxChecksumCrc16Process      (uint16_t        crc,
+                                              uint8_t const * data,
+                                              size_t          len,
+                                              uint8_t         reflect);
+
+static uint16_t TbxChecksumCrc16ProcessBitwise(uint16_t        crc,
+                                               uint16_t        polynom,
+                                               uint8_t const * data,
+                                               size_t          len,
+                                               uint8_t         reflect);
+
+static uint32_t TbxChecksumCrc32Process      (uint32_t        crc,
+                                              uint8_t const * data,
+                                              size_t          len,
+                                              uint8_t         reflect);
+
+static uint32_t TbxChecksumCrc32ProcessBitwise(uint32_t        crc,
+                                               uint32_t        polynom,
+                                               uint8_t const * data,
+                                               size_t          len,
+                                               uint8_t         reflect);
+
+static uint32_t TbxChecksumReflect           (uint32_t        value,
+                                              uint8_t         numBits);
+
+#if defined(TBX_CHECKSUM_CRC16_SLICES)
+static void     TbxChecksumCrc16SlicesInit   (void);
+#endif
+
+#if defined(TBX_CHECKSUM_CRC32_SLICES)
+static void     TbxChecksumCrc32SlicesInit   (void);
+#endif
+
+static void     TbxChecksumXxHash32Stripes   (uint32_t        acc[],
+                                              uint8_t const * data,
+                                              size_t          numStripes);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Table with the value of each 4-bit value, with the order of its bits reversed.
+ */
+static const uint8_t tbxChecksumReflectNibble[16] =
+{
+  0x00U, 0x08U, 0x04U, 0x0CU, 0x02U, 0x0AU, 0x06U, 0x0EU,
+  0x01U, 0x09U, 0x05U, 0x0DU, 0x03U, 0x0BU, 0x07U, 0x0FU
+};
+
+#if (TBX_CONF_CHECKSUM_CRC16_METHOD == TBX_CHECKSUM_CRC_NIBBLE)
+/** \brief Table with the 16-bit CRC remainders of all 4-bit values. */
+static const uint16_t tbxChecksumCrc16Table[16] =
+{
+  TBX_CHECKSUM_LIST16(TBX_CHECKSUM_CRC16_NIBBLE, 0U)
+};
+#elif (TBX_CONF_CHECKSUM_CRC16_METHOD >= TBX_CHECKSUM_CRC_TABLE)
+/** \brief Table with the 16-bit CRC remainders of all 8-bit values. */
+static const uint16_t tbxChecksumCrc16Table[256] =
+{
+  TBX_CHECKSUM_LIST256(TBX_CHECKSUM_CRC16_BYTE)
+};
+#endif
+
+#if (TBX_CONF_CHECKSUM_CRC32_METHOD == TBX_CHECKSUM_CRC_NIBBLE)
+/** \brief Table with the 32-bit CRC remainders of all 4-bit values. */
+static const uint32_t tbxChecksumCrc32Table[16] =
+{
+  TBX_CHECKSUM_LIST16(TBX_CHECKSUM_CRC32_NIBBLE, 0U)
+};
+#elif (TBX_CONF_CHECKSUM_CRC32_METHOD >= TBX_CHECKSUM_CRC_TABLE)
+/** \brief Table with the 32-bit CRC remainders of all 8-bit values. */
+static const uint32_t tbxChecksumCrc32Table[256] =
+{
+  TBX_CHECKSUM_LIST256(TBX_CHECKSUM_CRC32_BYTE)
+};
+#endif
+
+#if defined(TBX_CHECKSUM_CRC16_SLICES)
+/** \brief Tables for processing multiple bytes at a time with the 16-bit CRC. The entry
+ *         at index i of table k holds the 16-bit CRC remainder of value i, followed by
+ *         k zero bytes. Table 0 is the one in ROM. The other ones are generated in RAM.
+ */
+static uint16_t const * tbxChecksumCrc16Slices[TBX_CHECKSUM_CRC16_SLICES];
+
+/** \brief Storage of the tables in RAM for processing multiple bytes at a time with the
+ *         16-bit CRC.
+ */
+static uint16_t tbxChecksumCrc16SlicesRam[TBX_CHECKSUM_CRC16_SLICES - 1U][256];
+
+/** \brief Flag to keep track of whether the tables in RAM were already generated. */
+static volatile uint8_t tbxChecksumCrc16SlicesReady = TBX_FALSE;
+#endif
+
+#if defined(TBX_CHECKSUM_CRC32_SLICES)
+/** \brief Tables for processing multiple bytes at a time with the 32-bit CRC. The entry
+ *         at index i of table k holds the 32-bit CRC remainder of value i, followed by
+ *         k zero bytes. Table 0 is the one in ROM. The other ones are generated in RAM.
+ */
+static uint32_t const * tbxChecksumCrc32Slices[TBX_CHECKSUM_CRC32_SLICES];
+
+/** \brief Storage of the tables in RAM for processing multiple bytes at a time with the
+ *         32-bit CRC.
+ */
+static uint32_t tbxChecksumCrc32SlicesRam[TBX_CHECKSUM_CRC32_SLICES - 1U][256];
+
+/** \brief Flag to keep track of whether the tables in RAM were already generated. */
+static volatile uint8_t tbxChecksumCrc32SlicesReady = TBX_FALSE;
+#endif
+
 
 /************************************************************************************//**
 ** \brief     Calculates a 16-bit CRC value over the specified data.
@@ -101,28 +398,9 @@ uint16_t TbxChecksumCrc16Calculate(uint8_t const * data,
   /* Only continue if the parameters are valid. */
   if ( (data != NULL) && (len > 0U) )
   {
-    /* Set the initial value. */
-    result = TBX_CONF_CHECKSUM_CRC16_INITIAL;
-
-    /* Loop through all data bytes to perform modulo 2 division per byte. */
-    for (size_t byteIdx = 0U; byteIdx < len; byteIdx++)
-    {
-      /* Introduce the next byte into the remainder. */
-      result = result ^ ((uint16_t)data[byteIdx] << 8U);
-      /* Loop through the bits to perform modulo 2 division per bit. */
-      for (uint8_t bitIdx = 0U; bitIdx <= 7U; bitIdx++)
-      {
-        /* Attempt to divide the current bit. */
-        if ((result & 0x8000U) != 0U)
-        {
-          result = ((uint16_t)(result << 1U)) ^ TBX_CONF_CHECKSUM_CRC16_POLYNOM;
-        }
-        else
-        {
-          result = (uint16_t)(result << 1U);
-        }
-      }
-    }
+    /* Set the initial value and process all data bytes. */
+    result = TbxChecksumCrc16Process(TBX_CONF_CHECKSUM_CRC16_INITIAL, data, len,
+                                     TBX_FALSE);
   }
 
   /* Give the result back to the caller. */
@@ -154,33 +432,1147 @@ uint32_t TbxChecksumCrc32Calculate(uint8_t const * data,
   /* Only continue if the parameters are valid. */
   if ( (data != NULL) && (len > 0U) )
   {
+    /* Set the initial value and process all data bytes. */
+    result = TbxChecksumCrc32Process(TBX_CONF_CHECKSUM_CRC32_INITIAL, data, len,
+                                     TBX_FALSE);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumCrc32Calculate ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes the context of a 16-bit CRC calculation that processes its data
+**            in multiple chunks. For example when the data arrives in parts, such as
+**            flash pages, network segments or halves of a DMA buffer. Call
+**            TbxChecksumCrc16Update() for each chunk and TbxChecksumCrc16Final() to
+**            obtain the CRC value.
+** \param     ctx Pointer to the context to initialize.
+** \param     params Parameters of the CRC algorithm. The parameters are copied, so they
+**            do not have to remain valid afterwards. Set it to NULL for the algorithm of
+**            TbxChecksumCrc16Calculate().
+**
+****************************************************************************************/
+void TbxChecksumCrc16Init(tTbxChecksumCrc16               * ctx,
+                          tTbxChecksumCrc16Params   const * params)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    /* Store the parameters of the CRC algorithm. */
+    if (params != NULL)
+    {
+      ctx->params = *params;
+    }
+    else
+    {
+      ctx->params.polynom = TBX_CONF_CHECKSUM_CRC16_POLYNOM;
+      ctx->params.initial = TBX_CONF_CHECKSUM_CRC16_INITIAL;
+      ctx->params.finalXor = 0U;
+      ctx->params.reflectInput = TBX_FALSE;
+      ctx->params.reflectOutput = TBX_FALSE;
+    }
+    /* Set the initial value. */
+    ctx->crc = ctx->params.initial;
+  }
+} /*** end of TbxChecksumCrc16Init ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the next chunk of data of a 16-bit CRC calculation. If the
+**            polynomial of the algorithm is the one configured with
+**            TBX_CONF_CHECKSUM_CRC16_POLYNOM, the calculation uses the method configured
+**            with TBX_CONF_CHECKSUM_CRC16_METHOD. Otherwise it processes one bit at a
+**            time.
+** \param     ctx Pointer to a context that was initialized with TbxChecksumCrc16Init().
+** \param     data Array with the bytes of the chunk.
+** \param     len Number of bytes in the data array. Can be 0.
+**
+****************************************************************************************/
+void TbxChecksumCrc16Update(tTbxChecksumCrc16       * ctx,
+                            uint8_t         const * data,
+                            size_t                  len)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((ctx != NULL) && ((data != NULL) || (len == 0U)));
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && ((data != NULL) || (len == 0U)) )
+  {
+    /* Only process the data, if there is some. */
+    if (len > 0U)
+    {
+      if (ctx->params.polynom == (uint16_t)TBX_CONF_CHECKSUM_CRC16_POLYNOM)
+      {
+        ctx->crc = TbxChecksumCrc16Process(ctx->crc, data, len,
+                                           ctx->params.reflectInput);
+      }
+      else
+      {
+        ctx->crc = TbxChecksumCrc16ProcessBitwise(ctx->crc, ctx->params.polynom, data,
+                                                  len, ctx->params.reflectInput);
+      }
+    }
+  }
+} /*** end of TbxChecksumCrc16Update ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the value of a 16-bit CRC calculation, over all the data that was
+**            processed so far. The context is not changed, so processing more chunks
+**            afterwards is possible.
+** \param     ctx Pointer to a context that was initialized with TbxChecksumCrc16Init().
+** \return    The 16-bit CRC value.
+**
+****************************************************************************************/
+uint16_t TbxChecksumCrc16Final(tTbxChecksumCrc16 const * ctx)
+{
+  uint16_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    result = ctx->crc;
+    /* Reverse the order of the bits of the result, if configured. */
+    if (ctx->params.reflectOutput != TBX_FALSE)
+    {
+      result = (uint16_t)TbxChecksumReflect(result, 16U);
+    }
+    /* Apply the final XOR value. */
+    result ^= ctx->params.finalXor;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumCrc16Final ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes the context of a 32-bit CRC calculation that processes its data
+**            in multiple chunks. For example when the data arrives in parts, such as
+**            flash pages, network segments or halves of a DMA buffer. Call
+**            TbxChecksumCrc32Update() for each chunk and TbxChecksumCrc32Final() to
+**            obtain the CRC value.
+** \param     ctx Pointer to the context to initialize.
+** \param     params Parameters of the CRC algorithm. The parameters are copied, so they
+**            do not have to remain valid afterwards. Set it to NULL for the algorithm of
+**            TbxChecksumCrc32Calculate().
+**
+****************************************************************************************/
+void TbxChecksumCrc32Init(tTbxChecksumCrc32               * ctx,
+                          tTbxChecksumCrc32Params   const * params)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    /* Store the parameters of the CRC algorithm. */
+    if (params != NULL)
+    {
+      ctx->params = *params;
+    }
+    else
+    {
+      ctx->params.polynom = TBX_CONF_CHECKSUM_CRC32_POLYNOM;
+      ctx->params.initial = TBX_CONF_CHECKSUM_CRC32_INITIAL;
+      ctx->params.finalXor = 0U;
+      ctx->params.reflectInput = TBX_FALSE;
+      ctx->params.reflectOutput = TBX_FALSE;
+    }
     /* Set the initial value. */
-    result = TBX_CONF_CHECKSUM_CRC32_INITIAL;
+    ctx->crc = ctx->params.initial;
+  }
+} /*** end of TbxChecksumCrc32Init ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the next chunk of data of a 32-bit CRC calculation. If the
+**            polynomial of the algorithm is the one configured with
+**            TBX_CONF_CHECKSUM_CRC32_POLYNOM, the calculation uses the method configured
+**            with TBX_CONF_CHECKSUM_CRC32_METHOD. Otherwise it processes one bit at a
+**            time.
+** \param     ctx Pointer to a context that was initialized with TbxChecksumCrc32Init().
+** \param     data Array with the bytes of the chunk.
+** \param     len Number of bytes in the data array. Can be 0.
+**
+****************************************************************************************/
+void TbxChecksumCrc32Update(tTbxChecksumCrc32       * ctx,
+                            uint8_t         const * data,
+                            size_t                  len)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((ctx != NULL) && ((data != NULL) || (len == 0U)));
 
-    /* Loop through all data bytes to perform modulo 2 division per byte. */
-    for (size_t byteIdx = 0U; byteIdx < len; byteIdx++)
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && ((data != NULL) || (len == 0U)) )
+  {
+    /* Only process the data, if there is some. */
+    if (len > 0U)
     {
-      /* Introduce the next byte into the remainder. */
-      result = result ^ ((uint32_t)data[byteIdx] << 24U);
-      /* Loop through the bits to perform modulo 2 division per bit. */
-      for (uint8_t bitIdx = 0U; bitIdx <= 7U; bitIdx++)
+      if (ctx->params.polynom == (uint32_t)TBX_CONF_CHECKSUM_CRC32_POLYNOM)
+      {
+        ctx->crc = TbxChecksumCrc32Process(ctx->crc, data, len,
+                                           ctx->params.reflectInput);
+      }
+      else
       {
-        /* Attempt to divide the current bit. */
-        if ((result & 0x80000000UL) != 0U)
-        {
-          result = ((uint32_t)(result << 1U)) ^ TBX_CONF_CHECKSUM_CRC32_POLYNOM;
-        }
-        else
-        {
-          result = (uint32_t)(result << 1U);
-        }
+        ctx->crc = TbxChecksumCrc32ProcessBitwise(ctx->crc, ctx->params.polynom, data,
+                                                  len, ctx->params.reflectInput);
       }
     }
   }
+} /*** end of TbxChecksumCrc32Update ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the value of a 32-bit CRC calculation, over all the data that was
+**            processed so far. The context is not changed, so processing more chunks
+**            afterwards is possible.
+** \param     ctx Pointer to a context that was initialized with TbxChecksumCrc32Init().
+** \return    The 32-bit CRC value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumCrc32Final(tTbxChecksumCrc32 const * ctx)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    result = ctx->crc;
+    /* Reverse the order of the bits of the result, if configured. */
+    if (ctx->params.reflectOutput != TBX_FALSE)
+    {
+      result = (uint32_t)TbxChecksumReflect(result, 32U);
+    }
+    /* Apply the final XOR value. */
+    result ^= ctx->params.finalXor;
+  }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxChecksumCrc32Calculate ***/
+} /*** end of TbxChecksumCrc32Final ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates a Fletcher-32 checksum over the specified data. It is much
+**            faster than a CRC, but detects fewer error patterns. The data is processed
+**            as 16-bit little endian words. An odd number of bytes is padded with a zero
+**            byte.
+** \param     data Array with bytes over which the checksum should be calculated.
+** \param     len Number of bytes in the data array.
+** \return    The Fletcher-32 checksum value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumFletcher32Calculate(uint8_t const * data,
+                                        size_t          len)
+{
+  uint32_t               result = 0U;
+  tTbxChecksumFletcher32 ctx;
+
+  /* Verify parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ( (data != NULL) && (len > 0U) )
+  {
+    /* Process all data bytes in one chunk. */
+    TbxChecksumFletcher32Init(&ctx);
+    TbxChecksumFletcher32Update(&ctx, data, len);
+    result = TbxChecksumFletcher32Final(&ctx);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumFletcher32Calculate ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes the context of a Fletcher-32 checksum calculation that processes
+**            its data in multiple chunks. Call TbxChecksumFletcher32Update() for each
+**            chunk and TbxChecksumFletcher32Final() to obtain the checksum value.
+** \param     ctx Pointer to the context to initialize.
+**
+****************************************************************************************/
+void TbxChecksumFletcher32Init(tTbxChecksumFletcher32 * ctx)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    ctx->sum1 = 0U;
+    ctx->sum2 = 0U;
+    ctx->pendingByte = 0U;
+    ctx->pendingValid = TBX_FALSE;
+  }
+} /*** end of TbxChecksumFletcher32Init ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the next chunk of data of a Fletcher-32 checksum calculation. The
+**            chunks do not have to hold an even number of bytes.
+** \param     ctx Pointer to a context that was initialized with
+**            TbxChecksumFletcher32Init().
+** \param     data Array with the bytes of the chunk.
+** \param     len Number of bytes in the data array. Can be 0.
+**
+****************************************************************************************/
+void TbxChecksumFletcher32Update(tTbxChecksumFletcher32       * ctx,
+                                 uint8_t                const * data,
+                                 size_t                         len)
+{
+  size_t   byteIdx = 0U;
+  size_t   numWords;
+  uint32_t sum1;
+  uint32_t sum2;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ctx != NULL) && ((data != NULL) || (len == 0U)));
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (len > 0U) && (data != NULL) )
+  {
+    sum1 = ctx->sum1;
+    sum2 = ctx->sum2;
+    /* Complete the data word of the byte that the last chunk ended with. */
+    if (ctx->pendingValid != TBX_FALSE)
+    {
+      sum1 = (sum1 + ((uint32_t)ctx->pendingByte | ((uint32_t)data[0] << 8U))) %
+             TBX_CHECKSUM_FLETCHER32_MOD;
+      sum2 = (sum2 + sum1) % TBX_CHECKSUM_FLETCHER32_MOD;
+      ctx->pendingValid = TBX_FALSE;
+      byteIdx = 1U;
+    }
+    /* Add the data words in blocks. The modulo only needs to be taken after each block,
+     * because the sums cannot overflow before that.
+     */
+    while ((len - byteIdx) >= 2U)
+    {
+      numWords = (len - byteIdx) / 2U;
+      if (numWords > TBX_CHECKSUM_FLETCHER32_MAX_WORDS)
+      {
+        numWords = TBX_CHECKSUM_FLETCHER32_MAX_WORDS;
+      }
+      for (size_t wordIdx = 0U; wordIdx < numWords; wordIdx++)
+      {
+        sum1 += TBX_CHECKSUM_READ16(&data[byteIdx]);
+        sum2 += sum1;
+        byteIdx += 2U;
+      }
+      sum1 %= TBX_CHECKSUM_FLETCHER32_MOD;
+      sum2 %= TBX_CHECKSUM_FLETCHER32_MOD;
+    }
+    /* Keep an odd byte at the end, until the next chunk or the final step. */
+    if (byteIdx < len)
+    {
+      ctx->pendingByte = data[byteIdx];
+      ctx->pendingValid = TBX_TRUE;
+    }
+    ctx->sum1 = sum1;
+    ctx->sum2 = sum2;
+  }
+} /*** end of TbxChecksumFletcher32Update ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the value of a Fletcher-32 checksum calculation, over all the data
+**            that was processed so far. The context is not changed, so processing more
+**            chunks afterwards is possible.
+** \param     ctx Pointer to a context that was initialized with
+**            TbxChecksumFletcher32Init().
+** \return    The Fletcher-32 checksum value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumFletcher32Final(tTbxChecksumFletcher32 const * ctx)
+{
+  uint32_t result = 0U;
+  uint32_t sum1;
+  uint32_t sum2;
+
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    sum1 = ctx->sum1;
+    sum2 = ctx->sum2;
+    /* Pad an odd byte at the end with a zero byte. */
+    if (ctx->pendingValid != TBX_FALSE)
+    {
+      sum1 = (sum1 + ctx->pendingByte) % TBX_CHECKSUM_FLETCHER32_MOD;
+      sum2 = (sum2 + sum1) % TBX_CHECKSUM_FLETCHER32_MOD;
+    }
+    result = (sum2 << 16U) | sum1;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumFletcher32Final ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates an Adler-32 checksum over the specified data, as used by zlib. It
+**            is much faster than a CRC, but detects fewer error patterns.
+** \param     data Array with bytes over which the checksum should be calculated.
+** \param     len Number of bytes in the data array.
+** \return    The Adler-32 checksum value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumAdler32Calculate(uint8_t const * data,
+                                     size_t          len)
+{
+  uint32_t            result = 0U;
+  tTbxChecksumAdler32 ctx;
+
+  /* Verify parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ( (data != NULL) && (len > 0U) )
+  {
+    /* Process all data bytes in one chunk. */
+    TbxChecksumAdler32Init(&ctx);
+    TbxChecksumAdler32Update(&ctx, data, len);
+    result = TbxChecksumAdler32Final(&ctx);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumAdler32Calculate ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes the context of an Adler-32 checksum calculation that processes
+**            its data in multiple chunks. Call TbxChecksumAdler32Update() for each chunk
+**            and TbxChecksumAdler32Final() to obtain the checksum value.
+** \param     ctx Pointer to the context to initialize.
+**
+****************************************************************************************/
+void TbxChecksumAdler32Init(tTbxChecksumAdler32 * ctx)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    ctx->sumA = 1U;
+    ctx->sumB = 0U;
+  }
+} /*** end of TbxChecksumAdler32Init ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the next chunk of data of an Adler-32 checksum calculation.
+** \param     ctx Pointer to a context that was initialized with TbxChecksumAdler32Init().
+** \param     data Array with the bytes of the chunk.
+** \param     len Number of bytes in the data array. Can be 0.
+**
+****************************************************************************************/
+void TbxChecksumAdler32Update(tTbxChecksumAdler32       * ctx,
+                              uint8_t             const * data,
+                              size_t                      len)
+{
+  size_t   byteIdx = 0U;
+  size_t   blockEnd;
+  uint32_t sumA;
+  uint32_t sumB;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ctx != NULL) && ((data != NULL) || (len == 0U)));
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (len > 0U) && (data != NULL) )
+  {
+    sumA = ctx->sumA;
+    sumB = ctx->sumB;
+    /* Add the data bytes in blocks. The modulo only needs to be taken after each block,
+     * because the sums cannot overflow before that.
+     */
+    while (byteIdx < len)
+    {
+      blockEnd = byteIdx + TBX_CHECKSUM_ADLER32_MAX_BYTES;
+      if (blockEnd > len)
+      {
+        blockEnd = len;
+      }
+      /* Add four bytes at a time. Each byte contributes to sumB once for each of the
+       * remaining bytes of the group, which shortens the chain of dependent additions.
+       */
+      for (; (blockEnd - byteIdx) >= 4U; byteIdx += 4U)
+      {
+        sumB += (4U * sumA) + (4U * (uint32_t)data[byteIdx]) +
+                (3U * (uint32_t)data[byteIdx + 1U]) +
+                (2U * (uint32_t)data[byteIdx + 2U]) + (uint32_t)data[byteIdx + 3U];
+        sumA += (uint32_t)data[byteIdx] + (uint32_t)data[byteIdx + 1U] +
+                (uint32_t)data[byteIdx + 2U] + (uint32_t)data[byteIdx + 3U];
+      }
+      for (; byteIdx < blockEnd; byteIdx++)
+      {
+        sumA += data[byteIdx];
+        sumB += sumA;
+      }
+      sumA %= TBX_CHECKSUM_ADLER32_MOD;
+      sumB %= TBX_CHECKSUM_ADLER32_MOD;
+    }
+    ctx->sumA = sumA;
+    ctx->sumB = sumB;
+  }
+} /*** end of TbxChecksumAdler32Update ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the value of an Adler-32 checksum calculation, over all the data
+**            that was processed so far. The context is not changed, so processing more
+**            chunks afterwards is possible.
+** \param     ctx Pointer to a context that was initialized with TbxChecksumAdler32Init().
+** \return    The Adler-32 checksum value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumAdler32Final(tTbxChecksumAdler32 const * ctx)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    result = (ctx->sumB << 16U) | ctx->sumA;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumAdler32Final ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates an xxHash32 hash value over the specified data. It processes 16
+**            bytes at a time, which makes it the fastest of the integrity checks in this
+**            module. Note that it is not a cryptographic hash.
+** \param     data Array with bytes over which the hash should be calculated.
+** \param     len Number of bytes in the data array.
+** \param     seed Seed of the hash calculation. Use 0 for the reference hash values.
+** \return    The xxHash32 hash value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumXxHash32Calculate(uint8_t const * data,
+                                      size_t          len,
+                                      uint32_t        seed)
+{
+  uint32_t             result = 0U;
+  tTbxChecksumXxHash32 ctx;
+
+  /* Verify parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ( (data != NULL) && (len > 0U) )
+  {
+    /* Process all data bytes in one chunk. */
+    TbxChecksumXxHash32Init(&ctx, seed);
+    TbxChecksumXxHash32Update(&ctx, data, len);
+    result = TbxChecksumXxHash32Final(&ctx);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumXxHash32Calculate ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes the context of an xxHash32 hash calculation that processes its
+**            data in multiple chunks. Call TbxChecksumXxHash32Update() for each chunk and
+**            TbxChecksumXxHash32Final() to obtain the hash value.
+** \param     ctx Pointer to the context to initialize.
+** \param     seed Seed of the hash calculation. Use 0 for the reference hash values.
+**
+****************************************************************************************/
+void TbxChecksumXxHash32Init(tTbxChecksumXxHash32 * ctx,
+                             uint32_t               seed)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    ctx->acc[0] = seed + TBX_CHECKSUM_XXHASH32_PRIME1 + TBX_CHECKSUM_XXHASH32_PRIME2;
+    ctx->acc[1] = seed + TBX_CHECKSUM_XXHASH32_PRIME2;
+    ctx->acc[2] = seed;
+    ctx->acc[3] = seed - TBX_CHECKSUM_XXHASH32_PRIME1;
+    ctx->totalLen = 0U;
+    ctx->largeLen = TBX_FALSE;
+    ctx->bufferLen = 0U;
+    ctx->seed = seed;
+  }
+} /*** end of TbxChecksumXxHash32Init ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the next chunk of data of an xxHash32 hash calculation.
+** \param     ctx Pointer to a context that was initialized with
+**            TbxChecksumXxHash32Init().
+** \param     data Array with the bytes of the chunk.
+** \param     len Number of bytes in the data array. Can be 0.
+**
+****************************************************************************************/
+void TbxChecksumXxHash32Update(tTbxChecksumXxHash32       * ctx,
+                               uint8_t              const * data,
+                               size_t                       len)
+{
+  size_t byteIdx = 0U;
+  size_t numStripes;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ctx != NULL) && ((data != NULL) || (len == 0U)));
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (len > 0U) && (data != NULL) )
+  {
+    ctx->totalLen += (uint32_t)len;
+    /* First complete the stripe in the buffer, if it holds data bytes. */
+    if (ctx->bufferLen > 0U)
+    {
+      for (; (byteIdx < len) && (ctx->bufferLen < TBX_CHECKSUM_XXHASH32_STRIPE);
+           byteIdx++)
+      {
+        ctx->buffer[ctx->bufferLen] = data[byteIdx];
+        ctx->bufferLen++;
+      }
+      if (ctx->bufferLen == TBX_CHECKSUM_XXHASH32_STRIPE)
+      {
+        TbxChecksumXxHash32Stripes(ctx->acc, ctx->buffer, 1U);
+        ctx->largeLen = TBX_TRUE;
+        ctx->bufferLen = 0U;
+      }
+    }
+    /* Process the complete stripes directly from the data. */
+    numStripes = (len - byteIdx) / TBX_CHECKSUM_XXHASH32_STRIPE;
+    if (numStripes > 0U)
+    {
+      TbxChecksumXxHash32Stripes(ctx->acc, &data[byteIdx], numStripes);
+      ctx->largeLen = TBX_TRUE;
+      byteIdx += numStripes * TBX_CHECKSUM_XXHASH32_STRIPE;
+    }
+    /* Keep the remaining bytes in the buffer, until the next chunk or the final step. */
+    for (; byteIdx < len; byteIdx++)
+    {
+      ctx->buffer[ctx->bufferLen] = data[byteIdx];
+      ctx->bufferLen++;
+    }
+  }
+} /*** end of TbxChecksumXxHash32Update ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the value of an xxHash32 hash calculation, over all the data that
+**            was processed so far. The context is not changed, so processing more chunks
+**            afterwards is possible.
+** \param     ctx Pointer to a context that was initialized with
+**            TbxChecksumXxHash32Init().
+** \return    The xxHash32 hash value.
+**
+****************************************************************************************/
+uint32_t TbxChecksumXxHash32Final(tTbxChecksumXxHash32 const * ctx)
+{
+  uint32_t result = 0U;
+  uint8_t  byteIdx = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ctx != NULL)
+  {
+    /* Merge the accumulators, if at least one stripe was processed. */
+    if (ctx->largeLen != TBX_FALSE)
+    {
+      result = TBX_CHECKSUM_ROTL32(ctx->acc[0], 1U) +
+               TBX_CHECKSUM_ROTL32(ctx->acc[1], 7U) +
+               TBX_CHECKSUM_ROTL32(ctx->acc[2], 12U) +
+               TBX_CHECKSUM_ROTL32(ctx->acc[3], 18U);
+    }
+    else
+    {
+      result = ctx->seed + TBX_CHECKSUM_XXHASH32_PRIME5;
+    }
+    result += ctx->totalLen;
+    /* Mix in the remaining bytes in the buffer, four at a time and then one at a time. */
+    for (; (byteIdx + 4U) <= ctx->bufferLen; byteIdx += 4U)
+    {
+      result += TBX_CHECKSUM_READ32(&ctx->buffer[byteIdx]) * TBX_CHECKSUM_XXHASH32_PRIME3;
+      result = TBX_CHECKSUM_ROTL32(result, 17U) * TBX_CHECKSUM_XXHASH32_PRIME4;
+    }
+    for (; byteIdx < ctx->bufferLen; byteIdx++)
+    {
+      result += (uint32_t)ctx->buffer[byteIdx] * TBX_CHECKSUM_XXHASH32_PRIME5;
+      result = TBX_CHECKSUM_ROTL32(result, 11U) * TBX_CHECKSUM_XXHASH32_PRIME1;
+    }
+    /* Let each input bit affect all output bits. */
+    result ^= result >> 15U;
+    result *= TBX_CHECKSUM_XXHASH32_PRIME2;
+    result ^= result >> 13U;
+    result *= TBX_CHECKSUM_XXHASH32_PRIME3;
+    result ^= result >> 16U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumXxHash32Final ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the specified data bytes with the 16-bit CRC and the polynomial
+**            configured with TBX_CONF_CHECKSUM_CRC16_POLYNOM, using the method
+**            configured with TBX_CONF_CHECKSUM_CRC16_METHOD.
+** \details   The first call generates the tables in RAM, if the method needs them.
+**            The flag that marks them as ready is published and read with a
+**            memory barrier, so the function can be called from any context.
+** \param     crc The current 16-bit CRC remainder.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \return    The updated 16-bit CRC remainder.
+**
+****************************************************************************************/
+static uint16_t TbxChecksumCrc16Process(uint16_t        crc,
+                                       uint8_t const * data,
+                                       size_t          len,
+                                       uint8_t         reflect)
+{
+#if (TBX_CONF_CHECKSUM_CRC16_METHOD == TBX_CHECKSUM_CRC_BITWISE)
+  /* Process one bit at a time. */
+  return TbxChecksumCrc16ProcessBitwise(crc, TBX_CONF_CHECKSUM_CRC16_POLYNOM, data, len,
+                                        reflect);
+#else
+  uint16_t result = crc;
+  size_t   byteIdx = 0U;
+  uint8_t  dataByte;
+#if defined(TBX_CHECKSUM_CRC16_SLICES)
+  uint16_t remainder;
+#endif
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+  /* Let the port process the leading bytes, if the CPU can do so faster. */
+  byteIdx = TbxPortCrc16Process(&result, (uint16_t)TBX_CONF_CHECKSUM_CRC16_POLYNOM,
+                                reflect, data, len);
+#endif
+#if defined(TBX_CHECKSUM_CRC16_SLICES)
+  /* Generate the tables in RAM, if not yet done. Otherwise make sure the tables are
+   * read after the flag, to pair with the memory barrier before the flag was set.
+   */
+  if (tbxChecksumCrc16SlicesReady == TBX_FALSE)
+  {
+    TbxChecksumCrc16SlicesInit();
+  }
+  else
+  {
+    TbxPortMemoryBarrier();
+  }
+  /* Process as many data bytes as possible, multiple bytes at a time. */
+  while ((len - byteIdx) >= TBX_CHECKSUM_CRC16_SLICES)
+  {
+    /* Introduce the first two bytes into the remainder. The bytes that follow, each
+     * look up their contribution in the table that matches their distance from the
+     * last byte.
+     */
+    remainder = result ^ (uint16_t)(((uint16_t)TBX_CHECKSUM_INPUT(data[byteIdx],
+                                                                  reflect) << 8U) |
+                                    (uint16_t)TBX_CHECKSUM_INPUT(data[byteIdx + 1U],
+                                                                 reflect));
+    result = tbxChecksumCrc16Slices[TBX_CHECKSUM_CRC16_SLICES - 1U][remainder >> 8U] ^
+             tbxChecksumCrc16Slices[TBX_CHECKSUM_CRC16_SLICES - 2U][remainder & 0xFFU];
+    for (uint8_t sliceIdx = 2U; sliceIdx < TBX_CHECKSUM_CRC16_SLICES; sliceIdx++)
+    {
+      result ^= tbxChecksumCrc16Slices[TBX_CHECKSUM_CRC16_SLICES - 1U - sliceIdx]
+                                      [TBX_CHECKSUM_INPUT(data[byteIdx + sliceIdx],
+                                                          reflect)];
+    }
+    byteIdx += TBX_CHECKSUM_CRC16_SLICES;
+  }
+#endif
+
+  /* Loop through all remaining data bytes to perform modulo 2 division per byte. */
+  for (; byteIdx < len; byteIdx++)
+  {
+    dataByte = TBX_CHECKSUM_INPUT(data[byteIdx], reflect);
+#if (TBX_CONF_CHECKSUM_CRC16_METHOD == TBX_CHECKSUM_CRC_NIBBLE)
+    /* Divide the high nibble and then the low nibble, with the help of the table. */
+    result = (uint16_t)(result << 4U) ^
+             tbxChecksumCrc16Table[((result >> 12U) ^ (uint16_t)(dataByte >> 4U)) &
+                                   0x0FU];
+    result = (uint16_t)(result << 4U) ^
+             tbxChecksumCrc16Table[((result >> 12U) ^ (uint16_t)dataByte) & 0x0FU];
+#else
+    /* Divide the byte with the help of the table. */
+    result = (uint16_t)(result << 8U) ^
+             tbxChecksumCrc16Table[((result >> 8U) ^ (uint16_t)dataByte) & 0xFFU];
+#endif
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+#endif
+} /*** end of TbxChecksumCrc16Process ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the specified data bytes with the 16-bit CRC, one bit at a time.
+**            Needed for the polynomials that the tables were not generated for.
+** \param     crc The current 16-bit CRC remainder.
+** \param     polynom Polynomial of the CRC algorithm.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \return    The updated 16-bit CRC remainder.
+**
+****************************************************************************************/
+static uint16_t TbxChecksumCrc16ProcessBitwise(uint16_t        crc,
+                                              uint16_t        polynom,
+                                              uint8_t const * data,
+                                              size_t          len,
+                                              uint8_t         reflect)
+{
+  uint16_t result = crc;
+  size_t   byteIdx = 0U;
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+  /* Let the port process the leading bytes, if the CPU can do so faster. */
+  byteIdx = TbxPortCrc16Process(&result, polynom, reflect, data, len);
+#endif
+  /* Loop through all remaining data bytes to perform modulo 2 division per byte. */
+  for (; byteIdx < len; byteIdx++)
+  {
+    /* Introduce the next byte into the remainder. */
+    result = result ^ ((uint16_t)TBX_CHECKSUM_INPUT(data[byteIdx], reflect) << 8U);
+    /* Loop through the bits to perform modulo 2 division per bit. */
+    for (uint8_t bitIdx = 0U; bitIdx <= 7U; bitIdx++)
+    {
+      /* Attempt to divide the current bit. */
+      if ((result & 0x8000U) != 0U)
+      {
+        result = ((uint16_t)(result << 1U)) ^ polynom;
+      }
+      else
+      {
+        result = (uint16_t)(result << 1U);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumCrc16ProcessBitwise ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the specified data bytes with the 32-bit CRC and the polynomial
+**            configured with TBX_CONF_CHECKSUM_CRC32_POLYNOM, using the method
+**            configured with TBX_CONF_CHECKSUM_CRC32_METHOD.
+** \details   The first call generates the tables in RAM, if the method needs them.
+**            The flag that marks them as ready is published and read with a
+**            memory barrier, so the function can be called from any context.
+** \param     crc The current 32-bit CRC remainder.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \return    The updated 32-bit CRC remainder.
+**
+****************************************************************************************/
+static uint32_t TbxChecksumCrc32Process(uint32_t        crc,
+                                       uint8_t const * data,
+                                       size_t          len,
+                                       uint8_t         reflect)
+{
+#if (TBX_CONF_CHECKSUM_CRC32_METHOD == TBX_CHECKSUM_CRC_BITWISE)
+  /* Process one bit at a time. */
+  return TbxChecksumCrc32ProcessBitwise(crc, TBX_CONF_CHECKSUM_CRC32_POLYNOM, data, len,
+                                        reflect);
+#else
+  uint32_t result = crc;
+  size_t   byteIdx = 0U;
+  uint8_t  dataByte;
+#if defined(TBX_CHECKSUM_CRC32_SLICES)
+  uint32_t remainder;
+#endif
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+  /* Let the port process the leading bytes, if the CPU can do so faster. */
+  byteIdx = TbxPortCrc32Process(&result, (uint32_t)TBX_CONF_CHECKSUM_CRC32_POLYNOM,
+                                reflect, data, len);
+#endif
+#if defined(TBX_CHECKSUM_CRC32_SLICES)
+  /* Generate the tables in RAM, if not yet done. Otherwise make sure the tables are
+   * read after the flag, to pair with the memory barrier before the flag was set.
+   */
+  if (tbxChecksumCrc32SlicesReady == TBX_FALSE)
+  {
+    TbxChecksumCrc32SlicesInit();
+  }
+  else
+  {
+    TbxPortMemoryBarrier();
+  }
+  /* Process as many data bytes as possible, multiple bytes at a time. */
+  while ((len - byteIdx) >= TBX_CHECKSUM_CRC32_SLICES)
+  {
+    /* Introduce the first four bytes into the remainder. The bytes that follow, each
+     * look up their contribution in the table that matches their distance from the
+     * last byte.
+     */
+    remainder = result ^
+                (((uint32_t)TBX_CHECKSUM_INPUT(data[byteIdx], reflect) << 24U) |
+                 ((uint32_t)TBX_CHECKSUM_INPUT(data[byteIdx + 1U], reflect) << 16U) |
+                 ((uint32_t)TBX_CHECKSUM_INPUT(data[byteIdx + 2U], reflect) << 8U) |
+                 (uint32_t)TBX_CHECKSUM_INPUT(data[byteIdx + 3U], reflect));
+    result = tbxChecksumCrc32Slices[TBX_CHECKSUM_CRC32_SLICES - 1U][remainder >> 24U] ^
+             tbxChecksumCrc32Slices[TBX_CHECKSUM_CRC32_SLICES - 2U]
+                                   [(remainder >> 16U) & 0xFFU] ^
+             tbxChecksumCrc32Slices[TBX_CHECKSUM_CRC32_SLICES - 3U]
+                                   [(remainder >> 8U) & 0xFFU] ^
+             tbxChecksumCrc32Slices[TBX_CHECKSUM_CRC32_SLICES - 4U][remainder & 0xFFU];
+    for (uint8_t sliceIdx = 4U; sliceIdx < TBX_CHECKSUM_CRC32_SLICES; sliceIdx++)
+    {
+      result ^= tbxChecksumCrc32Slices[TBX_CHECKSUM_CRC32_SLICES - 1U - sliceIdx]
+                                      [TBX_CHECKSUM_INPUT(data[byteIdx + sliceIdx],
+                                                          reflect)];
+    }
+    byteIdx += TBX_CHECKSUM_CRC32_SLICES;
+  }
+#endif
+
+  /* Loop through all remaining data bytes to perform modulo 2 division per byte. */
+  for (; byteIdx < len; byteIdx++)
+  {
+    dataByte = TBX_CHECKSUM_INPUT(data[byteIdx], reflect);
+#if (TBX_CONF_CHECKSUM_CRC32_METHOD == TBX_CHECKSUM_CRC_NIBBLE)
+    /* Divide the high nibble and then the low nibble, with the help of the table. */
+    result = (uint32_t)(result << 4U) ^
+             tbxChecksumCrc32Table[((result >> 28U) ^ (uint32_t)(dataByte >> 4U)) &
+                                   0x0FU];
+    result = (uint32_t)(result << 4U) ^
+             tbxChecksumCrc32Table[((result >> 28U) ^ (uint32_t)dataByte) & 0x0FU];
+#else
+    /* Divide the byte with the help of the table. */
+    result = (uint32_t)(result << 8U) ^
+             tbxChecksumCrc32Table[((result >> 24U) ^ (uint32_t)dataByte) & 0xFFU];
+#endif
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+#endif
+} /*** end of TbxChecksumCrc32Process ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the specified data bytes with the 32-bit CRC, one bit at a time.
+**            Needed for the polynomials that the tables were not generated for.
+** \param     crc The current 32-bit CRC remainder.
+** \param     polynom Polynomial of the CRC algorithm.
+** \param     data Array with bytes to process.
+** \param     len Number of bytes in the data array.
+** \param     reflect TBX_TRUE to process the bits of each data byte starting with the
+**            lowest bit, TBX_FALSE to start with the highest bit.
+** \return    The updated 32-bit CRC remainder.
+**
+****************************************************************************************/
+static uint32_t TbxChecksumCrc32ProcessBitwise(uint32_t        crc,
+                                              uint32_t        polynom,
+                                              uint8_t const * data,
+                                              size_t          len,
+                                              uint8_t         reflect)
+{
+  uint32_t result = crc;
+  size_t   byteIdx = 0U;
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+  /* Let the port process the leading bytes, if the CPU can do so faster. */
+  byteIdx = TbxPortCrc32Process(&result, polynom, reflect, data, len);
+#endif
+  /* Loop through all remaining data bytes to perform modulo 2 division per byte. */
+  for (; byteIdx < len; byteIdx++)
+  {
+    /* Introduce the next byte into the remainder. */
+    result = result ^ ((uint32_t)TBX_CHECKSUM_INPUT(data[byteIdx], reflect) << 24U);
+    /* Loop through the bits to perform modulo 2 division per bit. */
+    for (uint8_t bitIdx = 0U; bitIdx <= 7U; bitIdx++)
+    {
+      /* Attempt to divide the current bit. */
+      if ((result & 0x80000000UL) != 0U)
+      {
+        result = ((uint32_t)(result << 1U)) ^ polynom;
+      }
+      else
+      {
+        result = (uint32_t)(result << 1U);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumCrc32ProcessBitwise ***/
+
+
+/************************************************************************************//**
+** \brief     Reverses the order of the lowest bits of a value.
+** \param     value The value to reflect.
+** \param     numBits Number of low bits to reverse.
+** \return    The reflected value.
+**
+****************************************************************************************/
+static uint32_t TbxChecksumReflect(uint32_t value,
+                                   uint8_t  numBits)
+{
+  uint32_t result = 0U;
+
+  /* Move the bits one at a time, from the low end of the value to the low end of the
+   * result.
+   */
+  for (uint8_t bitIdx = 0U; bitIdx < numBits; bitIdx++)
+  {
+    result = (result << 1U) | ((value >> bitIdx) & 0x01U);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxChecksumReflect ***/
+
+
+/************************************************************************************//**
+** \brief     Processes complete 16-byte stripes with the xxHash32 accumulators. Each of
+**            the four accumulators processes one 32-bit word of each stripe, such that
+**            the CPU can perform their calculations in parallel.
+** \param     acc Array with the four accumulators.
+** \param     data Array with the bytes of the stripes.
+** \param     numStripes Number of stripes in the data array.
+**
+****************************************************************************************/
+static void TbxChecksumXxHash32Stripes(uint32_t        acc[],
+                                       uint8_t const * data,
+                                       size_t          numStripes)
+{
+  uint32_t acc0 = acc[0];
+  uint32_t acc1 = acc[1];
+  uint32_t acc2 = acc[2];
+  uint32_t acc3 = acc[3];
+  size_t   byteIdx = 0U;
+
+  /* Process the stripes, keeping the accumulators in local variables. */
+  for (size_t stripeIdx = 0U; stripeIdx < numStripes; stripeIdx++)
+  {
+    acc0 += TBX_CHECKSUM_READ32(&data[byteIdx]) * TBX_CHECKSUM_XXHASH32_PRIME2;
+    acc0 = TBX_CHECKSUM_ROTL32(acc0, 13U) * TBX_CHECKSUM_XXHASH32_PRIME1;
+    acc1 += TBX_CHECKSUM_READ32(&data[byteIdx + 4U]) * TBX_CHECKSUM_XXHASH32_PRIME2;
+    acc1 = TBX_CHECKSUM_ROTL32(acc1, 13U) * TBX_CHECKSUM_XXHASH32_PRIME1;
+    acc2 += TBX_CHECKSUM_READ32(&data[byteIdx + 8U]) * TBX_CHECKSUM_XXHASH32_PRIME2;
+    acc2 = TBX_CHECKSUM_ROTL32(acc2, 13U) * TBX_CHECKSUM_XXHASH32_PRIME1;
+    acc3 += TBX_CHECKSUM_READ32(&data[byteIdx + 12U]) * TBX_CHECKSUM_XXHASH32_PRIME2;
+    acc3 = TBX_CHECKSUM_ROTL32(acc3, 13U) * TBX_CHECKSUM_XXHASH32_PRIME1;
+    byteIdx += TBX_CHECKSUM_XXHASH32_STRIPE;
+  }
+  acc[0] = acc0;
+  acc[1] = acc1;
+  acc[2] = acc2;
+  acc[3] = acc3;
+} /*** end of TbxChecksumXxHash32Stripes ***/
+
+
+#if defined(TBX_CHECKSUM_CRC16_SLICES)
+/************************************************************************************//**
+** \brief     Generates the tables in RAM for processing multiple bytes at a time with
+**            the 16-bit CRC. Each entry is derived from the entry at the same index in
+**            the previous table, by dividing it by one more zero byte. Multiple
+**            contexts that call this function at the same time, simply write the same
+**            values. No locking is therefore needed. The tables are only flagged as
+**            ready after a memory barrier. Readers that find the flag set, must
+**            perform a memory barrier as well, before they read the tables.
+**
+****************************************************************************************/
+static void TbxChecksumCrc16SlicesInit(void)
+{
+  uint16_t remainder;
+
+  /* Link the table in ROM and the ones in RAM. */
+  tbxChecksumCrc16Slices[0U] = tbxChecksumCrc16Table;
+  for (uint8_t sliceIdx = 1U; sliceIdx < TBX_CHECKSUM_CRC16_SLICES; sliceIdx++)
+  {
+    tbxChecksumCrc16Slices[sliceIdx] = tbxChecksumCrc16SlicesRam[sliceIdx - 1U];
+  }
+  /* Generate the entries of the tables in RAM. */
+  for (size_t entryIdx = 0U; entryIdx < 256U; entryIdx++)
+  {
+    remainder = tbxChecksumCrc16Table[entryIdx];
+    for (uint8_t sliceIdx = 1U; sliceIdx < TBX_CHECKSUM_CRC16_SLICES; sliceIdx++)
+    {
+      remainder = (uint16_t)(remainder << 8U) ^ tbxChecksumCrc16Table[remainder >> 8U];
+      tbxChecksumCrc16SlicesRam[sliceIdx - 1U][entryIdx] = remainder;
+    }
+  }
+  /* Make sure the tables are completely written, before flagging them as ready. */
+  TbxPortMemoryBarrier();
+  tbxChecksumCrc16SlicesReady = TBX_TRUE;
+} /*** end of TbxChecksumCrc16SlicesInit ***/
+#endif
+
+
+#if defined(TBX_CHECKSUM_CRC32_SLICES)
+/************************************************************************************//**
+** \brief     Generates the tables in RAM for processing multiple bytes at a time with
+**            the 32-bit CRC. Each entry is derived from the entry at the same index in
+**            the previous table, by dividing it by one more zero byte. Multiple
+**            contexts that call this function at the same time, simply write the same
+**            values. No locking is therefore needed. The tables are only flagged as
+**            ready after a memory barrier. Readers that find the flag set, must
+**            perform a memory barrier as well, before they read the tables.
+**
+****************************************************************************************/
+static void TbxChecksumCrc32SlicesInit(void)
+{
+  uint32_t remainder;
+
+  /* Link the table in ROM and the ones in RAM. */
+  tbxChecksumCrc32Slices[0U] = tbxChecksumCrc32Table;
+  for (uint8_t sliceIdx = 1U; sliceIdx < TBX_CHECKSUM_CRC32_SLICES; sliceIdx++)
+  {
+    tbxChecksumCrc32Slices[sliceIdx] = tbxChecksumCrc32SlicesRam[sliceIdx - 1U];
+  }
+  /* Generate the entries of the tables in RAM. */
+  for (size_t entryIdx = 0U; entryIdx < 256U; entryIdx++)
+  {
+    remainder = tbxChecksumCrc32Table[entryIdx];
+    for (uint8_t sliceIdx = 1U; sliceIdx < TBX_CHECKSUM_CRC32_SLICES; sliceIdx++)
+    {
+      remainder = (uint32_t)(remainder << 8U) ^ tbxChecksumCrc32Table[remainder >> 24U];
+      tbxChecksumCrc32SlicesRam[sliceIdx - 1U][entryIdx] = remainder;
+    }
+  }
+  /* Make sure the tables are completely written, before flagging them as ready. */
+  TbxPortMemoryBarrier();
+  tbxChecksumCrc32SlicesReady = TBX_TRUE;
+} /*** end of TbxChecksumCrc32SlicesInit ***/
+#endif
 
 
 /*********************************** end of tbx_checksum.c *****************************/
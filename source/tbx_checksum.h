@@ -39,6 +39,199 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief CRC calculation method that processes one bit at a time. It needs no table,
+ *         but it is the slowest one.
+ */
+#define TBX_CHECKSUM_CRC_BITWISE                 (0U)
+
+/** \brief CRC calculation method that processes four bits at a time, with the help of a
+ *         16-entry table in ROM.
+ */
+#define TBX_CHECKSUM_CRC_NIBBLE                  (1U)
+
+/** \brief CRC calculation method that processes one byte at a time, with the help of a
+ *         256-entry table in ROM.
+ */
+#define TBX_CHECKSUM_CRC_TABLE                   (2U)
+
+/** \brief CRC calculation method that processes four bytes at a time. Next to the
+ *         256-entry table in ROM, it needs three more 256-entry tables. These are
+ *         generated in RAM upon the first CRC calculation.
+ */
+#define TBX_CHECKSUM_CRC_SLICING4                (3U)
+
+/** \brief CRC calculation method that processes eight bytes at a time. Next to the
+ *         256-entry table in ROM, it needs seven more 256-entry tables. These are
+ *         generated in RAM upon the first CRC calculation.
+ */
+#define TBX_CHECKSUM_CRC_SLICING8                (4U)
+
+/* Initializers for the parameters of commonly used CRC algorithms. For example:
+ *   static const tTbxChecksumCrc32Params crcParams = TBX_CHECKSUM_CRC32_ISO_HDLC;
+ * Note that only the algorithms with the polynomial that is configured with
+ * TBX_CONF_CHECKSUM_CRC16_POLYNOM or TBX_CONF_CHECKSUM_CRC32_POLYNOM, benefit from the
+ * configured calculation method. The other ones are always calculated one bit at a time.
+ */
+/** \brief Parameters of the CRC-16/CCITT-FALSE algorithm. Check value 0x29B1. */
+#define TBX_CHECKSUM_CRC16_CCITT_FALSE           { 0x1021U, 0xFFFFU, 0x0000U, \
+                                                   TBX_FALSE, TBX_FALSE }
+
+/** \brief Parameters of the CRC-16/XMODEM algorithm. Check value 0x31C3. */
+#define TBX_CHECKSUM_CRC16_XMODEM                { 0x1021U, 0x0000U, 0x0000U, \
+                                                   TBX_FALSE, TBX_FALSE }
+
+/** \brief Parameters of the CRC-16/KERMIT algorithm. Check value 0x2189. */
+#define TBX_CHECKSUM_CRC16_KERMIT                { 0x1021U, 0x0000U, 0x0000U, \
+                                                   TBX_TRUE, TBX_TRUE }
+
+/** \brief Parameters of the CRC-16/MODBUS algorithm. Check value 0x4B37. */
+#define TBX_CHECKSUM_CRC16_MODBUS                { 0x8005U, 0xFFFFU, 0x0000U, \
+                                                   TBX_TRUE, TBX_TRUE }
+
+/** \brief Parameters of the CRC-32/MPEG-2 algorithm. Check value 0x0376E6E7. */
+#define TBX_CHECKSUM_CRC32_MPEG2                 { 0x04C11DB7UL, 0xFFFFFFFFUL, \
+                                                   0x00000000UL, TBX_FALSE, TBX_FALSE }
+
+/** \brief Parameters of the CRC-32/ISO-HDLC algorithm, as used by Ethernet and ZIP.
+ *         Check value 0xCBF43926.
+ */
+#define TBX_CHECKSUM_CRC32_ISO_HDLC              { 0x04C11DB7UL, 0xFFFFFFFFUL, \
+                                                   0xFFFFFFFFUL, TBX_TRUE, TBX_TRUE }
+
+/** \brief Parameters of the CRC-32/BZIP2 algorithm. Check value 0xFC891918. */
+#define TBX_CHECKSUM_CRC32_BZIP2                 { 0x04C11DB7UL, 0xFFFFFFFFUL, \
+                                                   0xFFFFFFFFUL, TBX_FALSE, TBX_FALSE }
+
+/** \brief Parameters of the CRC-32/ISCSI algorithm, also known as CRC-32C. Check value
+ *         0xE3069283.
+ */
+#define TBX_CHECKSUM_CRC32_ISCSI                 { 0x1EDC6F41UL, 0xFFFFFFFFUL, \
+                                                   0xFFFFFFFFUL, TBX_TRUE, TBX_TRUE }
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Parameters of a 16-bit CRC algorithm, according to the Rocksoft model. */
+typedef struct
+{
+  /** \brief Polynomial, without its highest bit. */
+  uint16_t polynom;
+  /** \brief Initial value of the CRC calculation. */
+  uint16_t initial;
+  /** \brief Value that the result is XOR-ed with, at the end of the calculation. */
+  uint16_t finalXor;
+  /** \brief TBX_TRUE to process the bits of each data byte starting with the lowest
+   *         bit, TBX_FALSE to start with the highest bit.
+   */
+  uint8_t  reflectInput;
+  /** \brief TBX_TRUE to reverse the order of the bits of the result, TBX_FALSE
+   *         otherwise.
+   */
+  uint8_t  reflectOutput;
+} tTbxChecksumCrc16Params;
+
+/** \brief Parameters of a 32-bit CRC algorithm, according to the Rocksoft model. */
+typedef struct
+{
+  /** \brief Polynomial, without its highest bit. */
+  uint32_t polynom;
+  /** \brief Initial value of the CRC calculation. */
+  uint32_t initial;
+  /** \brief Value that the result is XOR-ed with, at the end of the calculation. */
+  uint32_t finalXor;
+  /** \brief TBX_TRUE to process the bits of each data byte starting with the lowest
+   *         bit, TBX_FALSE to start with the highest bit.
+   */
+  uint8_t  reflectInput;
+  /** \brief TBX_TRUE to reverse the order of the bits of the result, TBX_FALSE
+   *         otherwise.
+   */
+  uint8_t  reflectOutput;
+} tTbxChecksumCrc32Params;
+
+/** \brief Context of a 16-bit CRC calculation that processes its data in multiple
+ *         chunks. Note that its elements should be considered private and only be
+ *         accessed internally by this checksum module.
+ */
+typedef struct
+{
+  /** \brief Parameters of the CRC algorithm. */
+  tTbxChecksumCrc16Params params;
+  /** \brief Current CRC remainder. */
+  uint16_t                crc;
+} tTbxChecksumCrc16;
+
+/** \brief Context of a 32-bit CRC calculation that processes its data in multiple
+ *         chunks. Note that its elements should be considered private and only be
+ *         accessed internally by this checksum module.
+ */
+typedef struct
+{
+  /** \brief Parameters of the CRC algorithm. */
+  tTbxChecksumCrc32Params params;
+  /** \brief Current CRC remainder. */
+  uint32_t                crc;
+} tTbxChecksumCrc32;
+
+/** \brief Context of a Fletcher-32 checksum calculation that processes its data in
+ *         multiple chunks. Note that its elements should be considered private and only
+ *         be accessed internally by this checksum module.
+ */
+typedef struct
+{
+  /** \brief Sum of the 16-bit data words, modulo 65535. */
+  uint32_t sum1;
+  /** \brief Sum of the intermediate values of sum1, modulo 65535. */
+  uint32_t sum2;
+  /** \brief Data byte at the end of the last chunk, which still waits for the byte that
+   *         completes its 16-bit data word.
+   */
+  uint8_t  pendingByte;
+  /** \brief TBX_TRUE if pendingByte holds a data byte, TBX_FALSE otherwise. */
+  uint8_t  pendingValid;
+} tTbxChecksumFletcher32;
+
+/** \brief Context of an Adler-32 checksum calculation that processes its data in
+ *         multiple chunks. Note that its elements should be considered private and only
+ *         be accessed internally by this checksum module.
+ */
+typedef struct
+{
+  /** \brief One plus the sum of the data bytes, modulo 65521. */
+  uint32_t sumA;
+  /** \brief Sum of the intermediate values of sumA, modulo 65521. */
+  uint32_t sumB;
+} tTbxChecksumAdler32;
+
+/** \brief Context of an xxHash32 hash calculation that processes its data in multiple
+ *         chunks. Note that its elements should be considered private and only be
+ *         accessed internally by this checksum module.
+ */
+typedef struct
+{
+  /** \brief The four accumulators, which each process one 32-bit word of a 16-byte
+   *         stripe.
+   */
+  uint32_t acc[4];
+  /** \brief Total number of data bytes processed so far, modulo 2^32. */
+  uint32_t totalLen;
+  /** \brief TBX_TRUE if at least one 16-byte stripe was processed, TBX_FALSE
+   *         otherwise.
+   */
+  uint8_t  largeLen;
+  /** \brief Data bytes at the end of the last chunk, which do not yet form a complete
+   *         16-byte stripe.
+   */
+  uint8_t  buffer[16];
+  /** \brief Number of data bytes in the buffer. */
+  uint8_t  bufferLen;
+  /** \brief Seed of the hash calculation. */
+  uint32_t seed;
+} tTbxChecksumXxHash32;
 
 
 /****************************************************************************************
@@ -50,6 +243,59 @@ uint16_t TbxChecksumCrc16Calculate(uint8_t const * data,
 uint32_t TbxChecksumCrc32Calculate(uint8_t const * data, 
                                    size_t          len);
 
+void     TbxChecksumCrc16Init     (tTbxChecksumCrc16                   * ctx,
+                                   tTbxChecksumCrc16Params       const * params);
+
+void     TbxChecksumCrc16Update   (tTbxChecksumCrc16                   * ctx,
+                                   uint8_t                       const * data,
+                                   size_t                                len);
+
+uint16_t TbxChecksumCrc16Final    (tTbxChecksumCrc16             const * ctx);
+
+void     TbxChecksumCrc32Init     (tTbxChecksumCrc32                   * ctx,
+                                   tTbxChecksumCrc32Params       const * params);
+
+void     TbxChecksumCrc32Update   (tTbxChecksumCrc32                   * ctx,
+                                   uint8_t                       const * data,
+                                   size_t                                len);
+
+uint32_t TbxChecksumCrc32Final    (tTbxChecksumCrc32             const * ctx);
+
+uint32_t TbxChecksumFletcher32Calculate(uint8_t                  const * data,
+                                        size_t                           len);
+
+void     TbxChecksumFletcher32Init     (tTbxChecksumFletcher32         * ctx);
+
+void     TbxChecksumFletcher32Update   (tTbxChecksumFletcher32         * ctx,
+                                        uint8_t                  const * data,
+                                        size_t                           len);
+
+uint32_t TbxChecksumFletcher32Final    (tTbxChecksumFletcher32   const * ctx);
+
+uint32_t TbxChecksumAdler32Calculate   (uint8_t                  const * data,
+                                        size_t                           len);
+
+void     TbxChecksumAdler32Init        (tTbxChecksumAdler32            * ctx);
+
+void     TbxChecksumAdler32Update      (tTbxChecksumAdler32            * ctx,
+                                        uint8_t                  const * data,
+                                        size_t                           len);
+
+uint32_t TbxChecksumAdler32Final       (tTbxChecksumAdler32      const * ctx);
+
+uint32_t TbxChecksumXxHash32Calculate  (uint8_t                  const * data,
+                                        size_t                           len,
+                                        uint32_t                         seed);
+
+void     TbxChecksumXxHash32Init       (tTbxChecksumXxHash32           * ctx,
+                                        uint32_t                         seed);
+
+void     TbxChecksumXxHash32Update     (tTbxChecksumXxHash32           * ctx,
+                                        uint8_t                  const * data,
+                                        size_t                           len);
+
+uint32_t TbxChecksumXxHash32Final      (tTbxChecksumXxHash32     const * ctx);
+
 
 #ifdef __cplusplus
 }
@@ -40,6 +40,22 @@
 #include "microtbx.h"                            /* MicroTBX global header             */
 
 
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void   TbxCriticalSectionProfileUpdate(char const        * file,
+                                              uint32_t            line,
+                                              uint32_t            elapsed);
+
+static size_t TbxCriticalSectionProfileFind  (char const        * file,
+                                              uint32_t            line);
+
+static void   TbxCriticalSectionStatsAdd     (tTbxCritSectStats * stats,
+                                              uint32_t            elapsed);
+#endif
+
+
 /****************************************************************************************
 * Local data declarations
 ****************************************************************************************/
@@ -54,6 +70,31 @@ static volatile uint32_t      tbxCritSectNestingCounter = 0U;
  */
 static volatile tTbxPortCpuSR tbxCritSectCpuSR = 0U;
 
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/** \brief Value of the cycle counter upon the outermost entry of the critical section. */
+static uint32_t               tbxCritSectProfileStart = 0U;
+
+/** \brief Source file of the call site of the outermost entry of the critical section.
+ *         NULL if the critical section was entered internally by this module, in which
+ *         case it is not profiled.
+ */
+static char const *           tbxCritSectProfileFile = NULL;
+
+/** \brief Line number of the call site of the outermost entry of the critical section. */
+static uint32_t               tbxCritSectProfileLine = 0U;
+
+/** \brief Statistics of all call sites together. */
+static tTbxCritSectStats      tbxCritSectProfileTotal = { NULL, 0U, 0U, 0U, 0U };
+
+/** \brief Statistics of the individual call sites, in the order that they were first
+ *         recorded.
+ */
+static tTbxCritSectStats      tbxCritSectProfileSites[TBX_CONF_CRITSECT_PROFILE_SITES];
+
+/** \brief Number of call sites in tbxCritSectProfileSites[]. */
+static size_t                 tbxCritSectProfileNumSites = 0U;
+#endif
+
 
 /************************************************************************************//**
 ** \brief     Enter a critical section. Critical sections are needed in an interrupt
@@ -64,10 +105,17 @@ static volatile tTbxPortCpuSR tbxCritSectCpuSR = 0U;
 **              TbxCriticalSectionEnter();
 **              ...access shared resource...
 **              TbxCriticalSectionExit();
+**            If profiling is enabled, the function-like macro with the same name takes
+**            its place at the call site. A direct call of this function, for example
+**            through a function pointer, is then recorded as a call site in this module.
 **
 ****************************************************************************************/
-void TbxCriticalSectionEnter(void)
+void (TbxCriticalSectionEnter)(void)
 {
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+  /* Pass the request on, with this function as the call site. */
+  TbxCriticalSectionEnterAt(__FILE__, __LINE__);
+#else
   tTbxPortCpuSR cpuSR;
 
   /* Disable the interrupts and store the CPU status register value in a local variable.
@@ -90,9 +138,53 @@ void TbxCriticalSectionEnter(void)
   }
   /* Increment the nesting counter. */
   tbxCritSectNestingCounter++;
+#endif
 } /*** end of TbxCriticalSectionEnter ***/
 
 
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Enter a critical section and record the call site for the profiling of the
+**            critical section. The function-like macro TbxCriticalSectionEnter() calls
+**            this function, if profiling is enabled. The time that the critical section
+**            is held, is measured from its outermost entry until its final exit.
+** \param     file Source file of the call site. NULL to not profile the critical section.
+** \param     line Line number of the call site.
+**
+****************************************************************************************/
+void TbxCriticalSectionEnterAt(char const * file,
+                               uint32_t     line)
+{
+  tTbxPortCpuSR cpuSR;
+
+  /* Disable the interrupts and store the CPU status register value in a local variable.
+   * Note that it should not write directly to tbxCritSectCpuSR yet, because the
+   * tbxCritSectCpuSR variable is a shared resource and should only be accessed with
+   * interrupts disabled.
+   */
+  cpuSR = TbxPortInterruptsDisable();
+
+  /* It this the first time we enter the critical section, as opposed to a nested
+   * entry?
+   */
+  if (tbxCritSectNestingCounter == 0U)
+  {
+    /* Store the CPU status register value in tbxCritSectCpuSR, since it is now safe
+     * to access it. It is needed to restore the interrupt status upon exiting the
+     * critical section.
+     */
+    tbxCritSectCpuSR = cpuSR;
+    /* Store the call site and start the measurement. */
+    tbxCritSectProfileFile = file;
+    tbxCritSectProfileLine = line;
+    tbxCritSectProfileStart = TbxPortCycleCounterGet();
+  }
+  /* Increment the nesting counter. */
+  tbxCritSectNestingCounter++;
+} /*** end of TbxCriticalSectionEnterAt ***/
+#endif /* (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U) */
+
+
 /************************************************************************************//**
 ** \brief     Exit a critical section. Critical sections are needed in an interrupt
 **            driven software program to obtain mutual exclusive access shared resources
@@ -106,6 +198,12 @@ void TbxCriticalSectionEnter(void)
 ****************************************************************************************/
 void TbxCriticalSectionExit(void)
 {
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+  uint32_t     elapsed;
+  char const * file;
+  uint32_t     line;
+#endif
+
   /* A call to this function must always be preceeded by a call to
    * TbxCriticalSectionEnter(). This means the tbxCritSectNestingCounter must be > 0.
    */
@@ -124,13 +222,362 @@ void TbxCriticalSectionExit(void)
      */
     if (tbxCritSectNestingCounter == 0U)
     {
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+      /* Stop the measurement and copy the call site, while still holding the critical
+       * section.
+       */
+      elapsed = TbxPortCycleCounterGet() - tbxCritSectProfileStart;
+      file = tbxCritSectProfileFile;
+      line = tbxCritSectProfileLine;
+#endif
       /* Restore the interrupt status to the state it was right before the interrupts
        * were all disabled upon the first time the critical section was entered.
       */
       TbxPortInterruptsRestore(tbxCritSectCpuSR);
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+      /* Record how long the critical section was held, unless it should not be
+       * profiled. This is done afterwards, to not extend the time that the interrupts
+       * are disabled with the bookkeeping of the profiling.
+       */
+      if (file != NULL)
+      {
+        TbxCriticalSectionProfileUpdate(file, line, elapsed);
+      }
+#endif
     }
   }
 } /*** end of TbxCriticalSectionExit ***/
 
 
+/************************************************************************************//**
+** \brief     Initializes a lock object. Only needed for lock objects that are not
+**            statically initialized with TBX_LOCK_INIT, for example when the lock object
+**            is part of dynamically allocated memory.
+** \param     lock Pointer to the lock object to initialize.
+**
+****************************************************************************************/
+void TbxLockInit(tTbxLock * lock)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(lock != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (lock != NULL)
+  {
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+    /* Pass the request on to the port specific implementation. */
+    TbxPortLockInit(&lock->portLock);
+#else
+    /* Nothing to initialize, because the global critical section is used. */
+    lock->unused = 0U;
+#endif
+  }
+} /*** end of TbxLockInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the resource that is protected by the
+**            lock object. Nested calls for the same lock object are allowed, as long as
+**            each call to this function is followed by a call to TbxLockExit(). When
+**            holding multiple lock objects at the same time, always obtain them in the
+**            same order and release them in the reverse order. For example:
+**              TbxLockEnter(&myLock);
+**              ...access resource protected by myLock...
+**              TbxLockExit(&myLock);
+**            If profiling is enabled, the function-like macro with the same name takes
+**            its place at the call site, in the same way as for
+**            TbxCriticalSectionEnter().
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void (TbxLockEnter)(tTbxLock * lock)
+{
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+  /* Pass the request on, with this function as the call site. */
+  TbxLockEnterAt(lock, __FILE__, __LINE__);
+#else
+  /* Verify parameter. */
+  TBX_ASSERT(lock != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (lock != NULL)
+  {
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+    /* Pass the request on to the port specific implementation. */
+    TbxPortLockEnter(&lock->portLock);
+#else
+    /* Fall back to the global critical section. */
+    TbxCriticalSectionEnter();
+#endif
+  }
+#endif
+} /*** end of TbxLockEnter ***/
+
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the resource that is protected by the
+**            lock object and records the call site for the profiling of the critical
+**            section. The function-like macro TbxLockEnter() calls this function, if
+**            profiling is enabled. The call site is only used, if the lock object falls
+**            back to the global critical section.
+** \param     lock Pointer to the lock object.
+** \param     file Source file of the call site.
+** \param     line Line number of the call site.
+**
+****************************************************************************************/
+void TbxLockEnterAt(tTbxLock   * lock,
+                    char const * file,
+                    uint32_t     line)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(lock != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (lock != NULL)
+  {
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+    /* The native lock objects of the port are not profiled. */
+    TBX_UNUSED_ARG(file);
+    TBX_UNUSED_ARG(line);
+    /* Pass the request on to the port specific implementation. */
+    TbxPortLockEnter(&lock->portLock);
+#else
+    /* Fall back to the global critical section. */
+    TbxCriticalSectionEnterAt(file, line);
+#endif
+  }
+} /*** end of TbxLockEnterAt ***/
+#endif /* (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U) */
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the resource that is protected by the
+**            lock object. Note that each call to this function should always be preceded
+**            by a call to TbxLockEnter().
+** \param     lock Pointer to the lock object.
+**
+****************************************************************************************/
+void TbxLockExit(tTbxLock * lock)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(lock != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (lock != NULL)
+  {
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+    /* Pass the request on to the port specific implementation. */
+    TbxPortLockExit(&lock->portLock);
+#else
+    /* Fall back to the global critical section. */
+    TbxCriticalSectionExit();
+#endif
+  }
+} /*** end of TbxLockExit ***/
+
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Obtains the profiling statistics of all call sites of the critical section
+**            together. The critical section itself is held while reading them, but this
+**            is not included in the statistics.
+** \param     stats Pointer to where the statistics are written to.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t TbxCriticalSectionGetStats(tTbxCritSectStats * stats)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (stats != NULL)
+  {
+    /* Copy the statistics, without profiling this critical section. */
+    TbxCriticalSectionEnterAt(NULL, 0U);
+    *stats = tbxCritSectProfileTotal;
+    TbxCriticalSectionExit();
+    result = TBX_OK;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxCriticalSectionGetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the profiling statistics of one call site of the critical section.
+**            The call sites are numbered in the order that they were first recorded.
+**            This makes it possible to iterate over the statistics of all call sites:
+**              tTbxCritSectStats stats;
+**              size_t            siteIdx = 0U;
+**              while (TbxCriticalSectionGetSiteStats(siteIdx, &stats) == TBX_OK)
+**              {
+**                ...
+**                siteIdx++;
+**              }
+** \param     siteIdx Zero-based index of the call site.
+** \param     stats Pointer to where the statistics are written to.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when no call site with
+**            this index was recorded.
+**
+****************************************************************************************/
+uint8_t TbxCriticalSectionGetSiteStats(size_t              siteIdx,
+                                       tTbxCritSectStats * stats)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (stats != NULL)
+  {
+    /* Copy the statistics, without profiling this critical section. */
+    TbxCriticalSectionEnterAt(NULL, 0U);
+    if (siteIdx < tbxCritSectProfileNumSites)
+    {
+      *stats = tbxCritSectProfileSites[siteIdx];
+      result = TBX_OK;
+    }
+    TbxCriticalSectionExit();
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxCriticalSectionGetSiteStats ***/
+
+
+/************************************************************************************//**
+** \brief     Resets the profiling statistics of the critical section, for example to
+**            start a new measurement after the initialization of the application.
+**
+****************************************************************************************/
+void TbxCriticalSectionResetStats(void)
+{
+  /* Reset the statistics, without profiling this critical section. */
+  TbxCriticalSectionEnterAt(NULL, 0U);
+  tbxCritSectProfileTotal.count = 0U;
+  tbxCritSectProfileTotal.maxTime = 0U;
+  tbxCritSectProfileTotal.totalTime = 0U;
+  tbxCritSectProfileNumSites = 0U;
+  TbxCriticalSectionExit();
+} /*** end of TbxCriticalSectionResetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Adds the measured time of the critical section to the statistics of all
+**            call sites together and to those of its call site. Should be called after
+**            the critical section was left. The call site is located without holding
+**            the critical section. Recorded call sites are only ever appended, until
+**            the statistics are reset. Only the counters are therefore updated with the
+**            critical section held, unless the call sites changed in the meantime.
+** \param     file Source file of the call site.
+** \param     line Line number of the call site.
+** \param     elapsed Number of cycle counter ticks that the critical section was held.
+**
+****************************************************************************************/
+static void TbxCriticalSectionProfileUpdate(char const * file,
+                                            uint32_t     line,
+                                            uint32_t     elapsed)
+{
+  tTbxCritSectStats * siteStats = NULL;
+  size_t              siteIdx;
+
+  /* Locate the statistics of the call site, without holding the critical section. */
+  siteIdx = TbxCriticalSectionProfileFind(file, line);
+  /* Update the statistics, without profiling this critical section. */
+  TbxCriticalSectionEnterAt(NULL, 0U);
+  /* Update the statistics of all call sites together. */
+  TbxCriticalSectionStatsAdd(&tbxCritSectProfileTotal, elapsed);
+  /* Is the located call site still valid? */
+  if ( (siteIdx < tbxCritSectProfileNumSites) && \
+       (tbxCritSectProfileSites[siteIdx].file == file) && \
+       (tbxCritSectProfileSites[siteIdx].line == line) )
+  {
+    siteStats = &tbxCritSectProfileSites[siteIdx];
+  }
+  /* Search again if the call sites changed in the meantime, which is rare. */
+  else if (siteIdx != tbxCritSectProfileNumSites)
+  {
+    siteIdx = TbxCriticalSectionProfileFind(file, line);
+    if (siteIdx < tbxCritSectProfileNumSites)
+    {
+      siteStats = &tbxCritSectProfileSites[siteIdx];
+    }
+  }
+  else
+  {
+    /* The call site is not yet recorded. */
+  }
+  /* Start recording a new call site, if there is still room for it. */
+  if ( (siteStats == NULL) && \
+       (tbxCritSectProfileNumSites < TBX_CONF_CRITSECT_PROFILE_SITES) )
+  {
+    siteStats = &tbxCritSectProfileSites[tbxCritSectProfileNumSites];
+    siteStats->file = file;
+    siteStats->line = line;
+    siteStats->count = 0U;
+    siteStats->maxTime = 0U;
+    siteStats->totalTime = 0U;
+    tbxCritSectProfileNumSites++;
+  }
+  /* Update the statistics of the call site. */
+  if (siteStats != NULL)
+  {
+    TbxCriticalSectionStatsAdd(siteStats, elapsed);
+  }
+  TbxCriticalSectionExit();
+} /*** end of TbxCriticalSectionProfileUpdate ***/
+
+
+/************************************************************************************//**
+** \brief     Searches the recorded call sites for the specified one.
+** \param     file Source file of the call site.
+** \param     line Line number of the call site.
+** \return    Index of the call site in tbxCritSectProfileSites[] if found, the number of
+**            recorded call sites otherwise.
+**
+****************************************************************************************/
+static size_t TbxCriticalSectionProfileFind(char const * file,
+                                            uint32_t     line)
+{
+  size_t numSites = tbxCritSectProfileNumSites;
+  size_t siteIdx = 0U;
+
+  /* Compare the recorded call sites one by one, until a match is found. */
+  while ( (siteIdx < numSites) && \
+          ( (tbxCritSectProfileSites[siteIdx].file != file) || \
+            (tbxCritSectProfileSites[siteIdx].line != line) ) )
+  {
+    siteIdx++;
+  }
+
+  /* Give the result back to the caller. */
+  return siteIdx;
+} /*** end of TbxCriticalSectionProfileFind ***/
+
+
+/************************************************************************************//**
+** \brief     Adds one measured time of the critical section to the statistics.
+** \param     stats Pointer to the statistics to update.
+** \param     elapsed Number of cycle counter ticks that the critical section was held.
+**
+****************************************************************************************/
+static void TbxCriticalSectionStatsAdd(tTbxCritSectStats * stats,
+                                       uint32_t            elapsed)
+{
+  stats->count++;
+  stats->totalTime += elapsed;
+  if (elapsed > stats->maxTime)
+  {
+    stats->maxTime = elapsed;
+  }
+} /*** end of TbxCriticalSectionStatsAdd ***/
+#endif /* (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U) */
+
+
 /*********************************** end of tbx_critsect.c *****************************/
@@ -39,12 +39,143 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_CRITSECT_PROFILE_ENABLE
+/** \brief Enable/disable the profiling of the critical section. When enabled, the time
+ *         from the outermost entry of the critical section until its final exit is
+ *         measured with the cycle counter of the port. The statistics are kept per
+ *         call site and can be read with TbxCriticalSectionGetStats(). Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_CRITSECT_PROFILE_ENABLE         (0U)
+#endif
+
+#ifndef TBX_CONF_CRITSECT_PROFILE_SITES
+/** \brief Configure the maximum number of call sites that the profiling of the critical
+ *         section keeps statistics for. Call sites beyond this number are only included
+ *         in the statistics of all call sites together. Note that it is possible to
+ *         override this value by adding this macro definition to the configuration
+ *         header file.
+ */
+#define TBX_CONF_CRITSECT_PROFILE_SITES          (16U)
+#endif
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U) && (TBX_PORT_CYCLE_COUNTER == 0U)
+#error "TBX_CONF_CRITSECT_PROFILE_ENABLE requires a port with a cycle counter."
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+/** \brief Initializer for a statically allocated lock object. For example:
+ *           static tTbxLock myLock = TBX_LOCK_INIT;
+ */
+#define TBX_LOCK_INIT                            { TBX_PORT_LOCK_INIT }
+#else
+/** \brief Initializer for a statically allocated lock object. For example:
+ *           static tTbxLock myLock = TBX_LOCK_INIT;
+ */
+#define TBX_LOCK_INIT                            { 0U }
+#endif
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/** \brief Enters the critical section and passes the source file and line number of the
+ *         caller on as its call site, for the profiling of the critical section. The
+ *         function itself remains available, for example to take its address. Its name
+ *         is then placed between parentheses, which suppresses this macro.
+ */
+#define TbxCriticalSectionEnter()                TbxCriticalSectionEnterAt(__FILE__, \
+                                                                           __LINE__)
+
+/** \brief Obtains the lock object and passes the source file and line number of the
+ *         caller on as its call site, for the profiling of the critical section. The
+ *         function itself remains available, in the same way as for
+ *         TbxCriticalSectionEnter().
+ */
+#define TbxLockEnter(lock)                       TbxLockEnterAt((lock), __FILE__, \
+                                                                __LINE__)
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a lock object. A lock object provides mutual exclusive access to
+ *         one specific resource. Contrary to the global critical section, it does not
+ *         block the resources that are protected by other lock objects. Note that its
+ *         elements should be considered private and only be accessed internally by this
+ *         critical section module.
+ */
+typedef struct
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /** \brief Port specific implementation of the lock object. */
+  tTbxPortLock portLock;
+#else
+  /** \brief Unused. All lock objects fall back to the global critical section. */
+  uint8_t      unused;
+#endif
+} tTbxLock;
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/** \brief Layout of the profiling statistics of the critical section. The times are in
+ *         ticks of the cycle counter of the port.
+ */
+typedef struct
+{
+  /** \brief Source file of the call site that entered the critical section. NULL for the
+   *         statistics of all call sites together.
+   */
+  char const * file;
+  /** \brief Line number of the call site that entered the critical section. */
+  uint32_t     line;
+  /** \brief Number of times that the critical section was entered and exited again. */
+  uint32_t     count;
+  /** \brief Longest time that the critical section was held. */
+  uint32_t     maxTime;
+  /** \brief Total time that the critical section was held. */
+  uint64_t     totalTime;
+} tTbxCritSectStats;
+#endif
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-void TbxCriticalSectionEnter(void);
+void    (TbxCriticalSectionEnter)     (void);
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+void    TbxCriticalSectionEnterAt     (char const        * file,
+                                       uint32_t            line);
+#endif
+
+void    TbxCriticalSectionExit        (void);
 
-void TbxCriticalSectionExit (void);
+void    TbxLockInit                   (tTbxLock          * lock);
+
+void    (TbxLockEnter)                (tTbxLock          * lock);
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+void    TbxLockEnterAt                (tTbxLock          * lock,
+                                       char const        * file,
+                                       uint32_t            line);
+#endif
+
+void    TbxLockExit                   (tTbxLock          * lock);
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+uint8_t TbxCriticalSectionGetStats    (tTbxCritSectStats * stats);
+
+uint8_t TbxCriticalSectionGetSiteStats(size_t              siteIdx,
+                                       tTbxCritSectStats * stats);
+
+void    TbxCriticalSectionResetStats  (void);
+#endif
 
 
 #ifdef __cplusplus
@@ -44,8 +44,43 @@
 /****************************************************************************************
 * Macro definitions
 ****************************************************************************************/
-/** \brief Size of an AES block. Decryption is performed in this block size. */
-#define TBX_CRYPTO_AES_BLOCK_SIZE                (16U)
+/** \brief Maximum number of blocks that are passed to the AES256 backend at once, in CTR
+ *         mode and when decrypting in CBC mode. Hardware implementations process these
+ *         blocks at the same time.
+ */
+#define TBX_CRYPTO_AES256_BATCH_BLOCKS           (8U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TbxCryptoAes256EncryptBlocks(tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                   * data,
+                                         size_t                      numBlocks);
+
+static void TbxCryptoAes256DecryptBlocks(tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                   * data,
+                                         size_t                      numBlocks);
+
+static void TbxCryptoAes256Process      (tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                     encrypt,
+                                         uint8_t             const * src,
+                                         uint8_t                   * dst,
+                                         size_t                      len);
+
+static void TbxCryptoAes256ProcessGather(tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                     encrypt,
+                                         tTbxCryptoSegment   const * segments,
+                                         size_t                      numSegments,
+                                         uint8_t                   * dst);
+
+static void TbxCryptoAes256CtrProcess   (tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t             const * src,
+                                         uint8_t                   * dst,
+                                         size_t                      len);
+
+static void TbxCryptoAes256CounterAdd   (uint8_t                   * counter,
+                                         size_t                      numBlocks);
 
 
 /************************************************************************************//**
@@ -62,7 +97,7 @@ void TbxCryptoAes256Encrypt(uint8_t       * data,
                             size_t          len, 
                             uint8_t const * key)
 {
-  tbx_aes256_context ctx;
+  tTbxCryptoAes256Ctx ctx;
 
   /* Verify parameters. */
   TBX_ASSERT(data != NULL);
@@ -75,14 +110,11 @@ void TbxCryptoAes256Encrypt(uint8_t       * data,
        ((len % TBX_CRYPTO_AES_BLOCK_SIZE) == 0U) )
   {
     /* Initialize the context. */
-    tbx_aes256_init(&ctx, key);
-    /* Encrypt in blocks of 16 bytes. */
-    for (size_t idx = 0U; idx < (len / TBX_CRYPTO_AES_BLOCK_SIZE); idx++)
-    {
-      tbx_aes256_encrypt_ecb(&ctx, &data[idx * TBX_CRYPTO_AES_BLOCK_SIZE]);
-    }
+    TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_ECB, key, NULL);
+    /* Encrypt all blocks of 16 bytes. */
+    TbxCryptoAes256EncryptBlocks(&ctx, data, len / TBX_CRYPTO_AES_BLOCK_SIZE);
     /* Cleanup */
-    tbx_aes256_done(&ctx);
+    TbxCryptoAes256Done(&ctx);
   }
 } /*** end of TbxCryptoAes256Encrypt ***/
 
@@ -101,7 +133,7 @@ void TbxCryptoAes256Decrypt(uint8_t       * data,
                             size_t          len, 
                             uint8_t const * key)
 {
-  tbx_aes256_context ctx;
+  tTbxCryptoAes256Ctx ctx;
 
   /* Verify parameters. */
   TBX_ASSERT(data != NULL);
@@ -114,16 +146,801 @@ void TbxCryptoAes256Decrypt(uint8_t       * data,
        ((len % TBX_CRYPTO_AES_BLOCK_SIZE) == 0U) )
   {
     /* Initialize the context. */
-    tbx_aes256_init(&ctx, key);
-    /* Decrypt in blocks of 16 bytes. */
-    for (size_t idx = 0U; idx < (len / TBX_CRYPTO_AES_BLOCK_SIZE); idx++)
-    {
-      tbx_aes256_decrypt_ecb(&ctx, &data[idx * TBX_CRYPTO_AES_BLOCK_SIZE]);
-    }
+    TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_ECB, key, NULL);
+    /* Decrypt all blocks of 16 bytes. */
+    TbxCryptoAes256DecryptBlocks(&ctx, data, len / TBX_CRYPTO_AES_BLOCK_SIZE);
     /* Cleanup */
-    tbx_aes256_done(&ctx);
+    TbxCryptoAes256Done(&ctx);
   }
 } /*** end of TbxCryptoAes256Decrypt ***/
 
 
+/************************************************************************************//**
+** \brief     Initializes an AES256 context for encrypting or decrypting data in chunks,
+**            using the specified 256-bit (32 bytes) key and block cipher mode. The key
+**            is expanded only once, here. Call TbxCryptoAes256Done() once the context
+**            is no longer needed, to clear the expanded key from memory.
+** \param     ctx Pointer to the AES256 context.
+** \param     mode Block cipher mode: TBX_CRYPTO_AES256_MODE_ECB,
+**            TBX_CRYPTO_AES256_MODE_CBC or TBX_CRYPTO_AES256_MODE_CTR.
+** \param     key The 256-bit key as a array of 32 bytes.
+** \param     iv The 16-byte initialization vector. In CBC mode, this is the block that
+**            the first block is combined with. In CTR mode, this is the initial value
+**            of the counter block. It is not used in ECB mode and can be NULL there.
+** \attention If the port offers hardware accelerated AES256 (TBX_PORT_AES_ACCEL), the
+**            blocks are processed by the port, whenever it reports that the hardware is
+**            available. Otherwise they are processed by the software engine.
+**
+****************************************************************************************/
+void TbxCryptoAes256Init(tTbxCryptoAes256Ctx       * ctx,
+                         uint8_t                     mode,
+                         uint8_t             const * key,
+                         uint8_t             const * iv)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(mode <= TBX_CRYPTO_AES256_MODE_CTR);
+  TBX_ASSERT(key != NULL);
+  TBX_ASSERT((iv != NULL) || (mode == TBX_CRYPTO_AES256_MODE_ECB));
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (mode <= TBX_CRYPTO_AES256_MODE_CTR) && (key != NULL) && \
+       ((iv != NULL) || (mode == TBX_CRYPTO_AES256_MODE_ECB)) )
+  {
+#if (TBX_PORT_AES_ACCEL > 0U)
+    /* Attempt to hand the key over to the hardware accelerated implementation. */
+    ctx->accelActive = TbxPortAes256Init(&ctx->accel, key);
+    /* Only expand the key for the software engine if the hardware is not available. */
+    if (ctx->accelActive == TBX_FALSE)
+    {
+      tbx_aes256_init(&ctx->engine, key);
+    }
+#else
+    /* Expand the key. */
+    tbx_aes256_init(&ctx->engine, key);
+#endif
+    /* Store the initialization vector. */
+    for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+    {
+      ctx->iv[idx] = (iv != NULL) ? iv[idx] : 0U;
+      ctx->chain[idx] = ctx->iv[idx];
+      ctx->keystream[idx] = 0U;
+    }
+    ctx->mode = mode;
+    /* No keystream block was generated yet. */
+    ctx->keystreamIdx = TBX_CRYPTO_AES_BLOCK_SIZE;
+  }
+} /*** end of TbxCryptoAes256Init ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts the next chunk of data, using the AES256 context. The results are
+**            written back into the same array. After encryption with the same key, mode
+**            and initialization vector, calling this function multiple times for parts
+**            of the data gives the same result as calling it once for all data.
+** \param     ctx Pointer to the AES256 context.
+** \param     data Pointer to the byte array with data to encrypt. The encrypted bytes
+**            are stored in the same array.
+** \param     len The number of bytes in the data-array to encrypt. In ECB and CBC mode,
+**            it must be a multiple of 16, as this is the AES256 minimal block size. In
+**            CTR mode, it can be any length.
+**
+****************************************************************************************/
+void TbxCryptoAes256EncryptUpdate(tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t                   * data,
+                                  size_t                      len)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (data != NULL) )
+  {
+    TbxCryptoAes256Process(ctx, TBX_TRUE, data, data, len);
+  }
+} /*** end of TbxCryptoAes256EncryptUpdate ***/
+
+
+/************************************************************************************//**
+** \brief     Decrypts the next chunk of data, using the AES256 context. The results are
+**            written back into the same array. Calling this function multiple times for
+**            parts of the data gives the same result as calling it once for all data.
+** \param     ctx Pointer to the AES256 context.
+** \param     data Pointer to the byte array with data to decrypt. The decrypted bytes
+**            are stored in the same array.
+** \param     len The number of bytes in the data-array to decrypt. In ECB and CBC mode,
+**            it must be a multiple of 16, as this is the AES256 minimal block size. In
+**            CTR mode, it can be any length.
+**
+****************************************************************************************/
+void TbxCryptoAes256DecryptUpdate(tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t                   * data,
+                                  size_t                      len)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (data != NULL) )
+  {
+    TbxCryptoAes256Process(ctx, TBX_FALSE, data, data, len);
+  }
+} /*** end of TbxCryptoAes256DecryptUpdate ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts the next chunk of data, using the AES256 context. Same as
+**            TbxCryptoAes256EncryptUpdate(), except that the results are written to a
+**            different array. The source data stays as it is, so it does not need to be
+**            copied first.
+** \param     ctx Pointer to the AES256 context.
+** \param     src Pointer to the byte array with data to encrypt.
+** \param     dst Pointer to the byte array to store the encrypted bytes in. It must be
+**            either the same array as src or an array that does not overlap with it.
+** \param     len The number of bytes to encrypt. In ECB and CBC mode, it must be a
+**            multiple of 16, as this is the AES256 minimal block size. In CTR mode, it
+**            can be any length.
+**
+****************************************************************************************/
+void TbxCryptoAes256EncryptTo(tTbxCryptoAes256Ctx       * ctx,
+                              uint8_t             const * src,
+                              uint8_t                   * dst,
+                              size_t                      len)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(src != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (src != NULL) && (dst != NULL) )
+  {
+    TbxCryptoAes256Process(ctx, TBX_TRUE, src, dst, len);
+  }
+} /*** end of TbxCryptoAes256EncryptTo ***/
+
+
+/************************************************************************************//**
+** \brief     Decrypts the next chunk of data, using the AES256 context. Same as
+**            TbxCryptoAes256DecryptUpdate(), except that the results are written to a
+**            different array. The source data stays as it is, so it does not need to be
+**            copied first, for example to keep it for a retransmission.
+** \param     ctx Pointer to the AES256 context.
+** \param     src Pointer to the byte array with data to decrypt.
+** \param     dst Pointer to the byte array to store the decrypted bytes in. It must be
+**            either the same array as src or an array that does not overlap with it.
+** \param     len The number of bytes to decrypt. In ECB and CBC mode, it must be a
+**            multiple of 16, as this is the AES256 minimal block size. In CTR mode, it
+**            can be any length.
+**
+****************************************************************************************/
+void TbxCryptoAes256DecryptTo(tTbxCryptoAes256Ctx       * ctx,
+                              uint8_t             const * src,
+                              uint8_t                   * dst,
+                              size_t                      len)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(src != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (src != NULL) && (dst != NULL) )
+  {
+    TbxCryptoAes256Process(ctx, TBX_FALSE, src, dst, len);
+  }
+} /*** end of TbxCryptoAes256DecryptTo ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts the next chunk of data, which is spread out over multiple
+**            segments, using the AES256 context. The encrypted bytes of all segments are
+**            stored one after the other in a single destination array. This makes it
+**            possible to encrypt a packet, which is chained over multiple memory blocks,
+**            directly into a transmit buffer. The segments do not have to be a multiple
+**            of 16 bytes, also not in ECB and CBC mode.
+** \param     ctx Pointer to the AES256 context.
+** \param     segments Pointer to the array with segments to encrypt.
+** \param     numSegments Number of segments in the array.
+** \param     dst Pointer to the byte array to store the encrypted bytes in. It must be
+**            large enough for the total length of all segments and it must not overlap
+**            with any of the segments.
+**
+****************************************************************************************/
+void TbxCryptoAes256EncryptGather(tTbxCryptoAes256Ctx       * ctx,
+                                  tTbxCryptoSegment   const * segments,
+                                  size_t                      numSegments,
+                                  uint8_t                   * dst)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(segments != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (segments != NULL) && (dst != NULL) )
+  {
+    TbxCryptoAes256ProcessGather(ctx, TBX_TRUE, segments, numSegments, dst);
+  }
+} /*** end of TbxCryptoAes256EncryptGather ***/
+
+
+/************************************************************************************//**
+** \brief     Decrypts the next chunk of data, which is spread out over multiple
+**            segments, using the AES256 context. The decrypted bytes of all segments are
+**            stored one after the other in a single destination array. The segments do
+**            not have to be a multiple of 16 bytes, also not in ECB and CBC mode.
+** \param     ctx Pointer to the AES256 context.
+** \param     segments Pointer to the array with segments to decrypt.
+** \param     numSegments Number of segments in the array.
+** \param     dst Pointer to the byte array to store the decrypted bytes in. It must be
+**            large enough for the total length of all segments and it must not overlap
+**            with any of the segments.
+**
+****************************************************************************************/
+void TbxCryptoAes256DecryptGather(tTbxCryptoAes256Ctx       * ctx,
+                                  tTbxCryptoSegment   const * segments,
+                                  size_t                      numSegments,
+                                  uint8_t                   * dst)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(segments != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (segments != NULL) && (dst != NULL) )
+  {
+    TbxCryptoAes256ProcessGather(ctx, TBX_FALSE, segments, numSegments, dst);
+  }
+} /*** end of TbxCryptoAes256DecryptGather ***/
+
+
+/************************************************************************************//**
+** \brief     Jumps to the specified byte offset in the keystream of an AES256 context in
+**            CTR mode. The next call to TbxCryptoAes256EncryptUpdate() or
+**            TbxCryptoAes256DecryptUpdate() then continues with the data at this offset
+**            from the start of the data. This makes it possible to decrypt any part of
+**            the data, without processing the data before it. It also makes it possible
+**            to split the data over multiple contexts with the same key and
+**            initialization vector, for example to process them in parallel.
+** \param     ctx Pointer to the AES256 context.
+** \param     offset Byte offset from the start of the data.
+**
+****************************************************************************************/
+void TbxCryptoAes256SetOffset(tTbxCryptoAes256Ctx       * ctx,
+                              size_t                      offset)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (ctx != NULL)
+  {
+    /* Random access into the data is only possible in CTR mode. */
+    TBX_ASSERT(ctx->mode == TBX_CRYPTO_AES256_MODE_CTR);
+
+    /* Only continue if the context is in CTR mode. */
+    if (ctx->mode == TBX_CRYPTO_AES256_MODE_CTR)
+    {
+      /* Calculate the counter block that belongs to the offset. */
+      for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+      {
+        ctx->chain[idx] = ctx->iv[idx];
+      }
+      TbxCryptoAes256CounterAdd(ctx->chain, offset / TBX_CRYPTO_AES_BLOCK_SIZE);
+      /* No keystream block is available for this counter block yet. */
+      ctx->keystreamIdx = TBX_CRYPTO_AES_BLOCK_SIZE;
+      /* Skip the first bytes of the keystream block, if the offset is in the middle of
+       * a data block.
+       */
+      if ((offset % TBX_CRYPTO_AES_BLOCK_SIZE) != 0U)
+      {
+        uint8_t skip[TBX_CRYPTO_AES_BLOCK_SIZE] = { 0U };
+
+        TbxCryptoAes256CtrProcess(ctx, skip, skip, offset % TBX_CRYPTO_AES_BLOCK_SIZE);
+      }
+    }
+  }
+} /*** end of TbxCryptoAes256SetOffset ***/
+
+
+/************************************************************************************//**
+** \brief     Releases an AES256 context. It clears the expanded key and the other
+**            internal state from memory, such that it cannot leak afterwards.
+** \param     ctx Pointer to the AES256 context.
+**
+****************************************************************************************/
+void TbxCryptoAes256Done(tTbxCryptoAes256Ctx * ctx)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (ctx != NULL)
+  {
+    /* Clear the expanded key. */
+    tbx_aes256_done(&ctx->engine);
+#if (TBX_PORT_AES_ACCEL > 0U)
+    if (ctx->accelActive != TBX_FALSE)
+    {
+      TbxPortAes256Done(&ctx->accel);
+      ctx->accelActive = TBX_FALSE;
+    }
+#endif
+    /* Clear the initialization vector, counter and keystream. */
+    for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+    {
+      ctx->chain[idx] = 0U;
+      ctx->iv[idx] = 0U;
+      ctx->keystream[idx] = 0U;
+    }
+    ctx->keystreamIdx = TBX_CRYPTO_AES_BLOCK_SIZE;
+  }
+} /*** end of TbxCryptoAes256Done ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts or decrypts the next chunk of data, using the AES256 context. The
+**            source and destination can be the same array, for in place processing.
+** \param     ctx Pointer to the AES256 context.
+** \param     encrypt TBX_TRUE to encrypt, TBX_FALSE to decrypt.
+** \param     src Pointer to the byte array with data to process.
+** \param     dst Pointer to the byte array to store the results in. It must be either
+**            the same array as src or an array that does not overlap with it.
+** \param     len The number of bytes to process. In ECB and CBC mode, it must be a
+**            multiple of 16, as this is the AES256 minimal block size.
+**
+****************************************************************************************/
+static void TbxCryptoAes256Process(tTbxCryptoAes256Ctx       * ctx,
+                                   uint8_t                     encrypt,
+                                   uint8_t             const * src,
+                                   uint8_t                   * dst,
+                                   size_t                      len)
+{
+  uint8_t encrypted[TBX_CRYPTO_AES256_BATCH_BLOCKS * TBX_CRYPTO_AES_BLOCK_SIZE];
+
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(src != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (src != NULL) && (dst != NULL) )
+  {
+    /* Verify that the length is aligned to the block size, if the mode requires it. */
+    TBX_ASSERT((ctx->mode == TBX_CRYPTO_AES256_MODE_CTR) || \
+               ((len % TBX_CRYPTO_AES_BLOCK_SIZE) == 0U));
+
+    /* Encryption and decryption are the same operation in CTR mode. */
+    if (ctx->mode == TBX_CRYPTO_AES256_MODE_CTR)
+    {
+      TbxCryptoAes256CtrProcess(ctx, src, dst, len);
+    }
+    /* Only continue with the other modes if the length is properly aligned. */
+    else if ((len % TBX_CRYPTO_AES_BLOCK_SIZE) == 0U)
+    {
+      /* The blocks do not depend on each other in ECB mode, so process them all at
+       * once, directly in the destination array.
+       */
+      if (ctx->mode == TBX_CRYPTO_AES256_MODE_ECB)
+      {
+        if (src != dst)
+        {
+          for (size_t idx = 0U; idx < len; idx++)
+          {
+            dst[idx] = src[idx];
+          }
+        }
+        if (encrypt != TBX_FALSE)
+        {
+          TbxCryptoAes256EncryptBlocks(ctx, dst, len / TBX_CRYPTO_AES_BLOCK_SIZE);
+        }
+        else
+        {
+          TbxCryptoAes256DecryptBlocks(ctx, dst, len / TBX_CRYPTO_AES_BLOCK_SIZE);
+        }
+      }
+      /* Each block depends on the previous encrypted block, when encrypting in CBC mode,
+       * so they can only be encrypted one after the other.
+       */
+      else if (encrypt != TBX_FALSE)
+      {
+        for (size_t offset = 0U; offset < len; offset += TBX_CRYPTO_AES_BLOCK_SIZE)
+        {
+          uint8_t * block = &dst[offset];
+
+          /* Combine the block with the previous encrypted block. */
+          for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+          {
+            block[idx] = src[offset + idx] ^ ctx->chain[idx];
+          }
+          TbxCryptoAes256EncryptBlocks(ctx, block, 1U);
+          /* Store the encrypted block for combining with the next block. */
+          for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+          {
+            ctx->chain[idx] = block[idx];
+          }
+        }
+      }
+      /* In CBC mode, each decrypted block is combined with the previous encrypted
+       * block. The encrypted blocks are all known, so decrypt them in batches.
+       */
+      else
+      {
+        for (size_t offset = 0U; offset < len; )
+        {
+          uint8_t const * cipher = &src[offset];
+          uint8_t       * block = &dst[offset];
+          size_t          batchLen = len - offset;
+
+          if (batchLen > sizeof(encrypted))
+          {
+            batchLen = sizeof(encrypted);
+          }
+          /* Keep the encrypted blocks for combining with the decrypted blocks. When
+           * decrypting into a different array, they are still in the source array.
+           */
+          if (src == dst)
+          {
+            for (size_t idx = 0U; idx < batchLen; idx++)
+            {
+              encrypted[idx] = cipher[idx];
+            }
+            cipher = encrypted;
+          }
+          else
+          {
+            for (size_t idx = 0U; idx < batchLen; idx++)
+            {
+              block[idx] = cipher[idx];
+            }
+          }
+          TbxCryptoAes256DecryptBlocks(ctx, block, batchLen / TBX_CRYPTO_AES_BLOCK_SIZE);
+          /* Combine the first block with the last encrypted block of the previous batch
+           * and the other blocks with their previous encrypted block.
+           */
+          for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+          {
+            block[idx] ^= ctx->chain[idx];
+          }
+          for (size_t idx = TBX_CRYPTO_AES_BLOCK_SIZE; idx < batchLen; idx++)
+          {
+            block[idx] ^= cipher[idx - TBX_CRYPTO_AES_BLOCK_SIZE];
+          }
+          /* Store the last encrypted block for combining with the next batch. */
+          for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+          {
+            ctx->chain[idx] = cipher[(batchLen - TBX_CRYPTO_AES_BLOCK_SIZE) + idx];
+          }
+          offset += batchLen;
+        }
+      }
+    }
+    else
+    {
+      /* Nothing to do as the length is not aligned, which was already flagged. */
+    }
+  }
+} /*** end of TbxCryptoAes256Process ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts or decrypts the next chunk of data, which is spread out over
+**            multiple segments, into a single destination array. In ECB and CBC mode,
+**            a block that is split over two or more segments is first collected in a
+**            local block. All other data goes directly from the segments to the
+**            destination array.
+** \param     ctx Pointer to the AES256 context.
+** \param     encrypt TBX_TRUE to encrypt, TBX_FALSE to decrypt.
+** \param     segments Pointer to the array with segments to process.
+** \param     numSegments Number of segments in the array.
+** \param     dst Pointer to the byte array to store the results in.
+**
+****************************************************************************************/
+static void TbxCryptoAes256ProcessGather(tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                     encrypt,
+                                         tTbxCryptoSegment   const * segments,
+                                         size_t                      numSegments,
+                                         uint8_t                   * dst)
+{
+  uint8_t block[TBX_CRYPTO_AES_BLOCK_SIZE];
+  size_t  blockLen = 0U;
+  size_t  totalLen = 0U;
+  size_t  dstOffset = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(segments != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (segments != NULL) && (dst != NULL) )
+  {
+    /* Determine the total length, which must be aligned if the mode requires it. Check
+     * this upfront, such that a misaligned chunk leaves the context untouched.
+     */
+    for (size_t segIdx = 0U; segIdx < numSegments; segIdx++)
+    {
+      TBX_ASSERT((segments[segIdx].data != NULL) || (segments[segIdx].len == 0U));
+      totalLen += segments[segIdx].len;
+    }
+    TBX_ASSERT((ctx->mode == TBX_CRYPTO_AES256_MODE_CTR) || \
+               ((totalLen % TBX_CRYPTO_AES_BLOCK_SIZE) == 0U));
+
+    /* Only continue if the length is properly aligned, if the mode requires it. */
+    if ( (ctx->mode == TBX_CRYPTO_AES256_MODE_CTR) || \
+         ((totalLen % TBX_CRYPTO_AES_BLOCK_SIZE) == 0U) )
+    {
+      for (size_t segIdx = 0U; segIdx < numSegments; segIdx++)
+      {
+        uint8_t const * src = segments[segIdx].data;
+        size_t          remaining = segments[segIdx].len;
+        size_t          alignedLen;
+
+        /* Skip empty segments. */
+        if ( (src == NULL) || (remaining == 0U) )
+        {
+          remaining = 0U;
+        }
+        /* The CTR mode can process segments of any length. */
+        else if (ctx->mode == TBX_CRYPTO_AES256_MODE_CTR)
+        {
+          TbxCryptoAes256Process(ctx, encrypt, src, &dst[dstOffset], remaining);
+          dstOffset += remaining;
+          remaining = 0U;
+        }
+        /* Complete the block that started in one of the previous segments, if any. */
+        else if (blockLen > 0U)
+        {
+          while ( (blockLen < TBX_CRYPTO_AES_BLOCK_SIZE) && (remaining > 0U) )
+          {
+            block[blockLen] = *src;
+            blockLen++;
+            src++;
+            remaining--;
+          }
+          if (blockLen == TBX_CRYPTO_AES_BLOCK_SIZE)
+          {
+            TbxCryptoAes256Process(ctx, encrypt, block, &dst[dstOffset], blockLen);
+            dstOffset += blockLen;
+            blockLen = 0U;
+          }
+        }
+        else
+        {
+          /* No block to complete. */
+        }
+        /* Process the whole blocks directly from the segment. */
+        alignedLen = remaining - (remaining % TBX_CRYPTO_AES_BLOCK_SIZE);
+        if (alignedLen > 0U)
+        {
+          TbxCryptoAes256Process(ctx, encrypt, src, &dst[dstOffset], alignedLen);
+          dstOffset += alignedLen;
+          src = &src[alignedLen];
+          remaining -= alignedLen;
+        }
+        /* Keep the bytes of a block that continues in the next segment. */
+        while (remaining > 0U)
+        {
+          block[blockLen] = *src;
+          blockLen++;
+          src++;
+          remaining--;
+        }
+      }
+    }
+    /* Do not leave data bytes behind on the stack. */
+    for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+    {
+      block[idx] = 0U;
+    }
+  }
+} /*** end of TbxCryptoAes256ProcessGather ***/
+
+
+/************************************************************************************//**
+** \brief     Combines the data with the keystream in CTR mode. Each time all bytes of
+**            the keystream block are used, the next keystream block is generated by
+**            encrypting the counter block, after which the counter block is incremented.
+**            For whole data blocks, the keystream blocks of up to
+**            TBX_CRYPTO_AES256_BATCH_BLOCKS counter blocks are generated at once.
+** \param     ctx Pointer to the AES256 context.
+** \param     src Pointer to the byte array with data to process.
+** \param     dst Pointer to the byte array to store the results in. It must be either
+**            the same array as src or an array that does not overlap with it.
+** \param     len The number of bytes to process.
+**
+****************************************************************************************/
+static void TbxCryptoAes256CtrProcess(tTbxCryptoAes256Ctx       * ctx,
+                                      uint8_t             const * src,
+                                      uint8_t                   * dst,
+                                      size_t                      len)
+{
+  uint8_t keystream[TBX_CRYPTO_AES256_BATCH_BLOCKS * TBX_CRYPTO_AES_BLOCK_SIZE];
+  size_t  offset = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(src != NULL);
+  TBX_ASSERT(dst != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (src != NULL) && (dst != NULL) )
+  {
+    /* First use the remaining bytes of the current keystream block. */
+    while ( (offset < len) && (ctx->keystreamIdx < TBX_CRYPTO_AES_BLOCK_SIZE) )
+    {
+      dst[offset] = src[offset] ^ ctx->keystream[ctx->keystreamIdx];
+      ctx->keystreamIdx++;
+      offset++;
+    }
+    /* Process the whole data blocks in batches. */
+    while ((len - offset) >= TBX_CRYPTO_AES_BLOCK_SIZE)
+    {
+      size_t batchLen = len - offset;
+
+      if (batchLen > sizeof(keystream))
+      {
+        batchLen = sizeof(keystream);
+      }
+      batchLen -= batchLen % TBX_CRYPTO_AES_BLOCK_SIZE;
+      /* Generate the keystream blocks of the next counter blocks. */
+      for (size_t blockIdx = 0U; blockIdx < batchLen; blockIdx += TBX_CRYPTO_AES_BLOCK_SIZE)
+      {
+        for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+        {
+          keystream[blockIdx + idx] = ctx->chain[idx];
+        }
+        TbxCryptoAes256CounterAdd(ctx->chain, 1U);
+      }
+      TbxCryptoAes256EncryptBlocks(ctx, keystream, batchLen / TBX_CRYPTO_AES_BLOCK_SIZE);
+      /* Combine the data bytes with the keystream bytes. */
+      for (size_t idx = 0U; idx < batchLen; idx++)
+      {
+        dst[offset + idx] = src[offset + idx] ^ keystream[idx];
+      }
+      offset += batchLen;
+    }
+    /* Process the trailing bytes of a partial data block, if any. */
+    if (offset < len)
+    {
+      /* Generate the next keystream block and keep it for the next call. */
+      for (uint8_t idx = 0U; idx < TBX_CRYPTO_AES_BLOCK_SIZE; idx++)
+      {
+        ctx->keystream[idx] = ctx->chain[idx];
+      }
+      TbxCryptoAes256EncryptBlocks(ctx, ctx->keystream, 1U);
+      TbxCryptoAes256CounterAdd(ctx->chain, 1U);
+      ctx->keystreamIdx = 0U;
+      /* Combine the data bytes with the keystream bytes. */
+      while (offset < len)
+      {
+        dst[offset] = src[offset] ^ ctx->keystream[ctx->keystreamIdx];
+        ctx->keystreamIdx++;
+        offset++;
+      }
+    }
+    /* Do not leave keystream bytes behind on the stack. */
+    for (size_t idx = 0U; idx < sizeof(keystream); idx++)
+    {
+      keystream[idx] = 0U;
+    }
+  }
+} /*** end of TbxCryptoAes256CtrProcess ***/
+
+
+/************************************************************************************//**
+** \brief     Encrypts a number of 16-byte blocks, each on its own. The blocks are passed
+**            to the hardware accelerated implementation of the port, if it is active.
+**            Otherwise they are encrypted one at a time by the software engine.
+** \param     ctx Pointer to the AES256 context.
+** \param     data Pointer to the byte array with the blocks to encrypt. The encrypted
+**            blocks are stored in the same array.
+** \param     numBlocks Number of 16-byte blocks to encrypt.
+**
+****************************************************************************************/
+static void TbxCryptoAes256EncryptBlocks(tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                   * data,
+                                         size_t                      numBlocks)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (data != NULL) )
+  {
+#if (TBX_PORT_AES_ACCEL > 0U)
+    if (ctx->accelActive != TBX_FALSE)
+    {
+      TbxPortAes256EncryptBlocks(&ctx->accel, data, numBlocks);
+    }
+    else
+#endif
+    {
+      for (size_t idx = 0U; idx < numBlocks; idx++)
+      {
+        tbx_aes256_encrypt_ecb(&ctx->engine, &data[idx * TBX_CRYPTO_AES_BLOCK_SIZE]);
+      }
+    }
+  }
+} /*** end of TbxCryptoAes256EncryptBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Decrypts a number of 16-byte blocks, each on its own. The blocks are passed
+**            to the hardware accelerated implementation of the port, if it is active.
+**            Otherwise they are decrypted one at a time by the software engine.
+** \param     ctx Pointer to the AES256 context.
+** \param     data Pointer to the byte array with the blocks to decrypt. The decrypted
+**            blocks are stored in the same array.
+** \param     numBlocks Number of 16-byte blocks to decrypt.
+**
+****************************************************************************************/
+static void TbxCryptoAes256DecryptBlocks(tTbxCryptoAes256Ctx       * ctx,
+                                         uint8_t                   * data,
+                                         size_t                      numBlocks)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (data != NULL) )
+  {
+#if (TBX_PORT_AES_ACCEL > 0U)
+    if (ctx->accelActive != TBX_FALSE)
+    {
+      TbxPortAes256DecryptBlocks(&ctx->accel, data, numBlocks);
+    }
+    else
+#endif
+    {
+      for (size_t idx = 0U; idx < numBlocks; idx++)
+      {
+        tbx_aes256_decrypt_ecb(&ctx->engine, &data[idx * TBX_CRYPTO_AES_BLOCK_SIZE]);
+      }
+    }
+  }
+} /*** end of TbxCryptoAes256DecryptBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a number of blocks to the 128-bit counter block, which is stored in
+**            big endian format. An overflow wraps around to zero.
+** \param     counter Pointer to the 16-byte counter block.
+** \param     numBlocks The value to add to the counter block.
+**
+****************************************************************************************/
+static void TbxCryptoAes256CounterAdd(uint8_t                   * counter,
+                                      size_t                      numBlocks)
+{
+  size_t  remaining = numBlocks;
+  uint8_t carry = 0U;
+  uint8_t idx = TBX_CRYPTO_AES_BLOCK_SIZE;
+
+  /* Verify parameters. */
+  TBX_ASSERT(counter != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (counter != NULL)
+  {
+    /* Add from the least significant byte onwards, until nothing is left to add. */
+    while ( (idx > 0U) && ((remaining > 0U) || (carry > 0U)) )
+    {
+      uint16_t sum;
+
+      idx--;
+      sum = (uint16_t)((uint16_t)counter[idx] + (uint16_t)(remaining & 0xFFU) + carry);
+      counter[idx] = (uint8_t)sum;
+      carry = (uint8_t)(sum >> 8U);
+      remaining >>= 8U;
+    }
+  }
+} /*** end of TbxCryptoAes256CounterAdd ***/
+
+
 /*********************************** end of tbx_crypto.c *******************************/
@@ -39,6 +39,117 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief AES256 engine that processes one byte at a time and calculates the round keys
+ *         on the fly. It needs the least amount of ROM and RAM, but it is the slowest
+ *         one.
+ */
+#define TBX_CRYPTO_AES256_BYTEWISE               (0U)
+
+/** \brief AES256 engine that processes 32-bit words with the help of two 256-entry
+ *         tables in ROM. The round keys are calculated once upon initialization, which
+ *         needs 480 bytes of RAM for the engine context instead of 96 bytes.
+ */
+#define TBX_CRYPTO_AES256_TTABLE                 (1U)
+
+/** \brief Size of an AES block. Encryption and decryption are performed in this block
+ *         size.
+ */
+#define TBX_CRYPTO_AES_BLOCK_SIZE                (16U)
+
+/** \brief AES256 block cipher mode electronic codebook. Each 16-byte block is encrypted
+ *         on its own. The length of the data must be a multiple of 16.
+ */
+#define TBX_CRYPTO_AES256_MODE_ECB               (0U)
+
+/** \brief AES256 block cipher mode cipher block chaining. Each 16-byte block is combined
+ *         with the previous encrypted block, starting with the initialization vector.
+ *         The length of the data must be a multiple of 16.
+ */
+#define TBX_CRYPTO_AES256_MODE_CBC               (1U)
+
+/** \brief AES256 block cipher mode counter. The data is combined with a keystream,
+ *         obtained by encrypting successive values of a 128-bit counter, starting with
+ *         the initialization vector. The data can have any length and it is possible to
+ *         jump to any position in the keystream with TbxCryptoAes256SetOffset().
+ */
+#define TBX_CRYPTO_AES256_MODE_CTR               (2U)
+
+
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_CRYPTO_AES256_METHOD
+/** \brief Configure the AES256 engine. Set it to TBX_CRYPTO_AES256_BYTEWISE for the
+ *         smallest ROM and RAM footprint, or to TBX_CRYPTO_AES256_TTABLE for an engine
+ *         that is several times faster, at the cost of about 2 kB of extra ROM. Note
+ *         that it is possible to override this value by adding this macro definition to
+ *         the configuration header file.
+ */
+#define TBX_CONF_CRYPTO_AES256_METHOD            (TBX_CRYPTO_AES256_BYTEWISE)
+#endif
+
+#if (TBX_CONF_CRYPTO_AES256_METHOD > TBX_CRYPTO_AES256_TTABLE)
+#error "TBX_CONF_CRYPTO_AES256_METHOD is invalid."
+#endif
+
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+/* Note that the AES256 engine depends on the configuration macros of this module. */
+#include "tbx_aes256.h"                     /* AES256 engine                           */
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a segment of data, for encrypting or decrypting data that is spread
+ *         out over multiple memory blocks with TbxCryptoAes256EncryptGather() and
+ *         TbxCryptoAes256DecryptGather().
+ */
+typedef struct
+{
+  /** \brief Pointer to the first byte of the segment. */
+  uint8_t const * data;
+  /** \brief Number of bytes in the segment. */
+  size_t          len;
+} tTbxCryptoSegment;
+
+/** \brief Layout of an AES256 context. It holds the expanded key, such that data can be
+ *         encrypted or decrypted in chunks, without repeating the key setup for each
+ *         chunk. Initialize it with TbxCryptoAes256Init(). Note that its elements should
+ *         be considered private and only be accessed internally by this module.
+ */
+typedef struct
+{
+  /** \brief Context of the AES256 engine, with the expanded key. */
+  tbx_aes256_context engine;
+  /** \brief Block cipher mode. */
+  uint8_t            mode;
+  /** \brief Index of the next unused byte in keystream[]. Only used in CTR mode. */
+  uint8_t            keystreamIdx;
+  /** \brief The previous encrypted block in CBC mode. The next counter block in CTR
+   *         mode.
+   */
+  uint8_t            chain[TBX_CRYPTO_AES_BLOCK_SIZE];
+  /** \brief The initial counter block. Only used in CTR mode. */
+  uint8_t            iv[TBX_CRYPTO_AES_BLOCK_SIZE];
+  /** \brief The encrypted counter block. Only used in CTR mode. */
+  uint8_t            keystream[TBX_CRYPTO_AES_BLOCK_SIZE];
+#if (TBX_PORT_AES_ACCEL > 0U)
+  /** \brief Context of the hardware accelerated AES256 implementation of the port. */
+  tTbxPortAesCtx     accel;
+  /** \brief TBX_TRUE if the blocks are processed by the port, TBX_FALSE if they are
+   *         processed by the software engine.
+   */
+  uint8_t            accelActive;
+#endif
+} tTbxCryptoAes256Ctx;
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
@@ -50,6 +161,44 @@ void TbxCryptoAes256Decrypt(uint8_t       * data,
                             size_t          len,
                             uint8_t const * key);
 
+void TbxCryptoAes256Init         (tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t                     mode,
+                                  uint8_t             const * key,
+                                  uint8_t             const * iv);
+
+void TbxCryptoAes256EncryptUpdate(tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t                   * data,
+                                  size_t                      len);
+
+void TbxCryptoAes256DecryptUpdate(tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t                   * data,
+                                  size_t                      len);
+
+void TbxCryptoAes256EncryptTo    (tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t             const * src,
+                                  uint8_t                   * dst,
+                                  size_t                      len);
+
+void TbxCryptoAes256DecryptTo    (tTbxCryptoAes256Ctx       * ctx,
+                                  uint8_t             const * src,
+                                  uint8_t                   * dst,
+                                  size_t                      len);
+
+void TbxCryptoAes256EncryptGather(tTbxCryptoAes256Ctx       * ctx,
+                                  tTbxCryptoSegment   const * segments,
+                                  size_t                      numSegments,
+                                  uint8_t                   * dst);
+
+void TbxCryptoAes256DecryptGather(tTbxCryptoAes256Ctx       * ctx,
+                                  tTbxCryptoSegment   const * segments,
+                                  size_t                      numSegments,
+                                  uint8_t                   * dst);
+
+void TbxCryptoAes256SetOffset    (tTbxCryptoAes256Ctx       * ctx,
+                                  size_t                      offset);
+
+void TbxCryptoAes256Done         (tTbxCryptoAes256Ctx       * ctx);
+
 
 #ifdef __cplusplus
 }
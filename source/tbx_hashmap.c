@@ -0,0 +1,951 @@
+/************************************************************************************//**
+* \file         tbx_hashmap.c
+* \brief        Hash maps source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Minimum number of slots in a table. */
+#define TBX_HASHMAP_MIN_SLOTS                    (8U)
+
+/** \brief Number of slots in the old table that are processed with each change of the
+ *         hash map, while it grows. It is set such that all entries are moved to the new
+ *         table, before the new table reaches its maximum load.
+ */
+#define TBX_HASHMAP_MIGRATE_SLOTS                ((100U / TBX_CONF_HASHMAP_MAX_LOAD) + 1U)
+
+/** \brief Hash value that marks a slot as empty. */
+#define TBX_HASHMAP_HASH_EMPTY                   (0U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of the start of a slot in a table. The key bytes follow directly after
+ *         it.
+ */
+typedef struct
+{
+  /** \brief Hash value of the key or TBX_HASHMAP_HASH_EMPTY if the slot is empty. */
+  uint32_t   hash;
+  /** \brief Pointer to the value that belongs to the key. */
+  void     * valuePtr;
+} tTbxHashMapSlot;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void            * TbxHashMapMemAllocate (size_t                   size);
+
+static uint8_t           TbxHashMapTableCreate (tTbxHashMap      const * map,
+                                                tTbxHashMapTable       * table,
+                                                size_t                   numSlots);
+
+static tTbxHashMapSlot * TbxHashMapTableGetSlot(tTbxHashMap      const * map,
+                                                tTbxHashMapTable const * table,
+                                                size_t                   idx);
+
+static tTbxHashMapSlot * TbxHashMapTableFind   (tTbxHashMap      const * map,
+                                                tTbxHashMapTable const * table,
+                                                uint32_t                 hash,
+                                                void             const * key,
+                                                size_t                 * slotIdx);
+
+static void              TbxHashMapTablePlace  (tTbxHashMap            * map,
+                                                tTbxHashMapTable       * table);
+
+static void              TbxHashMapTableRemove (tTbxHashMap      const * map,
+                                                tTbxHashMapTable       * table,
+                                                size_t                   slotIdx);
+
+static void              TbxHashMapGrow        (tTbxHashMap            * map);
+
+static void              TbxHashMapMigrate     (tTbxHashMap            * map,
+                                                size_t                   numSlots);
+
+static uint32_t          TbxHashMapGetHash     (tTbxHashMap      const * map,
+                                                void             const * key);
+
+static uint32_t          TbxHashMapMix         (uint32_t                 value);
+
+static void              TbxHashMapLockEnter   (tTbxHashMap      const * map);
+
+static void              TbxHashMapLockExit    (tTbxHashMap      const * map);
+
+
+/************************************************************************************//**
+** \brief     Creates a new and empty hash map and returns its pointer. Make sure to store
+**            the pointer because it serves as a handle to the hash map, which is needed
+**            when calling the other API functions in this module. Each entry in the hash
+**            map consists of a key and a pointer to its value. The keys are copied into
+**            the hash map, the values are not. The memory is allocated from the memory
+**            pools.
+** \param     capacity Number of entries that the hash map initially has room for. The
+**            hash map automatically grows, once more entries are inserted.
+** \param     keySize Number of bytes of a key. For example 4 for a uint32_t key.
+** \param     hashKeyFcn Callback function to calculate the hash value of a key. Set it
+**            to NULL to use TbxHashMapDefaultHash().
+** \return    Pointer to the created hash map or NULL in case of an error.
+**
+****************************************************************************************/
+tTbxHashMap * TbxHashMapCreate(size_t             capacity,
+                               size_t             keySize,
+                               tTbxHashMapHashKey hashKeyFcn)
+{
+  tTbxHashMap * result = NULL;
+  tTbxHashMap * mapPtr;
+  size_t        slotSize;
+  size_t        slotAlign;
+  size_t        numSlots = TBX_HASHMAP_MIN_SLOTS;
+  uint8_t       errorDetected = TBX_FALSE;
+
+  /* Verify parameters. */
+  TBX_ASSERT((keySize > 0U) && (keySize <= (SIZE_MAX / 2U)));
+
+  /* Only continue if the parameter is valid. */
+  if ((keySize > 0U) && (keySize <= (SIZE_MAX / 2U)))
+  {
+    /* Each slot holds its hash value and value pointer, followed by the key bytes. Round
+     * its size up, such that each slot in the table is properly aligned.
+     */
+    slotAlign = (sizeof(void *) > sizeof(uint32_t)) ? sizeof(void *) : sizeof(uint32_t);
+    slotSize = sizeof(tTbxHashMapSlot) + keySize;
+    slotSize = (((slotSize + slotAlign) - 1U) / slotAlign) * slotAlign;
+    /* Determine the number of slots needed for the initial capacity. */
+    while ( (errorDetected == TBX_FALSE) &&
+            (((numSlots / 100U) * TBX_CONF_HASHMAP_MAX_LOAD) +
+             (((numSlots % 100U) * TBX_CONF_HASHMAP_MAX_LOAD) / 100U) < capacity) )
+    {
+      if (numSlots > ((SIZE_MAX / 2U) / slotSize))
+      {
+        errorDetected = TBX_TRUE;
+      }
+      numSlots <<= 1U;
+    }
+    /* Attempt to allocate the hash map object, together with room for one slot. */
+    mapPtr = NULL;
+    if (errorDetected == TBX_FALSE)
+    {
+      mapPtr = TbxHashMapMemAllocate(sizeof(tTbxHashMap) + slotSize);
+    }
+    /* Only continue if the allocation was successful. */
+    if (mapPtr != NULL)
+    {
+      /* Initialize the hash map. */
+      mapPtr->keySize = keySize;
+      mapPtr->slotSize = slotSize;
+      mapPtr->hashKeyFcn = (hashKeyFcn != NULL) ? hashKeyFcn : TbxHashMapDefaultHash;
+      mapPtr->scratchPtr = (uint8_t *)(void *)&mapPtr[1];
+      mapPtr->oldTable.slotsPtr = NULL;
+      mapPtr->oldTable.indexMask = 0U;
+      mapPtr->oldTable.count = 0U;
+      mapPtr->migrateIdx = 0U;
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+      /* Initialize the lock object of the hash map. */
+      TbxLockInit(&mapPtr->lock);
+      mapPtr->lockPtr = &mapPtr->lock;
+#endif
+      /* Allocate the table with slots. */
+      if (TbxHashMapTableCreate(mapPtr, &mapPtr->table, numSlots) == TBX_OK)
+      {
+        /* Update the result for success. */
+        result = mapPtr;
+      }
+      else
+      {
+        /* Give the hash map object back to its memory pool. */
+        TbxMemPoolRelease(mapPtr);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Deletes a previously created hash map. Afterwards, the pointer to the hash
+**            map is no longer valid and should not be used anymore. Keep in mind that it
+**            is the caller's responsibility to release the memory of the values.
+** \param     map Pointer to a previously created hash map to operate on.
+**
+****************************************************************************************/
+void TbxHashMapDelete(tTbxHashMap * map)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(map != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (map != NULL)
+  {
+    /* Release the memory of the tables and the hash map object. */
+    if (map->oldTable.slotsPtr != NULL)
+    {
+      TbxMemPoolRelease(map->oldTable.slotsPtr);
+    }
+    TbxMemPoolRelease(map->table.slotsPtr);
+    TbxMemPoolRelease(map);
+  }
+} /*** end of TbxHashMapDelete ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of entries that are currently stored in the hash map.
+** \param     map Pointer to a previously created hash map to operate on.
+** \return    Total number of entries in the hash map.
+**
+****************************************************************************************/
+size_t TbxHashMapGetSize(tTbxHashMap const * map)
+{
+  size_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(map != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (map != NULL)
+  {
+    /* Obtain mutual exclusive access to the hash map. */
+    TbxHashMapLockEnter(map);
+    /* Entries can be in both tables, while the hash map grows. */
+    result = map->table.count + map->oldTable.count;
+    /* Release mutual exclusive access of the hash map. */
+    TbxHashMapLockExit(map);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapGetSize ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts an entry into the hash map. If an entry with the same key is already
+**            present, only its value is replaced. When the hash map reaches its maximum
+**            load, it grows to twice its number of slots. Instead of moving all entries
+**            at once, they are moved a few at a time with each following change of the
+**            hash map. This keeps the duration of each insertion short.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     key Pointer to the key bytes.
+** \param     value Pointer to the value. Cannot be NULL.
+** \return    TBX_OK if successful, TBX_ERROR otherwise, for example when there was not
+**            enough memory to grow the hash map.
+**
+****************************************************************************************/
+uint8_t TbxHashMapInsert(tTbxHashMap       * map,
+                         void        const * key,
+                         void              * value)
+{
+  uint8_t           result = TBX_ERROR;
+  tTbxHashMapSlot * slotPtr;
+  tTbxHashMapSlot * scratchSlotPtr;
+  uint8_t         * scratchKeyPtr;
+  uint8_t   const * keyPtr;
+  uint32_t          hash;
+  size_t            slotIdx;
+  size_t            numSlots;
+
+  /* Verify parameters. */
+  TBX_ASSERT((map != NULL) && (key != NULL) && (value != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((map != NULL) && (key != NULL) && (value != NULL))
+  {
+    hash = TbxHashMapGetHash(map, key);
+    /* Obtain mutual exclusive access to the hash map. */
+    TbxHashMapLockEnter(map);
+    /* Move some entries from the old table, if the hash map is growing. */
+    TbxHashMapMigrate(map, TBX_HASHMAP_MIGRATE_SLOTS);
+    /* Check if the key is already present in one of the tables. */
+    slotPtr = TbxHashMapTableFind(map, &map->table, hash, key, &slotIdx);
+    if ( (slotPtr == NULL) && (map->oldTable.slotsPtr != NULL) )
+    {
+      slotPtr = TbxHashMapTableFind(map, &map->oldTable, hash, key, &slotIdx);
+    }
+    /* Only replace the value, if the key is already present. */
+    if (slotPtr != NULL)
+    {
+      slotPtr->valuePtr = value;
+      result = TBX_OK;
+    }
+    else
+    {
+      /* Grow the hash map, if the new entry makes it exceed its maximum load. */
+      numSlots = map->table.indexMask + 1U;
+      if ((map->table.count + map->oldTable.count + 1U) >
+          (((numSlots / 100U) * TBX_CONF_HASHMAP_MAX_LOAD) +
+           (((numSlots % 100U) * TBX_CONF_HASHMAP_MAX_LOAD) / 100U)))
+      {
+        TbxHashMapGrow(map);
+      }
+      /* Only continue if there is at least one more empty slot left after inserting.
+       * This is always the case, unless growing failed.
+       */
+      if ((map->table.count + 1U) < (map->table.indexMask + 1U))
+      {
+        /* Build the entry and place it in the table. */
+        scratchSlotPtr = (tTbxHashMapSlot *)(void *)map->scratchPtr;
+        scratchSlotPtr->hash = hash;
+        scratchSlotPtr->valuePtr = value;
+        scratchKeyPtr = &map->scratchPtr[sizeof(tTbxHashMapSlot)];
+        keyPtr = key;
+        for (size_t idx = 0U; idx < map->keySize; idx++)
+        {
+          scratchKeyPtr[idx] = keyPtr[idx];
+        }
+        TbxHashMapTablePlace(map, &map->table);
+        result = TBX_OK;
+      }
+    }
+    /* Release mutual exclusive access of the hash map. */
+    TbxHashMapLockExit(map);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Searches the hash map for the entry with the specified key.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     key Pointer to the key bytes.
+** \return    Pointer to the value of the entry or NULL if the key is not present.
+**
+****************************************************************************************/
+void * TbxHashMapFind(tTbxHashMap const * map,
+                      void        const * key)
+{
+  void            * result = NULL;
+  tTbxHashMapSlot * slotPtr;
+  uint32_t          hash;
+  size_t            slotIdx;
+
+  /* Verify parameters. */
+  TBX_ASSERT((map != NULL) && (key != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((map != NULL) && (key != NULL))
+  {
+    hash = TbxHashMapGetHash(map, key);
+    /* Obtain mutual exclusive access to the hash map. */
+    TbxHashMapLockEnter(map);
+    /* Search both tables, while the hash map grows. */
+    slotPtr = TbxHashMapTableFind(map, &map->table, hash, key, &slotIdx);
+    if ( (slotPtr == NULL) && (map->oldTable.slotsPtr != NULL) )
+    {
+      slotPtr = TbxHashMapTableFind(map, &map->oldTable, hash, key, &slotIdx);
+    }
+    if (slotPtr != NULL)
+    {
+      result = slotPtr->valuePtr;
+    }
+    /* Release mutual exclusive access of the hash map. */
+    TbxHashMapLockExit(map);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapFind ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the entry with the specified key from the hash map. Keep in mind
+**            that it is the caller's responsibility to release the memory of the value.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     key Pointer to the key bytes.
+** \return    Pointer to the value of the removed entry or NULL if the key is not
+**            present.
+**
+****************************************************************************************/
+void * TbxHashMapRemove(tTbxHashMap       * map,
+                        void        const * key)
+{
+  void            * result = NULL;
+  tTbxHashMapSlot * slotPtr;
+  uint32_t          hash;
+  size_t            slotIdx = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT((map != NULL) && (key != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((map != NULL) && (key != NULL))
+  {
+    hash = TbxHashMapGetHash(map, key);
+    /* Obtain mutual exclusive access to the hash map. */
+    TbxHashMapLockEnter(map);
+    /* Move some entries from the old table, if the hash map is growing. */
+    TbxHashMapMigrate(map, TBX_HASHMAP_MIGRATE_SLOTS);
+    /* Search both tables for the entry and remove it. */
+    slotPtr = TbxHashMapTableFind(map, &map->table, hash, key, &slotIdx);
+    if (slotPtr != NULL)
+    {
+      result = slotPtr->valuePtr;
+      TbxHashMapTableRemove(map, &map->table, slotIdx);
+    }
+    else if (map->oldTable.slotsPtr != NULL)
+    {
+      slotPtr = TbxHashMapTableFind(map, &map->oldTable, hash, key, &slotIdx);
+      if (slotPtr != NULL)
+      {
+        result = slotPtr->valuePtr;
+        TbxHashMapTableRemove(map, &map->oldTable, slotIdx);
+      }
+    }
+    else
+    {
+      /* The key is not present. */
+    }
+    /* Release mutual exclusive access of the hash map. */
+    TbxHashMapLockExit(map);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapRemove ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the hash value of a key. Keys of up to 8 bytes, such as uint32_t
+**            and uint64_t keys, are combined into integers and mixed. Longer keys are
+**            hashed byte by byte with FNV-1a. The result does not depend on the
+**            endianness of the platform.
+** \param     key Pointer to the key bytes.
+** \param     keySize Number of key bytes.
+** \return    The hash value.
+**
+****************************************************************************************/
+uint32_t TbxHashMapDefaultHash(void const * key,
+                               size_t       keySize)
+{
+  uint32_t        result = 0U;
+  uint8_t const * keyPtr;
+  uint32_t        lowWord = 0U;
+  uint32_t        highWord = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(key != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (key != NULL)
+  {
+    keyPtr = key;
+    /* Combine short keys into two words and mix them. */
+    if (keySize <= 8U)
+    {
+      for (size_t idx = 0U; idx < keySize; idx++)
+      {
+        if (idx < 4U)
+        {
+          lowWord |= (uint32_t)keyPtr[idx] << (8U * idx);
+        }
+        else
+        {
+          highWord |= (uint32_t)keyPtr[idx] << (8U * (idx - 4U));
+        }
+      }
+      result = TbxHashMapMix(lowWord ^ TbxHashMapMix(highWord ^ (uint32_t)keySize));
+    }
+    /* Hash longer keys byte by byte. */
+    else
+    {
+      result = 2166136261UL;
+      for (size_t idx = 0U; idx < keySize; idx++)
+      {
+        result ^= keyPtr[idx];
+        result *= 16777619UL;
+      }
+      result = TbxHashMapMix(result);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapDefaultHash ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates memory from the memory pools. If this fails, the memory pool of
+**            the size class that the requested size belongs to is created or extended
+**            and the allocation is attempted again. Using size classes, instead of the
+**            exact size, keeps the number of memory pools small when the table grows.
+**            A table released after growing goes back to its memory pool, where it is
+**            available for the next table of a similar size. Note that its heap space
+**            is never returned to the heap itself.
+** \param     size Number of bytes to allocate.
+** \return    Pointer to the allocated memory if successful, NULL otherwise.
+**
+****************************************************************************************/
+static void * TbxHashMapMemAllocate(size_t size)
+{
+  void * result;
+
+  /* Attempt to allocate a block from the best fitting memory pool. */
+  result = TbxMemPoolAllocate(size);
+  /* In case the allocation failed, try to add another block to the memory pool. This
+   * works as long as there is enough heap configured.
+   */
+  if (result == NULL)
+  {
+    /* Round up to the size class, such that the new block is reusable for nearby
+     * sizes as well.
+     */
+    size = TbxMemPoolGetSizeClass(size);
+    if (TbxMemPoolCreate(1U, size) == TBX_OK)
+    {
+      /* Second attempt of the block allocation. */
+      result = TbxMemPoolAllocate(size);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapMemAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates a table with empty slots.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     table Pointer to the table.
+** \param     numSlots Number of slots. It must be a power of two.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t TbxHashMapTableCreate(tTbxHashMap const * map,
+                                     tTbxHashMapTable  * table,
+                                     size_t              numSlots)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Allocate the memory for the slots. */
+  table->slotsPtr = TbxHashMapMemAllocate(numSlots * map->slotSize);
+  /* Only continue if the allocation was successful. */
+  if (table->slotsPtr != NULL)
+  {
+    table->indexMask = numSlots - 1U;
+    table->count = 0U;
+    /* Mark all slots as empty. */
+    for (size_t idx = 0U; idx < numSlots; idx++)
+    {
+      TbxHashMapTableGetSlot(map, table, idx)->hash = TBX_HASHMAP_HASH_EMPTY;
+    }
+    /* Update the result for success. */
+    result = TBX_OK;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapTableCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the slot at the specified index of a table.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     table Pointer to the table.
+** \param     idx Index of the slot.
+** \return    Pointer to the slot.
+**
+****************************************************************************************/
+static tTbxHashMapSlot * TbxHashMapTableGetSlot(tTbxHashMap      const * map,
+                                                tTbxHashMapTable const * table,
+                                                size_t                   idx)
+{
+  /* Give the result back to the caller. */
+  return (tTbxHashMapSlot *)(void *)&table->slotsPtr[idx * map->slotSize];
+} /*** end of TbxHashMapTableGetSlot ***/
+
+
+/************************************************************************************//**
+** \brief     Searches a table for the entry with the specified key. The entries are
+**            placed with Robin Hood hashing: an entry never has a longer distance to its
+**            home slot than the entry that comes after it. This means that the search
+**            can stop as soon as an entry is found that is closer to its home slot than
+**            the searched entry would be.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     table Pointer to the table.
+** \param     hash Hash value of the key.
+** \param     key Pointer to the key bytes.
+** \param     slotIdx Pointer to where the index of the found slot is stored.
+** \return    Pointer to the slot with the entry or NULL if the key is not present.
+**
+****************************************************************************************/
+static tTbxHashMapSlot * TbxHashMapTableFind(tTbxHashMap      const * map,
+                                             tTbxHashMapTable const * table,
+                                             uint32_t                 hash,
+                                             void             const * key,
+                                             size_t                 * slotIdx)
+{
+  tTbxHashMapSlot * result = NULL;
+  tTbxHashMapSlot * slotPtr;
+  uint8_t   const * slotKeyPtr;
+  uint8_t   const * keyPtr = key;
+  uint8_t           done = TBX_FALSE;
+  uint8_t           keyMatch;
+  size_t            idx;
+  size_t            distance = 0U;
+
+  idx = (size_t)hash & table->indexMask;
+  while (done == TBX_FALSE)
+  {
+    slotPtr = TbxHashMapTableGetSlot(map, table, idx);
+    /* Stop at an empty slot or at an entry that is closer to its home slot. */
+    if ( (slotPtr->hash == TBX_HASHMAP_HASH_EMPTY) ||
+         (((idx - (size_t)slotPtr->hash) & table->indexMask) < distance) ||
+         (distance > table->indexMask) )
+    {
+      done = TBX_TRUE;
+    }
+    /* Only compare the keys if the hash values match. */
+    else if (slotPtr->hash == hash)
+    {
+      keyMatch = TBX_TRUE;
+      slotKeyPtr = &((uint8_t const *)(void const *)slotPtr)[sizeof(tTbxHashMapSlot)];
+      for (size_t byteIdx = 0U; byteIdx < map->keySize; byteIdx++)
+      {
+        if (slotKeyPtr[byteIdx] != keyPtr[byteIdx])
+        {
+          keyMatch = TBX_FALSE;
+        }
+      }
+      if (keyMatch == TBX_TRUE)
+      {
+        result = slotPtr;
+        *slotIdx = idx;
+        done = TBX_TRUE;
+      }
+    }
+    else
+    {
+      /* No match. Continue with the next slot. */
+    }
+    idx = (idx + 1U) & table->indexMask;
+    distance++;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapTableFind ***/
+
+
+/************************************************************************************//**
+** \brief     Places the entry that is held in the scratch slot of the hash map in a
+**            table, with Robin Hood hashing. While searching for an empty slot, the
+**            entry takes the place of each entry that is closer to its home slot. The
+**            displaced entry then continues the search. The caller should make sure that
+**            the key is not yet present and that the table has at least one empty slot.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     table Pointer to the table.
+**
+****************************************************************************************/
+static void TbxHashMapTablePlace(tTbxHashMap      * map,
+                                 tTbxHashMapTable * table)
+{
+  tTbxHashMapSlot * slotPtr;
+  tTbxHashMapSlot * scratchSlotPtr;
+  uint8_t         * slotBytesPtr;
+  uint8_t           byteValue;
+  uint8_t           done = TBX_FALSE;
+  size_t            idx;
+  size_t            distance = 0U;
+  size_t            slotDistance;
+
+  scratchSlotPtr = (tTbxHashMapSlot *)(void *)map->scratchPtr;
+  idx = (size_t)scratchSlotPtr->hash & table->indexMask;
+  while (done == TBX_FALSE)
+  {
+    slotPtr = TbxHashMapTableGetSlot(map, table, idx);
+    slotBytesPtr = (uint8_t *)(void *)slotPtr;
+    /* Store the entry in the slot, if it is empty. */
+    if (slotPtr->hash == TBX_HASHMAP_HASH_EMPTY)
+    {
+      for (size_t byteIdx = 0U; byteIdx < map->slotSize; byteIdx++)
+      {
+        slotBytesPtr[byteIdx] = map->scratchPtr[byteIdx];
+      }
+      table->count++;
+      done = TBX_TRUE;
+    }
+    else
+    {
+      /* Swap the entries, if the one in the slot is closer to its home slot. */
+      slotDistance = (idx - (size_t)slotPtr->hash) & table->indexMask;
+      if (slotDistance < distance)
+      {
+        for (size_t byteIdx = 0U; byteIdx < map->slotSize; byteIdx++)
+        {
+          byteValue = slotBytesPtr[byteIdx];
+          slotBytesPtr[byteIdx] = map->scratchPtr[byteIdx];
+          map->scratchPtr[byteIdx] = byteValue;
+        }
+        distance = slotDistance;
+      }
+      idx = (idx + 1U) & table->indexMask;
+      distance++;
+    }
+  }
+} /*** end of TbxHashMapTablePlace ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the entry at the specified slot of a table. The entries that follow
+**            it are shifted back by one slot, until an empty slot or an entry in its
+**            home slot is reached. This keeps the Robin Hood ordering intact, without
+**            the need for markers of removed entries.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     table Pointer to the table.
+** \param     slotIdx Index of the slot with the entry to remove.
+**
+****************************************************************************************/
+static void TbxHashMapTableRemove(tTbxHashMap const * map,
+                                  tTbxHashMapTable  * table,
+                                  size_t              slotIdx)
+{
+  tTbxHashMapSlot * slotPtr;
+  tTbxHashMapSlot * nextSlotPtr;
+  uint8_t         * slotBytesPtr;
+  uint8_t   const * nextSlotBytesPtr;
+  size_t            idx = slotIdx;
+  size_t            nextIdx;
+
+  slotPtr = TbxHashMapTableGetSlot(map, table, idx);
+  nextIdx = (idx + 1U) & table->indexMask;
+  nextSlotPtr = TbxHashMapTableGetSlot(map, table, nextIdx);
+  /* Shift back the entries that are not in their home slot. */
+  while ( (nextSlotPtr->hash != TBX_HASHMAP_HASH_EMPTY) &&
+          (((nextIdx - (size_t)nextSlotPtr->hash) & table->indexMask) != 0U) )
+  {
+    slotBytesPtr = (uint8_t *)(void *)slotPtr;
+    nextSlotBytesPtr = (uint8_t const *)(void const *)nextSlotPtr;
+    for (size_t byteIdx = 0U; byteIdx < map->slotSize; byteIdx++)
+    {
+      slotBytesPtr[byteIdx] = nextSlotBytesPtr[byteIdx];
+    }
+    slotPtr = nextSlotPtr;
+    nextIdx = (nextIdx + 1U) & table->indexMask;
+    nextSlotPtr = TbxHashMapTableGetSlot(map, table, nextIdx);
+  }
+  /* The last slot that was shifted from is now empty. */
+  slotPtr->hash = TBX_HASHMAP_HASH_EMPTY;
+  table->count--;
+} /*** end of TbxHashMapTableRemove ***/
+
+
+/************************************************************************************//**
+** \brief     Grows the hash map to twice its number of slots. The current table becomes
+**            the old table, from which the entries are moved to the new table with the
+**            following changes of the hash map. If the old table from a previous growth
+**            still holds entries, these are moved first.
+** \param     map Pointer to a previously created hash map to operate on.
+**
+****************************************************************************************/
+static void TbxHashMapGrow(tTbxHashMap * map)
+{
+  tTbxHashMapTable newTable;
+  size_t           numSlots;
+
+  /* Finish moving the entries from the old table, if a previous growth is still in
+   * progress. This normally does not happen, because the number of slots that are
+   * processed with each change makes sure it finishes in time.
+   */
+  if (map->oldTable.slotsPtr != NULL)
+  {
+    TbxHashMapMigrate(map, SIZE_MAX);
+  }
+  /* Only grow if the number of slots does not overflow. */
+  numSlots = map->table.indexMask + 1U;
+  if (numSlots <= ((SIZE_MAX / 2U) / (2U * map->slotSize)))
+  {
+    /* Allocate the new table. Without enough memory, the hash map simply stays at its
+     * current size.
+     */
+    if (TbxHashMapTableCreate(map, &newTable, 2U * numSlots) == TBX_OK)
+    {
+      map->oldTable = map->table;
+      map->table = newTable;
+      map->migrateIdx = 0U;
+    }
+  }
+} /*** end of TbxHashMapGrow ***/
+
+
+/************************************************************************************//**
+** \brief     Moves the entries from a number of slots in the old table to the new table.
+**            Once the old table is empty, its memory is released.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     numSlots Maximum number of slots of the old table to process.
+**
+****************************************************************************************/
+static void TbxHashMapMigrate(tTbxHashMap * map,
+                              size_t        numSlots)
+{
+  tTbxHashMapSlot * slotPtr;
+  uint8_t   const * slotBytesPtr;
+  size_t            slotCount = 0U;
+
+  /* Only continue if the hash map is growing. */
+  if (map->oldTable.slotsPtr != NULL)
+  {
+    while ( (slotCount < numSlots) && (map->oldTable.count > 0U) &&
+            (map->migrateIdx <= map->oldTable.indexMask) )
+    {
+      slotPtr = TbxHashMapTableGetSlot(map, &map->oldTable, map->migrateIdx);
+      /* Removing the entry can shift the next one into this slot. That is why the slot
+       * is only done once it is empty.
+       */
+      if (slotPtr->hash != TBX_HASHMAP_HASH_EMPTY)
+      {
+        slotBytesPtr = (uint8_t const *)(void const *)slotPtr;
+        for (size_t byteIdx = 0U; byteIdx < map->slotSize; byteIdx++)
+        {
+          map->scratchPtr[byteIdx] = slotBytesPtr[byteIdx];
+        }
+        TbxHashMapTablePlace(map, &map->table);
+        TbxHashMapTableRemove(map, &map->oldTable, map->migrateIdx);
+      }
+      else
+      {
+        map->migrateIdx++;
+      }
+      slotCount++;
+    }
+    /* Release the old table, once all its entries were moved. */
+    if (map->oldTable.count == 0U)
+    {
+      TbxMemPoolRelease(map->oldTable.slotsPtr);
+      map->oldTable.slotsPtr = NULL;
+      map->oldTable.indexMask = 0U;
+    }
+  }
+} /*** end of TbxHashMapMigrate ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the hash value of a key with the callback function of the hash
+**            map. The hash value that marks an empty slot is replaced by another one.
+** \param     map Pointer to a previously created hash map to operate on.
+** \param     key Pointer to the key bytes.
+** \return    The hash value.
+**
+****************************************************************************************/
+static uint32_t TbxHashMapGetHash(tTbxHashMap const * map,
+                                  void        const * key)
+{
+  uint32_t result;
+
+  result = map->hashKeyFcn(key, map->keySize);
+  if (result == TBX_HASHMAP_HASH_EMPTY)
+  {
+    result = TBX_HASHMAP_HASH_EMPTY + 1U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapGetHash ***/
+
+
+/************************************************************************************//**
+** \brief     Mixes the bits of a value, such that each input bit affects each output bit.
+**            This is the finalizer of the MurmurHash3 algorithm.
+** \param     value The value to mix.
+** \return    The mixed value.
+**
+****************************************************************************************/
+static uint32_t TbxHashMapMix(uint32_t value)
+{
+  uint32_t result = value;
+
+  result ^= result >> 16U;
+  result *= 0x85EBCA6BUL;
+  result ^= result >> 13U;
+  result *= 0xC2B2AE35UL;
+  result ^= result >> 16U;
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHashMapMix ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the hash map.
+** \param     map Pointer to a previously created hash map to operate on.
+**
+****************************************************************************************/
+static void TbxHashMapLockEnter(tTbxHashMap const * map)
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /* Enter the lock object of the hash map. Note that it is accessed through its pointer,
+   * which makes this also possible for functions that only have read access to the
+   * hash map.
+   */
+  TbxLockEnter(map->lockPtr);
+#else
+  /* The hash map does not have its own lock object, so use the global critical
+   * section.
+   */
+  (void)map;
+  TbxCriticalSectionEnter();
+#endif
+} /*** end of TbxHashMapLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the hash map.
+** \param     map Pointer to a previously created hash map to operate on.
+**
+****************************************************************************************/
+static void TbxHashMapLockExit(tTbxHashMap const * map)
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /* Exit the lock object of the hash map. */
+  TbxLockExit(map->lockPtr);
+#else
+  /* The hash map does not have its own lock object, so use the global critical
+   * section.
+   */
+  (void)map;
+  TbxCriticalSectionExit();
+#endif
+} /*** end of TbxHashMapLockExit ***/
+
+
+/*********************************** end of tbx_hashmap.c ******************************/
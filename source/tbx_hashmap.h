@@ -0,0 +1,146 @@
+/************************************************************************************//**
+* \file         tbx_hashmap.h
+* \brief        Hash maps header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_HASHMAP_H
+#define TBX_HASHMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_HASHMAP_MAX_LOAD
+/** \brief Maximum percentage of the slots of a hash map that can be in use, before the
+ *         hash map grows to twice its number of slots. A lower value shortens the
+ *         searches, at the cost of more memory. Note that it is possible to override
+ *         this value by adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_HASHMAP_MAX_LOAD                (75U)
+#endif
+
+#if ((TBX_CONF_HASHMAP_MAX_LOAD < 10U) || (TBX_CONF_HASHMAP_MAX_LOAD > 95U))
+#error "TBX_CONF_HASHMAP_MAX_LOAD must be in the range 10..95."
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Callback function to calculate the hash value of a key. The key parameter
+ *         points to the key bytes and the keySize parameter holds the number of key
+ *         bytes, as configured when creating the hash map.
+ */
+typedef uint32_t (* tTbxHashMapHashKey)(void const * key,
+                                        size_t       keySize);
+
+/** \brief Layout of the table with slots of a hash map. Note that its elements should be
+ *         considered private and only be accessed internally by this hash map module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the slots or NULL if the table is not allocated. */
+  uint8_t * slotsPtr;
+  /** \brief Number of slots in the table minus one. */
+  size_t    indexMask;
+  /** \brief Number of slots in the table that are in use. */
+  size_t    count;
+} tTbxHashMapTable;
+
+/** \brief Layout of a hash map. Its pointer serves as the handle to the hash map, which
+ *         is obtained after creation of the hash map and which is needed in the other
+ *         functions of this module. Note that its elements should be considered private
+ *         and only be accessed internally by this hash map module.
+ */
+typedef struct
+{
+  /** \brief Table in which new entries are inserted. */
+  tTbxHashMapTable     table;
+  /** \brief Table from before the hash map grew. Its entries are moved to the new table
+   *         a few at a time, with each change of the hash map.
+   */
+  tTbxHashMapTable     oldTable;
+  /** \brief Index of the next slot in the old table, from where entries are moved. */
+  size_t               migrateIdx;
+  /** \brief Number of bytes of a key. */
+  size_t               keySize;
+  /** \brief Number of bytes that each slot occupies in a table. */
+  size_t               slotSize;
+  /** \brief Callback function to calculate the hash value of a key. */
+  tTbxHashMapHashKey   hashKeyFcn;
+  /** \brief Pointer to the memory of one slot, for temporarily holding an entry. */
+  uint8_t            * scratchPtr;
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /** \brief Lock object for mutual exclusive access to the hash map. */
+  tTbxLock             lock;
+  /** \brief Pointer to the lock object. Needed for obtaining mutual exclusive access in
+   *         functions that only have read access to the hash map.
+   */
+  tTbxLock           * lockPtr;
+#endif
+} tTbxHashMap;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxHashMap * TbxHashMapCreate     (size_t                   capacity,
+                                    size_t                   keySize,
+                                    tTbxHashMapHashKey       hashKeyFcn);
+
+void          TbxHashMapDelete     (tTbxHashMap            * map);
+
+size_t        TbxHashMapGetSize    (tTbxHashMap      const * map);
+
+uint8_t       TbxHashMapInsert     (tTbxHashMap            * map,
+                                    void             const * key,
+                                    void                   * value);
+
+void        * TbxHashMapFind       (tTbxHashMap      const * map,
+                                    void             const * key);
+
+void        * TbxHashMapRemove     (tTbxHashMap            * map,
+                                    void             const * key);
+
+uint32_t      TbxHashMapDefaultHash(void             const * key,
+                                    size_t                   keySize);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_HASHMAP_H */
+/*********************************** end of tbx_hashmap.h ******************************/
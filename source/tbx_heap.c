@@ -51,11 +51,42 @@
 #endif
 
 
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of bytes of the heap buffer that the default heap region manages. The
+ *         number of allocated bytes is updated with a 32-bit atomic compare and exchange
+ *         operation. So just like with TbxHeapRegionCreate(), the size is limited to
+ *         what fits in 32 bits. This only affects 64-bit targets with a heap of 4 GiB or
+ *         more, which can still use the first 4 GiB of it.
+ */
+#define TBX_HEAP_DEFAULT_REGION_SIZE             ((TBX_CONF_HEAP_SIZE > 0xFFFFFFFFU) ? \
+                                                  0xFFFFFFFFU : TBX_CONF_HEAP_SIZE)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static size_t TbxHeapGetAlignPadding(void const * memPtr,
+                                     size_t       alignment);
+
+
 /****************************************************************************************
 * Local data declarations
 ****************************************************************************************/
-/** \brief Keeps track of how many bytes have already been allocated on the heap. */
-static size_t tbxHeapAllocated = 0U;
+/* cppcheck-suppress [unassignedVariable,unmatchedSuppression] 
+ * The actual heap buffer. Whenever memory needs to be dynamically allocated, it will
+ * be taken from this buffer. As such, it is okay to not be initialized and therefore
+ * the warning about no value being assigned to this variable can be ignored.
+ */
+static uint8_t        tbxHeapBuffer[TBX_CONF_HEAP_SIZE];
+
+/** \brief The default heap region. Functions TbxHeapAllocate(), TbxHeapAllocateAligned()
+ *         and TbxHeapGetFree() operate on this heap region.
+ */
+static tTbxHeapRegion tbxHeapRegionDefault = { tbxHeapBuffer,
+                                               (uint32_t)TBX_HEAP_DEFAULT_REGION_SIZE,
+                                               0U };
 
 
 /************************************************************************************//**
@@ -69,13 +100,7 @@ static size_t tbxHeapAllocated = 0U;
 ****************************************************************************************/
 void * TbxHeapAllocate(size_t size)
 {
-  /* cppcheck-suppress [unassignedVariable,unmatchedSuppression] 
-   * The actual heap buffer. Whenever memory needs to be dynamically allocated, it will
-   * be taken from this buffer. As such, it is okay to not be initialized and therefore
-   * the warning about no value being assigned to this variable can be ignored.
-   */
-  static uint8_t   tbxHeapBuffer[TBX_CONF_HEAP_SIZE];
-  void           * result = NULL;
+  void * result = NULL;
 
   /* Verify parameter. */
   TBX_ASSERT(size > 0U);
@@ -83,22 +108,10 @@ void * TbxHeapAllocate(size_t size)
   /* Only continue if the parameters are valid. */
   if (size > 0U)
   {
-    /* Align the desired size to the address size to make it work on all targets. */
-    size_t sizeWanted = (size + (sizeof(void *) - 1U)) & ~(sizeof(void *) - 1U);
-    /* Obtain mutual exclusive access to tbxHeapAllocated. */
-    TbxCriticalSectionEnter();
-      /* Determine the number of still available bytes in the heap buffer. */
-    size_t sizeAvailable = TBX_CONF_HEAP_SIZE - tbxHeapAllocated;
-    /* Is there enough space left on the heap for this allocation request? */
-    if (sizeAvailable >= sizeWanted)
-    {
-      /* Set the address for the newly allocated memory. */
-      result = &tbxHeapBuffer[tbxHeapAllocated];
-      /* Perform the actual allocation by incrementing the counter. */
-      tbxHeapAllocated += sizeWanted;
-    }
-    /* Release mutual exclusive access to tbxHeapAllocated. */
-    TbxCriticalSectionExit();
+    /* Allocate from the default heap region, aligned to the address size to make it
+     * work on all targets.
+     */
+    result = TbxHeapRegionAllocate(&tbxHeapRegionDefault, size, sizeof(void *));
   }
 
   /* Return the address of the allocated memory to the caller. */
@@ -106,6 +119,27 @@ void * TbxHeapAllocate(size_t size)
 } /*** end of TbxHeapAllocate ***/
 
 
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes on the heap, such that the start
+**            address of the allocated memory is aligned to the specified number of
+**            bytes. Useful for buffers that need to be aligned to a cache line, for
+**            example for DMA transfers.
+** \param     size The number of bytes to allocate on the heap.
+** \param     alignment Alignment of the start address in bytes. Must be a power of two.
+** \return    Pointer to the start of the newly allocated heap memory if successful,
+**            NULL otherwise.
+**
+****************************************************************************************/
+void * TbxHeapAllocateAligned(size_t size,
+                              size_t alignment)
+{
+  /* Allocate from the default heap region. Note that this function also verifies the
+   * parameters.
+   */
+  return TbxHeapRegionAllocate(&tbxHeapRegionDefault, size, alignment);
+} /*** end of TbxHeapAllocateAligned ***/
+
+
 /************************************************************************************//**
 ** \brief     Obtains the current amount of bytes that are still available on the heap.
 ** \return    Number of free bytes on the heap.
@@ -113,18 +147,202 @@ void * TbxHeapAllocate(size_t size)
 ****************************************************************************************/
 size_t TbxHeapGetFree(void)
 {
-  size_t result;
+  /* Obtain the number of free bytes in the default heap region. */
+  return TbxHeapRegionGetFree(&tbxHeapRegionDefault);
+} /*** end of TbxHeapGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new heap region in the specified memory. This makes it possible
+**            to allocate memory from a specific RAM area, for example tightly coupled
+**            memory for data that is accessed often or external RAM for large buffers.
+**            The application declares the memory, typically as a byte array, and places
+**            it in the desired RAM area with the section attribute of its compiler. The
+**            control data of the heap region is stored at the start of the memory, so
+**            the number of bytes available for allocation is slightly less than the
+**            size of the memory.
+** \param     memPtr Pointer to the start of the memory for the heap region.
+** \param     size The size of the memory in bytes.
+** \return    Handle to the newly created heap region if successful, NULL otherwise.
+**
+****************************************************************************************/
+tTbxHeapRegion * TbxHeapRegionCreate(void   * memPtr,
+                                     size_t   size)
+{
+  tTbxHeapRegion * result = NULL;
+  size_t           padding;
+  size_t           regionSize;
 
-  /* Obtain mutual exclusive access to tbxHeapAllocated. */
-  TbxCriticalSectionEnter();
-  /* Determine the number of still available bytes in the heap buffer. */
-  result = TBX_CONF_HEAP_SIZE - tbxHeapAllocated;
-  /* Release mutual exclusive access to tbxHeapAllocated. */
-  TbxCriticalSectionExit();
+  /* Verify parameters. */
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (memPtr != NULL) && (size > 0U) )
+  {
+    /* Determine the number of bytes to skip at the start of the memory to align the
+     * control data of the heap region to the address size.
+     */
+    padding = TbxHeapGetAlignPadding(memPtr, sizeof(void *));
+    /* Only continue if the memory is large enough to hold the control data. */
+    if (size > (padding + sizeof(tTbxHeapRegion)))
+    {
+      /* Place the control data of the heap region at the start of the memory. */
+      result = (tTbxHeapRegion *)(void *)&((uint8_t *)memPtr)[padding];
+      /* The memory for allocation follows directly after the control data. */
+      regionSize = size - padding - sizeof(tTbxHeapRegion);
+#if (SIZE_MAX > 0xFFFFFFFFU)
+      /* Limit the size to what can be represented by the heap region. */
+      if (regionSize > 0xFFFFFFFFU)
+      {
+        regionSize = 0xFFFFFFFFU;
+      }
+#endif
+      /* Initialize the heap region. */
+      result->bufferPtr = (uint8_t *)&result[1];
+      result->size = (uint32_t)regionSize;
+      result->allocated = 0U;
+    }
+  }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxHeapGetFree ***/
+} /*** end of TbxHeapRegionCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes in the specified heap region, such
+**            that the start address of the allocated memory is aligned to the specified
+**            number of bytes. The allocation is lock-free. Instead of entering a
+**            critical section, the number of allocated bytes is advanced with an atomic
+**            compare and exchange operation.
+** \param     region Handle to the heap region to allocate from.
+** \param     size The number of bytes to allocate.
+** \param     alignment Alignment of the start address in bytes. Must be a power of two.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxHeapRegionAllocate(tTbxHeapRegion * region,
+                             size_t           size,
+                             size_t           alignment)
+{
+  void * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(region != NULL);
+  TBX_ASSERT(size > 0U);
+  TBX_ASSERT( (alignment > 0U) && ((alignment & (alignment - 1U)) == 0U) );
+
+  /* Only continue if the parameters are valid. */
+  if ( (region != NULL) && (size > 0U) && 
+       (alignment > 0U) && ((alignment & (alignment - 1U)) == 0U) )
+  {
+    /* Align the desired size to the address size to make it work on all targets. */
+    size_t   sizeWanted = (size + (sizeof(void *) - 1U)) & ~(sizeof(void *) - 1U);
+    size_t   sizeAvailable;
+    size_t   padding;
+    uint32_t allocatedOld;
+    uint32_t allocatedNew;
+    uint32_t allocatedPrev;
+
+    /* Atomically read the number of already allocated bytes. */
+    allocatedPrev = TbxPortAtomicCompareExchange32(&region->allocated, 0U, 0U);
+    /* Keep trying until the number of allocated bytes was atomically updated. This fails
+     * only if it was changed, for example by an interrupt or another thread, after it
+     * was read.
+     */
+    do
+    {
+      allocatedOld = allocatedPrev;
+      allocatedNew = allocatedOld;
+      /* Determine the number of bytes to skip for aligning the start address. */
+      padding = TbxHeapGetAlignPadding(&region->bufferPtr[allocatedOld], alignment);
+      /* Is there enough space left in the heap region for this allocation request? */
+      sizeAvailable = (size_t)region->size - (size_t)allocatedOld;
+      if ( (sizeAvailable >= padding) && ((sizeAvailable - padding) >= sizeWanted) )
+      {
+        /* Perform the actual allocation by incrementing the counter. */
+        allocatedNew = allocatedOld + (uint32_t)(padding + sizeWanted);
+      }
+      /* Atomically store the new value. Also done when there is not enough space left,
+       * to verify that the decision was based on an up-to-date value.
+       */
+      allocatedPrev = TbxPortAtomicCompareExchange32(&region->allocated, allocatedOld,
+                                                     allocatedNew);
+    }
+    while (allocatedPrev != allocatedOld);
+    /* Did the allocation succeed? */
+    if (allocatedNew != allocatedOld)
+    {
+      /* Set the address for the newly allocated memory. */
+      result = &region->bufferPtr[allocatedOld + padding];
+    }
+  }
+
+  /* Return the address of the allocated memory to the caller. */
+  return result;
+} /*** end of TbxHeapRegionAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the current amount of bytes that are still available in the
+**            specified heap region.
+** \param     region Handle to the heap region.
+** \return    Number of free bytes in the heap region.
+**
+****************************************************************************************/
+size_t TbxHeapRegionGetFree(tTbxHeapRegion const * region)
+{
+  size_t   result = 0U;
+  uint32_t allocated;
+
+  /* Verify parameter. */
+  TBX_ASSERT(region != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (region != NULL)
+  {
+    /* Atomically read the number of already allocated bytes. The compare and exchange
+     * operation never changes the value, because it only writes the value it expects.
+     * Note that the cast only removes the const qualifier for this reason.
+     */
+    allocated = TbxPortAtomicCompareExchange32((uint32_t volatile *)&region->allocated,
+                                               0U, 0U);
+    /* Determine the number of still available bytes in the heap region. */
+    result = (size_t)region->size - (size_t)allocated;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapRegionGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the number of bytes to add to the specified address to align it
+**            to the specified number of bytes.
+** \param     memPtr The address to align.
+** \param     alignment Alignment in bytes. Must be a power of two.
+** \return    Number of bytes to add to the address to align it.
+**
+****************************************************************************************/
+static size_t TbxHeapGetAlignPadding(void const * memPtr,
+                                     size_t       alignment)
+{
+  size_t    result = 0U;
+  uintptr_t misalignment;
+
+  /* Determine by how many bytes the address is past the previous aligned address. */
+  misalignment = (uintptr_t)memPtr & (uintptr_t)(alignment - 1U);
+  /* Calculate the number of bytes to the next aligned address, if not yet aligned. */
+  if (misalignment != 0U)
+  {
+    result = alignment - (size_t)misalignment;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxHeapGetAlignPadding ***/
 
 
 /*********************************** end of tbx_heap.c *********************************/
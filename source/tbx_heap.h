@@ -39,12 +39,45 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a heap region. Its pointer serves as the handle to the heap region,
+ *         which is obtained after creation of the heap region and which is needed in the
+ *         other heap region functions. Note that its elements should be considered
+ *         private and only be accessed internally by this heap module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the start of the memory from where the heap region allocates. */
+  uint8_t           * bufferPtr;
+  /** \brief Total number of bytes that the heap region can allocate. */
+  uint32_t            size;
+  /** \brief Number of bytes that were already allocated in the heap region. Only
+   *         accessed with an atomic compare and exchange operation.
+   */
+  volatile uint32_t   allocated;
+} tTbxHeapRegion;
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-void * TbxHeapAllocate(size_t size);
+void           * TbxHeapAllocate       (size_t                   size);
+
+void           * TbxHeapAllocateAligned(size_t                   size,
+                                        size_t                   alignment);
+
+size_t           TbxHeapGetFree        (void);
+
+tTbxHeapRegion * TbxHeapRegionCreate   (void                   * memPtr,
+                                        size_t                   size);
+
+void           * TbxHeapRegionAllocate (tTbxHeapRegion         * region,
+                                        size_t                   size,
+                                        size_t                   alignment);
 
-size_t TbxHeapGetFree (void);
+size_t           TbxHeapRegionGetFree  (tTbxHeapRegion   const * region);
 
 
 #ifdef __cplusplus
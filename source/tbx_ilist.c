@@ -0,0 +1,562 @@
+/************************************************************************************//**
+* \file         tbx_ilist.c
+* \brief        Intrusive linked lists source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TbxIListLockEnter(tTbxIList const * list);
+
+static void TbxIListLockExit (tTbxIList const * list);
+
+
+/************************************************************************************//**
+** \brief     Initializes an intrusive linked list. Afterwards, the list is empty. Make
+**            sure to call this function once, before calling the other API functions in
+**            this module. Since the nodes are embedded in the items, inserting and
+**            removing items never allocates memory and never fails.
+** \param     list Pointer to the intrusive linked list to initialize.
+**
+****************************************************************************************/
+void TbxIListInit(tTbxIList * list)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (list != NULL)
+  {
+    /* By default the list is empty. */
+    list->firstNodePtr = NULL;
+    list->lastNodePtr = NULL;
+    list->nodeCount = 0U;
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+    /* Initialize the lock object of the list. */
+    TbxLockInit(&list->lock);
+    list->lockPtr = &list->lock;
+#endif
+  }
+} /*** end of TbxIListInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of nodes that are currently stored in the list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \return    Total number of nodes currently stored in the list.
+**
+****************************************************************************************/
+size_t TbxIListGetSize(tTbxIList const * list)
+{
+  size_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (list != NULL)
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Store the current number of nodes in the list in the result variable. */
+    result = list->nodeCount;
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxIListGetSize ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts a node into the list. The node will be added at the start of the
+**            list. Note that the node should not already be part of a list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     node Pointer to the node that is embedded in the item to insert.
+**
+****************************************************************************************/
+void TbxIListInsertNodeFront(tTbxIList     * list,
+                             tTbxIListNode * node)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* The node will be added at the start, so it has no previous node. */
+    node->prevNodePtr = NULL;
+    node->nextNodePtr = list->firstNodePtr;
+    /* Check if the list is not empty. */
+    if (list->firstNodePtr != NULL)
+    {
+      /* The current start of the list should be moved down. */
+      list->firstNodePtr->prevNodePtr = node;
+    }
+    /* The list is currently empty. */
+    else
+    {
+      /* The node will be the only node, so it is also the last node. */
+      list->lastNodePtr = node;
+    }
+    /* Insert the node at the start of the list. */
+    list->firstNodePtr = node;
+    /* Increment the node counter. */
+    list->nodeCount++;
+    /* Release mutual exclusive access for the list. */
+    TbxIListLockExit(list);
+  }
+} /*** end of TbxIListInsertNodeFront ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts a node into the list. The node will be added at the end of the
+**            list. Note that the node should not already be part of a list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     node Pointer to the node that is embedded in the item to insert.
+**
+****************************************************************************************/
+void TbxIListInsertNodeBack(tTbxIList     * list,
+                            tTbxIListNode * node)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* The node will be added at the end, so it has no next node. */
+    node->prevNodePtr = list->lastNodePtr;
+    node->nextNodePtr = NULL;
+    /* Check if the list is not empty. */
+    if (list->lastNodePtr != NULL)
+    {
+      /* The current end of the list should be moved up. */
+      list->lastNodePtr->nextNodePtr = node;
+    }
+    /* The list is currently empty. */
+    else
+    {
+      /* The node will be the only node, so it is also the first node. */
+      list->firstNodePtr = node;
+    }
+    /* Insert the node at the end of the list. */
+    list->lastNodePtr = node;
+    /* Increment the node counter. */
+    list->nodeCount++;
+    /* Release mutual exclusive access for the list. */
+    TbxIListLockExit(list);
+  }
+} /*** end of TbxIListInsertNodeBack ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts a node into the list. The node will be added before the reference
+**            node. Note that the node should not already be part of a list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     node Pointer to the node that is embedded in the item to insert.
+** \param     nodeRef Reference node that is part of the list, before which the new node
+**            should be inserted.
+**
+****************************************************************************************/
+void TbxIListInsertNodeBefore(tTbxIList     * list,
+                              tTbxIListNode * node,
+                              tTbxIListNode * nodeRef)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+  TBX_ASSERT(nodeRef != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) && (nodeRef != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Link the node in between the reference node and its previous node. */
+    node->prevNodePtr = nodeRef->prevNodePtr;
+    node->nextNodePtr = nodeRef;
+    /* Is the reference node the first (or only) one in the list? */
+    if (nodeRef->prevNodePtr == NULL)
+    {
+      /* Sanity check. This should be the start of the list. */
+      TBX_ASSERT(nodeRef == list->firstNodePtr);
+      /* The node becomes the new start of the list. */
+      list->firstNodePtr = node;
+    }
+    else
+    {
+      nodeRef->prevNodePtr->nextNodePtr = node;
+    }
+    nodeRef->prevNodePtr = node;
+    /* Increment the node counter. */
+    list->nodeCount++;
+    /* Release mutual exclusive access for the list. */
+    TbxIListLockExit(list);
+  }
+} /*** end of TbxIListInsertNodeBefore ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts a node into the list. The node will be added after the reference
+**            node. Note that the node should not already be part of a list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     node Pointer to the node that is embedded in the item to insert.
+** \param     nodeRef Reference node that is part of the list, after which the new node
+**            should be inserted.
+**
+****************************************************************************************/
+void TbxIListInsertNodeAfter(tTbxIList     * list,
+                             tTbxIListNode * node,
+                             tTbxIListNode * nodeRef)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+  TBX_ASSERT(nodeRef != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) && (nodeRef != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Link the node in between the reference node and its next node. */
+    node->prevNodePtr = nodeRef;
+    node->nextNodePtr = nodeRef->nextNodePtr;
+    /* Is the reference node the last (or only) one in the list? */
+    if (nodeRef->nextNodePtr == NULL)
+    {
+      /* Sanity check. This should be the end of the list. */
+      TBX_ASSERT(nodeRef == list->lastNodePtr);
+      /* The node becomes the new end of the list. */
+      list->lastNodePtr = node;
+    }
+    else
+    {
+      nodeRef->nextNodePtr->prevNodePtr = node;
+    }
+    nodeRef->nextNodePtr = node;
+    /* Increment the node counter. */
+    list->nodeCount++;
+    /* Release mutual exclusive access for the list. */
+    TbxIListLockExit(list);
+  }
+} /*** end of TbxIListInsertNodeAfter ***/
+
+
+/************************************************************************************//**
+** \brief     Removes a node from the list. Note that the node should be part of the
+**            list. Afterwards, the item that the node is embedded in can be inserted
+**            into a list again.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     node Pointer to the node to remove.
+**
+****************************************************************************************/
+void TbxIListRemoveNode(tTbxIList     * list,
+                        tTbxIListNode * node)
+{
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Sanity check. The list should have at least one node. */
+    TBX_ASSERT(list->nodeCount > 0U);
+    /* Unlink the node from its previous node, or from the start of the list. */
+    if (node->prevNodePtr == NULL)
+    {
+      /* Sanity check. This should be the start of the list. */
+      TBX_ASSERT(node == list->firstNodePtr);
+      list->firstNodePtr = node->nextNodePtr;
+    }
+    else
+    {
+      node->prevNodePtr->nextNodePtr = node->nextNodePtr;
+    }
+    /* Unlink the node from its next node, or from the end of the list. */
+    if (node->nextNodePtr == NULL)
+    {
+      /* Sanity check. This should be the end of the list. */
+      TBX_ASSERT(node == list->lastNodePtr);
+      list->lastNodePtr = node->prevNodePtr;
+    }
+    else
+    {
+      node->nextNodePtr->prevNodePtr = node->prevNodePtr;
+    }
+    /* The node is no longer part of the list. */
+    node->prevNodePtr = NULL;
+    node->nextNodePtr = NULL;
+    /* Decrement the node counter. */
+    list->nodeCount--;
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+} /*** end of TbxIListRemoveNode ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the node at the start of the list, if any. Useful for first-in
+**            first-out queues, because obtaining and removing the first node happens
+**            with just one access to the list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \return    The node that was removed from the start of the list or NULL if the list
+**            is empty.
+**
+****************************************************************************************/
+tTbxIListNode * TbxIListRemoveFirstNode(tTbxIList * list)
+{
+  tTbxIListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (list != NULL)
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Get the first node in the list if there is one. */
+    result = list->firstNodePtr;
+    if (result != NULL)
+    {
+      /* Make the next node the new start of the list. */
+      list->firstNodePtr = result->nextNodePtr;
+      if (list->firstNodePtr != NULL)
+      {
+        list->firstNodePtr->prevNodePtr = NULL;
+      }
+      /* The list is now empty. */
+      else
+      {
+        list->lastNodePtr = NULL;
+      }
+      /* The node is no longer part of the list. */
+      result->nextNodePtr = NULL;
+      /* Decrement the node counter. */
+      list->nodeCount--;
+    }
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxIListRemoveFirstNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node that is located at the start of the list. Note that the
+**            node is just read, not removed.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \return    The node at the start of the list or NULL if the list is empty.
+**
+****************************************************************************************/
+tTbxIListNode * TbxIListGetFirstNode(tTbxIList const * list)
+{
+  tTbxIListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (list != NULL)
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Get the first node in the list. */
+    result = list->firstNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxIListGetFirstNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node that is located at the end of the list. Note that the
+**            node is just read, not removed.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \return    The node at the end of the list or NULL if the list is empty.
+**
+****************************************************************************************/
+tTbxIListNode * TbxIListGetLastNode(tTbxIList const * list)
+{
+  tTbxIListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (list != NULL)
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Get the last node in the list. */
+    result = list->lastNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxIListGetLastNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node that is located one position before in the list,
+**            relative to the reference node.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     nodeRef Reference node that is part of the list.
+** \return    The node one position before in the list or NULL if the reference node is
+**            at the start of the list.
+**
+****************************************************************************************/
+tTbxIListNode * TbxIListGetPreviousNode(tTbxIList     const * list,
+                                        tTbxIListNode const * nodeRef)
+{
+  tTbxIListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(nodeRef != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (nodeRef != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Get the previous node in the list. */
+    result = nodeRef->prevNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxIListGetPreviousNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node that is located one position further down in the list,
+**            relative to the reference node.
+** \param     list Pointer to a previously initialized intrusive linked list.
+** \param     nodeRef Reference node that is part of the list.
+** \return    The node one position further down in the list or NULL if the reference
+**            node is at the end of the list.
+**
+****************************************************************************************/
+tTbxIListNode * TbxIListGetNextNode(tTbxIList     const * list,
+                                    tTbxIListNode const * nodeRef)
+{
+  tTbxIListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(nodeRef != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (nodeRef != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxIListLockEnter(list);
+    /* Get the next node in the list. */
+    result = nodeRef->nextNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxIListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxIListGetNextNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+**
+****************************************************************************************/
+static void TbxIListLockEnter(tTbxIList const * list)
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /* Enter the lock object of the list. Note that it is accessed through its pointer,
+   * which makes this also possible for functions that only have read access to the list.
+   */
+  TbxLockEnter(list->lockPtr);
+#else
+  /* The list does not have its own lock object, so use the global critical section. */
+  (void)list;
+  TbxCriticalSectionEnter();
+#endif
+} /*** end of TbxIListLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the list.
+** \param     list Pointer to a previously initialized intrusive linked list.
+**
+****************************************************************************************/
+static void TbxIListLockExit(tTbxIList const * list)
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /* Exit the lock object of the list. */
+  TbxLockExit(list->lockPtr);
+#else
+  /* The list does not have its own lock object, so use the global critical section. */
+  (void)list;
+  TbxCriticalSectionExit();
+#endif
+} /*** end of TbxIListLockExit ***/
+
+
+/*********************************** end of tbx_ilist.c ********************************/
@@ -0,0 +1,136 @@
+/************************************************************************************//**
+* \file         tbx_ilist.h
+* \brief        Intrusive linked lists header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_ILIST_H
+#define TBX_ILIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Obtains the pointer to the item that the intrusive linked list node is
+ *         embedded in. The type parameter is the type of the item and the member
+ *         parameter is the name of the tTbxIListNode element inside this type.
+ */
+#define TBX_ILIST_GET_ITEM(node, type, member) \
+  ((type *)(void *)((uint8_t *)(node) - offsetof(type, member)))
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of an intrusive linked list node. Unlike with tTbxList, the node is not
+ *         allocated by the linked list module. Instead, it is embedded as an element in
+ *         the item itself. Note that its elements should be considered private and only
+ *         be accessed internally by this intrusive linked list module.
+ */
+typedef struct t_tbx_ilist_node
+{
+  /** \brief Pointer to the previous node in the list or NULL if it is the list start. */
+  struct t_tbx_ilist_node * prevNodePtr;
+  /** \brief Pointer to the next node in the list or NULL if it is the list end. */
+  struct t_tbx_ilist_node * nextNodePtr;
+} tTbxIListNode;
+
+/** \brief Layout of an intrusive linked list. It can be allocated statically or as an
+ *         element of a larger structure. Initialize it with TbxIListInit(), before
+ *         calling the other functions of this module. Note that its elements should be
+ *         considered private and only be accessed internally by this intrusive linked
+ *         list module.
+ */
+typedef struct
+{
+  /** \brief Total number of nodes that are currently present in the linked list. */
+  size_t          nodeCount;
+  /** \brief Pointer to the first node of the linked list, also known as the head. */
+  tTbxIListNode * firstNodePtr;
+  /** \brief Pointer to the last node of the linked list, also known as the tail. */
+  tTbxIListNode * lastNodePtr;
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /** \brief Lock object for mutual exclusive access to the linked list. */
+  tTbxLock        lock;
+  /** \brief Pointer to the lock object. Needed for obtaining mutual exclusive access in
+   *         functions that only have read access to the linked list.
+   */
+  tTbxLock      * lockPtr;
+#endif
+} tTbxIList;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void            TbxIListInit           (tTbxIList           * list);
+
+size_t          TbxIListGetSize        (tTbxIList     const * list);
+
+void            TbxIListInsertNodeFront(tTbxIList           * list,
+                                        tTbxIListNode       * node);
+
+void            TbxIListInsertNodeBack (tTbxIList           * list,
+                                        tTbxIListNode       * node);
+
+void            TbxIListInsertNodeBefore(tTbxIList          * list,
+                                         tTbxIListNode      * node,
+                                         tTbxIListNode      * nodeRef);
+
+void            TbxIListInsertNodeAfter(tTbxIList           * list,
+                                        tTbxIListNode       * node,
+                                        tTbxIListNode       * nodeRef);
+
+void            TbxIListRemoveNode     (tTbxIList           * list,
+                                        tTbxIListNode       * node);
+
+tTbxIListNode * TbxIListRemoveFirstNode(tTbxIList           * list);
+
+tTbxIListNode * TbxIListGetFirstNode   (tTbxIList     const * list);
+
+tTbxIListNode * TbxIListGetLastNode    (tTbxIList     const * list);
+
+tTbxIListNode * TbxIListGetPreviousNode(tTbxIList     const * list,
+                                        tTbxIListNode const * nodeRef);
+
+tTbxIListNode * TbxIListGetNextNode    (tTbxIList     const * list,
+                                        tTbxIListNode const * nodeRef);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_ILIST_H */
+/*********************************** end of tbx_ilist.h ********************************/
@@ -43,8 +43,28 @@
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-static tTbxListNode * TbxListFindListNode(tTbxList const * list, 
-                                          void     const * item);
+static tTbxListNode * TbxListFindListNode  (tTbxList const * list, 
+                                            void     const * item);
+
+static tTbxListNode * TbxListNodeCreate    (void           * item);
+
+static void           TbxListNodeLinkFront (tTbxList       * list,
+                                            tTbxListNode   * newNodePtr);
+
+static void           TbxListNodeLinkBefore(tTbxList       * list,
+                                            tTbxListNode   * newNodePtr,
+                                            tTbxListNode   * refNodePtr);
+
+static void           TbxListNodeLinkAfter (tTbxList       * list,
+                                            tTbxListNode   * newNodePtr,
+                                            tTbxListNode   * refNodePtr);
+
+static void           TbxListNodeUnlink    (tTbxList       * list,
+                                            tTbxListNode   * nodePtr);
+
+static void           TbxListLockEnter     (tTbxList const * list);
+
+static void           TbxListLockExit      (tTbxList const * list);
 
 
 /************************************************************************************//**
@@ -68,15 +88,16 @@ tTbxList * TbxListCreate(void)
     memPoolsCreated = TBX_TRUE;
     /* This module allows the dynamic creation and deletion of a linked list and its
      * nodes. For both these times (tTbxList and tTbxListNode) a memory pool needs to be
-     * created. An initial size of 1 is sufficient, because the plan is to expand each
-     * memory pool whenever more blocks need to be allocated from it.
+     * created. An initial size of 1 is sufficient for the lists, because the plan is to
+     * expand each memory pool whenever more blocks need to be allocated from it. The
+     * memory pool for the nodes starts with one growth chunk.
      */
     if (TbxMemPoolCreate(1, sizeof(tTbxList)) == TBX_ERROR)
     {
       /* Flag the error. */
       errorDetected = TBX_TRUE;
     }
-    if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_ERROR)
+    if (TbxMemPoolCreate(TBX_CONF_LIST_GROWTH_CHUNK, sizeof(tTbxListNode)) == TBX_ERROR)
     {
       /* Flag the error. */
       errorDetected = TBX_TRUE;
@@ -109,6 +130,11 @@ tTbxList * TbxListCreate(void)
       newListPtr->firstNodePtr = NULL;
       newListPtr->lastNodePtr = NULL;
       newListPtr->nodeCount = 0U;
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+      /* Initialize the lock object of the list. */
+      TbxLockInit(&newListPtr->lock);
+      newListPtr->lockPtr = &newListPtr->lock;
+#endif
       /* The list was successfully created so update the result to give the pointer to
        * the newly created list back to the caller. This pointer serves as the handle to
        * the list and is needed when calling API function of this module.
@@ -136,14 +162,12 @@ void TbxListDelete(tTbxList * list)
   /* Only continue if the parameter is valid. */
   if (list != NULL)
   {
-    /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
     /* Clear the list. */
     TbxListClear(list);
-    /* Release memory of the list. */
+    /* Release memory of the list. Note that this should not be done while holding the
+     * lock of the list, because the lock object is part of the released memory.
+     */
     TbxMemPoolRelease(list);
-    /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
   }
 } /*** end of TbxListDelete ***/
 
@@ -169,7 +193,7 @@ void TbxListClear(tTbxList * list)
   if (list != NULL)
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Get the pointer to the node at the head of the internal linked list. */
     currentListNodePtr = list->firstNodePtr;
     /* Loop through the nodes to find the location of the list that is to be deleted. */
@@ -191,7 +215,7 @@ void TbxListClear(tTbxList * list)
     list->lastNodePtr = NULL;
     list->nodeCount = 0U;
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 } /*** end of TbxListClear ***/
 
@@ -213,11 +237,11 @@ size_t TbxListGetSize(tTbxList const * list)
   if (list != NULL)
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Store the current number of items in the list in the result variable. */
     result = list->nodeCount;
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -225,6 +249,42 @@ size_t TbxListGetSize(tTbxList const * list)
 } /*** end of TbxListGetSize ***/
 
 
+/************************************************************************************//**
+** \brief     Preallocates nodes on the heap, such that the specified number of items can
+**            be inserted afterwards, without accessing the heap. This makes the time
+**            needed for inserting an item deterministic. Note that the nodes of all
+**            linked lists come from the same memory pool. The reserved nodes are
+**            therefore shared by all linked lists.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     count The number of nodes to preallocate.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when there is no more
+**            space available on the heap.
+**
+****************************************************************************************/
+uint8_t TbxListReserve(tTbxList const * list,
+                       size_t           count)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(count > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (count > 0U) )
+  {
+    /* Extend the memory pool for the nodes. It is already created when the list was
+     * created, so this adds the nodes to the existing memory pool, allocated as one
+     * slab on the heap.
+     */
+    result = TbxMemPoolCreate(count, sizeof(tTbxListNode));
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListReserve ***/
+
+
 /************************************************************************************//**
 ** \brief     Inserts an item into the list. The item will be added at the start of the
 **            list.
@@ -246,55 +306,17 @@ uint8_t TbxListInsertItemFront(tTbxList * list,
   /* Only continue if the parameters are valid. */
   if ( (list != NULL) && (item != NULL) )
   {
-    /* Attempt to allocate a block for a node in the list. */
-    newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-    /* In case the allocation failed, the memory pool could be exhausted. Try to add
-     * another block to the memory pool. This works as long as there is enough heap
-     * configured.
-     */
-    if (newListNodePtr == NULL)
-    {
-      /* Try to add another block to the memory pool. */
-      if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
-      {
-        /* Second attempt of the block allocation. */
-        newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-      }
-    }
-    /* Only continue if the allocation was successful. */
+    /* Attempt to create a new node for the item. */
+    newListNodePtr = TbxListNodeCreate(item);
+    /* Only continue if the node was successfully created. */
     if (newListNodePtr != NULL)
     {
-      /* Initialize the node for the list. */
-      newListNodePtr->itemPtr = item;
-      newListNodePtr->prevNodePtr = NULL;
-      newListNodePtr->nextNodePtr = NULL;
       /* Obtain mutual exclusive access to the list. */
-      TbxCriticalSectionEnter();
-      /* Check if the list is not empty. */
-      if (list->firstNodePtr != NULL)
-      {
-        /* Sanity check. An non-empty list should have at least one node. */
-        TBX_ASSERT(list->nodeCount > 0U);
-        /* The new node that is to be inserted will be added at the start and the current
-         * start of the list should be moved down.
-         */
-        newListNodePtr->nextNodePtr = list->firstNodePtr;
-        newListNodePtr->nextNodePtr->prevNodePtr = newListNodePtr;
-      }
-      /* The list is currently empty. */
-      else
-      {
-        /* The to be added node will be the only node, so it is not only the first node
-         * but also the last node.
-         */
-        list->lastNodePtr = newListNodePtr;
-      }
+      TbxListLockEnter(list);
       /* Insert the new node at the start of the list. */
-      list->firstNodePtr = newListNodePtr;
-      /* Increment the node counter. */
-      list->nodeCount++;
+      TbxListNodeLinkFront(list, newListNodePtr);
       /* Release mutual exclusive access for the list. */
-      TbxCriticalSectionExit();
+      TbxListLockExit(list);
       /* Update the result for success. */
       result = TBX_OK;
     }
@@ -326,30 +348,13 @@ uint8_t TbxListInsertItemBack(tTbxList * list,
   /* Only continue if the parameters are valid. */
   if ( (list != NULL) && (item != NULL) )
   {
-    /* Attempt to allocate a block for a node in the list. */
-    newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-    /* In case the allocation failed, the memory pool could be exhausted. Try to add
-     * another block to the memory pool. This works as long as there is enough heap
-     * configured.
-     */
-    if (newListNodePtr == NULL)
-    {
-      /* Try to add another block to the memory pool. */
-      if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
-      {
-        /* Second attempt of the block allocation. */
-        newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-      }
-    }
-    /* Only continue if the allocation was successful. */
+    /* Attempt to create a new node for the item. */
+    newListNodePtr = TbxListNodeCreate(item);
+    /* Only continue if the node was successfully created. */
     if (newListNodePtr != NULL)
     {
-      /* Initialize the node for the list. */
-      newListNodePtr->itemPtr = item;
-      newListNodePtr->prevNodePtr = NULL;
-      newListNodePtr->nextNodePtr = NULL;
       /* Obtain mutual exclusive access to the list. */
-      TbxCriticalSectionEnter();
+      TbxListLockEnter(list);
       /* Check if the list is not empty. */
       if (list->firstNodePtr != NULL)
       {
@@ -374,7 +379,7 @@ uint8_t TbxListInsertItemBack(tTbxList * list,
       /* Increment the node counter. */
       list->nodeCount++;
       /* Release mutual exclusive access for the list. */
-      TbxCriticalSectionExit();
+      TbxListLockExit(list);
       /* Update the result for success. */
       result = TBX_OK;
     }
@@ -410,63 +415,28 @@ uint8_t TbxListInsertItemBefore(tTbxList       * list,
   /* Only continue if the parameters are valid. */
   if ( (list != NULL) && (item != NULL) && (itemRef != NULL) )
   {
+    /* Obtain mutual exclusive access to the list. Already done before looking up the
+     * reference node, to prevent it from being removed in the mean time.
+     */
+    TbxListLockEnter(list);
     /* Try to get pointer to the reference node. */
     refListNodePtr = TbxListFindListNode(list, itemRef);
     /* Only continue if the refeernce node exists. */
     if (refListNodePtr != NULL)
     {
-      /* Attempt to allocate a block for a node in the list. */
-      newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-      /* In case the allocation failed, the memory pool could be exhausted. Try to add
-       * another block to the memory pool. This works as long as there is enough heap
-       * configured.
-       */
-      if (newListNodePtr == NULL)
-      {
-        /* Try to add another block to the memory pool. */
-        if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
-        {
-          /* Second attempt of the block allocation. */
-          newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-        }
-      }
-      /* Only continue if the allocation was successful. */
+      /* Attempt to create a new node for the item. */
+      newListNodePtr = TbxListNodeCreate(item);
+      /* Only continue if the node was successfully created. */
       if (newListNodePtr != NULL)
       {
-        /* Initialize the node for the list. */
-        newListNodePtr->itemPtr = item;
-        newListNodePtr->prevNodePtr = NULL;
-        newListNodePtr->nextNodePtr = NULL;
-        /* Obtain mutual exclusive access to the list. */
-        TbxCriticalSectionEnter();
-        /* Is the reference item the first (or only) one in the list? */
-        if (refListNodePtr == list->firstNodePtr)
-        {
-          /* Add the item at the start of the list. */
-          newListNodePtr->nextNodePtr = list->firstNodePtr;
-          newListNodePtr->nextNodePtr->prevNodePtr = newListNodePtr;
-          list->firstNodePtr = newListNodePtr;
-        }
-        /* The reference item is not the first one. This also means that there are at
-         * least two items in the list. Sqeeze the new item in before the reference item.
-         */
-        else
-        {
-          /* Sanity check. The reference node must have a previous node. */
-          TBX_ASSERT(refListNodePtr->prevNodePtr != NULL);
-          newListNodePtr->prevNodePtr = refListNodePtr->prevNodePtr;
-          newListNodePtr->nextNodePtr = refListNodePtr;
-          newListNodePtr->prevNodePtr->nextNodePtr = newListNodePtr;
-          newListNodePtr->nextNodePtr->prevNodePtr = newListNodePtr;
-        }
-        /* Increment the node counter. */
-        list->nodeCount++;
-        /* Release mutual exclusive access for the list. */
-        TbxCriticalSectionExit();
+        /* Link the new node into the list, before the reference node. */
+        TbxListNodeLinkBefore(list, newListNodePtr, refListNodePtr);
         /* Update the result for success. */
         result = TBX_OK;
       }
     }
+    /* Release mutual exclusive access for the list. */
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -499,69 +469,28 @@ uint8_t TbxListInsertItemAfter(tTbxList       * list,
   /* Only continue if the parameters are valid. */
   if ( (list != NULL) && (item != NULL) && (itemRef != NULL) )
   {
+    /* Obtain mutual exclusive access to the list. Already done before looking up the
+     * reference node, to prevent it from being removed in the mean time.
+     */
+    TbxListLockEnter(list);
     /* Try to get pointer to the reference node. */
     refListNodePtr = TbxListFindListNode(list, itemRef);
     /* Only continue if the refeernce node exists. */
     if (refListNodePtr != NULL)
     {
-      /* Attempt to allocate a block for a node in the list. */
-      newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-      /* In case the allocation failed, the memory pool could be exhausted. Try to add
-       * another block to the memory pool. This works as long as there is enough heap
-       * configured.
-       */
-      if (newListNodePtr == NULL)
-      {
-        /* Try to add another block to the memory pool. */
-        if (TbxMemPoolCreate(1, sizeof(tTbxListNode)) == TBX_OK)
-        {
-          /* Second attempt of the block allocation. */
-          newListNodePtr = TbxMemPoolAllocate(sizeof(tTbxListNode));
-        }
-      }
-      /* Only continue if the allocation was successful. */
+      /* Attempt to create a new node for the item. */
+      newListNodePtr = TbxListNodeCreate(item);
+      /* Only continue if the node was successfully created. */
       if (newListNodePtr != NULL)
       {
-        /* Initialize the node for the list. */
-        newListNodePtr->itemPtr = item;
-        newListNodePtr->prevNodePtr = NULL;
-        newListNodePtr->nextNodePtr = NULL;
-        /* Obtain mutual exclusive access to the list. */
-        TbxCriticalSectionEnter();
-
-
-        /* Is the reference item the last (or only) one in the list? */
-        if (refListNodePtr == list->lastNodePtr)
-        {
-          /* Add the item at the end of the list. */
-          newListNodePtr->prevNodePtr = list->lastNodePtr;
-          newListNodePtr->prevNodePtr->nextNodePtr = newListNodePtr;
-          list->lastNodePtr = newListNodePtr;
-        }
-        /* The reference item is not the last one. This also means that there are at
-         * least two items in the list. Sqeeze the new item in after the reference item.
-         */
-        else
-        {
-          /* Sanity check. The reference node must have a next node. */
-          TBX_ASSERT(refListNodePtr->nextNodePtr != NULL);
-          /* Only continue if the sanity check passed. */
-          if (refListNodePtr->nextNodePtr != NULL)
-          {
-            newListNodePtr->prevNodePtr = refListNodePtr;
-            newListNodePtr->nextNodePtr = refListNodePtr->nextNodePtr;
-            newListNodePtr->prevNodePtr->nextNodePtr = newListNodePtr;
-            newListNodePtr->nextNodePtr->prevNodePtr = newListNodePtr;
-          }
-        }
-        /* Increment the node counter. */
-        list->nodeCount++;
-        /* Release mutual exclusive access for the list. */
-        TbxCriticalSectionExit();
+        /* Link the new node into the list, after the reference node. */
+        TbxListNodeLinkAfter(list, newListNodePtr, refListNodePtr);
         /* Update the result for success. */
         result = TBX_OK;
       }
     }
+    /* Release mutual exclusive access for the list. */
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -589,75 +518,23 @@ void TbxListRemoveItem(tTbxList       * list,
   /* Only continue if the parameters are valid. */
   if ( (list != NULL) && (item != NULL) )
   {
+    /* Obtain mutual exclusive access to the list. Already done before looking up the
+     * node, to prevent it from being removed in the mean time.
+     */
+    TbxListLockEnter(list);
     /* Try to find the node that this item belongs to. */
     listNodePtr = TbxListFindListNode(list, item);
     /* Only continue with removal if the item actually belongs to the list. */
     if (listNodePtr != NULL)
     {
-      /* Obtain mutual exclusive access to the list. */
-      TbxCriticalSectionEnter();
-      /* Remove the node from the list. First check if it is the only node in the
-       * list.
-       */
-      if ( (listNodePtr->prevNodePtr == NULL) && (listNodePtr->nextNodePtr == NULL) )
-      {
-        /* Sanity check. This should also be the start of the list. */
-        TBX_ASSERT(listNodePtr == list->firstNodePtr);
-        /* Sanity check. This should also be the end of the list. */
-        TBX_ASSERT(listNodePtr == list->lastNodePtr);
-        /* Sanity check. The list should only have one node. */
-        TBX_ASSERT(list->nodeCount == 1U);
-        /* Set the list to empty. */
-        list->firstNodePtr = NULL;
-        list->lastNodePtr = NULL;
-      }
-      /* Check if it is at the start of the list. */
-      else if (listNodePtr->prevNodePtr == NULL)
-      {
-        /* Sanity check. This should be the start of the list. */
-        TBX_ASSERT(listNodePtr == list->firstNodePtr);
-        /* Sanity check. There should be a next node. */
-        TBX_ASSERT(listNodePtr->nextNodePtr != NULL);
-        /* Sanity check. The list should have at least two nodes. */
-        TBX_ASSERT(list->nodeCount > 1U);
-        /* Make the next node the new start of the list. */
-        list->firstNodePtr = listNodePtr->nextNodePtr;
-        list->firstNodePtr->prevNodePtr = NULL;
-      }
-      /* Check if it is at the end of the list. */
-      else if (listNodePtr->nextNodePtr == NULL)
-      {
-        /* Sanity check. This should be the end of the list. */
-        TBX_ASSERT(listNodePtr == list->lastNodePtr);
-        /* Sanity check. There should be a previous node. */
-        TBX_ASSERT(listNodePtr->prevNodePtr != NULL);
-        /* Sanity check. The list should have at least two nodes. */
-        TBX_ASSERT(list->nodeCount > 1U);
-        /* Make the previous node the end of the list. */
-        list->lastNodePtr = listNodePtr->prevNodePtr;
-        list->lastNodePtr->nextNodePtr = NULL;
-      }
-      /* If it is not the only node in the list, not at the start and not at the end,
-       * then the list must have at least three nodes and the current node is somewhere
-       * in the middle.
-       */
-      else
-      {
-        /* Sanity check. There should be a previous node. */
-        TBX_ASSERT(listNodePtr->prevNodePtr != NULL);
-        /* Sanity check. There should be a next node. */
-        TBX_ASSERT(listNodePtr->nextNodePtr != NULL);
-        /* Sanity check. The list should have at least three nodes. */
-        TBX_ASSERT(list->nodeCount > 2U);
-        /* Remove ourselves from the list. */
-        listNodePtr->prevNodePtr->nextNodePtr = listNodePtr->nextNodePtr;
-        listNodePtr->nextNodePtr->prevNodePtr = listNodePtr->prevNodePtr;
-      }
-      /* Decrement the node counter. */
-      list->nodeCount--;
-      /* Release mutual exclusive access of the list. */
-      TbxCriticalSectionExit();
-      /* Give the node back to the memory pool. */
+      /* Unlink the node from the list. */
+      TbxListNodeUnlink(list, listNodePtr);
+    }
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+    /* Give the node back to the memory pool, now that it is no longer part of the list. */
+    if (listNodePtr != NULL)
+    {
       TbxMemPoolRelease(listNodePtr);
     }
   }
@@ -682,14 +559,14 @@ void * TbxListGetFirstItem(tTbxList const * list)
   if (list != NULL)
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Get the first item in the list if there is one. */
     if (list->firstNodePtr != NULL)
     {
       result = list->firstNodePtr->itemPtr;
     }
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -715,14 +592,14 @@ void * TbxListGetLastItem(tTbxList const * list)
   if (list != NULL)
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Get the last item in the list if there is one. */
     if (list->lastNodePtr != NULL)
     {
       result = list->lastNodePtr->itemPtr;
     }
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -755,7 +632,7 @@ void * TbxListGetPreviousItem(tTbxList const * list,
   if ( (list != NULL) && (itemRef != NULL) )
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Obtain the node of the item specified in the parameter. */
     listNodePtr = TbxListFindListNode(list, itemRef);
     /* Only continue if the node could be found. */
@@ -771,7 +648,7 @@ void * TbxListGetPreviousItem(tTbxList const * list,
       }
     }
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -804,7 +681,7 @@ void * TbxListGetNextItem(tTbxList const * list,
   if ( (list != NULL) && (itemRef != NULL) )
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Obtain the node of the item specified in the parameter. */
     listNodePtr = TbxListFindListNode(list, itemRef);
     /* Only continue if the node could be found. */
@@ -820,7 +697,7 @@ void * TbxListGetNextItem(tTbxList const * list,
       }
     }
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 
   /* Give the result back to the caller. */
@@ -848,7 +725,7 @@ void TbxListSwapItems(tTbxList const * list,
   if ( (list != NULL) && (item1 != NULL) && (item2 != NULL) )
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
+    TbxListLockEnter(list);
     /* Obtain the node pointers of the items that need to be swapped. */
     tTbxListNode * listNode1Ptr = TbxListFindListNode(list, item1);
     tTbxListNode * listNode2Ptr = TbxListFindListNode(list, item2);
@@ -861,24 +738,33 @@ void TbxListSwapItems(tTbxList const * list,
       listNode2Ptr->itemPtr = item1;
     }
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 } /*** end of TbxListSwapItems ***/
 
 
 /************************************************************************************//**
 ** \brief     Sorts the items in the list. While sorting, it calls the specified callback
-**            function which should do the actual comparison of the items.
+**            function which should do the actual comparison of the items. The sort is
+**            stable, meaning that items that compare equal keep their order. It is a
+**            bottom-up merge sort, which relinks the nodes instead of moving the items.
+**            As such, it does not need any extra memory and it takes O(n log n) time.
 ** \param     list Pointer to a previously created linked list to operate on.
 ** \param     compareItemsFcn Callback function that does the item comparison.
 **
 ****************************************************************************************/
-void TbxListSortItems(tTbxList             const * list, 
-                      tTbxListCompareItems         compareItemsFcn)
+void TbxListSortItems(tTbxList             * list, 
+                      tTbxListCompareItems   compareItemsFcn)
 {
-  tTbxListNode * currentNode;
-  tTbxListNode * idxNode;
-  void         * tempItemPtr;
+  tTbxListNode * sortedListPtr;
+  tTbxListNode * tailNodePtr;
+  tTbxListNode * leftNodePtr;
+  tTbxListNode * rightNodePtr;
+  tTbxListNode * nextNodePtr;
+  size_t         runSize = 1U;
+  size_t         leftSize;
+  size_t         rightSize;
+  size_t         mergeCount = 0U;
 
   /* Verify parameters. */
   TBX_ASSERT(list != NULL);
@@ -888,50 +774,500 @@ void TbxListSortItems(tTbxList             const * list,
   if ( (list != NULL) && (compareItemsFcn != NULL) )
   {
     /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
-    /* To accomplish the sort, we maintain two pointers: current and index. Initially,
-     * current points to head node and index will point to node next to current.
-     * Traverse through the list till current's next node points to NULL, by comparing
-     * current's data with index's data. If the current's data is greater than the
-     * index's data, then swap data between them. Continue this process till the entire
-     * list is sorted in ascending order. It is a basic bubble sort algorithm.
-     */
-    currentNode = list->firstNodePtr;
-    /* Traverse through the entire list. Note that sorting is only done if there are
-     * at least two nodes in the list.
-     */
-    while (currentNode->nextNodePtr != NULL)
+    TbxListLockEnter(list);
+    /* Sorting is only needed if there are at least two nodes in the list. */
+    if (list->nodeCount > 1U)
     {
-      /* Point index to the node next to current. */
-      idxNode = currentNode->nextNodePtr;
-      /* Keep looping while the index node is valid. */
-      while (idxNode != NULL)
+      sortedListPtr = list->firstNodePtr;
+      tailNodePtr = NULL;
+      /* Each pass merges pairs of adjacent sorted runs of runSize nodes into sorted runs
+       * of twice that size. The list is sorted once a pass only needed one merge.
+       */
+      do
       {
-        /* If current's data is greater than index's data, swap the data of current and
-         * index.
-         */
-        if (compareItemsFcn(currentNode->itemPtr, idxNode->itemPtr) == TBX_TRUE)
+        leftNodePtr = sortedListPtr;
+        sortedListPtr = NULL;
+        tailNodePtr = NULL;
+        mergeCount = 0U;
+        /* Keep merging runs until the end of the list is reached. */
+        while (leftNodePtr != NULL)
         {
-          /* Perform the swap. */
-          tempItemPtr = currentNode->itemPtr;
-          currentNode->itemPtr = idxNode->itemPtr;
-          idxNode->itemPtr = tempItemPtr;
+          mergeCount++;
+          /* Step over the left run, to find the start of the right run. */
+          rightNodePtr = leftNodePtr;
+          leftSize = 0U;
+          while ( (leftSize < runSize) && (rightNodePtr != NULL) )
+          {
+            leftSize++;
+            rightNodePtr = rightNodePtr->nextNodePtr;
+          }
+          rightSize = runSize;
+          /* Merge the left and right runs. */
+          while ( (leftSize > 0U) || ((rightSize > 0U) && (rightNodePtr != NULL)) )
+          {
+            /* Take the node from the left run, unless the left run is empty or its node
+             * is greater than the one of the right run. Taking the node from the left
+             * run when they are equal, keeps the sort stable.
+             */
+            if ( (leftSize > 0U) &&
+                 ( (rightSize == 0U) || (rightNodePtr == NULL) ||
+                   (compareItemsFcn(leftNodePtr->itemPtr,
+                                    rightNodePtr->itemPtr) == TBX_FALSE) ) )
+            {
+              nextNodePtr = leftNodePtr;
+              leftNodePtr = leftNodePtr->nextNodePtr;
+              leftSize--;
+            }
+            else
+            {
+              nextNodePtr = rightNodePtr;
+              rightNodePtr = rightNodePtr->nextNodePtr;
+              rightSize--;
+            }
+            /* Append the node to the end of the sorted list. */
+            if (tailNodePtr != NULL)
+            {
+              tailNodePtr->nextNodePtr = nextNodePtr;
+            }
+            else
+            {
+              sortedListPtr = nextNodePtr;
+            }
+            nextNodePtr->prevNodePtr = tailNodePtr;
+            tailNodePtr = nextNodePtr;
+          }
+          /* Continue with the next pair of runs, which starts after the right run. */
+          leftNodePtr = rightNodePtr;
         }
-        /* Move the index node one forward and continue there the next loop. */
-        idxNode = idxNode->nextNodePtr;
+        /* Terminate the sorted list. */
+        tailNodePtr->nextNodePtr = NULL;
+        /* Double the size of the runs for the next pass. */
+        runSize *= 2U;
       }
-      /* Move the current node one forward and continue there the next loop. */
-      currentNode = currentNode->nextNodePtr;
+      while (mergeCount > 1U);
+      /* Store the new start and end of the list. */
+      list->firstNodePtr = sortedListPtr;
+      list->lastNodePtr = tailNodePtr;
     }
     /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
+    TbxListLockExit(list);
   }
 } /*** end of TbxListSortItems ***/
 
 
+/************************************************************************************//**
+** \brief     Inserts an item into a sorted list, at the location that keeps the list
+**            sorted. The item is added after all items that are not greater than it, so
+**            items that compare equal keep the order in which they were inserted. This
+**            makes it possible to keep a list sorted, without the need to call
+**            TbxListSortItems() each time an item is added. Note that the search for the
+**            location starts at the end of the list. Inserting items in an ascending
+**            order is therefore fast.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     item Pointer to the item to insert.
+** \param     compareItemsFcn Callback function that does the item comparison.
+** \return    TBX_OK if the item could be inserted, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t TbxListInsertItemSorted(tTbxList             * list,
+                                void                 * item,
+                                tTbxListCompareItems   compareItemsFcn)
+{
+  uint8_t        result = TBX_ERROR;
+  tTbxListNode * newListNodePtr;
+  tTbxListNode * refListNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(item != NULL);
+  TBX_ASSERT(compareItemsFcn != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (item != NULL) && (compareItemsFcn != NULL) )
+  {
+    /* Attempt to create a new node for the item. */
+    newListNodePtr = TbxListNodeCreate(item);
+    /* Only continue if the node was successfully created. */
+    if (newListNodePtr != NULL)
+    {
+      /* Obtain mutual exclusive access to the list. */
+      TbxListLockEnter(list);
+      /* Search backwards for the last node, whose item is not greater than the new
+       * item.
+       */
+      refListNodePtr = list->lastNodePtr;
+      while ( (refListNodePtr != NULL) &&
+              (compareItemsFcn(refListNodePtr->itemPtr, item) == TBX_TRUE) )
+      {
+        refListNodePtr = refListNodePtr->prevNodePtr;
+      }
+      /* Was such a node found? */
+      if (refListNodePtr != NULL)
+      {
+        /* Link the new node into the list, after this node. */
+        TbxListNodeLinkAfter(list, newListNodePtr, refListNodePtr);
+      }
+      /* All items are greater than the new one or the list is empty. */
+      else
+      {
+        /* Link the new node into the list, at the start. */
+        TbxListNodeLinkFront(list, newListNodePtr);
+      }
+      /* Release mutual exclusive access for the list. */
+      TbxListLockExit(list);
+      /* Update the result for success. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListInsertItemSorted ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node at the start of the list. Together with
+**            TbxListGetNextNode() and TbxListGetPreviousNode(), it makes it possible to
+**            iterate over the list, without the need to search for the node of an item
+**            each step. Note that the node remains valid as long as it is part of the
+**            list. It is the caller's responsibility to make sure that the node is not
+**            removed, by this or another thread, while it is still being used.
+** \param     list Pointer to a previously created linked list to operate on.
+** \return    The node at the start of the list or NULL if the list is empty.
+**
+****************************************************************************************/
+tTbxListNode * TbxListGetFirstNode(tTbxList const * list)
+{
+  tTbxListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (list != NULL)
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxListLockEnter(list);
+    /* Get the first node in the list. */
+    result = list->firstNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListGetFirstNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node at the end of the list.
+** \param     list Pointer to a previously created linked list to operate on.
+** \return    The node at the end of the list or NULL if the list is empty.
+**
+****************************************************************************************/
+tTbxListNode * TbxListGetLastNode(tTbxList const * list)
+{
+  tTbxListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (list != NULL)
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxListLockEnter(list);
+    /* Get the last node in the list. */
+    result = list->lastNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListGetLastNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node that is located one position before in the list, relative
+**            to the specified node.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     node The node that is part of the list.
+** \return    The node one position before in the list or NULL if the specified node is
+**            at the start of the list.
+**
+****************************************************************************************/
+tTbxListNode * TbxListGetPreviousNode(tTbxList     const * list,
+                                      tTbxListNode const * node)
+{
+  tTbxListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxListLockEnter(list);
+    /* Get the previous node in the list. */
+    result = node->prevNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListGetPreviousNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the node that is located one position further down in the list,
+**            relative to the specified node.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     node The node that is part of the list.
+** \return    The node one position further down in the list or NULL if the specified
+**            node is at the end of the list.
+**
+****************************************************************************************/
+tTbxListNode * TbxListGetNextNode(tTbxList     const * list,
+                                  tTbxListNode const * node)
+{
+  tTbxListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxListLockEnter(list);
+    /* Get the next node in the list. */
+    result = node->nextNodePtr;
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListGetNextNode ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the item that is stored in the specified node.
+** \param     node The node that is part of the list.
+** \return    The item stored in the node or NULL if the node is not valid.
+**
+****************************************************************************************/
+void * TbxListGetNodeItem(tTbxListNode const * node)
+{
+  void * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (node != NULL)
+  {
+    /* Read the item that is stored in the node. */
+    result = node->itemPtr;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListGetNodeItem ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts an item into the list. The item will be added before the specified
+**            node. Compared to TbxListInsertItemBefore(), this does not need to search
+**            for the node of the reference item.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     item Pointer to the item to insert.
+** \param     node The node that is part of the list, before which the new item should
+**            be inserted.
+** \return    TBX_OK if the item could be inserted, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t TbxListInsertItemBeforeNode(tTbxList     * list,
+                                    void         * item,
+                                    tTbxListNode * node)
+{
+  uint8_t        result = TBX_ERROR;
+  tTbxListNode * newListNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(item != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (item != NULL) && (node != NULL) )
+  {
+    /* Attempt to create a new node for the item. */
+    newListNodePtr = TbxListNodeCreate(item);
+    /* Only continue if the node was successfully created. */
+    if (newListNodePtr != NULL)
+    {
+      /* Obtain mutual exclusive access to the list. */
+      TbxListLockEnter(list);
+      /* Link the new node into the list, before the reference node. */
+      TbxListNodeLinkBefore(list, newListNodePtr, node);
+      /* Release mutual exclusive access for the list. */
+      TbxListLockExit(list);
+      /* Update the result for success. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListInsertItemBeforeNode ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts an item into the list. The item will be added after the specified
+**            node. Compared to TbxListInsertItemAfter(), this does not need to search
+**            for the node of the reference item.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     item Pointer to the item to insert.
+** \param     node The node that is part of the list, after which the new item should be
+**            inserted.
+** \return    TBX_OK if the item could be inserted, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t TbxListInsertItemAfterNode(tTbxList     * list,
+                                   void         * item,
+                                   tTbxListNode * node)
+{
+  uint8_t        result = TBX_ERROR;
+  tTbxListNode * newListNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(item != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (item != NULL) && (node != NULL) )
+  {
+    /* Attempt to create a new node for the item. */
+    newListNodePtr = TbxListNodeCreate(item);
+    /* Only continue if the node was successfully created. */
+    if (newListNodePtr != NULL)
+    {
+      /* Obtain mutual exclusive access to the list. */
+      TbxListLockEnter(list);
+      /* Link the new node into the list, after the reference node. */
+      TbxListNodeLinkAfter(list, newListNodePtr, node);
+      /* Release mutual exclusive access for the list. */
+      TbxListLockExit(list);
+      /* Update the result for success. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListInsertItemAfterNode ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the specified node, and with it its item, from the list. Compared
+**            to TbxListRemoveItem(), this does not need to search for the node of the
+**            item. Afterwards, the node is no longer valid and should not be used
+**            anymore. The returned node makes it possible to remove nodes, while
+**            iterating over the list. Keep in mind that it is the caller's
+**            responsibility to release the memory of the item that is being removed.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     node The node that is part of the list.
+** \return    The node that followed the removed node or NULL if the removed node was at
+**            the end of the list.
+**
+****************************************************************************************/
+tTbxListNode * TbxListRemoveNode(tTbxList     * list,
+                                 tTbxListNode * node)
+{
+  tTbxListNode * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(node != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (node != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxListLockEnter(list);
+    /* Store the next node, before it gets unlinked. */
+    result = node->nextNodePtr;
+    /* Unlink the node from the list. */
+    TbxListNodeUnlink(list, node);
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+    /* Give the node back to the memory pool, now that it is no longer part of the list. */
+    TbxMemPoolRelease(node);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListRemoveNode ***/
+
+
+/************************************************************************************//**
+** \brief     Calls the specified callback function for each item in the list, starting
+**            at the start of the list. Mutual exclusive access to the list is obtained
+**            only once for the entire traversal, instead of once per item. For this
+**            reason, the callback function should be kept short and it should not insert
+**            or remove items in the list.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     visitItemFcn Callback function that is called for each item. Its return
+**            value determines if the traversal continues.
+** \param     context Pointer that is passed on to the callback function. Can be NULL.
+**
+****************************************************************************************/
+void TbxListForEach(tTbxList          const * list,
+                    tTbxListVisitItem         visitItemFcn,
+                    void                    * context)
+{
+  tTbxListNode const * currentListNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(list != NULL);
+  TBX_ASSERT(visitItemFcn != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (list != NULL) && (visitItemFcn != NULL) )
+  {
+    /* Obtain mutual exclusive access to the list. */
+    TbxListLockEnter(list);
+    /* Get the pointer to the node at the head of the internal linked list. */
+    currentListNodePtr = list->firstNodePtr;
+    /* Loop through the nodes until the end of the list is reached or until the
+     * callback function requests to stop.
+     */
+    while (currentListNodePtr != NULL)
+    {
+      if (visitItemFcn(currentListNodePtr->itemPtr, context) == TBX_FALSE)
+      {
+        break;
+      }
+      /* Continue with the next node in the following loop iteration. */
+      currentListNodePtr = currentListNodePtr->nextNodePtr;
+    }
+    /* Release mutual exclusive access of the list. */
+    TbxListLockExit(list);
+  }
+} /*** end of TbxListForEach ***/
+
+
 /************************************************************************************//**
 ** \brief     Helper function to get the node that a specific item in the list belongs
-**            to.
+**            to. Note that the caller should already have mutual exclusive access to
+**            the list.
 ** \param     list Pointer to a previously created linked list to operate on.
 ** \param     item Pointer to the item of whoms owning node should be found.
 ** \return    Pointer to the node if successful, NULL otherwise.
@@ -950,8 +1286,6 @@ static tTbxListNode * TbxListFindListNode(tTbxList const * list,
   /* Only continue if the parameters are valid. */
   if ( (list != NULL) && (item != NULL) )
   {
-    /* Obtain mutual exclusive access to the list. */
-    TbxCriticalSectionEnter();
     /* Get the pointer to the node at the head of the internal linked list. */
     currentListNodePtr = list->firstNodePtr;
     /* Loop through the nodes to find the node that the item belongs to. */
@@ -969,8 +1303,6 @@ static tTbxListNode * TbxListFindListNode(tTbxList const * list,
        */
       currentListNodePtr = currentListNodePtr->nextNodePtr;
     }
-    /* Release mutual exclusive access of the list. */
-    TbxCriticalSectionExit();
   }
 
   /* Give the result back to the caller. */
@@ -978,4 +1310,268 @@ static tTbxListNode * TbxListFindListNode(tTbxList const * list,
 } /*** end of TbxListFindListNode ***/
 
 
+/************************************************************************************//**
+** \brief     Helper function to create a new node for the specified item. The node is
+**            allocated from the memory pool for list nodes, which is extended if it has
+**            no more free blocks.
+** \param     item Pointer to the item to store in the node.
+** \return    Pointer to the new node if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tTbxListNode * TbxListNodeCreate(void * item)
+{
+  tTbxListNode * result;
+
+  /* Attempt to allocate a block for a node in the list. */
+  result = TbxMemPoolAllocate(sizeof(tTbxListNode));
+  /* In case the allocation failed, the memory pool could be exhausted. Try to extend
+   * the memory pool with another chunk of blocks. This works as long as there is enough
+   * heap configured.
+   */
+  if (result == NULL)
+  {
+    /* Try to add another chunk of blocks to the memory pool. */
+    if (TbxMemPoolCreate(TBX_CONF_LIST_GROWTH_CHUNK, sizeof(tTbxListNode)) == TBX_OK)
+    {
+      /* Second attempt of the block allocation. */
+      result = TbxMemPoolAllocate(sizeof(tTbxListNode));
+    }
+  }
+  /* Only continue if the allocation was successful. */
+  if (result != NULL)
+  {
+    /* Initialize the node for the list. */
+    result->itemPtr = item;
+    result->prevNodePtr = NULL;
+    result->nextNodePtr = NULL;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxListNodeCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Helper function to link a new node into the list, at the start of the
+**            list. The list is allowed to be empty. Note that the caller should already
+**            have mutual exclusive access to the list.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     newNodePtr Pointer to the new node to link into the list.
+**
+****************************************************************************************/
+static void TbxListNodeLinkFront(tTbxList     * list,
+                                 tTbxListNode * newNodePtr)
+{
+  /* The new node becomes the first node, so the current first node follows it. */
+  newNodePtr->prevNodePtr = NULL;
+  newNodePtr->nextNodePtr = list->firstNodePtr;
+  /* Check if the list is not empty. */
+  if (list->firstNodePtr != NULL)
+  {
+    /* Sanity check. An non-empty list should have at least one node. */
+    TBX_ASSERT(list->nodeCount > 0U);
+    /* The current start of the list should be moved down. */
+    list->firstNodePtr->prevNodePtr = newNodePtr;
+  }
+  /* The list is currently empty. */
+  else
+  {
+    /* The to be added node will be the only node, so it is not only the first node
+     * but also the last node.
+     */
+    list->lastNodePtr = newNodePtr;
+  }
+  /* Insert the new node at the start of the list. */
+  list->firstNodePtr = newNodePtr;
+  /* Increment the node counter. */
+  list->nodeCount++;
+} /*** end of TbxListNodeLinkFront ***/
+
+
+/************************************************************************************//**
+** \brief     Helper function to link a new node into the list, before the reference
+**            node. Note that the caller should already have mutual exclusive access to
+**            the list.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     newNodePtr Pointer to the new node to link into the list.
+** \param     refNodePtr Pointer to the reference node that is part of the list.
+**
+****************************************************************************************/
+static void TbxListNodeLinkBefore(tTbxList     * list,
+                                  tTbxListNode * newNodePtr,
+                                  tTbxListNode * refNodePtr)
+{
+  /* Is the reference node the first (or only) one in the list? */
+  if (refNodePtr == list->firstNodePtr)
+  {
+    /* Add the node at the start of the list. */
+    TbxListNodeLinkFront(list, newNodePtr);
+  }
+  /* The reference node is not the first one. This also means that there are at
+   * least two nodes in the list. Sqeeze the new node in before the reference node.
+   */
+  else
+  {
+    /* Sanity check. The reference node must have a previous node. */
+    TBX_ASSERT(refNodePtr->prevNodePtr != NULL);
+    newNodePtr->prevNodePtr = refNodePtr->prevNodePtr;
+    newNodePtr->nextNodePtr = refNodePtr;
+    newNodePtr->prevNodePtr->nextNodePtr = newNodePtr;
+    newNodePtr->nextNodePtr->prevNodePtr = newNodePtr;
+    /* Increment the node counter. */
+    list->nodeCount++;
+  }
+} /*** end of TbxListNodeLinkBefore ***/
+
+
+/************************************************************************************//**
+** \brief     Helper function to link a new node into the list, after the reference
+**            node. Note that the caller should already have mutual exclusive access to
+**            the list.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     newNodePtr Pointer to the new node to link into the list.
+** \param     refNodePtr Pointer to the reference node that is part of the list.
+**
+****************************************************************************************/
+static void TbxListNodeLinkAfter(tTbxList     * list,
+                                 tTbxListNode * newNodePtr,
+                                 tTbxListNode * refNodePtr)
+{
+  /* Is the reference node the last (or only) one in the list? */
+  if (refNodePtr == list->lastNodePtr)
+  {
+    /* Add the node at the end of the list. */
+    newNodePtr->nextNodePtr = NULL;
+    newNodePtr->prevNodePtr = list->lastNodePtr;
+    newNodePtr->prevNodePtr->nextNodePtr = newNodePtr;
+    list->lastNodePtr = newNodePtr;
+  }
+  /* The reference node is not the last one. This also means that there are at
+   * least two nodes in the list. Sqeeze the new node in after the reference node.
+   */
+  else
+  {
+    /* Sanity check. The reference node must have a next node. */
+    TBX_ASSERT(refNodePtr->nextNodePtr != NULL);
+    newNodePtr->prevNodePtr = refNodePtr;
+    newNodePtr->nextNodePtr = refNodePtr->nextNodePtr;
+    newNodePtr->prevNodePtr->nextNodePtr = newNodePtr;
+    newNodePtr->nextNodePtr->prevNodePtr = newNodePtr;
+  }
+  /* Increment the node counter. */
+  list->nodeCount++;
+} /*** end of TbxListNodeLinkAfter ***/
+
+
+/************************************************************************************//**
+** \brief     Helper function to unlink a node from the list. Note that the caller
+**            should already have mutual exclusive access to the list. Afterwards, the
+**            caller is responsible for releasing the memory of the node.
+** \param     list Pointer to a previously created linked list to operate on.
+** \param     nodePtr Pointer to the node that is part of the list.
+**
+****************************************************************************************/
+static void TbxListNodeUnlink(tTbxList     * list,
+                              tTbxListNode * nodePtr)
+{
+  /* Remove the node from the list. First check if it is the only node in the
+   * list.
+   */
+  if ( (nodePtr->prevNodePtr == NULL) && (nodePtr->nextNodePtr == NULL) )
+  {
+    /* Sanity check. This should also be the start of the list. */
+    TBX_ASSERT(nodePtr == list->firstNodePtr);
+    /* Sanity check. This should also be the end of the list. */
+    TBX_ASSERT(nodePtr == list->lastNodePtr);
+    /* Sanity check. The list should only have one node. */
+    TBX_ASSERT(list->nodeCount == 1U);
+    /* Set the list to empty. */
+    list->firstNodePtr = NULL;
+    list->lastNodePtr = NULL;
+  }
+  /* Check if it is at the start of the list. */
+  else if (nodePtr->prevNodePtr == NULL)
+  {
+    /* Sanity check. This should be the start of the list. */
+    TBX_ASSERT(nodePtr == list->firstNodePtr);
+    /* Sanity check. There should be a next node. */
+    TBX_ASSERT(nodePtr->nextNodePtr != NULL);
+    /* Sanity check. The list should have at least two nodes. */
+    TBX_ASSERT(list->nodeCount > 1U);
+    /* Make the next node the new start of the list. */
+    list->firstNodePtr = nodePtr->nextNodePtr;
+    list->firstNodePtr->prevNodePtr = NULL;
+  }
+  /* Check if it is at the end of the list. */
+  else if (nodePtr->nextNodePtr == NULL)
+  {
+    /* Sanity check. This should be the end of the list. */
+    TBX_ASSERT(nodePtr == list->lastNodePtr);
+    /* Sanity check. There should be a previous node. */
+    TBX_ASSERT(nodePtr->prevNodePtr != NULL);
+    /* Sanity check. The list should have at least two nodes. */
+    TBX_ASSERT(list->nodeCount > 1U);
+    /* Make the previous node the end of the list. */
+    list->lastNodePtr = nodePtr->prevNodePtr;
+    list->lastNodePtr->nextNodePtr = NULL;
+  }
+  /* If it is not the only node in the list, not at the start and not at the end,
+   * then the list must have at least three nodes and the current node is somewhere
+   * in the middle.
+   */
+  else
+  {
+    /* Sanity check. There should be a previous node. */
+    TBX_ASSERT(nodePtr->prevNodePtr != NULL);
+    /* Sanity check. There should be a next node. */
+    TBX_ASSERT(nodePtr->nextNodePtr != NULL);
+    /* Sanity check. The list should have at least three nodes. */
+    TBX_ASSERT(list->nodeCount > 2U);
+    /* Remove ourselves from the list. */
+    nodePtr->prevNodePtr->nextNodePtr = nodePtr->nextNodePtr;
+    nodePtr->nextNodePtr->prevNodePtr = nodePtr->prevNodePtr;
+  }
+  /* Decrement the node counter. */
+  list->nodeCount--;
+} /*** end of TbxListNodeUnlink ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the list.
+** \param     list Pointer to a previously created linked list to operate on.
+**
+****************************************************************************************/
+static void TbxListLockEnter(tTbxList const * list)
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /* Enter the lock object of the list. Note that it is accessed through its pointer,
+   * which makes this also possible for functions that only have read access to the list.
+   */
+  TbxLockEnter(list->lockPtr);
+#else
+  /* The list does not have its own lock object, so use the global critical section. */
+  (void)list;
+  TbxCriticalSectionEnter();
+#endif
+} /*** end of TbxListLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the list.
+** \param     list Pointer to a previously created linked list to operate on.
+**
+****************************************************************************************/
+static void TbxListLockExit(tTbxList const * list)
+{
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /* Exit the lock object of the list. */
+  TbxLockExit(list->lockPtr);
+#else
+  /* The list does not have its own lock object, so use the global critical section. */
+  (void)list;
+  TbxCriticalSectionExit();
+#endif
+} /*** end of TbxListLockExit ***/
+
+
 /*********************************** end of tbx_list.c *********************************/
@@ -39,6 +39,25 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_LIST_GROWTH_CHUNK
+/** \brief Number of nodes that the memory pool for the linked list nodes is extended
+ *         with at once, when it has no more free nodes while inserting an item. A larger
+ *         value means that the heap is accessed less often on the insert path, at the
+ *         cost of possibly preallocating nodes that are never used. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_LIST_GROWTH_CHUNK               (1U)
+#endif
+
+#if (TBX_CONF_LIST_GROWTH_CHUNK == 0U)
+#error "TBX_CONF_LIST_GROWTH_CHUNK must be at least 1."
+#endif
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -69,6 +88,14 @@ typedef struct
   tTbxListNode * firstNodePtr;
   /** \brief Pointer to the last node of the linked list, also known as the tail. */
   tTbxListNode * lastNodePtr;
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+  /** \brief Lock object for mutual exclusive access to the linked list. */
+  tTbxLock       lock;
+  /** \brief Pointer to the lock object. Needed for obtaining mutual exclusive access in
+   *         functions that only have read access to the linked list.
+   */
+  tTbxLock     * lockPtr;
+#endif
 } tTbxList;
 
 /** \brief Callback function to compare items. It is called during list sorting. The
@@ -78,6 +105,14 @@ typedef struct
 typedef uint8_t (* tTbxListCompareItems)(void const * item1, 
                                          void const * item2);
 
+/** \brief Callback function to visit an item. It is called for each item by
+ *         TbxListForEach(). The context parameter is the one that was passed to
+ *         TbxListForEach(). The return value of the callback function has the following
+ *         meaning: TBX_TRUE to continue with the next item, TBX_FALSE to stop.
+ */
+typedef uint8_t (* tTbxListVisitItem)(void * item,
+                                      void * context);
+
 
 /****************************************************************************************
 * Function prototypes
@@ -90,6 +125,9 @@ void       TbxListClear           (tTbxList                   * list);
 
 size_t     TbxListGetSize         (tTbxList             const * list);
 
+uint8_t    TbxListReserve         (tTbxList             const * list,
+                                   size_t                       count);
+
 uint8_t    TbxListInsertItemFront(tTbxList                    * list,
                                   void                        * item);
 
@@ -121,9 +159,40 @@ void       TbxListSwapItems       (tTbxList             const * list,
                                    void                       * item1,
                                    void                       * item2);
 
-void       TbxListSortItems       (tTbxList             const * list, 
+void       TbxListSortItems       (tTbxList                   * list, 
                                    tTbxListCompareItems         compareItemsFcn);
 
+uint8_t    TbxListInsertItemSorted(tTbxList                   * list,
+                                   void                       * item,
+                                   tTbxListCompareItems         compareItemsFcn);
+
+tTbxListNode * TbxListGetFirstNode   (tTbxList             const * list);
+
+tTbxListNode * TbxListGetLastNode    (tTbxList             const * list);
+
+tTbxListNode * TbxListGetPreviousNode(tTbxList             const * list,
+                                      tTbxListNode         const * node);
+
+tTbxListNode * TbxListGetNextNode    (tTbxList             const * list,
+                                      tTbxListNode         const * node);
+
+void         * TbxListGetNodeItem    (tTbxListNode         const * node);
+
+uint8_t        TbxListInsertItemBeforeNode(tTbxList            * list,
+                                           void                * item,
+                                           tTbxListNode        * node);
+
+uint8_t        TbxListInsertItemAfterNode (tTbxList            * list,
+                                           void                * item,
+                                           tTbxListNode        * node);
+
+tTbxListNode * TbxListRemoveNode     (tTbxList                   * list,
+                                      tTbxListNode               * node);
+
+void           TbxListForEach        (tTbxList             const * list,
+                                      tTbxListVisitItem            visitItemFcn,
+                                      void                       * context);
+
 
 #ifdef __cplusplus
 }
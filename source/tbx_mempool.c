@@ -41,31 +41,124 @@
 
 
 /****************************************************************************************
-* Type definitions
+* Configuration macros
 ****************************************************************************************/
-/** \brief Layout of a block node, which forms the building block of a linked list
- *         consisting of data blocks.
+#ifndef TBX_CONF_MEMPOOL_INDEX_MAX_SIZE
+/** \brief Largest block size in bytes that is covered by the size-class index of the
+ *         memory pools. For block sizes up to and including this value, the memory pool
+ *         that a block is allocated from or released to is looked up in constant time,
+ *         instead of searching through the linked list with memory pools. The index
+ *         costs one pointer of RAM per byte of this value. A value of zero disables the
+ *         index. Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
  */
-typedef struct t_block_node
-{
-  /** \brief Pointer to the block. */
-  void                * blockPtr;
-  /** \brief Pointer to the next node in the list or NULL if it is the list end. */
-  struct t_block_node * nextNodePtr;
-} tBlockNode;
+#define TBX_CONF_MEMPOOL_INDEX_MAX_SIZE          (0U)
+#endif
+
+#ifndef TBX_CONF_MEMPOOL_CACHE_SIZE
+/** \brief Maximum number of recently released blocks that each thread or core keeps
+ *         in its own cache, per memory pool. Allocations and releases are served from
+ *         this cache first, without entering the memory pool lock. Only refilling and
+ *         flushing the cache accesses the shared memory pool. A value of zero disables
+ *         the cache. Note that the cache is only supported on ports that define
+ *         TBX_PORT_CACHE_NUM_SLOTS, such as the LINUX and RP2040 ports. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_CACHE_SIZE              (0U)
+#endif
+
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+#ifndef TBX_PORT_CACHE_NUM_SLOTS
+#error "TBX_CONF_MEMPOOL_CACHE_SIZE is not supported by the selected port."
+#endif
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+/** \brief Number of blocks that are moved at once between a cache and the shared memory
+ *         pool, when refilling an empty cache or flushing a full cache.
+ */
+#define TBX_MEMPOOL_CACHE_BATCH_SIZE             ((TBX_CONF_MEMPOOL_CACHE_SIZE + 1U) / 2U)
+#endif
+
+/** \brief Flag in the block size value of a block, which marks that the block belongs to
+ *         a lock-free fixed-size memory pool.
+ */
+#define TBX_MEMPOOL_FIXED_FLAG                   (~(SIZE_MAX >> 1U))
+
+/** \brief Flag in the block size value of a block, which marks that the block is free.
+ *         Only set with the run-time assertions enabled, to detect the release of a
+ *         block that is not allocated.
+ */
+#define TBX_MEMPOOL_FREE_FLAG                    (TBX_MEMPOOL_FIXED_FLAG >> 1U)
+
+/** \brief Bit mask of the one-based block index in the head of the lock-free stack with
+ *         free blocks of a fixed-size memory pool.
+ */
+#define TBX_MEMPOOL_FIXED_IDX_MASK               (0x0000FFFFU)
 
-/** \brief Linked list consisting of data block nodes. */
-typedef tBlockNode (* tBlockList);
+/** \brief Value to add to the head of the lock-free stack with free blocks of a
+ *         fixed-size memory pool, to increment its ABA protection tag.
+ */
+#define TBX_MEMPOOL_FIXED_TAG_INCR               (0x00010000U)
+
+/** \brief Maximum number of blocks in a fixed-size memory pool. */
+#define TBX_MEMPOOL_FIXED_MAX_BLOCKS             (TBX_MEMPOOL_FIXED_IDX_MASK)
 
-/** \brief Layout of a single memory pool. */
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/** \brief Layout of the statistics counters of a memory pool. The counters are only
+ *         accessed with an atomic compare and exchange operation, because with the cache
+ *         enabled, allocations and releases do not enter the memory pool lock.
+ */
+typedef struct
+{
+  /** \brief Total number of blocks in the memory pool. */
+  volatile uint32_t totalBlocks;
+  /** \brief Number of blocks that are currently allocated. */
+  volatile uint32_t usedBlocks;
+  /** \brief Highest number of blocks that were allocated at the same time. */
+  volatile uint32_t highWaterMark;
+  /** \brief Number of successful allocations. */
+  volatile uint32_t allocCount;
+  /** \brief Number of failed allocations. */
+  volatile uint32_t allocFailCount;
+  /** \brief Number of times that the memory pool was extended after its creation. */
+  volatile uint32_t growCount;
+} tPoolStats;
+#endif
+
+/** \brief Layout of a single memory pool. The blocks of a memory pool are carved from
+ *         one or more contiguous slabs on the heap. While a block is free, its data
+ *         area holds the pointer to the next free block. This way the linked list with
+ *         free blocks is threaded through the blocks themselves and no additional
+ *         memory is needed to manage the blocks.
+ */
 typedef struct
 {
   /** \brief The number of bytes that fit in one block. */
-  size_t       blockSize;
-  /** \brief Pointer to the linked list with free data block nodes. */
-  tBlockList * freeBlockListPtr;
-  /** \brief Pointer to the linked list with used data block nodes. */
-  tBlockList * usedBlockListPtr;
+  size_t   blockSize;
+  /** \brief Pointer to the memory of the first free block in the linked list with free
+   *         blocks or NULL if there are no more free blocks.
+   */
+  void   * freeBlockListPtr;
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+  /** \brief Linked lists with the free blocks that are cached per thread or core. */
+  void   * cacheListPtr[TBX_PORT_CACHE_NUM_SLOTS];
+  /** \brief Number of free blocks that are currently stored in each cache. */
+  size_t   cacheCount[TBX_PORT_CACHE_NUM_SLOTS];
+#endif
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+  /** \brief Statistics counters of the memory pool. */
+  tPoolStats stats;
+#endif
 } tPool;
 
 /** \brief Layout of a memory pool node, which forms the building block of a linked list
@@ -89,12 +182,70 @@ typedef tPoolNode (* tPoolList);
 /* Pool list management functions */
 static tPoolNode  * TbxMemPoolListFind         (size_t             blockSize);
 
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
 static tPoolNode  * TbxMemPoolListFindBestFit  (size_t             blockSize);
+#endif
+
+static tPoolNode  * TbxMemPoolListFindFit      (size_t             blockSize);
 
 static void         TbxMemPoolListInsert       (tPoolNode        * nodePtr);
 
+static tPoolNode  * TbxMemPoolListLoad         (tPoolNode * volatile const * linkPtr);
+
+static void         TbxMemPoolListPublish      (tPoolNode * volatile * linkPtr,
+                                                tPoolNode            * nodePtr);
+
+#if (TBX_CONF_MEMPOOL_INDEX_MAX_SIZE > 0U)
+/* Size-class index management functions. */
+static void         TbxMemPoolIndexInsert      (tPoolNode        * nodePtr);
+#endif
+
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+/* Cache management functions. */
+static void       * TbxMemPoolCacheExtract     (tPool            * poolPtr);
+
+static void         TbxMemPoolCacheInsert      (tPool            * poolPtr,
+                                                void             * memPtr);
+#endif
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/* Statistics management functions. */
+static uint32_t     TbxMemPoolStatsAdd         (uint32_t volatile * counterPtr,
+                                                uint32_t            value);
+
+static void         TbxMemPoolStatsUpdateMax   (uint32_t volatile * maxPtr,
+                                                uint32_t            value);
+
+static uint32_t     TbxMemPoolStatsRead        (uint32_t volatile * counterPtr);
+
+static void         TbxMemPoolStatsCollect     (tPool             * poolPtr,
+                                                tTbxMemPoolStats  * stats);
+#endif
+
+/* Fixed-size memory pool management functions. */
+static void       * TbxMemPoolFixedGetDataPtr  (tTbxMemPoolFixed const * pool,
+                                                uint32_t                 blockIdx);
+
+static void         TbxMemPoolFixedReleaseBlock(void             * memPtr);
+
+static void       * TbxMemPoolFixedCarve       (tTbxMemPoolFixed * pool);
+
+static void         TbxMemPoolFixedListInsert  (tTbxMemPoolFixed * pool);
+
+static void       * TbxMemPoolFixedLinkLoad    (void * volatile  * linkPtr);
+
+static uint8_t      TbxMemPoolFixedIsListed    (tTbxMemPoolFixed * pool);
+
+/* Slab management functions. */
+static uint8_t      TbxMemPoolSlabCreate       (tPool            * poolPtr,
+                                                tTbxHeapRegion   * region,
+                                                size_t             numBlocks);
+
 /* Block management functions. */
-static void       * TbxMemPoolBlockCreate      (size_t             size);
+static void       * TbxMemPoolBlockCreate      (void             * memPtr,
+                                                size_t             size);
+
+static size_t       TbxMemPoolBlockGetMemSize  (size_t             size);
 
 static void       * TbxMemPoolBlockGetDataPtr  (void             * memPtr);
 
@@ -102,15 +253,17 @@ static size_t       TbxMemPoolBlockGetBlockSize(void       const * memPtr);
 
 static void       * TbxMemPoolBlockGetMemPtr   (void             * dataPtr);
 
-/* Block list management functions. */
-static tBlockList * TbxMemPoolBlockListCreate  (void);
+static uint8_t      TbxMemPoolBlockMarkFree    (void             * memPtr);
 
-static void         TbxMemPoolBlockListInsert  (tBlockList       * listPtr,
-                                                tBlockNode       * nodePtr);
+static void         TbxMemPoolBlockMarkUsed    (void             * memPtr);
+
+/* Block list management functions. */
+static void         TbxMemPoolBlockListInsert  (void           * * listPtr,
+                                                void             * memPtr);
                                               
-static tBlockNode * TbxMemPoolBlockListExtract (tBlockList       * listPtr);
+static void       * TbxMemPoolBlockListExtract (void           * * listPtr);
 
-static uint8_t      TbxMemPoolBlockListIsEmpty (tBlockList const * listPtr);
+static uint8_t      TbxMemPoolBlockListIsEmpty (void     * const * listPtr);
 
 
 /****************************************************************************************
@@ -119,6 +272,24 @@ static uint8_t      TbxMemPoolBlockListIsEmpty (tBlockList const * listPtr);
 /** \brief Linked list with memory pools. */
 static tPoolList tbxPoolList = NULL;
 
+/** \brief Lock object for mutual exclusive access to the memory pools. */
+static tTbxLock  tbxMemPoolLock = TBX_LOCK_INIT;
+
+/** \brief Linked list with the lock-free fixed-size memory pools. Only needed for
+ *         verifying that a block, which is about to be released, actually belongs to
+ *         one of them.
+ */
+static void * volatile tbxMemPoolFixedList = NULL;
+
+#if (TBX_CONF_MEMPOOL_INDEX_MAX_SIZE > 0U)
+/** \brief Size-class index of the memory pools. The element at index (n - 1) points to
+ *         the node of the memory pool that best fits a block of n bytes, so the memory
+ *         pool with the smallest block size that is still equal to or larger than n. It
+ *         is NULL if no such memory pool exists yet.
+ */
+static tPoolNode * tbxPoolIndex[TBX_CONF_MEMPOOL_INDEX_MAX_SIZE];
+#endif
+
 
 /************************************************************************************//**
 ** \brief     Creates a new memory pool with the specified number of blocks, where each
@@ -146,10 +317,41 @@ static tPoolList tbxPoolList = NULL;
 ****************************************************************************************/
 uint8_t TbxMemPoolCreate(size_t numBlocks, 
                          size_t blockSize)
+{
+  /* Create the memory pool with its blocks on the default heap. Note that this function
+   * also verifies the parameters.
+   */
+  return TbxMemPoolCreateInRegion(numBlocks, blockSize, NULL);
+} /*** end of TbxMemPoolCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new memory pool or extends an existing one, just like
+**            TbxMemPoolCreate(). The difference is that the blocks are preallocated in
+**            the specified heap region, instead of on the default heap. This makes it
+**            possible to place the blocks in a specific RAM area, for example tightly
+**            coupled memory. Note that the memory pool is identified by its block size.
+**            So when extending an already existing memory pool, its blocks can end up in
+**            different heap regions.
+** \param     numBlocks The number of blocks to statically preallocate for this memory
+**            pool.
+** \param     blockSize The size of each block in bytes.
+** \param     region Handle to the heap region to preallocate the blocks in. NULL to
+**            preallocate them on the default heap.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when there is no
+**            more space available in the heap region to statically preallocate the
+**            blocks.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolCreateInRegion(size_t           numBlocks,
+                                 size_t           blockSize,
+                                 tTbxHeapRegion * region)
 {
   uint8_t      result = TBX_ERROR;
-  void       * blockPtr;
   tPool      * poolPtr;
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+  uint8_t      poolExtended = TBX_FALSE;
+#endif
 
   /* Verify parameters. */
   TBX_ASSERT(numBlocks > 0U);
@@ -158,14 +360,27 @@ uint8_t TbxMemPoolCreate(size_t numBlocks,
   /* Only continue if the parameters are valid. */
   if ( (numBlocks > 0U) && (blockSize > 0U) )
   {
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE > 0U)
+    /* Create or extend the memory pool of the size class that the block size belongs
+     * to, instead of a memory pool for this exact block size.
+     */
+    blockSize = TbxMemPoolGetSizeClass(blockSize);
+#endif
     /* Set the result value to okay. */
     result = TBX_OK;
     /* Obtain mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionEnter();
+    TbxLockEnter(&tbxMemPoolLock);
     /* Attempt to locate a memory pool node in the list that is configured for the same
      * block size.
      */
     tPoolNode * poolNodePtr = TbxMemPoolListFind(blockSize);
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+    /* Keep track of extending an already existing memory pool, for the statistics. */
+    if (poolNodePtr != NULL)
+    {
+      poolExtended = TBX_TRUE;
+    }
+#endif
     /* Create a new memory pool node and its associated empty memory pool if a memory
      * pool node for this block size does not yet exist.
      */
@@ -198,87 +413,72 @@ uint8_t TbxMemPoolCreate(size_t numBlocks,
           poolNodePtr->poolPtr = poolPtr;
           /* Store the data size of the blocks managed by the memory pool. */
           poolPtr->blockSize = blockSize;
-          /* Create the block list object that will hold blocks that are still free. */
-          poolPtr->freeBlockListPtr = TbxMemPoolBlockListCreate();
-          /* Create the block list object that will hold blocks that are in use. */
-          poolPtr->usedBlockListPtr = TbxMemPoolBlockListCreate();
-          /* Verify that the block list objects could be created. */
-          if ( (poolPtr->freeBlockListPtr == NULL) ||
-               (poolPtr->usedBlockListPtr == NULL) )
+          /* The memory pool does not yet have any free blocks. */
+          poolPtr->freeBlockListPtr = NULL;
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+          /* The caches of the memory pool are all still empty. */
+          for (size_t slotIdx = 0U; slotIdx < TBX_PORT_CACHE_NUM_SLOTS; slotIdx++)
           {
-            /* Flag the error. */
-            result = TBX_ERROR;
+            poolPtr->cacheListPtr[slotIdx] = NULL;
+            poolPtr->cacheCount[slotIdx] = 0U;
           }
+#endif
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+          /* Reset the statistics counters of the memory pool. */
+          poolPtr->stats.totalBlocks = 0U;
+          poolPtr->stats.usedBlocks = 0U;
+          poolPtr->stats.highWaterMark = 0U;
+          poolPtr->stats.allocCount = 0U;
+          poolPtr->stats.allocFailCount = 0U;
+          poolPtr->stats.growCount = 0U;
+#endif
           /* The (empty) memory pool and its node were created. Time to insert it into
            * the list.
            */
-          else
-          {
-            TbxMemPoolListInsert(poolNodePtr);
-          }
+          TbxMemPoolListInsert(poolNodePtr);
         }
       }
     }
     /* Only continue if all is okay so far. */
     if (result == TBX_OK)
     {
-      /* The pool node pointer it now valid. It either points to a node that holds a
-       * newly created and empty memory pool or to a node that holds an already existing
-       * memory pool that can be extended. Create the blocks one by one and add them as
-       * nodes to the free block list.
-       */
-      for (size_t blockNodeIdx = 0U; blockNodeIdx < numBlocks; blockNodeIdx++)
+      /* Sanity check. The pool node pointer should not be NULL here. */
+      TBX_ASSERT(poolNodePtr != NULL);
+      /* Flag error in case the sanity check failed. */
+      if (poolNodePtr == NULL)
       {
-        /* Allocate memory for the block node. */
-        tBlockNode * blockNodePtr = TbxHeapAllocate(sizeof(tBlockNode));
-        /* Verify that the node could be allocated. */
-        if (blockNodePtr == NULL)
-        {
-          /* Flag the error. */
-          result = TBX_ERROR;
-        }
-        /* The node was created. */
-        else
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      else
+      {
+        /* The pool node pointer is now valid. It either points to a node that holds a
+         * newly created and empty memory pool or to a node that holds an already
+         * existing memory pool that can be extended. Carve all the blocks from one
+         * contiguous slab and add them to the linked list with free blocks.
+         */
+        result = TbxMemPoolSlabCreate(poolNodePtr->poolPtr, region, numBlocks);
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+        /* Update the statistics counters, if the blocks were added. */
+        if (result == TBX_OK)
         {
-          /* Allocate memory for the actual data block itself. */
-          blockPtr = TbxMemPoolBlockCreate(blockSize);
-          /* Verify that the the data block could be allocated. */
-          if (blockPtr == NULL)
+          (void)TbxMemPoolStatsAdd(&poolNodePtr->poolPtr->stats.totalBlocks,
+                                   (uint32_t)numBlocks);
+          if (poolExtended == TBX_TRUE)
           {
-            /* Flag the error. */
-            result = TBX_ERROR;
-          }
-          /* The data block was created. */
-          else
-          {
-            /* Initialize the block node. */
-            blockNodePtr->blockPtr = blockPtr;
-            blockNodePtr->nextNodePtr = NULL;
-            /* Sanity check. The pool node pointer should not be NULL here. */
-            TBX_ASSERT(poolNodePtr != NULL);
-            /* Flag error in case the sanity check failed. */
-            if (poolNodePtr == NULL)
-            {
-              /* Flag the error. */
-              result = TBX_ERROR;
-            }
-            else
-            {
-              /* Insert the block node into the free block list. */
-              TbxMemPoolBlockListInsert(poolNodePtr->poolPtr->freeBlockListPtr,
-                                        blockNodePtr);
-            }
+            (void)TbxMemPoolStatsAdd(&poolNodePtr->poolPtr->stats.growCount, 1U);
           }
         }
+#endif
       }
     }
     /* Release mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionExit();
+    TbxLockExit(&tbxMemPoolLock);
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolCreate ***/
+} /*** end of TbxMemPoolCreateInRegion ***/
 
 
 /************************************************************************************//**
@@ -305,7 +505,6 @@ uint8_t TbxMemPoolCreate(size_t numBlocks,
 void * TbxMemPoolAllocate(size_t size)
 {
   void            * result = NULL;
-  void            * blockDataPtr;
   tPoolNode const * poolNodePtr;
 
   /* Verify parameter. */
@@ -314,41 +513,76 @@ void * TbxMemPoolAllocate(size_t size)
   /* Only continue if the parameter is valid. */
   if (size > 0U)
   {
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE > 0U)
+    /* Allocate from the memory pool of the size class that the size belongs to. */
+    size = TbxMemPoolGetSizeClass(size);
+#endif
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+    /* Try to find the best fitting memory pool. Its free blocks might be available in
+     * the cache of the calling thread or core, so do not check the shared linked list
+     * with free blocks just yet. Note that the memory pool lock is not needed for this.
+     * Memory pools are never removed and a new memory pool is only published in the
+     * list and the size-class index with a memory barrier, after it was fully
+     * initialized. The lookup reads these links with a memory barrier as well.
+     */
+    poolNodePtr = TbxMemPoolListFindFit(size);
+#else
     /* Obtain mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionEnter();
+    TbxLockEnter(&tbxMemPoolLock);
     /* Try to find the best fitting memory pool that has a block available. */
     poolNodePtr = TbxMemPoolListFindBestFit(size);
+#endif
     /* Only continue with the allocation of a memory pool candidate was found. */
     if (poolNodePtr != NULL)
     {
       /* Get the pointer to the actual memory pool. */
-      tPool const * poolPtr = poolNodePtr->poolPtr;
+      tPool * poolPtr = poolNodePtr->poolPtr;
       /* Sanity check. The memory pool should not be NULL here. */
       TBX_ASSERT(poolPtr != NULL);
       /* Only continue if the sanity check passed. */
       if (poolPtr != NULL)
       {
-        /* Attempt to extract a block node from the linked list with free block nodes. */
-        tBlockNode * blockNodePtr = TbxMemPoolBlockListExtract(poolPtr->freeBlockListPtr);
-        /* Only continue if a free block node could be extracted. */
-        if (blockNodePtr != NULL)
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+        /* Attempt to extract a block from the cache of the calling thread or core. */
+        void * blockPtr = TbxMemPoolCacheExtract(poolPtr);
+#else
+        /* Attempt to extract a block from the linked list with free blocks. */
+        void * blockPtr = TbxMemPoolBlockListExtract(&poolPtr->freeBlockListPtr);
+#endif
+        /* Only continue if a free block could be extracted. */
+        if (blockPtr != NULL)
         {
+          /* The block is now allocated. */
+          TbxMemPoolBlockMarkUsed(blockPtr);
           /* Read and store the pointer that points to the block's data. */
-          blockDataPtr = TbxMemPoolBlockGetDataPtr(blockNodePtr->blockPtr);
-          /* Now the node itself needs to be inserted into the linked list with used
-           * block nodes. This way this node can be reused when freeing this or another
-           * block.
-           */
-          TbxMemPoolBlockListInsert(poolPtr->usedBlockListPtr, blockNodePtr);
+          result = TbxMemPoolBlockGetDataPtr(blockPtr);
           /* Perform a sanity check. The block's data pointer should not be NULL here. */
-          TBX_ASSERT(blockDataPtr != NULL);
-          /* Set the result value. */
-          result = blockDataPtr;
+          TBX_ASSERT(result != NULL);
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+          /* Update the statistics counters. */
+          (void)TbxMemPoolStatsAdd(&poolPtr->stats.allocCount, 1U);
+          TbxMemPoolStatsUpdateMax(&poolPtr->stats.highWaterMark,
+                                   TbxMemPoolStatsAdd(&poolPtr->stats.usedBlocks, 1U));
+#endif
         }
       }
     }
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+    /* Did the allocation fail? */
+    if (result == NULL)
+    {
+      /* Register the failed allocation with the best fitting memory pool, if any. */
+      tPoolNode const * fitNodePtr = TbxMemPoolListFindFit(size);
+      if (fitNodePtr != NULL)
+      {
+        (void)TbxMemPoolStatsAdd(&fitNodePtr->poolPtr->stats.allocFailCount, 1U);
+      }
+    }
+#endif
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
     /* Release mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionExit();
+    TbxLockExit(&tbxMemPoolLock);
+#endif
   }
 
   /* Give the result back to the caller. */
@@ -370,6 +604,7 @@ void TbxMemPoolRelease(void * memPtr)
 {
   void            * blockPtr;
   tPoolNode const * poolNodePtr;
+  uint8_t           blockInUse;
 
   /* Verify parameter. */
   TBX_ASSERT(memPtr != NULL);
@@ -377,8 +612,6 @@ void TbxMemPoolRelease(void * memPtr)
   /* Only continue if the parameter is valid. */
   if (memPtr != NULL)
   {
-    /* Obtain mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionEnter();
     /* First convert the block's data pointer to the block's base memory pointer. */
     blockPtr = TbxMemPoolBlockGetMemPtr(memPtr);
     /* Only continue if the block pointer is valid. */
@@ -386,264 +619,1644 @@ void TbxMemPoolRelease(void * memPtr)
     {
       /* Get the block's data size. */
       size_t blockSize = TbxMemPoolBlockGetBlockSize(blockPtr);
-      /* Attempt to locate the memory pool node that holds the memory pool with this
-       * block size.
-       */
-      poolNodePtr = TbxMemPoolListFind(blockSize);
-      /* Sanity check. The memory pool node that the to be released memory originally
-       * belonged to should have been found.
-       */
-      TBX_ASSERT(poolNodePtr != NULL);
-      /* Only continue if the sanity check passed. */
-      if (poolNodePtr != NULL)
+      /* Does the block belong to a lock-free fixed-size memory pool? */
+      if ((blockSize & TBX_MEMPOOL_FIXED_FLAG) != 0U)
+      {
+        /* Release the block to its fixed-size memory pool, without any locking. */
+        TbxMemPoolFixedReleaseBlock(blockPtr);
+      }
+      else
       {
-        /* Get the pointer to the actual memory pool. */
-        tPool const * poolPtr = poolNodePtr->poolPtr;
-        /* Sanity check. The memory pool should not be NULL here. */
-        TBX_ASSERT(poolPtr != NULL);
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+        /* Obtain mutual exclusive access to the memory pool list. */
+        TbxLockEnter(&tbxMemPoolLock);
+#endif
+        /* Attempt to locate the memory pool node that holds the memory pool with this
+         * block size.
+         */
+        poolNodePtr = TbxMemPoolListFind(blockSize);
+        /* Sanity check. The memory pool node that the to be released memory originally
+         * belonged to should have been found.
+         */
+        TBX_ASSERT(poolNodePtr != NULL);
         /* Only continue if the sanity check passed. */
-        if (poolPtr != NULL)
+        if (poolNodePtr != NULL)
         {
-          /* Attempt to extract a block node from the linked list with used block
-           * nodes.
-           */
-          tBlockNode * blockNodePtr = TbxMemPoolBlockListExtract(poolPtr->usedBlockListPtr);
-          /* Sanity check. A node should be available, otherwise more blocks were
-           * released than actually allocated, which shouldn't happen.
-           */
-          TBX_ASSERT(blockNodePtr != NULL);
-          /* Only continue if a block node could be extracted. */
-          if (blockNodePtr != NULL)
+          /* Get the pointer to the actual memory pool. */
+          tPool * poolPtr = poolNodePtr->poolPtr;
+          /* Sanity check. The memory pool should not be NULL here. */
+          TBX_ASSERT(poolPtr != NULL);
+          /* Only continue if the sanity check passed. */
+          if (poolPtr != NULL)
           {
-            /* Initialize the block. */
-            blockNodePtr->blockPtr = blockPtr;
-            /* Now the node itself needs to be inserted into the linked list with free
-             * block nodes. This way this node can be allocated again in the future.
+            /* Sanity check. The block should still be allocated. Otherwise more blocks
+             * were released than actually allocated, which shouldn't happen.
              */
-            TbxMemPoolBlockListInsert(poolPtr->freeBlockListPtr, blockNodePtr);
+            blockInUse = TbxMemPoolBlockMarkFree(blockPtr);
+            TBX_ASSERT(blockInUse == TBX_TRUE);
+            /* Only continue if the sanity check passed. */
+            if (blockInUse == TBX_TRUE)
+            {
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+              /* Insert the block into the cache of the calling thread or core. This way
+               * it can be allocated again in the future.
+               */
+              TbxMemPoolCacheInsert(poolPtr, blockPtr);
+#else
+              /* Insert the block into the linked list with free blocks. This way it can
+               * be allocated again in the future.
+               */
+              TbxMemPoolBlockListInsert(&poolPtr->freeBlockListPtr, blockPtr);
+#endif
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+              /* Update the statistics counters. Adding UINT32_MAX decrements by one. */
+              (void)TbxMemPoolStatsAdd(&poolPtr->stats.usedBlocks, UINT32_MAX);
+#endif
+            }
           }
         }
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+        /* Release mutual exclusive access to the memory pool list. */
+        TbxLockExit(&tbxMemPoolLock);
+#endif
       }
     }
-    /* Release mutual exclusive access to the memory pool list. */
-    TbxCriticalSectionExit();
   }
 } /*** end of TbxMemPoolRelease ***/
 
 
-/****************************************************************************************
-*   P O O L   L I S T   M A N A G E M E N T   F U N C T I O N S
-****************************************************************************************/
-
 /************************************************************************************//**
-** \brief     Searches through the linked list with memory pools to find a pool that was
-**            created to hold blocks that are of the exact size as specified by the
-**            parameter.
-** \param     blockSize Size of the blocks managed by the memory pool.
-** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+** \brief     Attempts to allocate multiple blocks of the desired number of bytes at once,
+**            in a previously created memory pool. Compared to calling
+**            TbxMemPoolAllocate() for each block, the best fitting memory pool is looked
+**            up only once and the memory pool lock is entered only once for the entire
+**            batch. Either all blocks are allocated or none at all. Note that the blocks
+**            are all allocated from the best fitting memory pool.
+** \param     size The number of bytes to allocate for each block.
+** \param     count The number of blocks to allocate.
+** \param     ptrArray Array with at least count elements, where the pointers to the
+**            allocated blocks are written to.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when the best fitting
+**            memory pool does not have enough free blocks.
 **
 ****************************************************************************************/
-static tPoolNode * TbxMemPoolListFind(size_t blockSize)
+uint8_t TbxMemPoolAllocateBatch(size_t   size,
+                                size_t   count,
+                                void   * ptrArray[])
 {
-  tPoolNode * result = NULL;
-  tPoolNode * poolNodePtr;
+  uint8_t           result = TBX_ERROR;
+  tPoolNode const * poolNodePtr;
+  void            * blockPtr;
+  size_t            allocCount = 0U;
 
-  /* Verify parameter. */
-  TBX_ASSERT(blockSize > 0U);
+  /* Verify parameters. */
+  TBX_ASSERT(size > 0U);
+  TBX_ASSERT(count > 0U);
+  TBX_ASSERT(ptrArray != NULL);
 
-  /* Only continue if the parameter is valid. */
-  if (blockSize > 0U)
+  /* Only continue if the parameters are valid. */
+  if ( (size > 0U) && (count > 0U) && (ptrArray != NULL) )
   {
-    /* Get pointer to the pool node at the head of the linked list. */
-    poolNodePtr = tbxPoolList;
-    /* Loop through all nodes until a match is found. */
-    while (poolNodePtr != NULL)
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE > 0U)
+    /* Allocate from the memory pool of the size class that the size belongs to. */
+    size = TbxMemPoolGetSizeClass(size);
+#endif
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+    /* Obtain mutual exclusive access to the memory pool list. */
+    TbxLockEnter(&tbxMemPoolLock);
+#endif
+    /* Look up the best fitting memory pool only once, for the entire batch. */
+    poolNodePtr = TbxMemPoolListFindFit(size);
+    /* Only continue with the allocation of a memory pool candidate was found. */
+    if (poolNodePtr != NULL)
     {
-      /* Does this node hold a memory pool created for the same block size as we are
-       * trying to find?
+      /* Get the pointer to the actual memory pool. */
+      tPool * poolPtr = poolNodePtr->poolPtr;
+      /* Extract the blocks one by one, until the batch is complete or until the memory
+       * pool ran out of free blocks.
        */
-      if (poolNodePtr->poolPtr->blockSize == blockSize)
+      while (allocCount < count)
       {
-        /* Update the result because a match was found. */
-        result = poolNodePtr;
-        /* No need to continue looping since a match was found. */
-        break;
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+        /* Attempt to extract a block from the cache of the calling thread or core. */
+        blockPtr = TbxMemPoolCacheExtract(poolPtr);
+#else
+        /* Attempt to extract a block from the linked list with free blocks. */
+        blockPtr = TbxMemPoolBlockListExtract(&poolPtr->freeBlockListPtr);
+#endif
+        /* Stop if the memory pool ran out of free blocks. */
+        if (blockPtr == NULL)
+        {
+          break;
+        }
+        /* The block is now allocated. Store the pointer that points to its data. */
+        TbxMemPoolBlockMarkUsed(blockPtr);
+        ptrArray[allocCount] = TbxMemPoolBlockGetDataPtr(blockPtr);
+        allocCount++;
+      }
+      /* Were all blocks of the batch allocated? */
+      if (allocCount == count)
+      {
+        /* Update the result for success. */
+        result = TBX_OK;
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+        /* Update the statistics counters. */
+        (void)TbxMemPoolStatsAdd(&poolPtr->stats.allocCount, (uint32_t)count);
+        TbxMemPoolStatsUpdateMax(&poolPtr->stats.highWaterMark,
+                                 TbxMemPoolStatsAdd(&poolPtr->stats.usedBlocks,
+                                                    (uint32_t)count));
+#endif
+      }
+      /* Not enough free blocks, so give back the ones that were already allocated. */
+      else
+      {
+        while (allocCount > 0U)
+        {
+          allocCount--;
+          blockPtr = TbxMemPoolBlockGetMemPtr(ptrArray[allocCount]);
+          (void)TbxMemPoolBlockMarkFree(blockPtr);
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+          TbxMemPoolCacheInsert(poolPtr, blockPtr);
+#else
+          TbxMemPoolBlockListInsert(&poolPtr->freeBlockListPtr, blockPtr);
+#endif
+          ptrArray[allocCount] = NULL;
+        }
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+        /* Update the statistics counters. */
+        (void)TbxMemPoolStatsAdd(&poolPtr->stats.allocFailCount, 1U);
+#endif
       }
-      /* Continue with the next pool node in the list. */
-      poolNodePtr = poolNodePtr->nextNodePtr;
     }
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+    /* Release mutual exclusive access to the memory pool list. */
+    TbxLockExit(&tbxMemPoolLock);
+#endif
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolListFind ***/
+} /*** end of TbxMemPoolAllocateBatch ***/
 
 
 /************************************************************************************//**
-** \brief     Searches through the linked list with memory pools to find a pool that was
-**            created to hold blocks that are of equal size or slightly greater. If the
-**            found memory pool has no more free blocks available the search
-**            is NOT continued for a memory pool of the next size up. Although this
-**            sounds like a nice feature to have, this was not implemented on purpose.
-**            The reason for this is that it is now possible to expand an existing memory
-**            pool when it is full. Assume a situation where all blocks in the memory
-**            pool are already allocated. The next call to TbxMemPoolAllocate() therefore
-**            fails. You can now call TbxMemPoolCreate() again for the same block size
-**            and the original memory pool is expanded automatically. Note that this
-**            function relies on the fact that the memory pools in the list are sorted
-**            by ascending block size.
-** \param     blockSize Size of the block to fit.
-** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+** \brief     Releases multiple previously allocated blocks of memory at once. Compared
+**            to calling TbxMemPoolRelease() for each block, the memory pool lock is
+**            entered only once for the entire batch. The memory pool that a block
+**            belongs to is only looked up again, if it differs from the one of the
+**            previous block in the array.
+** \param     ptrArray Array with the pointers to the blocks to release. Basically, the
+**            pointers that were returned by TbxMemPoolAllocate() or
+**            TbxMemPoolAllocateBatch(), when the memory was initially allocated.
+** \param     count The number of blocks in the array.
 **
 ****************************************************************************************/
-static tPoolNode * TbxMemPoolListFindBestFit(size_t blockSize)
+void TbxMemPoolReleaseBatch(void   * ptrArray[],
+                            size_t   count)
 {
-  tPoolNode * result = NULL;
-  tPoolNode * poolNodePtr;
+  void              * blockPtr;
+  tPoolNode   const * poolNodePtr;
+  tPool             * poolPtr = NULL;
+  uint8_t             blockInUse;
 
-  /* Verify parameter. */
-  TBX_ASSERT(blockSize > 0U);
+  /* Verify parameters. */
+  TBX_ASSERT(ptrArray != NULL);
+  TBX_ASSERT(count > 0U);
 
-  /* Only continue if the parameter is valid. */
-  if (blockSize > 0U)
+  /* Only continue if the parameters are valid. */
+  if ( (ptrArray != NULL) && (count > 0U) )
   {
-    /* Get pointer to the pool node at the head of the linked list. */
-    poolNodePtr = tbxPoolList;
-    /* Loop through all nodes until a fit is found. */
-    while (poolNodePtr != NULL)
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+    /* Obtain mutual exclusive access to the memory pool list. */
+    TbxLockEnter(&tbxMemPoolLock);
+#endif
+    /* Release the blocks one by one. */
+    for (size_t idx = 0U; idx < count; idx++)
     {
-      /* Does this memory pool hold blocks that would fit the specified block size? */
-      if (poolNodePtr->poolPtr->blockSize >= blockSize)
+      /* Convert the block's data pointer to the block's base memory pointer. Note that
+       * this function also verifies the block's data pointer.
+       */
+      blockPtr = TbxMemPoolBlockGetMemPtr(ptrArray[idx]);
+      /* Only continue if the block pointer is valid. */
+      if (blockPtr != NULL)
       {
-        /* A fit is found. Now check if this memory pool has free blocks available. */
-        if (TbxMemPoolBlockListIsEmpty(poolNodePtr->poolPtr->freeBlockListPtr) \
-            == TBX_FALSE)
+        /* Get the block's data size. */
+        size_t blockSize = TbxMemPoolBlockGetBlockSize(blockPtr);
+        /* Does the block belong to a lock-free fixed-size memory pool? */
+        if ((blockSize & TBX_MEMPOOL_FIXED_FLAG) != 0U)
         {
-          /* Found a match so update the result value. */
-          result = poolNodePtr;
+          /* Release the block to its fixed-size memory pool, without any locking. */
+          TbxMemPoolFixedReleaseBlock(blockPtr);
+        }
+        else
+        {
+          /* Only look up the memory pool, if the block belongs to a different one than
+           * the previous block.
+           */
+          if ( (poolPtr == NULL) || (poolPtr->blockSize != blockSize) )
+          {
+            poolPtr = NULL;
+            poolNodePtr = TbxMemPoolListFind(blockSize);
+            /* Sanity check. The memory pool node that the to be released memory
+             * originally belonged to should have been found.
+             */
+            TBX_ASSERT(poolNodePtr != NULL);
+            if (poolNodePtr != NULL)
+            {
+              poolPtr = poolNodePtr->poolPtr;
+            }
+          }
+          /* Only continue if the memory pool is known. */
+          if (poolPtr != NULL)
+          {
+            /* Sanity check. The block should still be allocated. */
+            blockInUse = TbxMemPoolBlockMarkFree(blockPtr);
+            TBX_ASSERT(blockInUse == TBX_TRUE);
+            /* Only continue if the sanity check passed. */
+            if (blockInUse == TBX_TRUE)
+            {
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+              /* Insert the block into the cache of the calling thread or core. */
+              TbxMemPoolCacheInsert(poolPtr, blockPtr);
+#else
+              /* Insert the block into the linked list with free blocks. */
+              TbxMemPoolBlockListInsert(&poolPtr->freeBlockListPtr, blockPtr);
+#endif
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+              /* Update the statistics counters. Adding UINT32_MAX decrements by one. */
+              (void)TbxMemPoolStatsAdd(&poolPtr->stats.usedBlocks, UINT32_MAX);
+#endif
+            }
+          }
         }
-        /* Best fit is found, so no need to continue searching even if the memory pool
-         * does not have any free blocks available.
-         */
-        break;
       }
-      /* Continue with the next pool node in the list. */
-      poolNodePtr = poolNodePtr->nextNodePtr;
+    }
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+    /* Release mutual exclusive access to the memory pool list. */
+    TbxLockExit(&tbxMemPoolLock);
+#endif
+  }
+} /*** end of TbxMemPoolReleaseBatch ***/
+
+
+/************************************************************************************//**
+** \brief     Rounds the specified size up to the size class that it belongs to. Sizes up
+**            to TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS times the address size are rounded up
+**            to a multiple of the address size. Larger sizes are rounded up, such that
+**            the range between two successive powers of two is split into
+**            TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS equally sized steps. For example, with
+**            four steps, size 37 and 38 both belong to size class 40. Creating memory
+**            pools per size class, instead of per exact size, keeps the number of memory
+**            pools small and makes it possible to reuse a released block for an
+**            allocation of a slightly different size.
+** \param     size The size in bytes to round up.
+** \return    The size class in bytes, or the size itself if rounding is disabled or if
+**            it would overflow.
+**
+****************************************************************************************/
+size_t TbxMemPoolGetSizeClass(size_t size)
+{
+  size_t result = size;
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS > 0U)
+  size_t step = sizeof(void *);
+  size_t rangeStart = TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS * sizeof(void *);
+#endif
+
+  /* Verify parameter. */
+  TBX_ASSERT(size > 0U);
+
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS > 0U)
+  /* Only continue if the parameter is valid. */
+  if (size > 0U)
+  {
+    /* Does the size lie above the range with linear steps of the address size? */
+    if (size > rangeStart)
+    {
+      /* Determine the power of two where the size range of the size starts, such that
+       * rangeStart < size <= (2 * rangeStart). Note that it is written like this to
+       * prevent an overflow.
+       */
+      while (rangeStart <= ((size - 1U) >> 1U))
+      {
+        rangeStart <<= 1U;
+      }
+      /* Split this size range into the configured number of steps. */
+      step = rangeStart / TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS;
+    }
+    /* Round the size up to a multiple of the step, if this does not overflow. */
+    if (size <= (SIZE_MAX - (step - 1U)))
+    {
+      result = (size + (step - 1U)) & ~(step - 1U);
     }
   }
+#endif
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolListFindBestFit ***/
+} /*** end of TbxMemPoolGetSizeClass ***/
 
 
 /************************************************************************************//**
-** \brief     Inserts the specified memory pool node into the linked list with memory
-**            pool nodes. It automatically sorts the nodes by ascending block size. Note
-**            that this function only works properly is there is not already a memory
-**            pool in the list configured for the same block size as the new one that
-**            this function should insert.
-** \param     nodePtr Pointer to the memory pool node to insert.
+** \brief     Creates a new lock-free fixed-size memory pool with the specified number of
+**            blocks, where each block has the size as specified by the second function
+**            parameter. The required memory is statically preallocated on the heap.
+**            Allocating a block is done with TbxMemPoolFixedAllocate(). Releasing a block
+**            is done with the regular TbxMemPoolRelease(). Its free blocks are managed
+**            with a lock-free stack, which is updated with an atomic compare and exchange
+**            operation. This makes it safe to allocate and release its blocks from an
+**            interrupt service routine, without masking the interrupts, on all ports
+**            where the atomic compare and exchange operation does not mask them.
+**            Note that such a memory pool is separate from the memory pools that were
+**            created with TbxMemPoolCreate(). TbxMemPoolAllocate() never allocates from
+**            it. To define a fixed-size memory pool at compile time instead, use macro
+**            TBX_MEMPOOL_DEFINE().
+** \param     numBlocks The number of blocks to statically preallocate on the heap for
+**            this memory pool. Can be 65535 at most.
+** \param     blockSize The size of each block in bytes.
+** \return    Handle to the newly created memory pool if successful, NULL otherwise for
+**            example when there is no more space available on the heap to statically
+**            preallocate the blocks.
 **
 ****************************************************************************************/
-static void TbxMemPoolListInsert(tPoolNode * nodePtr)
+tTbxMemPoolFixed * TbxMemPoolFixedCreate(size_t numBlocks,
+                                         size_t blockSize)
 {
-  tPoolNode * currentNodePtr;
-  tPoolNode * prevNodePtr = NULL;
-  uint8_t     nodeInserted = TBX_FALSE;
+  tTbxMemPoolFixed * result = NULL;
+  tTbxMemPoolFixed * poolPtr;
+  uint8_t          * slabPtr;
 
-  /* Verify parameter. */
-  TBX_ASSERT(nodePtr != NULL);
+  /* Verify parameters. */
+  TBX_ASSERT( (numBlocks > 0U) && (numBlocks <= TBX_MEMPOOL_FIXED_MAX_BLOCKS) );
+  TBX_ASSERT( (blockSize > 0U) && ((blockSize & TBX_MEMPOOL_FIXED_FLAG) == 0U) );
 
-  /* Only continue if the parameter is valid. */
-  if (nodePtr != NULL)
+  /* Only continue if the parameters are valid. */
+  if ( (numBlocks > 0U) && (numBlocks <= TBX_MEMPOOL_FIXED_MAX_BLOCKS) &&
+       (blockSize > 0U) && ((blockSize & TBX_MEMPOOL_FIXED_FLAG) == 0U) )
   {
-    /* Sanity check. The pointer to the memory pool should not be NULL here. */
-    TBX_ASSERT(nodePtr->poolPtr != NULL);
-    /* Is the list with memory pools empty? */
-    if (tbxPoolList == NULL)
+    /* Create the memory pool object and the slab that holds all the blocks. */
+    poolPtr = TbxHeapAllocate(sizeof(tTbxMemPoolFixed));
+    slabPtr = NULL;
+    if (poolPtr != NULL)
     {
-      /* Add the node at the start of the list. */
-      nodePtr->nextNodePtr = NULL;
-      tbxPoolList = nodePtr;
+      slabPtr = TbxHeapAllocate(numBlocks * TBX_MEMPOOL_FIXED_BLOCK_MEM_SIZE(blockSize));
     }
-    /* The list with memory pools is not empty. */
-    else
+    /* Only continue if the memory allocations were successful. */
+    if (slabPtr != NULL)
     {
-      /* Get pointer to the pool node at the head of the linked list. */
-      currentNodePtr = tbxPoolList;
-      /* Loop through the nodes to find the location where the new node should be
-       * inserted, such that the nodes always remain sorted by ascending block size.
+      /* Initialize the memory pool, just like TBX_MEMPOOL_DEFINE() does at compile
+       * time. Its blocks are carved from the slab on demand.
+       */
+      poolPtr->slabPtr = slabPtr;
+      poolPtr->blockMemSize = TBX_MEMPOOL_FIXED_BLOCK_MEM_SIZE(blockSize);
+      poolPtr->blockSize = blockSize;
+      poolPtr->numBlocks = (uint32_t)numBlocks;
+      poolPtr->freeHead = 0U;
+      poolPtr->numCarved = 0U;
+      poolPtr->nextPoolPtr = NULL;
+      poolPtr->listed = TBX_FALSE;
+      /* Add the memory pool to the linked list with fixed-size memory pools. */
+      TbxMemPoolFixedListInsert(poolPtr);
+      /* Update the result for success. */
+      result = poolPtr;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolFixedCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to allocate a block in the specified lock-free fixed-size memory
+**            pool. Safe to call from an interrupt service routine. Release the block
+**            with TbxMemPoolRelease(), once it is no longer needed.
+** \param     pool Handle to the fixed-size memory pool.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxMemPoolFixedAllocate(tTbxMemPoolFixed * pool)
+{
+  void                    * result = NULL;
+  void                    * dataPtr = NULL;
+  uint16_t volatile const * nextIdxPtr;
+  uint32_t                  blockIdx = 0U;
+  uint32_t                  headOld;
+  uint32_t                  headNew;
+  uint32_t                  headPrev;
+
+  /* Verify parameter. */
+  TBX_ASSERT(pool != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (pool != NULL)
+  {
+    /* Atomically read the head of the stack with free blocks. */
+    headPrev = TbxPortAtomicCompareExchange32(&pool->freeHead, 0U, 0U);
+    /* Keep trying until the first free block was atomically popped from the stack. */
+    do
+    {
+      headOld = headPrev;
+      blockIdx = headOld & TBX_MEMPOOL_FIXED_IDX_MASK;
+      /* Stop if there are no more free blocks. */
+      if (blockIdx == 0U)
+      {
+        break;
+      }
+      /* Read the index of the next free block from the first free block. If another
+       * thread or interrupt popped this block in the meantime, the value might not be
+       * valid. In this case the head changed, including its tag, and the compare and
+       * exchange operation below fails.
+       */
+      dataPtr = TbxMemPoolFixedGetDataPtr(pool, blockIdx);
+      nextIdxPtr = dataPtr;
+      /* The next free block becomes the new head. Increment the tag to protect against
+       * the ABA problem.
+       */
+      headNew = ((headOld + TBX_MEMPOOL_FIXED_TAG_INCR) & ~TBX_MEMPOOL_FIXED_IDX_MASK) |
+                ((uint32_t)*nextIdxPtr & TBX_MEMPOOL_FIXED_IDX_MASK);
+      headPrev = TbxPortAtomicCompareExchange32(&pool->freeHead, headOld, headNew);
+    }
+    while (headPrev != headOld);
+    /* Was a block popped from the stack? */
+    if (blockIdx != 0U)
+    {
+      /* The block is now allocated. */
+      TbxMemPoolBlockMarkUsed(TbxMemPoolBlockGetMemPtr(dataPtr));
+      result = dataPtr;
+    }
+    /* The stack is empty, so attempt to carve a block from the slab that was never
+     * allocated before.
+     */
+    else
+    {
+      result = TbxMemPoolFixedCarve(pool);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolFixedAllocate ***/
+
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Obtains the statistics of the memory pool with the specified block size.
+**            Useful for determining how many blocks a memory pool really needs.
+** \param     blockSize The block size of the memory pool, as specified when it was
+**            created.
+** \param     stats Pointer to where the statistics are written to.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when no memory pool
+**            with this block size exists.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolGetStats(size_t             blockSize,
+                           tTbxMemPoolStats * stats)
+{
+  uint8_t           result = TBX_ERROR;
+  tPoolNode const * poolNodePtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(blockSize > 0U);
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (blockSize > 0U) && (stats != NULL) )
+  {
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE > 0U)
+    /* The memory pool is identified by the size class of its block size. */
+    blockSize = TbxMemPoolGetSizeClass(blockSize);
+#endif
+    /* Obtain mutual exclusive access to the memory pool list. */
+    TbxLockEnter(&tbxMemPoolLock);
+    /* Attempt to locate the memory pool with this block size. */
+    poolNodePtr = TbxMemPoolListFind(blockSize);
+    /* Collect its statistics, if found. */
+    if (poolNodePtr != NULL)
+    {
+      TbxMemPoolStatsCollect(poolNodePtr->poolPtr, stats);
+      result = TBX_OK;
+    }
+    /* Release mutual exclusive access to the memory pool list. */
+    TbxLockExit(&tbxMemPoolLock);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolGetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the statistics of the memory pool with the smallest block size.
+**            Together with TbxMemPoolGetNextStats(), this makes it possible to iterate
+**            over the statistics of all memory pools:
+**              tTbxMemPoolStats stats;
+**              uint8_t          found = TbxMemPoolGetFirstStats(&stats);
+**              while (found == TBX_OK)
+**              {
+**                ...
+**                found = TbxMemPoolGetNextStats(&stats);
+**              }
+** \param     stats Pointer to where the statistics are written to.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when no memory pools
+**            were created yet.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolGetFirstStats(tTbxMemPoolStats * stats)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (stats != NULL)
+  {
+    /* Obtain mutual exclusive access to the memory pool list. */
+    TbxLockEnter(&tbxMemPoolLock);
+    /* The memory pool list is sorted by ascending block size, so the memory pool at
+     * the head of the list is the one with the smallest block size.
+     */
+    if (tbxPoolList != NULL)
+    {
+      TbxMemPoolStatsCollect(tbxPoolList->poolPtr, stats);
+      result = TBX_OK;
+    }
+    /* Release mutual exclusive access to the memory pool list. */
+    TbxLockExit(&tbxMemPoolLock);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolGetFirstStats ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the statistics of the memory pool that follows the one, whose
+**            statistics are currently stored in the stats parameter. The memory pools
+**            are iterated by ascending block size.
+** \param     stats Pointer to the statistics that were obtained with a previous call to
+**            TbxMemPoolGetFirstStats() or TbxMemPoolGetNextStats(). The statistics of
+**            the next memory pool are written to it.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when there are no
+**            more memory pools.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolGetNextStats(tTbxMemPoolStats * stats)
+{
+  uint8_t           result = TBX_ERROR;
+  tPoolNode const * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (stats != NULL)
+  {
+    /* Only continue if a memory pool with a larger block size can exist. */
+    if (stats->blockSize < SIZE_MAX)
+    {
+      /* Obtain mutual exclusive access to the memory pool list. */
+      TbxLockEnter(&tbxMemPoolLock);
+      /* The next memory pool is the one with the smallest block size that is larger
+       * than the block size of the current one.
+       */
+      poolNodePtr = TbxMemPoolListFindFit(stats->blockSize + 1U);
+      /* Collect its statistics, if found. */
+      if (poolNodePtr != NULL)
+      {
+        TbxMemPoolStatsCollect(poolNodePtr->poolPtr, stats);
+        result = TBX_OK;
+      }
+      /* Release mutual exclusive access to the memory pool list. */
+      TbxLockExit(&tbxMemPoolLock);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolGetNextStats ***/
+#endif /* (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U) */
+
+
+/****************************************************************************************
+*   P O O L   L I S T   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Searches through the linked list with memory pools to find a pool that was
+**            created to hold blocks that are of the exact size as specified by the
+**            parameter.
+** \param     blockSize Size of the blocks managed by the memory pool.
+** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListFind(size_t blockSize)
+{
+  tPoolNode * result = NULL;
+  tPoolNode * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (blockSize > 0U)
+  {
+    /* Locate the memory pool with the smallest block size that still fits. */
+    poolNodePtr = TbxMemPoolListFindFit(blockSize);
+    /* Only a match if this memory pool was created for exactly the same block size as
+     * we are trying to find.
+     */
+    if (poolNodePtr != NULL)
+    {
+      if (poolNodePtr->poolPtr->blockSize == blockSize)
+      {
+        /* Update the result because a match was found. */
+        result = poolNodePtr;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListFind ***/
+
+
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE == 0U)
+/************************************************************************************//**
+** \brief     Searches through the linked list with memory pools to find a pool that was
+**            created to hold blocks that are of equal size or slightly greater. If the
+**            found memory pool has no more free blocks available the search
+**            is NOT continued for a memory pool of the next size up. Although this
+**            sounds like a nice feature to have, this was not implemented on purpose.
+**            The reason for this is that it is now possible to expand an existing memory
+**            pool when it is full. Assume a situation where all blocks in the memory
+**            pool are already allocated. The next call to TbxMemPoolAllocate() therefore
+**            fails. You can now call TbxMemPoolCreate() again for the same block size
+**            and the original memory pool is expanded automatically.
+** \param     blockSize Size of the block to fit.
+** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListFindBestFit(size_t blockSize)
+{
+  tPoolNode * result = NULL;
+  tPoolNode * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (blockSize > 0U)
+  {
+    /* Locate the memory pool with the smallest block size that still fits. */
+    poolNodePtr = TbxMemPoolListFindFit(blockSize);
+    /* A fit is found. Now check if this memory pool has free blocks available. */
+    if (poolNodePtr != NULL)
+    {
+      if (TbxMemPoolBlockListIsEmpty(&poolNodePtr->poolPtr->freeBlockListPtr) \
+          == TBX_FALSE)
+      {
+        /* Found a match so update the result value. */
+        result = poolNodePtr;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListFindBestFit ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Locates the memory pool with the smallest block size that is still equal
+**            to or larger than the specified block size, regardless of it having free
+**            blocks available or not. Block sizes covered by the size-class index are
+**            looked up in constant time. For all other block sizes, the linked list with
+**            memory pools is searched. Note that this function relies on the fact that
+**            the memory pools in the list are sorted by ascending block size.
+** \param     blockSize Size of the block to fit.
+** \return    Pointer to the found memory pool node if successful, NULL otherwise.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListFindFit(size_t blockSize)
+{
+  tPoolNode * result = NULL;
+  tPoolNode * poolNodePtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(blockSize > 0U);
+
+  /* Only continue if the parameter is valid. */
+  if (blockSize > 0U)
+  {
+    /* Get pointer to the pool node at the head of the linked list. */
+    poolNodePtr = TbxMemPoolListLoad(&tbxPoolList);
+#if (TBX_CONF_MEMPOOL_INDEX_MAX_SIZE > 0U)
+    /* Is this block size covered by the size-class index? */
+    if (blockSize <= TBX_CONF_MEMPOOL_INDEX_MAX_SIZE)
+    {
+      /* Read the best fitting memory pool directly from the index. */
+      result = TbxMemPoolListLoad(&tbxPoolIndex[blockSize - 1U]);
+      /* No need to search through the linked list. */
+      poolNodePtr = NULL;
+    }
+#endif
+    /* Loop through all nodes until a fit is found. */
+    while (poolNodePtr != NULL)
+    {
+      /* Does this memory pool hold blocks that would fit the specified block size? */
+      if (poolNodePtr->poolPtr->blockSize >= blockSize)
+      {
+        /* Best fit is found, so no need to continue searching. */
+        result = poolNodePtr;
+        break;
+      }
+      /* Continue with the next pool node in the list. */
+      poolNodePtr = TbxMemPoolListLoad(&poolNodePtr->nextNodePtr);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListFindFit ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts the specified memory pool node into the linked list with memory
+**            pool nodes. It automatically sorts the nodes by ascending block size. Note
+**            that this function only works properly is there is not already a memory
+**            pool in the list configured for the same block size as the new one that
+**            this function should insert.
+** \param     nodePtr Pointer to the memory pool node to insert.
+**
+****************************************************************************************/
+static void TbxMemPoolListInsert(tPoolNode * nodePtr)
+{
+  tPoolNode * currentNodePtr;
+  tPoolNode * prevNodePtr = NULL;
+  uint8_t     nodeInserted = TBX_FALSE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(nodePtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (nodePtr != NULL)
+  {
+    /* Sanity check. The pointer to the memory pool should not be NULL here. */
+    TBX_ASSERT(nodePtr->poolPtr != NULL);
+    /* Is the list with memory pools empty? */
+    if (tbxPoolList == NULL)
+    {
+      /* Add the node at the start of the list. */
+      nodePtr->nextNodePtr = NULL;
+      TbxMemPoolListPublish(&tbxPoolList, nodePtr);
+    }
+    /* The list with memory pools is not empty. */
+    else
+    {
+      /* Get pointer to the pool node at the head of the linked list. */
+      currentNodePtr = tbxPoolList;
+      /* Loop through the nodes to find the location where the new node should be
+       * inserted, such that the nodes always remain sorted by ascending block size.
        */
       while (currentNodePtr != NULL)
       {
-        /* Sanity check. The pointer to the memory pool should not be NULL here. */
-        TBX_ASSERT(currentNodePtr->poolPtr != NULL);
-        /* Only continue if the sanity check passed. */
-        if (currentNodePtr->poolPtr != NULL)
-        {
-          /* This function should not be used to insert a memory pool node that has a
-           * block size that equals an already existing node. Verify this.
-          */
-          TBX_ASSERT(currentNodePtr->poolPtr->blockSize != nodePtr->poolPtr->blockSize);
-          /* Is the block size of this node's memory pool larger than the new one? */
-          if (currentNodePtr->poolPtr->blockSize > nodePtr->poolPtr->blockSize)
-          {
-            /* The new node should be inserted before this one. If the current node is
-             * the head of the list, the new node should become the new head.
-            */
-            if (currentNodePtr == tbxPoolList)
-            {
-              /* Sanity check. In this case the previous node should still be NULL. */
-              TBX_ASSERT(prevNodePtr == NULL);
-              /* Add the node at the start of the list, right before the current node. */
-              nodePtr->nextNodePtr = currentNodePtr;
-              tbxPoolList = nodePtr;
-            }
-            /* The current node is not the head of the list, so the new node should be
-             * inserted between previous node and the current node.
-            */
-            else
-            {
-              /* Sanity check. In this case the previous node should not be NULL. */
-              TBX_ASSERT(prevNodePtr != NULL);
-              /* Only continue if the sanity check passed. */
-              if (prevNodePtr != NULL)
-              {
-                /* Insert the node between the previous and current nodes. */
-                nodePtr->nextNodePtr = currentNodePtr;
-                prevNodePtr->nextNodePtr = nodePtr;
-              }
-            }
-            /* Set flag to indicate that the new node was successfully inserted. */
-            nodeInserted = TBX_TRUE;
-          }
-        }
-        /* Did we reach the end of the list and the new node was not yet inserted? */
-        if ( (currentNodePtr->nextNodePtr == NULL) && (nodeInserted == TBX_FALSE) )
+        /* Sanity check. The pointer to the memory pool should not be NULL here. */
+        TBX_ASSERT(currentNodePtr->poolPtr != NULL);
+        /* Only continue if the sanity check passed. */
+        if (currentNodePtr->poolPtr != NULL)
+        {
+          /* This function should not be used to insert a memory pool node that has a
+           * block size that equals an already existing node. Verify this.
+          */
+          TBX_ASSERT(currentNodePtr->poolPtr->blockSize != nodePtr->poolPtr->blockSize);
+          /* Is the block size of this node's memory pool larger than the new one? */
+          if (currentNodePtr->poolPtr->blockSize > nodePtr->poolPtr->blockSize)
+          {
+            /* The new node should be inserted before this one. If the current node is
+             * the head of the list, the new node should become the new head.
+            */
+            if (currentNodePtr == tbxPoolList)
+            {
+              /* Sanity check. In this case the previous node should still be NULL. */
+              TBX_ASSERT(prevNodePtr == NULL);
+              /* Add the node at the start of the list, right before the current node. */
+              nodePtr->nextNodePtr = currentNodePtr;
+              TbxMemPoolListPublish(&tbxPoolList, nodePtr);
+            }
+            /* The current node is not the head of the list, so the new node should be
+             * inserted between previous node and the current node.
+            */
+            else
+            {
+              /* Sanity check. In this case the previous node should not be NULL. */
+              TBX_ASSERT(prevNodePtr != NULL);
+              /* Only continue if the sanity check passed. */
+              if (prevNodePtr != NULL)
+              {
+                /* Insert the node between the previous and current nodes. */
+                nodePtr->nextNodePtr = currentNodePtr;
+                TbxMemPoolListPublish(&prevNodePtr->nextNodePtr, nodePtr);
+              }
+            }
+            /* Set flag to indicate that the new node was successfully inserted. */
+            nodeInserted = TBX_TRUE;
+          }
+        }
+        /* Did we reach the end of the list and the new node was not yet inserted? */
+        if ( (currentNodePtr->nextNodePtr == NULL) && (nodeInserted == TBX_FALSE) )
+        {
+          /* There are no memory pools present in the list that have a block size larger
+           * than the new node. This means that the new node should be inserted at the
+           * tail of the list.
+           */
+          nodePtr->nextNodePtr = NULL;
+          TbxMemPoolListPublish(&currentNodePtr->nextNodePtr, nodePtr);
+          /* Set flag to indicate that the new node was successfully inserted. */
+          nodeInserted = TBX_TRUE;
+        }
+        /* Check if the new node was already inserted. */
+        if (nodeInserted == TBX_TRUE)
+        {
+          /* All done so no need to continue looping. */
+          break;
+        }
+        /* Update loop variables. */
+        prevNodePtr = currentNodePtr;
+        currentNodePtr = currentNodePtr->nextNodePtr;
+      }
+    }
+#if (TBX_CONF_MEMPOOL_INDEX_MAX_SIZE > 0U)
+    /* Register the new memory pool in the size-class index. */
+    TbxMemPoolIndexInsert(nodePtr);
+#endif
+  }
+} /*** end of TbxMemPoolListInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Reads a link to a memory pool node, so either the head of the linked list
+**            with memory pools, the link to the next node or an element of the size-class
+**            index. With the cache enabled, the memory pools are looked up without the
+**            memory pool lock. The memory barrier makes sure that the node is not read
+**            before the link itself, which is the counterpart of the memory barrier in
+**            TbxMemPoolListPublish().
+** \param     linkPtr Pointer to the link to read.
+** \return    Pointer to the memory pool node that the link points to.
+**
+****************************************************************************************/
+static tPoolNode * TbxMemPoolListLoad(tPoolNode * volatile const * linkPtr)
+{
+  tPoolNode * result;
+
+  /* Read the link. */
+  result = *linkPtr;
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+  /* Make sure the node is only read after the link. */
+  TbxPortMemoryBarrier();
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolListLoad ***/
+
+
+/************************************************************************************//**
+** \brief     Writes a link to a memory pool node, so either the head of the linked list
+**            with memory pools, the link to the next node or an element of the size-class
+**            index. With the cache enabled, the memory pools are looked up without the
+**            memory pool lock. The memory barrier makes sure that the initialization of
+**            the node and its memory pool is visible to the other threads or cores,
+**            before the link that publishes the node.
+** \param     linkPtr Pointer to the link to write.
+** \param     nodePtr Pointer to the memory pool node to publish.
+**
+****************************************************************************************/
+static void TbxMemPoolListPublish(tPoolNode * volatile * linkPtr,
+                                  tPoolNode            * nodePtr)
+{
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+  /* Make sure the node is fully initialized, before it is published. */
+  TbxPortMemoryBarrier();
+#endif
+  /* Write the link. */
+  *linkPtr = nodePtr;
+} /*** end of TbxMemPoolListPublish ***/
+
+
+#if (TBX_CONF_MEMPOOL_INDEX_MAX_SIZE > 0U)
+/****************************************************************************************
+*   S I Z E - C L A S S   I N D E X   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Updates the size-class index after a new memory pool was added to the
+**            linked list with memory pools. All index elements, for which the new
+**            memory pool is now the best fit, are updated to point to its node. Note
+**            that the best fitting block size never decreases for a larger index. The
+**            update therefore starts at the top and stops at the first element that
+**            already has a better fitting memory pool.
+** \param     nodePtr Pointer to the memory pool node that was just inserted.
+**
+****************************************************************************************/
+static void TbxMemPoolIndexInsert(tPoolNode * nodePtr)
+{
+  size_t idx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(nodePtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (nodePtr != NULL)
+  {
+    /* The new memory pool can only be a fit for block sizes up to its own block size. */
+    idx = nodePtr->poolPtr->blockSize;
+    if (idx > TBX_CONF_MEMPOOL_INDEX_MAX_SIZE)
+    {
+      idx = TBX_CONF_MEMPOOL_INDEX_MAX_SIZE;
+    }
+    /* Loop downwards through the index elements that the new memory pool could fit. */
+    while (idx > 0U)
+    {
+      tPoolNode const * fitNodePtr = tbxPoolIndex[idx - 1U];
+      /* Stop as soon as an element already has a memory pool with a smaller block size
+       * or the same block size.
+       */
+      if (fitNodePtr != NULL)
+      {
+        if (fitNodePtr->poolPtr->blockSize <= nodePtr->poolPtr->blockSize)
+        {
+          break;
+        }
+      }
+      /* The new memory pool is the best fit for this block size. */
+      TbxMemPoolListPublish(&tbxPoolIndex[idx - 1U], nodePtr);
+      idx--;
+    }
+  }
+} /*** end of TbxMemPoolIndexInsert ***/
+#endif
+
+
+#if (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U)
+/****************************************************************************************
+*   C A C H E   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Extracts a free block from the cache of the calling thread or core. If the
+**            cache is empty, it is first refilled with a batch of free blocks from the
+**            shared linked list with free blocks of the memory pool. Only this refill
+**            needs the memory pool lock. Note that the cache and the memory pool lock
+**            are never held at the same time, which rules out lock order problems.
+** \param     poolPtr Pointer to the memory pool.
+** \return    Pointer to the memory of the block that was extracted or NULL if the
+**            memory pool has no more free blocks.
+**
+****************************************************************************************/
+static void * TbxMemPoolCacheExtract(tPool * poolPtr)
+{
+  void    * result = NULL;
+  void    * refillListPtr = NULL;
+  void    * blockPtr;
+  size_t    refillCount = 0U;
+  uint8_t   slotIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(poolPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (poolPtr != NULL)
+  {
+    /* Obtain exclusive access to the cache of the calling thread or core. */
+    slotIdx = TbxPortCacheSlotEnter();
+    /* Attempt to extract a block from the cache. */
+    result = TbxMemPoolBlockListExtract(&poolPtr->cacheListPtr[slotIdx]);
+    /* Update the block counter of the cache, if a block could be extracted. */
+    if (result != NULL)
+    {
+      poolPtr->cacheCount[slotIdx]--;
+    }
+    /* Release exclusive access to the cache. */
+    TbxPortCacheSlotExit(slotIdx);
+
+    /* Refill the cache from the shared memory pool in case of a cache miss. */
+    if (result == NULL)
+    {
+      /* Obtain mutual exclusive access to the shared memory pool. */
+      TbxLockEnter(&tbxMemPoolLock);
+      /* Attempt to extract the block for the caller. */
+      result = TbxMemPoolBlockListExtract(&poolPtr->freeBlockListPtr);
+      /* Only refill the cache if the memory pool did not run out of free blocks. */
+      if (result != NULL)
+      {
+        /* Collect a batch of free blocks for refilling the cache. */
+        while (refillCount < (TBX_MEMPOOL_CACHE_BATCH_SIZE - 1U))
+        {
+          blockPtr = TbxMemPoolBlockListExtract(&poolPtr->freeBlockListPtr);
+          /* Stop when the memory pool has no more free blocks. */
+          if (blockPtr == NULL)
+          {
+            break;
+          }
+          TbxMemPoolBlockListInsert(&refillListPtr, blockPtr);
+          refillCount++;
+        }
+      }
+      /* Release mutual exclusive access to the shared memory pool. */
+      TbxLockExit(&tbxMemPoolLock);
+
+      /* Move the collected free blocks to the cache. */
+      if (refillCount > 0U)
+      {
+        /* Obtain exclusive access to the cache of the calling thread or core. */
+        slotIdx = TbxPortCacheSlotEnter();
+        blockPtr = TbxMemPoolBlockListExtract(&refillListPtr);
+        while (blockPtr != NULL)
+        {
+          TbxMemPoolBlockListInsert(&poolPtr->cacheListPtr[slotIdx], blockPtr);
+          blockPtr = TbxMemPoolBlockListExtract(&refillListPtr);
+        }
+        poolPtr->cacheCount[slotIdx] += refillCount;
+        /* Release exclusive access to the cache. */
+        TbxPortCacheSlotExit(slotIdx);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolCacheExtract ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts a free block into the cache of the calling thread or core. If this
+**            makes the cache exceed its configured size, a batch of free blocks is
+**            flushed to the shared linked list with free blocks of the memory pool.
+**            Only this flush needs the memory pool lock.
+** \param     poolPtr Pointer to the memory pool.
+** \param     memPtr Pointer to the memory of the block to insert.
+**
+****************************************************************************************/
+static void TbxMemPoolCacheInsert(tPool * poolPtr,
+                                  void  * memPtr)
+{
+  void    * flushListPtr = NULL;
+  void    * blockPtr;
+  uint8_t   slotIdx;
+
+  /* Verify parameters. */
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (poolPtr != NULL) && (memPtr != NULL) )
+  {
+    /* Obtain exclusive access to the cache of the calling thread or core. */
+    slotIdx = TbxPortCacheSlotEnter();
+    /* Insert the block into the cache. */
+    TbxMemPoolBlockListInsert(&poolPtr->cacheListPtr[slotIdx], memPtr);
+    poolPtr->cacheCount[slotIdx]++;
+    /* Collect a batch of free blocks for flushing, if the cache is now too full. */
+    if (poolPtr->cacheCount[slotIdx] > TBX_CONF_MEMPOOL_CACHE_SIZE)
+    {
+      for (size_t flushIdx = 0U; flushIdx < TBX_MEMPOOL_CACHE_BATCH_SIZE; flushIdx++)
+      {
+        blockPtr = TbxMemPoolBlockListExtract(&poolPtr->cacheListPtr[slotIdx]);
+        TbxMemPoolBlockListInsert(&flushListPtr, blockPtr);
+      }
+      poolPtr->cacheCount[slotIdx] -= TBX_MEMPOOL_CACHE_BATCH_SIZE;
+    }
+    /* Release exclusive access to the cache. */
+    TbxPortCacheSlotExit(slotIdx);
+
+    /* Flush the collected free blocks to the shared memory pool. */
+    if (TbxMemPoolBlockListIsEmpty(&flushListPtr) == TBX_FALSE)
+    {
+      /* Obtain mutual exclusive access to the shared memory pool. */
+      TbxLockEnter(&tbxMemPoolLock);
+      blockPtr = TbxMemPoolBlockListExtract(&flushListPtr);
+      while (blockPtr != NULL)
+      {
+        TbxMemPoolBlockListInsert(&poolPtr->freeBlockListPtr, blockPtr);
+        blockPtr = TbxMemPoolBlockListExtract(&flushListPtr);
+      }
+      /* Release mutual exclusive access to the shared memory pool. */
+      TbxLockExit(&tbxMemPoolLock);
+    }
+  }
+} /*** end of TbxMemPoolCacheInsert ***/
+#endif /* (TBX_CONF_MEMPOOL_CACHE_SIZE > 0U) */
+
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/****************************************************************************************
+*   S T A T I S T I C S   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Atomically adds a value to a statistics counter. This is cheap enough to
+**            leave the statistics enabled in release builds.
+** \param     counterPtr Pointer to the statistics counter.
+** \param     value The value to add.
+** \return    The new value of the statistics counter.
+**
+****************************************************************************************/
+static uint32_t TbxMemPoolStatsAdd(uint32_t volatile * counterPtr,
+                                   uint32_t            value)
+{
+  uint32_t counterOld;
+  uint32_t counterPrev;
+
+  /* Verify parameter. */
+  TBX_ASSERT(counterPtr != NULL);
+
+  /* Atomically read the current value of the counter. */
+  counterPrev = TbxPortAtomicCompareExchange32(counterPtr, 0U, 0U);
+  /* Keep trying until the counter was atomically updated. */
+  do
+  {
+    counterOld = counterPrev;
+    counterPrev = TbxPortAtomicCompareExchange32(counterPtr, counterOld,
+                                                 counterOld + value);
+  }
+  while (counterPrev != counterOld);
+
+  /* Give the result back to the caller. */
+  return counterOld + value;
+} /*** end of TbxMemPoolStatsAdd ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically updates a statistics counter that holds a maximum value, in case
+**            the specified value is larger.
+** \param     maxPtr Pointer to the statistics counter.
+** \param     value The value that is possibly the new maximum.
+**
+****************************************************************************************/
+static void TbxMemPoolStatsUpdateMax(uint32_t volatile * maxPtr,
+                                     uint32_t            value)
+{
+  uint32_t maxOld;
+  uint32_t maxPrev;
+
+  /* Verify parameter. */
+  TBX_ASSERT(maxPtr != NULL);
+
+  /* Atomically read the current maximum value. */
+  maxPrev = TbxPortAtomicCompareExchange32(maxPtr, 0U, 0U);
+  /* Keep trying until the maximum is no longer smaller than the value. */
+  while (maxPrev < value)
+  {
+    maxOld = maxPrev;
+    maxPrev = TbxPortAtomicCompareExchange32(maxPtr, maxOld, value);
+    /* Done if the exchange succeeded. */
+    if (maxPrev == maxOld)
+    {
+      break;
+    }
+  }
+} /*** end of TbxMemPoolStatsUpdateMax ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically reads a statistics counter.
+** \param     counterPtr Pointer to the statistics counter.
+** \return    The value of the statistics counter.
+**
+****************************************************************************************/
+static uint32_t TbxMemPoolStatsRead(uint32_t volatile * counterPtr)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(counterPtr != NULL);
+
+  /* The compare and exchange operation never changes the value, because it only writes
+   * the value it expects.
+   */
+  return TbxPortAtomicCompareExchange32(counterPtr, 0U, 0U);
+} /*** end of TbxMemPoolStatsRead ***/
+
+
+/************************************************************************************//**
+** \brief     Collects the statistics of the specified memory pool.
+** \param     poolPtr Pointer to the memory pool.
+** \param     stats Pointer to where the statistics are written to.
+**
+****************************************************************************************/
+static void TbxMemPoolStatsCollect(tPool            * poolPtr,
+                                   tTbxMemPoolStats * stats)
+{
+  uint32_t usedBlocks;
+
+  /* Verify parameters. */
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(stats != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (poolPtr != NULL) && (stats != NULL) )
+  {
+    /* Read the statistics counters. */
+    stats->blockSize = poolPtr->blockSize;
+    stats->totalBlocks = TbxMemPoolStatsRead(&poolPtr->stats.totalBlocks);
+    stats->highWaterMark = TbxMemPoolStatsRead(&poolPtr->stats.highWaterMark);
+    stats->allocCount = TbxMemPoolStatsRead(&poolPtr->stats.allocCount);
+    stats->allocFailCount = TbxMemPoolStatsRead(&poolPtr->stats.allocFailCount);
+    stats->growCount = TbxMemPoolStatsRead(&poolPtr->stats.growCount);
+    usedBlocks = TbxMemPoolStatsRead(&poolPtr->stats.usedBlocks);
+    /* Determine the number of free blocks. The counters are read one by one, so protect
+     * against an allocation that happened in between.
+     */
+    stats->freeBlocks = 0U;
+    if (stats->totalBlocks > usedBlocks)
+    {
+      stats->freeBlocks = stats->totalBlocks - usedBlocks;
+    }
+  }
+} /*** end of TbxMemPoolStatsCollect ***/
+#endif /* (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U) */
+
+
+/****************************************************************************************
+*   F I X E D - S I Z E   M E M O R Y   P O O L   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Obtains the pointer to the data of a block in the fixed-size memory pool.
+** \param     pool Handle to the fixed-size memory pool.
+** \param     blockIdx One-based index of the block.
+** \return    Pointer to the block's data.
+**
+****************************************************************************************/
+static void * TbxMemPoolFixedGetDataPtr(tTbxMemPoolFixed const * pool,
+                                        uint32_t                 blockIdx)
+{
+  void * result = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT(pool != NULL);
+  TBX_ASSERT( (blockIdx > 0U) && (blockIdx <= pool->numBlocks) );
+
+  /* Only continue if the parameters are valid. */
+  if ( (pool != NULL) && (blockIdx > 0U) && (blockIdx <= pool->numBlocks) )
+  {
+    /* The block's data follows after the pointer to the memory pool and the block size
+     * value.
+     */
+    result = &pool->slabPtr[((size_t)(blockIdx - 1U) * pool->blockMemSize) +
+                            sizeof(void *) + sizeof(size_t)];
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolFixedGetDataPtr ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a block to the lock-free fixed-size memory pool that it belongs to,
+**            by atomically pushing it onto its stack with free blocks.
+** \param     memPtr Pointer to the block's base memory, so where its block size value
+**            is stored.
+**
+****************************************************************************************/
+static void TbxMemPoolFixedReleaseBlock(void * memPtr)
+{
+  tTbxMemPoolFixed  * const * poolRefArray;
+  tTbxMemPoolFixed          * poolPtr;
+  tTbxMemPoolFixed          * listPoolPtr;
+  uint16_t volatile         * nextIdxPtr;
+  uintptr_t                   blockAddr;
+  uintptr_t                   slabAddr;
+  size_t                      blockOffset = 0U;
+  uint32_t                    blockIdx = 0U;
+  uint32_t                    headOld;
+  uint32_t                    headNew;
+  uint32_t                    headPrev;
+  uint8_t                     blockInUse = TBX_FALSE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (memPtr != NULL)
+  {
+    /* The pointer to the memory pool is stored right before the block size value. */
+    poolRefArray = memPtr;
+    poolPtr = poolRefArray[-1];
+    /* Verify that this pointer refers to one of the fixed-size memory pools. This
+     * protects against releasing memory that was never allocated from a memory pool.
+     */
+    listPoolPtr = TbxMemPoolFixedLinkLoad(&tbxMemPoolFixedList);
+    while ( (listPoolPtr != NULL) && (listPoolPtr != poolPtr) )
+    {
+      listPoolPtr = TbxMemPoolFixedLinkLoad(&listPoolPtr->nextPoolPtr);
+    }
+    /* Determine the one-based index of the block in the slab, if the block is located
+     * inside the slab of the memory pool.
+     */
+    if (listPoolPtr != NULL)
+    {
+      blockAddr = (uintptr_t)memPtr - (uintptr_t)sizeof(void *);
+      slabAddr = (uintptr_t)poolPtr->slabPtr;
+      if (blockAddr >= slabAddr)
+      {
+        blockOffset = (size_t)(blockAddr - slabAddr);
+        blockIdx = (uint32_t)(blockOffset / poolPtr->blockMemSize) + 1U;
+      }
+    }
+    /* Sanity check. The block should be located at the start of a block in the slab. */
+    TBX_ASSERT( (blockIdx > 0U) && (blockIdx <= poolPtr->numBlocks) &&
+                ((blockOffset % poolPtr->blockMemSize) == 0U) );
+    /* Only check the block itself, if the sanity check passed. */
+    if ( (blockIdx > 0U) && (blockIdx <= poolPtr->numBlocks) &&
+         ((blockOffset % poolPtr->blockMemSize) == 0U) )
+    {
+      /* Sanity check. The block should still be allocated. */
+      blockInUse = TbxMemPoolBlockMarkFree(memPtr);
+      TBX_ASSERT(blockInUse == TBX_TRUE);
+    }
+    /* Only continue if the sanity checks passed. */
+    if (blockInUse == TBX_TRUE)
+    {
+      /* Get the location in the block's data, where the index of the next free block is
+       * stored.
+       */
+      nextIdxPtr = TbxMemPoolBlockGetDataPtr(memPtr);
+      /* Atomically read the head of the stack with free blocks. */
+      headPrev = TbxPortAtomicCompareExchange32(&poolPtr->freeHead, 0U, 0U);
+      /* Keep trying until the block was atomically pushed onto the stack. */
+      do
+      {
+        headOld = headPrev;
+        /* Link the current first free block to this block. */
+        *nextIdxPtr = (uint16_t)(headOld & TBX_MEMPOOL_FIXED_IDX_MASK);
+        /* This block becomes the new head. Keep the tag as is, because it is already
+         * incremented each time a block is popped.
+         */
+        headNew = (headOld & ~TBX_MEMPOOL_FIXED_IDX_MASK) | blockIdx;
+        headPrev = TbxPortAtomicCompareExchange32(&poolPtr->freeHead, headOld, headNew);
+      }
+      while (headPrev != headOld);
+    }
+  }
+} /*** end of TbxMemPoolFixedReleaseBlock ***/
+
+
+/************************************************************************************//**
+** \brief     Carves the next block, which was never allocated before, from the slab of
+**            a lock-free fixed-size memory pool. This way the blocks do not have to be
+**            initialized when creating the memory pool, which makes it possible to
+**            define the memory pool at compile time.
+** \param     pool Handle to the fixed-size memory pool.
+** \return    Pointer to the start of the block's data if successful, NULL otherwise
+**            when all blocks were already carved from the slab.
+**
+****************************************************************************************/
+static void * TbxMemPoolFixedCarve(tTbxMemPoolFixed * pool)
+{
+  void               * result = NULL;
+  tTbxMemPoolFixed * * poolRefPtr;
+  uint8_t            * blockBasePtr;
+  uint32_t             numOld;
+  uint32_t             numPrev;
+
+  /* Verify parameter. */
+  TBX_ASSERT(pool != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (pool != NULL)
+  {
+    /* Sanity check. The number of blocks of a memory pool that was defined at compile
+     * time, was not yet verified.
+     */
+    TBX_ASSERT(pool->numBlocks <= TBX_MEMPOOL_FIXED_MAX_BLOCKS);
+    /* A memory pool that was defined at compile time, is added to the linked list with
+     * fixed-size memory pools before its first block is handed out. Otherwise
+     * releasing the block would fail.
+     */
+    if (TbxMemPoolFixedIsListed(pool) == TBX_FALSE)
+    {
+      TbxMemPoolFixedListInsert(pool);
+    }
+    /* Atomically read the number of blocks that were already carved from the slab. */
+    numPrev = TbxPortAtomicCompareExchange32(&pool->numCarved, 0U, 0U);
+    /* Keep trying until the next block was atomically claimed. */
+    do
+    {
+      numOld = numPrev;
+      /* Stop if all blocks were already carved from the slab. */
+      if ( (numOld >= pool->numBlocks) || (numOld >= TBX_MEMPOOL_FIXED_MAX_BLOCKS) )
+      {
+        break;
+      }
+      numPrev = TbxPortAtomicCompareExchange32(&pool->numCarved, numOld, numOld + 1U);
+    }
+    while (numPrev != numOld);
+    /* Was a block claimed? */
+    if ( (numOld < pool->numBlocks) && (numOld < TBX_MEMPOOL_FIXED_MAX_BLOCKS) )
+    {
+      /* Each block starts with a pointer to its memory pool, followed by the regular
+       * block layout. This makes it possible to release the block with
+       * TbxMemPoolRelease().
+       */
+      blockBasePtr = &pool->slabPtr[(size_t)numOld * pool->blockMemSize];
+      poolRefPtr = (void *)blockBasePtr;
+      *poolRefPtr = pool;
+      (void)TbxMemPoolBlockCreate(&blockBasePtr[sizeof(void *)],
+                                  pool->blockSize | TBX_MEMPOOL_FIXED_FLAG);
+      result = TbxMemPoolFixedGetDataPtr(pool, numOld + 1U);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolFixedCarve ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a lock-free fixed-size memory pool to the start of the linked list
+**            with fixed-size memory pools, unless it was already added before. The
+**            linked list is accessed without locking when releasing a block. So the
+**            memory pool should be fully initialized before it is added. This function
+**            is lock-free as well, because it is called upon the first allocation from
+**            a memory pool that was defined at compile time. Several callers can add
+**            the same memory pool at the same time. They then help each other, instead
+**            of waiting on each other. This relies on the linked list only growing, so
+**            its head never returns to an older value.
+** \param     pool Handle to the fixed-size memory pool.
+**
+****************************************************************************************/
+static void TbxMemPoolFixedListInsert(tTbxMemPoolFixed * pool)
+{
+  tTbxMemPoolFixed * listPoolPtr;
+  void             * headPtr;
+  void             * nextPtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(pool != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (pool != NULL)
+  {
+    /* Keep trying until the memory pool is part of the linked list. */
+    while (TbxMemPoolFixedIsListed(pool) == TBX_FALSE)
+    {
+      /* Read the link of the memory pool before the head of the linked list. If they
+       * differ, the head is therefore newer than the link.
+       */
+      nextPtr = TbxMemPoolFixedLinkLoad(&pool->nextPoolPtr);
+      headPtr = TbxMemPoolFixedLinkLoad(&tbxMemPoolFixedList);
+      /* Check if the memory pool was already added, possibly by another caller. */
+      listPoolPtr = headPtr;
+      while ( (listPoolPtr != NULL) && (listPoolPtr != pool) )
+      {
+        listPoolPtr = TbxMemPoolFixedLinkLoad(&listPoolPtr->nextPoolPtr);
+      }
+      if (listPoolPtr == pool)
+      {
+        /* Flag it as listed, only now that it is known to be part of the list. */
+        TbxPortMemoryBarrier();
+        (void)TbxPortAtomicCompareExchange32(&pool->listed, TBX_FALSE, TBX_TRUE);
+      }
+      /* Is the memory pool linked to the current head of the linked list? */
+      else if (nextPtr == headPtr)
+      {
+        /* Make sure the memory pool is fully initialized before it is published. */
+        TbxPortMemoryBarrier();
+        /* Attempt to make the memory pool the new head of the linked list. */
+        if (TbxPortAtomicCompareExchangePtr(&tbxMemPoolFixedList, headPtr,
+                                            pool) == headPtr)
         {
-          /* There are no memory pools present in the list that have a block size larger
-           * than the new node. This means that the new node should be inserted at the
-           * tail of the list.
-           */
-          nodePtr->nextNodePtr = NULL;
-          currentNodePtr->nextNodePtr = nodePtr;
-          /* Set flag to indicate that the new node was successfully inserted. */
-          nodeInserted = TBX_TRUE;
+          /* Flag it as listed, only after it was successfully published. */
+          TbxPortMemoryBarrier();
+          (void)TbxPortAtomicCompareExchange32(&pool->listed, TBX_FALSE, TBX_TRUE);
         }
-        /* Check if the new node was already inserted. */
-        if (nodeInserted == TBX_TRUE)
+      }
+      else
+      {
+        /* Link the memory pool to the current head of the linked list. Since the head
+         * never returns to the value of the old link, no other caller can still add
+         * the memory pool with the old link.
+         */
+        (void)TbxPortAtomicCompareExchangePtr(&pool->nextPoolPtr, nextPtr, headPtr);
+      }
+    }
+  }
+} /*** end of TbxMemPoolFixedListInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically reads a link of the linked list with fixed-size memory pools, so
+**            either its head or the link to the next memory pool. Other callers can
+**            change these links at the same time with an atomic compare and exchange.
+**            Reading them with the same operation, which never changes the value, keeps
+**            the read ordered with respect to those changes.
+** \param     linkPtr Pointer to the link to read.
+** \return    Pointer to the fixed-size memory pool that the link points to.
+**
+****************************************************************************************/
+static void * TbxMemPoolFixedLinkLoad(void * volatile * linkPtr)
+{
+  /* Read the link with a compare and exchange that writes back the same value. */
+  return TbxPortAtomicCompareExchangePtr(linkPtr, NULL, NULL);
+} /*** end of TbxMemPoolFixedLinkLoad ***/
+
+
+/************************************************************************************//**
+** \brief     Atomically reads whether a fixed-size memory pool was already added to the
+**            linked list with fixed-size memory pools.
+** \param     pool Handle to the fixed-size memory pool.
+** \return    TBX_TRUE if the memory pool is part of the linked list, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t TbxMemPoolFixedIsListed(tTbxMemPoolFixed * pool)
+{
+  uint8_t result = TBX_FALSE;
+
+  /* Read the flag with a compare and exchange that writes back the same value. */
+  if (TbxPortAtomicCompareExchange32(&pool->listed, 0U, 0U) != TBX_FALSE)
+  {
+    result = TBX_TRUE;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolFixedIsListed ***/
+
+
+/****************************************************************************************
+*   S L A B   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
+/************************************************************************************//**
+** \brief     Allocates one contiguous slab on the heap that is large enough to hold the
+**            specified number of blocks of the memory pool. Next, it carves the blocks
+**            from the slab and adds them to the linked list with free blocks of the
+**            memory pool. Compared to allocating each block separately, this keeps the
+**            blocks of a memory pool close together in memory.
+** \param     poolPtr Pointer to the memory pool to add the blocks to.
+** \param     region Handle to the heap region to allocate the slab in. NULL to allocate
+**            it on the default heap.
+** \param     numBlocks The number of blocks to add to the memory pool.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when there is no
+**            more space available on the heap for the slab.
+**
+****************************************************************************************/
+static uint8_t TbxMemPoolSlabCreate(tPool          * poolPtr,
+                                    tTbxHeapRegion * region,
+                                    size_t           numBlocks)
+{
+  uint8_t   result = TBX_ERROR;
+  uint8_t * slabPtr;
+  size_t    blockMemSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT(poolPtr != NULL);
+  TBX_ASSERT(numBlocks > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (poolPtr != NULL) && (numBlocks > 0U) )
+  {
+    /* Determine how many bytes of the slab each block occupies. */
+    blockMemSize = TbxMemPoolBlockGetMemSize(poolPtr->blockSize);
+    /* Only continue if the total slab size can be represented. */
+    if (numBlocks <= (SIZE_MAX / blockMemSize))
+    {
+      /* Allocate memory for the slab that holds all the blocks, either on the default
+       * heap or in the specified heap region.
+       */
+      if (region == NULL)
+      {
+        slabPtr = TbxHeapAllocate(numBlocks * blockMemSize);
+      }
+      else
+      {
+        slabPtr = TbxHeapRegionAllocate(region, numBlocks * blockMemSize,
+                                        sizeof(void *));
+      }
+      /* Only continue if the memory allocation was successful. */
+      if (slabPtr != NULL)
+      {
+        /* Carve the blocks from the slab one by one and insert them into the linked
+         * list with free blocks.
+         */
+        for (size_t blockIdx = 0U; blockIdx < numBlocks; blockIdx++)
         {
-          /* All done so no need to continue looping. */
-          break;
+          void * blockPtr = TbxMemPoolBlockCreate(&slabPtr[blockIdx * blockMemSize],
+                                                  poolPtr->blockSize);
+          (void)TbxMemPoolBlockMarkFree(blockPtr);
+          TbxMemPoolBlockListInsert(&poolPtr->freeBlockListPtr, blockPtr);
         }
-        /* Update loop variables. */
-        prevNodePtr = currentNodePtr;
-        currentNodePtr = currentNodePtr->nextNodePtr;
+        /* Update the result for success. */
+        result = TBX_OK;
       }
     }
   }
-} /*** end of TbxMemPoolListInsert ***/
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxMemPoolSlabCreate ***/
 
 
 /****************************************************************************************
@@ -651,42 +2264,40 @@ static void TbxMemPoolListInsert(tPoolNode * nodePtr)
 ****************************************************************************************/
 
 /************************************************************************************//**
-** \brief     Creates and initializes a new block including its memory allocation on the
-**            heap. A block consists of the actual memory to hold the block data and is
-**            preceded by an element of size_t, where the size of the block is written
-**            to:
+** \brief     Initializes a new block at the specified memory. A block consists of the
+**            actual memory to hold the block data and is preceded by an element of
+**            size_t, where the size of the block is written to:
 **            memPtr  -> -----------
 **                      | blockSize |
 **            dataPtr ->|------------------------------------------------
 **                      | data byte 0 | data byte 1 | data byte 2 | etc. |
 **                       ------------------------------------------------
+**            While the block is free, the start of its data holds the pointer to the
+**            next free block.
+** \param     memPtr Pointer to the memory of the block. It must be at least
+**            TbxMemPoolBlockGetMemSize() bytes large.
 ** \param     size The data size of the block in bytes.
 ** \return    Pointer to the memory of the created block if successful, NULL otherwise.
 **
 ****************************************************************************************/
-static void * TbxMemPoolBlockCreate(size_t size)
+static void * TbxMemPoolBlockCreate(void   * memPtr,
+                                    size_t   size)
 {
   void   * result = NULL;
-  void   * blockMemPtr;
 
-  /* Verify parameter. */
+  /* Verify parameters. */
+  TBX_ASSERT(memPtr != NULL);
   TBX_ASSERT(size > 0U);
 
-  /* Only continue if the parameter is valid. */
-  if (size > 0U)
+  /* Only continue if the parameters are valid. */
+  if ( (memPtr != NULL) && (size > 0U) )
   {
-    /* Allocate memory for the block data and an extra size_t value at the start. */
-    blockMemPtr = TbxHeapAllocate(sizeof(size_t) + size);
-    /* Only continue if the memory allocation was successful. */
-    if (blockMemPtr != NULL)
-    {
-      /* Set the result value. */
-      result = blockMemPtr;
-      /* Create a pointer to an array of size_t elements. */
-      size_t * blockSizeArray = blockMemPtr;
-      /* Write to the first element, which should hold the block size. */
-      blockSizeArray[0U] = size;
-    }
+    /* Set the result value. */
+    result = memPtr;
+    /* Create a pointer to an array of size_t elements. */
+    size_t * blockSizeArray = memPtr;
+    /* Write to the first element, which should hold the block size. */
+    blockSizeArray[0U] = size;
   }
 
   /* Give the result back to the caller. */
@@ -694,6 +2305,33 @@ static void * TbxMemPoolBlockCreate(size_t size)
 } /*** end of TbxMemPoolBlockCreate ***/
 
 
+/************************************************************************************//**
+** \brief     Determines the number of bytes that a block occupies in memory, including
+**            the size_t element that precedes the block's data. The data part is at
+**            least large enough to hold the pointer to the next free block and is
+**            aligned to the address size, such that consecutive blocks in a slab are
+**            all properly aligned.
+** \param     size The data size of the block in bytes.
+** \return    Number of bytes that the block occupies in memory.
+**
+****************************************************************************************/
+static size_t TbxMemPoolBlockGetMemSize(size_t size)
+{
+  size_t dataSize = size;
+
+  /* A free block stores the pointer to the next free block in its data. */
+  if (dataSize < sizeof(void *))
+  {
+    dataSize = sizeof(void *);
+  }
+  /* Align the data size to the address size to make it work on all targets. */
+  dataSize = (dataSize + (sizeof(void *) - 1U)) & ~(sizeof(void *) - 1U);
+
+  /* Give the result back to the caller. */
+  return sizeof(size_t) + dataSize;
+} /*** end of TbxMemPoolBlockGetMemSize ***/
+
+
 /************************************************************************************//**
 ** \brief     Converts the block memory pointer, which points to the start of the block's
 **            allocated memory, to the pointer where the actual block data starts.
@@ -747,7 +2385,7 @@ static size_t TbxMemPoolBlockGetBlockSize(void const * memPtr)
     /* Create a pointer to an array of size_t elements. */
     blockSizeArray = memPtr;
     /* The block size value is located at the start of the block, */
-    size_t blockSize = blockSizeArray[0U];
+    size_t blockSize = blockSizeArray[0U] & ~TBX_MEMPOOL_FREE_FLAG;
     /* Set the result value. */
     result = blockSize;
   }
@@ -791,81 +2429,128 @@ static void * TbxMemPoolBlockGetMemPtr(void * dataPtr)
 } /*** end of TbxMemPoolBlockGetMemPtr ***/
 
 
-/****************************************************************************************
-*   B L O C K   L I S T   M A N A G E M E N T   F U N C T I O N S
-****************************************************************************************/
-
 /************************************************************************************//**
-** \brief     Creates a new and empty linked list that can be used for building a list
-**            with block nodes. Memory needed for the linked list object itself is
-**            allocated on the heap.
-** \return    Pointer to the newly created blocks list if successful, NULL otherwise.
+** \brief     Marks the block as free, right before it is released to its memory pool.
+**            With the run-time assertions enabled, a flag in the block size value of the
+**            block is set for this. This makes it possible to detect the release of a
+**            block that is not allocated, for example when it is released twice, which
+**            would corrupt the linked list with free blocks. Without the run-time
+**            assertions, this check is skipped.
+** \param     memPtr Pointer to the start of the block's allocated memory.
+** \return    TBX_TRUE if the block was allocated, TBX_FALSE if it was already free.
 **
 ****************************************************************************************/
-static tBlockList * TbxMemPoolBlockListCreate(void)
+static uint8_t TbxMemPoolBlockMarkFree(void * memPtr)
 {
-  tBlockList * result;
+  uint8_t  result = TBX_TRUE;
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+  size_t * blockSizeArray;
+#endif
 
-  /* Attempt to create the linked list object on the heap. */
-  result = TbxHeapAllocate(sizeof(tBlockList));
-  /* Only continue with the linked list initialization when the allocation was
-   * successful.
-   */
-  if (result != NULL)
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+  /* Only continue if the parameter is valid. */
+  if (memPtr != NULL)
   {
-    /* Initialize the linked list to be empty. */
-    *result = NULL;
+    /* Create a pointer to an array of size_t elements. */
+    blockSizeArray = memPtr;
+    /* Is the block already free? */
+    if ((blockSizeArray[0U] & TBX_MEMPOOL_FREE_FLAG) != 0U)
+    {
+      /* Update the result value. */
+      result = TBX_FALSE;
+    }
+    else
+    {
+      /* Set the flag in the block size value to mark the block as free. */
+      blockSizeArray[0U] |= TBX_MEMPOOL_FREE_FLAG;
+    }
   }
+#else
+  TBX_UNUSED_ARG(memPtr);
+#endif
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of TbxMemPoolBlockListCreate ***/
+} /*** end of TbxMemPoolBlockMarkFree ***/
+
+
+/************************************************************************************//**
+** \brief     Marks the block as allocated, right after it was extracted from its memory
+**            pool. Counterpart of TbxMemPoolBlockMarkFree().
+** \param     memPtr Pointer to the start of the block's allocated memory.
+**
+****************************************************************************************/
+static void TbxMemPoolBlockMarkUsed(void * memPtr)
+{
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+  size_t * blockSizeArray;
+#endif
+
+  /* Verify parameter. */
+  TBX_ASSERT(memPtr != NULL);
+
+#if (TBX_CONF_ASSERTIONS_ENABLE > 0U)
+  /* Only continue if the parameter is valid. */
+  if (memPtr != NULL)
+  {
+    /* Create a pointer to an array of size_t elements. */
+    blockSizeArray = memPtr;
+    /* Clear the flag in the block size value to mark the block as allocated. */
+    blockSizeArray[0U] &= ~TBX_MEMPOOL_FREE_FLAG;
+  }
+#else
+  TBX_UNUSED_ARG(memPtr);
+#endif
+} /*** end of TbxMemPoolBlockMarkUsed ***/
 
 
+/****************************************************************************************
+*   B L O C K   L I S T   M A N A G E M E N T   F U N C T I O N S
+****************************************************************************************/
+
 /************************************************************************************//**
-** \brief     Inserts the specified block node into the linked list with block nodes.
-** \param     listPtr Pointer to the linked list with blocks.
-** \param     nodePtr Pointer to the block node to insert.
+** \brief     Inserts the specified block at the start of a linked list with free blocks.
+**            The pointer to the next free block is stored in the block's data.
+** \param     listPtr Pointer to the head of the linked list with free blocks.
+** \param     memPtr Pointer to the memory of the block to insert.
 **
 ****************************************************************************************/
-static void TbxMemPoolBlockListInsert(tBlockList * listPtr, 
-                                      tBlockNode * nodePtr)
+static void TbxMemPoolBlockListInsert(void * * listPtr, 
+                                      void   * memPtr)
 {
+  void * * nextBlockPtr;
+
   /* Verify parameters. */
   TBX_ASSERT(listPtr != NULL);
-  TBX_ASSERT(nodePtr != NULL);
+  TBX_ASSERT(memPtr != NULL);
 
   /* Only continue if the parameters are valid. */
-  if ( (listPtr != NULL) && (nodePtr != NULL) )
+  if ( (listPtr != NULL) && (memPtr != NULL) )
   {
-    /* Is the list currently empty? */
-    if (*listPtr == NULL)
-    {
-      /* There is no next node. */
-      nodePtr->nextNodePtr = NULL;
-    }
-    /* Linked list is not empty. */
-    else
-    {
-      /* The new node will be the current head of the list. */
-      nodePtr->nextNodePtr = *listPtr;
-    }
-    /* Insert the new node at the start of the list. */
-    *listPtr = nodePtr;
+    /* The block's data holds the pointer to the next free block. */
+    nextBlockPtr = TbxMemPoolBlockGetDataPtr(memPtr);
+    /* The current head of the list becomes the next block of the new one. */
+    *nextBlockPtr = *listPtr;
+    /* Insert the new block at the start of the list. */
+    *listPtr = memPtr;
   }
 } /*** end of TbxMemPoolBlockListInsert ***/
 
 
 /************************************************************************************//**
-** \brief     Extracts a block node from the linked list with block nodes.
-** \param     listPtr Pointer to the linked list with blocks.
-** \return    Pointer to the block node that was extracted or NULL if the linked list
-**            contained no more nodes.
+** \brief     Extracts the block at the start of a linked list with free blocks.
+** \param     listPtr Pointer to the head of the linked list with free blocks.
+** \return    Pointer to the memory of the block that was extracted or NULL if the
+**            linked list contained no more blocks.
 **
 ****************************************************************************************/
-static tBlockNode * TbxMemPoolBlockListExtract(tBlockList * listPtr)
+static void * TbxMemPoolBlockListExtract(void * * listPtr)
 {
-  tBlockNode * result = NULL;
+  void   * result = NULL;
+  void * * nextBlockPtr;
 
   /* Verify parameter. */
   TBX_ASSERT(listPtr != NULL);
@@ -873,23 +2558,15 @@ static tBlockNode * TbxMemPoolBlockListExtract(tBlockList * listPtr)
   /* Only continue if the parameter is valid. */
   if (listPtr != NULL)
   {
-    /* Only extract a node if the list currently not empty. */
+    /* Only extract a block if the list is currently not empty. */
     if (*listPtr != NULL)
     {
-      /* Get the first node. */
+      /* Get the first block. */
       result = *listPtr;
-      /* Is there currently only one node in the list? */
-      if ((*listPtr)->nextNodePtr == NULL)
-      {
-        /* Set the list to be empty. */
-        *listPtr = NULL;
-      }
-      /* There are currently at least two nodes in the list. */
-      else
-      {
-        /* Make the second node the first one. */
-        *listPtr = result->nextNodePtr;
-      }
+      /* The block's data holds the pointer to the next free block. */
+      nextBlockPtr = TbxMemPoolBlockGetDataPtr(result);
+      /* Make the next block the first one. */
+      *listPtr = *nextBlockPtr;
     }
   }
 
@@ -899,13 +2576,13 @@ static tBlockNode * TbxMemPoolBlockListExtract(tBlockList * listPtr)
 
 
 /************************************************************************************//**
-** \brief     Checks if the linked list with block nodes is empty. So when it does not
-**            contain any nodes.
-** \param     listPtr Pointer to the linked list with blocks.
+** \brief     Checks if a linked list with free blocks is empty. So when it does not
+**            contain any blocks.
+** \param     listPtr Pointer to the head of the linked list with free blocks.
 ** \return    TBX_TRUE if the block list is empty, TBX_FALSE otherwise.
 **
 ****************************************************************************************/
-static uint8_t TbxMemPoolBlockListIsEmpty(tBlockList const * listPtr)
+static uint8_t TbxMemPoolBlockListIsEmpty(void * const * listPtr)
 {
   uint8_t result = TBX_FALSE;
 
@@ -39,16 +39,179 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_MEMPOOL_STATS_ENABLE
+/** \brief Enable/disable the statistics of the memory pools. When enabled, each memory
+ *         pool keeps counters that can be read with TbxMemPoolGetStats(), for example to
+ *         determine how many blocks a memory pool really needs. Note that it is possible
+ *         to override this value by adding this macro definition to the configuration
+ *         header file.
+ */
+#define TBX_CONF_MEMPOOL_STATS_ENABLE            (0U)
+#endif
+
+#ifndef TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS
+/** \brief Number of size classes between two successive powers of two, as used by
+ *         TbxMemPoolGetSizeClass(). With the default of 4, sizes are rounded up in
+ *         quarter steps, such as 32, 40, 48, 56, 64, 80 and so on. This wastes at most
+ *         25% of a block. Must be zero or a power of two. A value of zero disables the
+ *         rounding. Note that it is possible to override this value by adding this macro
+ *         definition to the configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS        (4U)
+#endif
+
+#ifndef TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE
+/** \brief Enable/disable the rounding of block sizes to size classes inside the memory
+ *         pool functions. When enabled, TbxMemPoolCreate() creates or extends the memory
+ *         pool of the size class that the block size belongs to. Likewise,
+ *         TbxMemPoolAllocate() allocates from the memory pool of the size class that the
+ *         requested size belongs to. Note that it is possible to override this value by
+ *         adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE       (0U)
+#endif
+
+#if ((TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS & (TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS - 1U)) != 0U)
+#error "TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS must be zero or a power of two."
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of bytes that a block of a lock-free fixed-size memory pool occupies in
+ *         its slab. This is the pointer to its memory pool, followed by the block size
+ *         value and the data, which is aligned to the address size.
+ */
+#define TBX_MEMPOOL_FIXED_BLOCK_MEM_SIZE(blockSize) \
+          (sizeof(void *) + sizeof(size_t) + \
+           ((((size_t)(blockSize) + sizeof(void *)) - 1U) / sizeof(void *)) * \
+           sizeof(void *))
+
+/** \brief Defines a lock-free fixed-size memory pool at compile time. Its blocks are
+ *         reserved in a statically allocated slab, so they end up in the .bss section
+ *         and show up in the linker map file. The memory pool needs no run-time
+ *         construction. Its blocks are carved from the slab one by one, upon allocation
+ *         and only when no released block is available. Use this macro at file scope.
+ *         Allocate a block with TbxMemPoolFixedAllocate(&name) and release it with the
+ *         regular TbxMemPoolRelease(). The number of blocks can be 65535 at most.
+ *         Example: TBX_MEMPOOL_DEFINE(rxPool, 64U, 32U);
+ */
+#define TBX_MEMPOOL_DEFINE(name, blockSize, numBlocks) \
+          static void * name##Slab[(numBlocks) * \
+                                   (TBX_MEMPOOL_FIXED_BLOCK_MEM_SIZE(blockSize) / \
+                                    sizeof(void *))]; \
+          tTbxMemPoolFixed name = \
+          { \
+            (uint8_t *)name##Slab, TBX_MEMPOOL_FIXED_BLOCK_MEM_SIZE(blockSize), \
+            (blockSize), (numBlocks), 0U, 0U, NULL, TBX_FALSE \
+          }
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a lock-free fixed-size memory pool. Its pointer serves as the handle
+ *         to the memory pool, which is obtained after creation of the memory pool and
+ *         which is needed in TbxMemPoolFixedAllocate(). Note that its elements should be
+ *         considered private and only be accessed internally by this memory pool module.
+ */
+typedef struct t_tbx_mem_pool_fixed
+{
+  /** \brief Pointer to the slab that holds all the blocks of the memory pool. */
+  uint8_t                     * slabPtr;
+  /** \brief Number of bytes that each block occupies in the slab. */
+  size_t                        blockMemSize;
+  /** \brief The number of bytes that fit in one block. */
+  size_t                        blockSize;
+  /** \brief Number of blocks in the memory pool. */
+  uint32_t                      numBlocks;
+  /** \brief Head of the lock-free stack with free blocks. The lower 16 bits hold the
+   *         one-based index of the first free block, or zero if there are no free
+   *         blocks. The upper 16 bits hold a tag that protects against the ABA problem.
+   */
+  volatile uint32_t             freeHead;
+  /** \brief Number of blocks that were already carved from the slab. The remaining
+   *         blocks are carved on demand, when the stack with free blocks is empty.
+   */
+  volatile uint32_t             numCarved;
+  /** \brief Pointer to the next fixed-size memory pool that was created. It is a void
+   *         pointer, such that it can be changed with an atomic compare and exchange.
+   */
+  void                * volatile nextPoolPtr;
+  /** \brief TBX_TRUE once the memory pool was added to the internal linked list with
+   *         fixed-size memory pools, TBX_FALSE otherwise. It is 32-bit, such that it can
+   *         be accessed with an atomic compare and exchange.
+   */
+  volatile uint32_t             listed;
+} tTbxMemPoolFixed;
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/** \brief Layout of the statistics of a memory pool. */
+typedef struct
+{
+  /** \brief The number of bytes that fit in one block. Identifies the memory pool. */
+  size_t   blockSize;
+  /** \brief Total number of blocks in the memory pool. */
+  uint32_t totalBlocks;
+  /** \brief Number of blocks that are currently not allocated. */
+  uint32_t freeBlocks;
+  /** \brief Highest number of blocks that were allocated at the same time. */
+  uint32_t highWaterMark;
+  /** \brief Number of successful allocations from the memory pool. */
+  uint32_t allocCount;
+  /** \brief Number of allocations that failed because the memory pool had no more
+   *         free blocks.
+   */
+  uint32_t allocFailCount;
+  /** \brief Number of times that the memory pool was extended after its creation, for
+   *         example on demand by pvPortMalloc() or operator new.
+   */
+  uint32_t growCount;
+} tTbxMemPoolStats;
+#endif
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
 uint8_t   TbxMemPoolCreate  (size_t   numBlocks,
                              size_t   blockSize);
 
+uint8_t   TbxMemPoolCreateInRegion(size_t           numBlocks,
+                                   size_t           blockSize,
+                                   tTbxHeapRegion * region);
+
 void    * TbxMemPoolAllocate(size_t   size);
 
 void      TbxMemPoolRelease (void   * memPtr);
 
+uint8_t   TbxMemPoolAllocateBatch(size_t   size,
+                                  size_t   count,
+                                  void   * ptrArray[]);
+
+void      TbxMemPoolReleaseBatch (void   * ptrArray[],
+                                  size_t   count);
+
+size_t    TbxMemPoolGetSizeClass (size_t   size);
+
+tTbxMemPoolFixed * TbxMemPoolFixedCreate  (size_t             numBlocks,
+                                           size_t             blockSize);
+
+void             * TbxMemPoolFixedAllocate(tTbxMemPoolFixed * pool);
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+uint8_t   TbxMemPoolGetStats     (size_t             blockSize,
+                                  tTbxMemPoolStats * stats);
+
+uint8_t   TbxMemPoolGetFirstStats(tTbxMemPoolStats * stats);
+
+uint8_t   TbxMemPoolGetNextStats (tTbxMemPoolStats * stats);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -45,6 +45,77 @@ extern "C" {
 #include "tbx_types.h"                      /* MicroTBX port specific types            */
 
 
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_LOCK_ENABLE
+/** \brief Enable/disable the native lock objects of the port. When enabled, each
+ *         MicroTBX resource, such as the heap, the memory pools and each linked list,
+ *         obtains mutual exclusive access with its own lock object. When disabled, all
+ *         lock objects fall back to the one global critical section. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_LOCK_ENABLE                     (0U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+#ifndef TBX_PORT_CRC_ACCEL
+/** \brief Indicates if the port offers hardware accelerated CRC calculations, with
+ *         functions TbxPortCrc16Process() and TbxPortCrc32Process(). Ports that do so
+ *         set this value to 1 in their tbx_types.h. An application that has a CRC unit
+ *         on its microcontroller, can also set this value to 1 in the configuration
+ *         header file, and implement these two functions itself.
+ */
+#define TBX_PORT_CRC_ACCEL                       (0U)
+#endif
+
+#ifndef TBX_PORT_AES_ACCEL
+/** \brief Indicates if the port offers hardware accelerated AES256 encryption and
+ *         decryption, with functions TbxPortAes256Init(), TbxPortAes256EncryptBlocks(),
+ *         TbxPortAes256DecryptBlocks() and TbxPortAes256Done(). Ports that do so set this
+ *         value to 1 in their tbx_types.h, together with the definition of type
+ *         tTbxPortAesCtx. An application that has an AES unit on its microcontroller,
+ *         can also set this value to 1 in the configuration header file, define type
+ *         tTbxPortAesCtx there and implement these four functions itself.
+ */
+#define TBX_PORT_AES_ACCEL                       (0U)
+#endif
+
+#ifndef TBX_PORT_ENTROPY
+/** \brief Indicates if the port offers a hardware entropy source, such as a true random
+ *         number generator, with function TbxPortEntropyGet(). Ports that do so set this
+ *         value to 1 in their tbx_types.h. An application that has a random number
+ *         generator peripheral on its microcontroller, can also set this value to 1 in
+ *         the configuration header file, and implement this function itself.
+ */
+#define TBX_PORT_ENTROPY                         (0U)
+#endif
+
+#ifndef TBX_PORT_CYCLE_COUNTER
+/** \brief Indicates if the port offers a free running 32-bit cycle counter, with function
+ *         TbxPortCycleCounterGet(). Ports that do so set this value to 1 in their
+ *         tbx_types.h. An application that has a suitable timer on its microcontroller,
+ *         can also set this value to 1 in the configuration header file, and implement
+ *         this function itself.
+ */
+#define TBX_PORT_CYCLE_COUNTER                   (0U)
+#endif
+
+#ifndef TBX_PORT_CORE_FIFO
+/** \brief Indicates if the port offers a hardware FIFO between the cores of a multicore
+ *         microcontroller, with functions TbxPortCoreFifoPush() and TbxPortCoreFifoPop().
+ *         Writing to the FIFO of one core makes the value available to the other core.
+ *         Ports that do so set this value to 1 in their tbx_types.h. Such a port must
+ *         also define TBX_PORT_CACHE_NUM_SLOTS, with one cache slot per core.
+ */
+#define TBX_PORT_CORE_FIFO                       (0U)
+#endif
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
@@ -52,6 +123,74 @@ tTbxPortCpuSR TbxPortInterruptsDisable(void);
 
 void          TbxPortInterruptsRestore(tTbxPortCpuSR prevCpuSr);
 
+uint32_t      TbxPortAtomicCompareExchange32(uint32_t volatile * target,
+                                             uint32_t            expected,
+                                             uint32_t            desired);
+
+void        * TbxPortAtomicCompareExchangePtr(void * volatile * target,
+                                              void           * expected,
+                                              void           * desired);
+
+void          TbxPortMemoryBarrier(void);
+
+#if (TBX_CONF_LOCK_ENABLE > 0U)
+void          TbxPortLockInit         (tTbxPortLock * lock);
+
+void          TbxPortLockEnter        (tTbxPortLock * lock);
+
+void          TbxPortLockExit         (tTbxPortLock * lock);
+#endif
+
+#ifdef TBX_PORT_CACHE_NUM_SLOTS
+uint8_t       TbxPortCacheSlotEnter(void);
+
+void          TbxPortCacheSlotExit(uint8_t slotIdx);
+#endif
+
+#if (TBX_PORT_CRC_ACCEL > 0U)
+size_t        TbxPortCrc16Process(uint16_t      * crc,
+                                  uint16_t        polynom,
+                                  uint8_t         reflect,
+                                  uint8_t const * data,
+                                  size_t          len);
+
+size_t        TbxPortCrc32Process(uint32_t      * crc,
+                                  uint32_t        polynom,
+                                  uint8_t         reflect,
+                                  uint8_t const * data,
+                                  size_t          len);
+#endif
+
+#if (TBX_PORT_AES_ACCEL > 0U)
+uint8_t       TbxPortAes256Init         (tTbxPortAesCtx       * ctx,
+                                         uint8_t        const * key);
+
+void          TbxPortAes256EncryptBlocks(tTbxPortAesCtx const * ctx,
+                                         uint8_t              * data,
+                                         size_t                 numBlocks);
+
+void          TbxPortAes256DecryptBlocks(tTbxPortAesCtx const * ctx,
+                                         uint8_t              * data,
+                                         size_t                 numBlocks);
+
+void          TbxPortAes256Done         (tTbxPortAesCtx       * ctx);
+#endif
+
+#if (TBX_PORT_ENTROPY > 0U)
+size_t        TbxPortEntropyGet(uint8_t * buf,
+                                size_t    len);
+#endif
+
+#if (TBX_PORT_CYCLE_COUNTER > 0U)
+uint32_t      TbxPortCycleCounterGet(void);
+#endif
+
+#if (TBX_PORT_CORE_FIFO > 0U)
+uint8_t       TbxPortCoreFifoPush(uintptr_t   value);
+
+uint8_t       TbxPortCoreFifoPop (uintptr_t * value);
+#endif
+
 
 #ifdef __cplusplus
 }
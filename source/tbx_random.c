@@ -56,16 +56,38 @@
  */
 #define TBX_RANDOM_LFSR31_POLYMASK     (0x7A5BC2E3UL)
 
+/** \brief Maximum number of random bytes that TbxRandomFill() generates, while holding
+ *         the lock of the shared generator. This limits how long other callers wait.
+ */
+#define TBX_RANDOM_FILL_CHUNK_SIZE     (64U)
+
+/** \brief Maximum number of bytes that TbxRandomEntropyCollect() obtains from the
+ *         hardware at once, without holding the lock of the entropy pool.
+ */
+#define TBX_RANDOM_ENTROPY_CHUNK_SIZE  (16U)
+
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-static void     TbxRandomInitLFSRs     (void);
+static void     TbxRandomSeed          (void);
+
+static uint32_t TbxRandomNumberGenerate(void);
 
+#if (TBX_CONF_RANDOM_METHOD == TBX_RANDOM_LFSR)
 static uint32_t TbxRandomShiftLFSR     (uint32_t * lfsr,
                                         uint32_t   polymask);
 
 static uint16_t TbxRandomNumber16BitGet(void);
+#endif
+
+static void     TbxRandomXoshiroSeed   (uint32_t * state,
+                                        uint32_t   seedA,
+                                        uint32_t   seedB);
+
+static uint32_t TbxRandomXoshiroNext   (uint32_t * state);
+
+static uint32_t TbxRandomSplitMix32    (uint32_t * value);
 
 
 /****************************************************************************************
@@ -74,11 +96,37 @@ static uint16_t TbxRandomNumber16BitGet(void);
 /** \brief Pointer to the application provided seed initialization handler function. */
 static tTbxRandomSeedInitHandler tbxRandomSeedInitHandler = NULL;
 
+#if (TBX_CONF_RANDOM_METHOD == TBX_RANDOM_LFSR)
 /** \brief Storage for the 32-bit LFSR value. */
 static uint32_t                  tbxRandomNumberLFSR32;
 
 /** \brief Storage for the 31-bit LFSR value. */
 static uint32_t                  tbxRandomNumberLFSR31;
+#else
+/** \brief State of the shared xoshiro128** generator. */
+static uint32_t                  tbxRandomXoshiroState[4];
+#endif
+
+/** \brief Flag to keep track of whether the shared generator was already seeded. It is
+ *         first read without the lock, so it is declared volatile.
+ */
+static volatile uint8_t          tbxRandomSeeded = TBX_FALSE;
+
+/** \brief Lock object for mutual exclusive access to the shared generator. */
+static tTbxLock                  tbxRandomLock = TBX_LOCK_INIT;
+
+#if (TBX_PORT_ENTROPY > 0U) && (TBX_CONF_RANDOM_ENTROPY_POOL_SIZE > 0U)
+/** \brief Buffer with the collected bytes of the entropy pool. The bytes at index 0 up
+ *         to tbxRandomEntropyCount are available. They are handed out from the end.
+ */
+static uint8_t                   tbxRandomEntropyPool[TBX_CONF_RANDOM_ENTROPY_POOL_SIZE];
+
+/** \brief Number of available bytes in the entropy pool. */
+static size_t                    tbxRandomEntropyCount = 0U;
+
+/** \brief Lock object for mutual exclusive access to the entropy pool. */
+static tTbxLock                  tbxRandomEntropyLock = TBX_LOCK_INIT;
+#endif
 
 
 /************************************************************************************//**
@@ -88,25 +136,72 @@ static uint32_t                  tbxRandomNumberLFSR31;
 ****************************************************************************************/
 uint32_t TbxRandomNumberGet(void)
 {
-  uint32_t       result;
-  static uint8_t seeded = TBX_FALSE;
+  uint32_t result;
 
-  /* Make sure both the 32-bit and 31-bit LFSRs are seeded. */
-  if (seeded == TBX_FALSE)
-  {
-    TbxRandomInitLFSRs();
-    seeded = TBX_TRUE;
-  }
-
-  /* Construct a 32-bit random number by combining two 16-bit random numbers. */
-  result  = ((uint32_t)TbxRandomNumber16BitGet() << 16UL);
-  result |= TbxRandomNumber16BitGet();
+  /* Make sure the generator is seeded. */
+  TbxRandomSeed();
+  /* Obtain mutual exclusive access to the shared generator. */
+  TbxLockEnter(&tbxRandomLock);
+  /* Generate the next random number. */
+  result = TbxRandomNumberGenerate();
+  /* Release mutual exclusive access to the shared generator. */
+  TbxLockExit(&tbxRandomLock);
 
   /* Give the result back to the caller. */
   return result;
 } /*** end of TbxRandomNumberGet ***/
 
 
+/************************************************************************************//**
+** \brief     Fills a byte array with random bytes. This is faster than calling
+**            TbxRandomNumberGet() for every four bytes, because the lock of the shared
+**            generator is only obtained once for every TBX_RANDOM_FILL_CHUNK_SIZE bytes.
+** \param     buf Pointer to the byte array to fill.
+** \param     len Number of bytes to fill.
+**
+****************************************************************************************/
+void TbxRandomFill(uint8_t * buf,
+                   size_t    len)
+{
+  size_t offset = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(buf != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (buf != NULL)
+  {
+    /* Make sure the generator is seeded. */
+    TbxRandomSeed();
+    while (offset < len)
+    {
+      size_t chunkEnd = len;
+
+      if ((len - offset) > TBX_RANDOM_FILL_CHUNK_SIZE)
+      {
+        chunkEnd = offset + TBX_RANDOM_FILL_CHUNK_SIZE;
+      }
+      /* Obtain mutual exclusive access to the shared generator. */
+      TbxLockEnter(&tbxRandomLock);
+      /* Store the bytes of the random numbers, least significant byte first. */
+      while (offset < chunkEnd)
+      {
+        uint32_t number = TbxRandomNumberGenerate();
+
+        for (uint8_t idx = 0U; (idx < 4U) && (offset < chunkEnd); idx++)
+        {
+          buf[offset] = (uint8_t)number;
+          number >>= 8U;
+          offset++;
+        }
+      }
+      /* Release mutual exclusive access to the shared generator. */
+      TbxLockExit(&tbxRandomLock);
+    }
+  }
+} /*** end of TbxRandomFill ***/
+
+
 /************************************************************************************//**
 ** \brief     Sets the application specific function that should be called when the
 **            seed for the random number generation should be initialized. The actual
@@ -152,44 +247,322 @@ void TbxRandomSetSeedInitHandler(tTbxRandomSeedInitHandler seedInitHandler)
 
 
 /************************************************************************************//**
-** \brief     Initialize both the 32-bit and 31-bit LFSRs with a non-zero seed value.
-** \return    none.
+** \brief     Initializes a caller owned random number generator context. The generator
+**            does not share any state with TbxRandomNumberGet(), so it does not need
+**            any locking. Contexts that are initialized with the same seed value
+**            generate the same sequence of random numbers. To give each thread its own
+**            sequence, initialize its context with a value from TbxRandomNumberGet().
+** \param     ctx Pointer to the random number generator context.
+** \param     seed Value to seed the generator with. Any value is allowed, including
+**            zero.
 **
 ****************************************************************************************/
-static void TbxRandomInitLFSRs(void)
+void TbxRandomCtxInit(tTbxRandomCtx * ctx,
+                      uint32_t        seed)
 {
-  uint32_t seedLFSR32 = 0xABCDEUL;
-  uint32_t seedLFSR31 = 0x23456789UL;
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
 
-  /* Request the application to fill in the seed values, if it registered a handler for
-   * this.
-   */
-  if (tbxRandomSeedInitHandler != NULL)
+  /* Only continue if the parameters are valid. */
+  if (ctx != NULL)
   {
-    /* Call the application specific seed initialization handler. */
-    seedLFSR32 = tbxRandomSeedInitHandler();
-    seedLFSR31 = tbxRandomSeedInitHandler();
+    TbxRandomXoshiroSeed(ctx->state, seed, 0U);
   }
+} /*** end of TbxRandomCtxInit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains a random number from a caller owned random number generator
+**            context.
+** \param     ctx Pointer to the random number generator context.
+** \return    Value of the newly generated random number.
+**
+****************************************************************************************/
+uint32_t TbxRandomCtxNumberGet(tTbxRandomCtx * ctx)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
 
-  /* Make sure the LFSRs seeds are a non-zero value. */
-  if (seedLFSR32 == 0U)
+  /* Only continue if the parameters are valid. */
+  if (ctx != NULL)
   {
-    seedLFSR32 = 0xABCDEUL;
+    result = TbxRandomXoshiroNext(ctx->state);
   }
-  if (seedLFSR31 == 0U)
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomCtxNumberGet ***/
+
+
+/************************************************************************************//**
+** \brief     Fills a byte array with random bytes from a caller owned random number
+**            generator context. The bytes of each random number are stored least
+**            significant byte first.
+** \param     ctx Pointer to the random number generator context.
+** \param     buf Pointer to the byte array to fill.
+** \param     len Number of bytes to fill.
+**
+****************************************************************************************/
+void TbxRandomCtxFill(tTbxRandomCtx * ctx,
+                      uint8_t       * buf,
+                      size_t          len)
+{
+  size_t offset = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ctx != NULL);
+  TBX_ASSERT(buf != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (ctx != NULL) && (buf != NULL) )
   {
-    seedLFSR31 = 0x23456789UL;
+    while (offset < len)
+    {
+      uint32_t number = TbxRandomXoshiroNext(ctx->state);
+
+      for (uint8_t idx = 0U; (idx < 4U) && (offset < len); idx++)
+      {
+        buf[offset] = (uint8_t)number;
+        number >>= 8U;
+        offset++;
+      }
+    }
   }
+} /*** end of TbxRandomCtxFill ***/
 
-  /* Seed the 32-bit and 31-bit LFSRs. Note that this function is only called once
-   * the first time a random number is generated, so there is no need to use a
-   * critical section for writing to the LFSR variables.
-   */
-  tbxRandomNumberLFSR32 = seedLFSR32;
-  tbxRandomNumberLFSR31 = seedLFSR31;
-} /*** end of TbxRandomInitLFSRs ***/
+
+#if (TBX_PORT_ENTROPY > 0U)
+/************************************************************************************//**
+** \brief     Tops up the entropy pool with bytes from the hardware entropy source of the
+**            port. The hardware is typically slow, so call this function from a low
+**            priority task or the idle loop. The callers of TbxRandomEntropyGet() then
+**            obtain their bytes from the pool, without waiting on the hardware. The lock
+**            of the pool is not held while the hardware produces the bytes.
+** \return    Number of bytes that were added to the entropy pool.
+**
+****************************************************************************************/
+size_t TbxRandomEntropyCollect(void)
+{
+  size_t  result = 0U;
+#if (TBX_CONF_RANDOM_ENTROPY_POOL_SIZE > 0U)
+  uint8_t chunk[TBX_RANDOM_ENTROPY_CHUNK_SIZE];
+  size_t  chunkLen;
+  size_t  numFree;
+  size_t  idx;
+
+  do
+  {
+    /* Determine how many bytes still fit in the pool. */
+    TbxLockEnter(&tbxRandomEntropyLock);
+    numFree = TBX_CONF_RANDOM_ENTROPY_POOL_SIZE - tbxRandomEntropyCount;
+    TbxLockExit(&tbxRandomEntropyLock);
+    chunkLen = (numFree < sizeof(chunk)) ? numFree : sizeof(chunk);
+    /* Obtain the bytes from the hardware. */
+    if (chunkLen > 0U)
+    {
+      chunkLen = TbxPortEntropyGet(chunk, chunkLen);
+    }
+    /* Add the bytes to the pool. Another caller might have added bytes in the meantime,
+     * so only add as many as still fit.
+     */
+    if (chunkLen > 0U)
+    {
+      TbxLockEnter(&tbxRandomEntropyLock);
+      for (idx = 0U; (idx < chunkLen) && \
+                     (tbxRandomEntropyCount < TBX_CONF_RANDOM_ENTROPY_POOL_SIZE); idx++)
+      {
+        tbxRandomEntropyPool[tbxRandomEntropyCount] = chunk[idx];
+        tbxRandomEntropyCount++;
+      }
+      TbxLockExit(&tbxRandomEntropyLock);
+      result += idx;
+    }
+  }
+  while ( (chunkLen > 0U) && (numFree > chunkLen) );
+  /* Do not leave entropy bytes behind on the stack. */
+  for (idx = 0U; idx < sizeof(chunk); idx++)
+  {
+    chunk[idx] = 0U;
+  }
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomEntropyCollect ***/
 
 
+/************************************************************************************//**
+** \brief     Obtains seed quality random bytes, for example for generating keys and
+**            nonces. The bytes come from the entropy pool first. Only if the pool holds
+**            fewer bytes than requested, the remaining ones are obtained directly from
+**            the hardware entropy source of the port. Each byte is handed out only once.
+** \param     buf Pointer to the byte array to store the random bytes in.
+** \param     len Number of random bytes to obtain.
+** \return    Number of random bytes that were actually stored in the byte array. Fewer
+**            than requested if the hardware could not produce enough bytes.
+**
+****************************************************************************************/
+size_t TbxRandomEntropyGet(uint8_t * buf,
+                           size_t    len)
+{
+  size_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(buf != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (buf != NULL)
+  {
+#if (TBX_CONF_RANDOM_ENTROPY_POOL_SIZE > 0U)
+    /* Hand out the bytes from the end of the pool and clear them there. */
+    TbxLockEnter(&tbxRandomEntropyLock);
+    while ( (result < len) && (tbxRandomEntropyCount > 0U) )
+    {
+      tbxRandomEntropyCount--;
+      buf[result] = tbxRandomEntropyPool[tbxRandomEntropyCount];
+      tbxRandomEntropyPool[tbxRandomEntropyCount] = 0U;
+      result++;
+    }
+    TbxLockExit(&tbxRandomEntropyLock);
+#endif
+    /* Obtain the remaining bytes directly from the hardware. */
+    if (result < len)
+    {
+      result += TbxPortEntropyGet(&buf[result], len - result);
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomEntropyGet ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of bytes in the entropy pool, which TbxRandomEntropyGet()
+**            can hand out without waiting on the hardware.
+** \return    Number of available bytes in the entropy pool.
+**
+****************************************************************************************/
+size_t TbxRandomEntropyAvailable(void)
+{
+  size_t result = 0U;
+
+#if (TBX_CONF_RANDOM_ENTROPY_POOL_SIZE > 0U)
+  TbxLockEnter(&tbxRandomEntropyLock);
+  result = tbxRandomEntropyCount;
+  TbxLockExit(&tbxRandomEntropyLock);
+#endif
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomEntropyAvailable ***/
+#endif /* (TBX_PORT_ENTROPY > 0U) */
+
+
+/************************************************************************************//**
+** \brief     Seeds the shared generator, if this did not happen yet. The seed values are
+**            obtained from the application specific seed initialization handler, if one
+**            is registered. Otherwise they come from the hardware entropy source of the
+**            port, if available. The seed values are obtained before taking the lock of
+**            the shared generator, such that the handler does not run while holding it.
+**            The seeded flag is therefore checked again, once the lock is obtained.
+**            Should be called without the lock of the shared generator obtained.
+**
+****************************************************************************************/
+static void TbxRandomSeed(void)
+{
+  uint32_t seedLFSR32 = 0xABCDEUL;
+  uint32_t seedLFSR31 = 0x23456789UL;
+#if (TBX_PORT_ENTROPY > 0U)
+  uint8_t  seedBytes[8];
+  uint8_t  idx;
+#endif
+
+  /* Only continue if the generator was not yet seeded. */
+  if (tbxRandomSeeded == TBX_FALSE)
+  {
+    /* Request the application to fill in the seed values, if it registered a handler
+     * for this.
+     */
+    if (tbxRandomSeedInitHandler != NULL)
+    {
+      /* Call the application specific seed initialization handler. */
+      seedLFSR32 = tbxRandomSeedInitHandler();
+      seedLFSR31 = tbxRandomSeedInitHandler();
+    }
+#if (TBX_PORT_ENTROPY > 0U)
+    /* Obtain the seed values from the hardware entropy source instead. Only use them
+     * if the hardware produced all the bytes.
+     */
+    else if (TbxRandomEntropyGet(seedBytes, sizeof(seedBytes)) == sizeof(seedBytes))
+    {
+      seedLFSR32 = 0U;
+      seedLFSR31 = 0U;
+      for (idx = 0U; idx < 4U; idx++)
+      {
+        seedLFSR32 = (seedLFSR32 << 8U) | seedBytes[idx];
+        seedLFSR31 = (seedLFSR31 << 8U) | seedBytes[idx + 4U];
+      }
+    }
+    else
+    {
+      /* Keep the default seed values. */
+    }
+#endif
+
+    /* Make sure the LFSRs seeds are a non-zero value. */
+    if (seedLFSR32 == 0U)
+    {
+      seedLFSR32 = 0xABCDEUL;
+    }
+    if (seedLFSR31 == 0U)
+    {
+      seedLFSR31 = 0x23456789UL;
+    }
+
+    /* Obtain mutual exclusive access to the shared generator. */
+    TbxLockEnter(&tbxRandomLock);
+    /* Another caller could have seeded the generator in the meantime. */
+    if (tbxRandomSeeded == TBX_FALSE)
+    {
+#if (TBX_CONF_RANDOM_METHOD == TBX_RANDOM_LFSR)
+      /* Seed the 32-bit and 31-bit LFSRs. */
+      tbxRandomNumberLFSR32 = seedLFSR32;
+      tbxRandomNumberLFSR31 = seedLFSR31;
+#else
+      /* Expand both seed values into the state of the xoshiro128** generator. */
+      TbxRandomXoshiroSeed(tbxRandomXoshiroState, seedLFSR32, seedLFSR31);
+#endif
+      tbxRandomSeeded = TBX_TRUE;
+    }
+    /* Release mutual exclusive access to the shared generator. */
+    TbxLockExit(&tbxRandomLock);
+  }
+} /*** end of TbxRandomSeed ***/
+
+
+/************************************************************************************//**
+** \brief     Generates the next random number of the shared generator. Should be
+**            called with the lock of the shared generator obtained.
+** \return    Value of the newly generated random number.
+**
+****************************************************************************************/
+static uint32_t TbxRandomNumberGenerate(void)
+{
+  uint32_t result;
+
+#if (TBX_CONF_RANDOM_METHOD == TBX_RANDOM_LFSR)
+  /* Construct a 32-bit random number by combining two 16-bit random numbers. */
+  result  = ((uint32_t)TbxRandomNumber16BitGet() << 16UL);
+  result |= TbxRandomNumber16BitGet();
+#else
+  result = TbxRandomXoshiroNext(tbxRandomXoshiroState);
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomNumberGenerate ***/
+
+
+#if (TBX_CONF_RANDOM_METHOD == TBX_RANDOM_LFSR)
 /************************************************************************************//**
 ** \brief     Perform the actual linear feedback shift operation.
 ** \param     lfsr Pointer to the current value of the LFSR. The newly generated value
@@ -226,7 +599,8 @@ static uint32_t TbxRandomShiftLFSR(uint32_t * lfsr,
 
 
 /************************************************************************************//**
-** \brief     Obtains a 16-bit random number.
+** \brief     Obtains a 16-bit random number. Should be called with the lock of the
+**            shared generator obtained.
 ** \return    Value of the newly generated 16-bit random number.
 **
 ****************************************************************************************/
@@ -236,8 +610,6 @@ static uint16_t TbxRandomNumber16BitGet(void)
   uint32_t lfsr32_second_shift;
   uint32_t lfsr31_first_shift;
 
-  /* Obtain mutual exclusive access to the 32-bit and 31-bit global LFSRs. */
-  TbxCriticalSectionEnter();
   /* Shifting the 32-bit LFSR more than once before getting a random number improves its
    * statistical properties. For this reason the 32-bit LFSR is shifted twice.
    */
@@ -251,8 +623,6 @@ static uint16_t TbxRandomNumber16BitGet(void)
    */
   lfsr31_first_shift = TbxRandomShiftLFSR(&tbxRandomNumberLFSR31,
                                           TBX_RANDOM_LFSR31_POLYMASK);
-  /* Release mutual exclusive access to the 32-bit and 31-bit global LFSRs. */
-  TbxCriticalSectionExit();
 
   /* Construct the actual 16-bit random value by XORing the twice shifted 32-bit LFSR and
    * the once shifted 31-bit LFSR.
@@ -262,6 +632,106 @@ static uint16_t TbxRandomNumber16BitGet(void)
   /* Give the result back to the caller. */
   return result;
 } /*** end of TbxRandomNumber16BitGet ***/
+#endif /* (TBX_CONF_RANDOM_METHOD == TBX_RANDOM_LFSR) */
+
+
+/************************************************************************************//**
+** \brief     Expands two 32-bit seed values into the 128-bit state of a xoshiro128**
+**            generator, with the help of the SplitMix32 generator. This makes sure that
+**            the state is never all zeroes and that similar seed values still give
+**            completely different states.
+** \param     state Pointer to the four 32-bit words of the generator state.
+** \param     seedA First seed value.
+** \param     seedB Second seed value.
+**
+****************************************************************************************/
+static void TbxRandomXoshiroSeed(uint32_t * state,
+                                 uint32_t   seedA,
+                                 uint32_t   seedB)
+{
+  uint32_t value = seedA;
+
+  /* Verify parameters. */
+  TBX_ASSERT(state != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (state != NULL)
+  {
+    state[0] = TbxRandomSplitMix32(&value);
+    state[1] = TbxRandomSplitMix32(&value);
+    value ^= seedB;
+    state[2] = TbxRandomSplitMix32(&value);
+    state[3] = TbxRandomSplitMix32(&value);
+    /* The generator gets stuck on an all zero state. */
+    if ((state[0] | state[1] | state[2] | state[3]) == 0U)
+    {
+      state[0] = 1U;
+    }
+  }
+} /*** end of TbxRandomXoshiroSeed ***/
+
+
+/************************************************************************************//**
+** \brief     Generates the next random number of a xoshiro128** generator, as
+**            published by David Blackman and Sebastiano Vigna.
+** \param     state Pointer to the four 32-bit words of the generator state.
+** \return    Value of the newly generated random number.
+**
+****************************************************************************************/
+static uint32_t TbxRandomXoshiroNext(uint32_t * state)
+{
+  uint32_t result = 0U;
+  uint32_t temp;
+
+  /* Verify parameters. */
+  TBX_ASSERT(state != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (state != NULL)
+  {
+    /* Scramble the second word into the result: rotl(state[1] * 5, 7) * 9. */
+    temp = state[1] * 5U;
+    result = ((temp << 7U) | (temp >> 25U)) * 9U;
+    /* Advance the state. */
+    temp = state[1] << 9U;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= temp;
+    state[3] = (state[3] << 11U) | (state[3] >> 21U);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomXoshiroNext ***/
+
+
+/************************************************************************************//**
+** \brief     Generates the next value of a SplitMix32 generator. Only used for
+**            expanding seed values into the state of a xoshiro128** generator.
+** \param     value Pointer to the state of the SplitMix32 generator.
+** \return    The newly generated value.
+**
+****************************************************************************************/
+static uint32_t TbxRandomSplitMix32(uint32_t * value)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(value != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if (value != NULL)
+  {
+    *value += 0x9E3779B9UL;
+    result = *value;
+    result = (result ^ (result >> 16U)) * 0x85EBCA6BUL;
+    result = (result ^ (result >> 13U)) * 0xC2B2AE35UL;
+    result ^= (result >> 16U);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRandomSplitMix32 ***/
 
 
 /*********************************** end of tbx_random.c *******************************/
@@ -39,19 +39,96 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Random number generator that combines a 32-bit and a 31-bit linear feedback
+ *         shift register. Each 32-bit random number takes six shift operations.
+ */
+#define TBX_RANDOM_LFSR                          (0U)
+
+/** \brief Random number generator xoshiro128**, with 128 bits of state. Each 32-bit
+ *         random number takes a handful of shift, rotate and exclusive-or operations and
+ *         two multiplications. Its statistical properties are much better than those of
+ *         the LFSR based generator.
+ */
+#define TBX_RANDOM_XOSHIRO128SS                  (1U)
+
+
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_RANDOM_METHOD
+/** \brief Configure the generator behind TbxRandomNumberGet() and TbxRandomFill(). Set
+ *         it to TBX_RANDOM_LFSR for the original LFSR based generator, or to
+ *         TBX_RANDOM_XOSHIRO128SS for the faster xoshiro128** generator. Note that it is
+ *         possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_RANDOM_METHOD                   (TBX_RANDOM_LFSR)
+#endif
+
+#if (TBX_CONF_RANDOM_METHOD > TBX_RANDOM_XOSHIRO128SS)
+#error "TBX_CONF_RANDOM_METHOD is invalid."
+#endif
+
+#ifndef TBX_CONF_RANDOM_ENTROPY_POOL_SIZE
+/** \brief Configure the number of bytes that the entropy pool buffers. Only used if the
+ *         port offers a hardware entropy source (TBX_PORT_ENTROPY). Set it to 0 to
+ *         disable the pool, in which case TbxRandomEntropyGet() always obtains the bytes
+ *         directly from the hardware. Note that it is possible to override this value
+ *         by adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_RANDOM_ENTROPY_POOL_SIZE        (64U)
+#endif
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
 /** \brief Function type for an application specific seed initialization handler. */
 typedef uint32_t (* tTbxRandomSeedInitHandler)(void);
 
+/** \brief Layout of a caller owned random number generator context. It holds the state
+ *         of a xoshiro128** generator. Initialize it with TbxRandomCtxInit(). It does not
+ *         need any locking, as long as each context is only used by one thread at a
+ *         time. Note that its elements should be considered private and only be
+ *         accessed internally by this module.
+ */
+typedef struct
+{
+  /** \brief State of the generator. */
+  uint32_t state[4];
+} tTbxRandomCtx;
+
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
 uint32_t TbxRandomNumberGet         (void);
 
-void     TbxRandomSetSeedInitHandler(tTbxRandomSeedInitHandler seedInitHandler);
+void     TbxRandomFill              (uint8_t                   * buf,
+                                     size_t                      len);
+
+void     TbxRandomSetSeedInitHandler(tTbxRandomSeedInitHandler   seedInitHandler);
+
+void     TbxRandomCtxInit           (tTbxRandomCtx             * ctx,
+                                     uint32_t                    seed);
+
+uint32_t TbxRandomCtxNumberGet      (tTbxRandomCtx             * ctx);
+
+void     TbxRandomCtxFill           (tTbxRandomCtx             * ctx,
+                                     uint8_t                   * buf,
+                                     size_t                      len);
+
+#if (TBX_PORT_ENTROPY > 0U)
+size_t   TbxRandomEntropyCollect    (void);
+
+size_t   TbxRandomEntropyGet        (uint8_t                   * buf,
+                                     size_t                      len);
+
+size_t   TbxRandomEntropyAvailable  (void);
+#endif
 
 
 #ifdef __cplusplus
@@ -0,0 +1,578 @@
+/************************************************************************************//**
+* \file         tbx_ringbuf.c
+* \brief        Lock-free ring buffers source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static size_t TbxRingBufGetWriteSpan(tTbxRingBuf const * ringBuf,
+                                     uint8_t         * * spanPtr);
+
+static size_t TbxRingBufGetReadSpan (tTbxRingBuf const * ringBuf,
+                                     uint8_t         * * spanPtr);
+
+
+/************************************************************************************//**
+** \brief     Creates a new and empty ring buffer and returns its pointer. Make sure to
+**            store the pointer because it serves as a handle to the ring buffer, which
+**            is needed when calling the other API functions in this module. The memory
+**            for the ring buffer is taken from the heap. The ring buffer is meant to be
+**            shared by one producer and one consumer, for example an interrupt service
+**            routine and a task. Neither of them needs a critical section to access it.
+** \param     capacity Maximum number of elements that the ring buffer can hold. It must
+**            be a power of two.
+** \param     elementSize Number of bytes of one element. Set it to one for a byte FIFO.
+** \return    Pointer to the created ring buffer or NULL in case of an error.
+**
+****************************************************************************************/
+tTbxRingBuf * TbxRingBufCreate(size_t capacity,
+                               size_t elementSize)
+{
+  tTbxRingBuf * result = NULL;
+  tTbxRingBuf * ringBufPtr;
+  uint8_t     * bufferPtr = NULL;
+
+  /* Verify parameters. */
+  TBX_ASSERT( (capacity > 0U) && ((capacity & (capacity - 1U)) == 0U) &&
+              (capacity <= (SIZE_MAX >> 1U)) );
+  TBX_ASSERT(elementSize > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (capacity > 0U) && ((capacity & (capacity - 1U)) == 0U) &&
+       (capacity <= (SIZE_MAX >> 1U)) && (elementSize > 0U) )
+  {
+    /* Create the ring buffer object and its storage, while making sure that the size of
+     * the storage does not overflow.
+     */
+    ringBufPtr = NULL;
+    if (capacity <= (SIZE_MAX / elementSize))
+    {
+      ringBufPtr = TbxHeapAllocate(sizeof(tTbxRingBuf));
+    }
+    if (ringBufPtr != NULL)
+    {
+      bufferPtr = TbxHeapAllocate(capacity * elementSize);
+    }
+    /* Only continue if the memory allocations were successful. */
+    if (bufferPtr != NULL)
+    {
+      /* Initialize the ring buffer. By default it is empty. */
+      ringBufPtr->bufferPtr = bufferPtr;
+      ringBufPtr->elementSize = elementSize;
+      ringBufPtr->indexMask = capacity - 1U;
+      ringBufPtr->writeIdx = 0U;
+      ringBufPtr->readIdx = 0U;
+      /* Update the result for success. */
+      result = ringBufPtr;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of elements that are currently stored in the ring
+**            buffer. Note that the value can already be outdated when the function
+**            returns, if the other side accessed the ring buffer in the meantime.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \return    Number of elements that can be read from the ring buffer.
+**
+****************************************************************************************/
+size_t TbxRingBufGetCount(tTbxRingBuf const * ringBuf)
+{
+  size_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ringBuf != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ringBuf != NULL)
+  {
+    /* The indices are free running, so their difference is the number of elements. */
+    result = ringBuf->writeIdx - ringBuf->readIdx;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of elements that can currently still be stored in the
+**            ring buffer. Note that the value can already be outdated when the function
+**            returns, if the other side accessed the ring buffer in the meantime.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \return    Number of elements that can be written to the ring buffer.
+**
+****************************************************************************************/
+size_t TbxRingBufGetFree(tTbxRingBuf const * ringBuf)
+{
+  size_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ringBuf != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ringBuf != NULL)
+  {
+    /* Subtract the number of stored elements from the capacity. */
+    result = (ringBuf->indexMask + 1U) - (ringBuf->writeIdx - ringBuf->readIdx);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufGetFree ***/
+
+
+/************************************************************************************//**
+** \brief     Writes one element to the ring buffer. May only be called by the producer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     element Pointer to the element data, of which the size equals the element
+**            size of the ring buffer.
+** \return    TBX_OK if the element was written, TBX_ERROR otherwise, for example when
+**            the ring buffer is full.
+**
+****************************************************************************************/
+uint8_t TbxRingBufWrite(tTbxRingBuf       * ringBuf,
+                        void        const * element)
+{
+  uint8_t         result = TBX_ERROR;
+  uint8_t       * spanPtr;
+  uint8_t const * elementPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ringBuf != NULL) && (element != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((ringBuf != NULL) && (element != NULL))
+  {
+    /* Only continue if there is space for at least one element. */
+    if (TbxRingBufGetWriteSpan(ringBuf, &spanPtr) > 0U)
+    {
+      /* Copy the element into the ring buffer. */
+      elementPtr = element;
+      for (size_t idx = 0U; idx < ringBuf->elementSize; idx++)
+      {
+        spanPtr[idx] = elementPtr[idx];
+      }
+      /* Make sure the element is stored, before the consumer can see it. */
+      TbxPortMemoryBarrier();
+      ringBuf->writeIdx = ringBuf->writeIdx + 1U;
+      /* Update the result for success. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufWrite ***/
+
+
+/************************************************************************************//**
+** \brief     Reads one element from the ring buffer. May only be called by the consumer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     element Pointer to where the element data should be stored. Its size must
+**            be at least the element size of the ring buffer.
+** \return    TBX_OK if an element was read, TBX_ERROR otherwise, for example when the
+**            ring buffer is empty.
+**
+****************************************************************************************/
+uint8_t TbxRingBufRead(tTbxRingBuf * ringBuf,
+                       void        * element)
+{
+  uint8_t   result = TBX_ERROR;
+  uint8_t * spanPtr;
+  uint8_t * elementPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ringBuf != NULL) && (element != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((ringBuf != NULL) && (element != NULL))
+  {
+    /* Only continue if there is at least one element. */
+    if (TbxRingBufGetReadSpan(ringBuf, &spanPtr) > 0U)
+    {
+      /* Copy the element out of the ring buffer. */
+      elementPtr = element;
+      for (size_t idx = 0U; idx < ringBuf->elementSize; idx++)
+      {
+        elementPtr[idx] = spanPtr[idx];
+      }
+      /* Make sure the element is copied, before the producer can overwrite it. */
+      TbxPortMemoryBarrier();
+      ringBuf->readIdx = ringBuf->readIdx + 1U;
+      /* Update the result for success. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufRead ***/
+
+
+/************************************************************************************//**
+** \brief     Writes as many bytes as possible to a ring buffer with an element size of
+**            one byte. May only be called by the producer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     data Pointer to the bytes to write.
+** \param     len Number of bytes to write.
+** \return    Number of bytes that were actually written. This is less than len, if the
+**            ring buffer did not have enough space.
+**
+****************************************************************************************/
+size_t TbxRingBufWriteBytes(tTbxRingBuf       * ringBuf,
+                            uint8_t     const * data,
+                            size_t              len)
+{
+  size_t    result = 0U;
+  size_t    spanLen;
+  uint8_t * spanPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ringBuf != NULL) && (data != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((ringBuf != NULL) && (data != NULL))
+  {
+    /* Bytes can only be written to a ring buffer with single byte elements. */
+    TBX_ASSERT(ringBuf->elementSize == 1U);
+
+    /* Only continue if the ring buffer has single byte elements. */
+    if (ringBuf->elementSize == 1U)
+    {
+      /* The free space consists of at most two contiguous spans. Keep copying into them
+       * until all bytes are written or until the ring buffer is full.
+       */
+      spanLen = TbxRingBufGetWriteSpan(ringBuf, &spanPtr);
+      while ((spanLen > 0U) && (result < len))
+      {
+        if (spanLen > (len - result))
+        {
+          spanLen = len - result;
+        }
+        for (size_t idx = 0U; idx < spanLen; idx++)
+        {
+          spanPtr[idx] = data[result + idx];
+        }
+        /* Make sure the bytes are stored, before the consumer can see them. */
+        TbxPortMemoryBarrier();
+        ringBuf->writeIdx = ringBuf->writeIdx + spanLen;
+        result += spanLen;
+        spanLen = TbxRingBufGetWriteSpan(ringBuf, &spanPtr);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufWriteBytes ***/
+
+
+/************************************************************************************//**
+** \brief     Reads as many bytes as possible from a ring buffer with an element size of
+**            one byte. May only be called by the consumer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     data Pointer to where the read bytes should be stored.
+** \param     len Maximum number of bytes to read.
+** \return    Number of bytes that were actually read. This is less than len, if the
+**            ring buffer did not hold that many bytes.
+**
+****************************************************************************************/
+size_t TbxRingBufReadBytes(tTbxRingBuf * ringBuf,
+                           uint8_t     * data,
+                           size_t        len)
+{
+  size_t    result = 0U;
+  size_t    spanLen;
+  uint8_t * spanPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ringBuf != NULL) && (data != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((ringBuf != NULL) && (data != NULL))
+  {
+    /* Bytes can only be read from a ring buffer with single byte elements. */
+    TBX_ASSERT(ringBuf->elementSize == 1U);
+
+    /* Only continue if the ring buffer has single byte elements. */
+    if (ringBuf->elementSize == 1U)
+    {
+      /* The stored bytes are in at most two contiguous spans. Keep copying from them
+       * until the requested number of bytes is read or until the ring buffer is empty.
+       */
+      spanLen = TbxRingBufGetReadSpan(ringBuf, &spanPtr);
+      while ((spanLen > 0U) && (result < len))
+      {
+        if (spanLen > (len - result))
+        {
+          spanLen = len - result;
+        }
+        for (size_t idx = 0U; idx < spanLen; idx++)
+        {
+          data[result + idx] = spanPtr[idx];
+        }
+        /* Make sure the bytes are copied, before the producer can overwrite them. */
+        TbxPortMemoryBarrier();
+        ringBuf->readIdx = ringBuf->readIdx + spanLen;
+        result += spanLen;
+        spanLen = TbxRingBufGetReadSpan(ringBuf, &spanPtr);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufReadBytes ***/
+
+
+/************************************************************************************//**
+** \brief     Reserves the contiguous free space at the write index of the ring buffer,
+**            without copying anything. The producer can store elements directly in the
+**            span, for example with DMA, and afterwards publish them to the consumer with
+**            TbxRingBufWriteCommit(). Because the free space can wrap around the end of
+**            the storage, it can be that not all free space is contiguous. In that case,
+**            call this function again after the commit. May only be called by the
+**            producer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     span Pointer to where the start address of the span is stored.
+** \return    Number of elements that fit in the span. Zero if the ring buffer is full.
+**
+****************************************************************************************/
+size_t TbxRingBufWriteReserve(tTbxRingBuf       * ringBuf,
+                              void            * * span)
+{
+  size_t    result = 0U;
+  uint8_t * spanPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ringBuf != NULL) && (span != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((ringBuf != NULL) && (span != NULL))
+  {
+    /* Determine the contiguous free space. */
+    result = TbxRingBufGetWriteSpan(ringBuf, &spanPtr);
+    *span = spanPtr;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufWriteReserve ***/
+
+
+/************************************************************************************//**
+** \brief     Publishes elements that the producer stored in the span that it obtained
+**            with TbxRingBufWriteReserve(). May only be called by the producer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     count Number of elements that were stored at the start of the span. It
+**            cannot be more than the number of elements that fit in the span.
+**
+****************************************************************************************/
+void TbxRingBufWriteCommit(tTbxRingBuf * ringBuf,
+                           size_t        count)
+{
+  uint8_t * spanPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ringBuf != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ringBuf != NULL)
+  {
+    /* The number of elements cannot exceed the reserved span. */
+    TBX_ASSERT(count <= TbxRingBufGetWriteSpan(ringBuf, &spanPtr));
+
+    /* Make sure the elements are stored, before the consumer can see them. */
+    TbxPortMemoryBarrier();
+    ringBuf->writeIdx = ringBuf->writeIdx + count;
+  }
+} /*** end of TbxRingBufWriteCommit ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the contiguous span of stored elements at the read index of the
+**            ring buffer, without copying anything. The consumer can process the
+**            elements directly in the span and afterwards give them back to the
+**            producer with TbxRingBufReadCommit(). Because the stored elements can wrap
+**            around the end of the storage, it can be that not all of them are
+**            contiguous. In that case, call this function again after the commit. May
+**            only be called by the consumer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     span Pointer to where the start address of the span is stored.
+** \return    Number of elements in the span. Zero if the ring buffer is empty.
+**
+****************************************************************************************/
+size_t TbxRingBufReadReserve(tTbxRingBuf       * ringBuf,
+                             void            * * span)
+{
+  size_t    result = 0U;
+  uint8_t * spanPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT((ringBuf != NULL) && (span != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((ringBuf != NULL) && (span != NULL))
+  {
+    /* Determine the contiguous stored elements. */
+    result = TbxRingBufGetReadSpan(ringBuf, &spanPtr);
+    *span = spanPtr;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufReadReserve ***/
+
+
+/************************************************************************************//**
+** \brief     Releases elements that the consumer processed in the span that it obtained
+**            with TbxRingBufReadReserve(). Afterwards, the producer can overwrite them.
+**            May only be called by the consumer.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     count Number of elements at the start of the span that were processed. It
+**            cannot be more than the number of elements in the span.
+**
+****************************************************************************************/
+void TbxRingBufReadCommit(tTbxRingBuf * ringBuf,
+                          size_t        count)
+{
+  uint8_t * spanPtr;
+
+  /* Verify parameters. */
+  TBX_ASSERT(ringBuf != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (ringBuf != NULL)
+  {
+    /* The number of elements cannot exceed the reserved span. */
+    TBX_ASSERT(count <= TbxRingBufGetReadSpan(ringBuf, &spanPtr));
+
+    /* Make sure the elements are processed, before the producer can overwrite them. */
+    TbxPortMemoryBarrier();
+    ringBuf->readIdx = ringBuf->readIdx + count;
+  }
+} /*** end of TbxRingBufReadCommit ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the contiguous free space at the write index of the ring buffer.
+**            Only the consumer changes the read index. It is read once and a memory
+**            barrier makes sure that the consumer is done with the elements, before the
+**            producer overwrites them.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     spanPtr Pointer to where the start address of the free space is stored.
+** \return    Number of elements that fit in the contiguous free space.
+**
+****************************************************************************************/
+static size_t TbxRingBufGetWriteSpan(tTbxRingBuf const * ringBuf,
+                                     uint8_t         * * spanPtr)
+{
+  size_t result;
+  size_t writeIdx;
+  size_t readIdx;
+  size_t offset;
+
+  /* Read both indices. The read index is changed by the consumer, so it is read only
+   * once.
+   */
+  writeIdx = ringBuf->writeIdx;
+  readIdx = ringBuf->readIdx;
+  TbxPortMemoryBarrier();
+  /* Determine the free space and limit it to the part before the end of the storage. */
+  offset = writeIdx & ringBuf->indexMask;
+  result = (ringBuf->indexMask + 1U) - (writeIdx - readIdx);
+  if (result > ((ringBuf->indexMask + 1U) - offset))
+  {
+    result = (ringBuf->indexMask + 1U) - offset;
+  }
+  *spanPtr = &ringBuf->bufferPtr[offset * ringBuf->elementSize];
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufGetWriteSpan ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the contiguous stored elements at the read index of the ring
+**            buffer. Only the producer changes the write index. It is read once and a
+**            memory barrier makes sure that the elements are not accessed before the
+**            producer stored them.
+** \param     ringBuf Pointer to a previously created ring buffer.
+** \param     spanPtr Pointer to where the start address of the stored elements is stored.
+** \return    Number of elements in the contiguous span.
+**
+****************************************************************************************/
+static size_t TbxRingBufGetReadSpan(tTbxRingBuf const * ringBuf,
+                                    uint8_t         * * spanPtr)
+{
+  size_t result;
+  size_t writeIdx;
+  size_t readIdx;
+  size_t offset;
+
+  /* Read both indices. The write index is changed by the producer, so it is read only
+   * once.
+   */
+  readIdx = ringBuf->readIdx;
+  writeIdx = ringBuf->writeIdx;
+  TbxPortMemoryBarrier();
+  /* Determine the stored elements and limit them to the part before the end of the
+   * storage.
+   */
+  offset = readIdx & ringBuf->indexMask;
+  result = writeIdx - readIdx;
+  if (result > ((ringBuf->indexMask + 1U) - offset))
+  {
+    result = (ringBuf->indexMask + 1U) - offset;
+  }
+  *spanPtr = &ringBuf->bufferPtr[offset * ringBuf->elementSize];
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxRingBufGetReadSpan ***/
+
+
+/*********************************** end of tbx_ringbuf.c ******************************/
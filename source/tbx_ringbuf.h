@@ -0,0 +1,111 @@
+/************************************************************************************//**
+* \file         tbx_ringbuf.h
+* \brief        Lock-free ring buffers header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_RINGBUF_H
+#define TBX_RINGBUF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a lock-free single-producer single-consumer ring buffer. Its pointer
+ *         serves as the handle to the ring buffer, which is obtained after creation of
+ *         the ring buffer and which is needed in the other functions of this module. The
+ *         write index is only changed by the producer and the read index is only changed
+ *         by the consumer. Both indices run freely and are masked when accessing the
+ *         storage, which is why the capacity must be a power of two. Note that its
+ *         elements should be considered private and only be accessed internally by this
+ *         ring buffer module.
+ */
+typedef struct
+{
+  /** \brief Pointer to the storage of the elements. */
+  uint8_t         * bufferPtr;
+  /** \brief Number of bytes of one element. */
+  size_t            elementSize;
+  /** \brief Capacity of the ring buffer in elements minus one. */
+  size_t            indexMask;
+  /** \brief Free running index of the next element to write. */
+  volatile size_t   writeIdx;
+  /** \brief Free running index of the next element to read. */
+  volatile size_t   readIdx;
+} tTbxRingBuf;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxRingBuf * TbxRingBufCreate      (size_t                capacity,
+                                     size_t                elementSize);
+
+size_t        TbxRingBufGetCount    (tTbxRingBuf   const * ringBuf);
+
+size_t        TbxRingBufGetFree     (tTbxRingBuf   const * ringBuf);
+
+uint8_t       TbxRingBufWrite       (tTbxRingBuf         * ringBuf,
+                                     void          const * element);
+
+uint8_t       TbxRingBufRead        (tTbxRingBuf         * ringBuf,
+                                     void                * element);
+
+size_t        TbxRingBufWriteBytes  (tTbxRingBuf         * ringBuf,
+                                     uint8_t       const * data,
+                                     size_t                len);
+
+size_t        TbxRingBufReadBytes   (tTbxRingBuf         * ringBuf,
+                                     uint8_t             * data,
+                                     size_t                len);
+
+size_t        TbxRingBufWriteReserve(tTbxRingBuf         * ringBuf,
+                                     void              * * span);
+
+void          TbxRingBufWriteCommit (tTbxRingBuf         * ringBuf,
+                                     size_t                count);
+
+size_t        TbxRingBufReadReserve (tTbxRingBuf         * ringBuf,
+                                     void              * * span);
+
+void          TbxRingBufReadCommit  (tTbxRingBuf         * ringBuf,
+                                     size_t                count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_RINGBUF_H */
+/*********************************** end of tbx_ringbuf.h ******************************/
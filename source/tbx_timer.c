@@ -0,0 +1,575 @@
+/************************************************************************************//**
+* \file         tbx_timer.c
+* \brief        Software timers source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of slots in each level of the timing wheel. */
+#define TBX_TIMER_WHEEL_SLOTS                    (1U << TBX_CONF_TIMER_WHEEL_BITS)
+
+/** \brief Bit mask for extracting the slot index of a level from a tick counter value. */
+#define TBX_TIMER_WHEEL_MASK                     ((uint32_t)TBX_TIMER_WHEEL_SLOTS - 1U)
+
+/** \brief Total number of tick bits that the levels of the timing wheel cover. */
+#define TBX_TIMER_WHEEL_RANGE_BITS               (TBX_CONF_TIMER_WHEEL_LEVELS * \
+                                                  TBX_CONF_TIMER_WHEEL_BITS)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TbxTimerLink       (tTbxTimer       * * slotPtr,
+                                tTbxTimer         * timer);
+
+static void TbxTimerUnlink     (tTbxTimer         * timer);
+
+static void TbxTimerInsert     (tTbxTimer         * timer);
+
+static void TbxTimerProcessSlot(tTbxTimer       * * slotPtr,
+                                uint8_t             expire);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Slots of the timing wheel. Each slot points to the first timer of a singly
+ *         linked list with the timers that belong to the slot. A timer that expires
+ *         within 2^TBX_CONF_TIMER_WHEEL_BITS ticks is in the first level, in the slot of
+ *         its exact expire time. A timer that expires later is in a higher level, whose
+ *         slots each cover a range of expire times. Such a timer is moved to a lower
+ *         level, once the tick counter reaches the start of its range.
+ */
+static tTbxTimer * tbxTimerWheel[TBX_CONF_TIMER_WHEEL_LEVELS][TBX_TIMER_WHEEL_SLOTS];
+
+/** \brief Linked list with the timers that TbxTimerTick() took from a slot and still
+ *         needs to process. Needed such that the lock can be released after processing
+ *         each timer.
+ */
+static tTbxTimer * tbxTimerPending = NULL;
+
+/** \brief Tick counter. Incremented by one with each call of TbxTimerTick(). */
+static uint32_t tbxTimerTime = 0U;
+
+/** \brief Dedicated memory pool for the timer objects. */
+static tTbxMemPoolFixed * tbxTimerPool = NULL;
+
+/** \brief Lock object for mutual exclusive access to the timing wheel. */
+static tTbxLock tbxTimerLock = TBX_LOCK_INIT;
+
+
+/************************************************************************************//**
+** \brief     Creates a new software timer. The timer object is allocated from a
+**            dedicated memory pool, which holds TBX_CONF_TIMER_POOL_SIZE timer objects.
+**            The memory pool itself is allocated on the heap, upon the first call of
+**            this function. The timer is not yet running after its creation. Call
+**            TbxTimerStart() to start it.
+** \param     callbackFcn Function that is called when the timer expires.
+** \param     context Optional context that is passed to the callback function. Can be
+**            NULL.
+** \return    Pointer to the newly created timer, if successful. NULL otherwise, for
+**            example when all timer objects of the memory pool are in use.
+**
+****************************************************************************************/
+tTbxTimer * TbxTimerCreate(tTbxTimerCallback   callbackFcn,
+                           void              * context)
+{
+  tTbxTimer * result = NULL;
+
+  /* Verify parameter. */
+  TBX_ASSERT(callbackFcn != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (callbackFcn != NULL)
+  {
+    /* Create the dedicated memory pool for the timer objects, if not yet done. */
+    TbxLockEnter(&tbxTimerLock);
+    if (tbxTimerPool == NULL)
+    {
+      tbxTimerPool = TbxMemPoolFixedCreate(TBX_CONF_TIMER_POOL_SIZE, sizeof(tTbxTimer));
+    }
+    TbxLockExit(&tbxTimerLock);
+    /* Only continue if the memory pool is available. */
+    if (tbxTimerPool != NULL)
+    {
+      /* Attempt to allocate a timer object. */
+      result = TbxMemPoolFixedAllocate(tbxTimerPool);
+      /* Initialize the timer, if the allocation was successful. */
+      if (result != NULL)
+      {
+        result->nextPtr = NULL;
+        result->prevNextPtr = NULL;
+        result->expireTime = 0U;
+        result->period = 0U;
+        result->callbackFcn = callbackFcn;
+        result->context = context;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTimerCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Stops and deletes a previously created software timer. Afterwards, the
+**            pointer to the timer is no longer valid and should not be used anymore.
+**            Note that the timer should not be deleted from another context than the one
+**            that calls TbxTimerTick(), while its callback function might be running.
+** \param     timer Pointer to a previously created timer to operate on.
+**
+****************************************************************************************/
+void TbxTimerDelete(tTbxTimer * timer)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(timer != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (timer != NULL)
+  {
+    /* Make sure the timer is no longer part of the timing wheel. */
+    TbxTimerStop(timer);
+    /* Give the timer object back to its memory pool. */
+    TbxMemPoolRelease(timer);
+  }
+} /*** end of TbxTimerDelete ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the software timer. If the timer was already running, it is
+**            restarted. This function runs in a constant time, no matter how many
+**            timers are running.
+** \param     timer Pointer to a previously created timer to operate on.
+** \param     ticks Number of calls of TbxTimerTick(), after which the timer expires.
+**            Must be at least 1.
+** \param     period Number of ticks after which the timer expires again, each time it
+**            expired, or 0 to stop the timer once it expired.
+**
+****************************************************************************************/
+void TbxTimerStart(tTbxTimer * timer,
+                   uint32_t    ticks,
+                   uint32_t    period)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((timer != NULL) && (ticks > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ((timer != NULL) && (ticks > 0U))
+  {
+    /* Obtain mutual exclusive access to the timing wheel. */
+    TbxLockEnter(&tbxTimerLock);
+    /* Remove the timer from its slot, if it is already running. */
+    if (timer->prevNextPtr != NULL)
+    {
+      TbxTimerUnlink(timer);
+    }
+    /* Insert the timer in the slot of its new expire time. */
+    timer->expireTime = tbxTimerTime + ticks;
+    timer->period = period;
+    TbxTimerInsert(timer);
+    /* Release mutual exclusive access to the timing wheel. */
+    TbxLockExit(&tbxTimerLock);
+  }
+} /*** end of TbxTimerStart ***/
+
+
+/************************************************************************************//**
+** \brief     Stops the software timer, if it is running. This function runs in a
+**            constant time, no matter how many timers are running.
+** \param     timer Pointer to a previously created timer to operate on.
+**
+****************************************************************************************/
+void TbxTimerStop(tTbxTimer * timer)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(timer != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (timer != NULL)
+  {
+    /* Obtain mutual exclusive access to the timing wheel. */
+    TbxLockEnter(&tbxTimerLock);
+    /* Remove the timer from its slot, if it is running. */
+    if (timer->prevNextPtr != NULL)
+    {
+      TbxTimerUnlink(timer);
+    }
+    /* Release mutual exclusive access to the timing wheel. */
+    TbxLockExit(&tbxTimerLock);
+  }
+} /*** end of TbxTimerStop ***/
+
+
+/************************************************************************************//**
+** \brief     Determines if the software timer is running.
+** \param     timer Pointer to a previously created timer to operate on.
+** \return    TBX_TRUE if the timer is running, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+uint8_t TbxTimerIsRunning(tTbxTimer const * timer)
+{
+  uint8_t result = TBX_FALSE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(timer != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (timer != NULL)
+  {
+    /* Obtain mutual exclusive access to the timing wheel. */
+    TbxLockEnter(&tbxTimerLock);
+    /* The timer is running, if it is linked into a slot of the timing wheel. */
+    if (timer->prevNextPtr != NULL)
+    {
+      result = TBX_TRUE;
+    }
+    /* Release mutual exclusive access to the timing wheel. */
+    TbxLockExit(&tbxTimerLock);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTimerIsRunning ***/
+
+
+/************************************************************************************//**
+** \brief     Advances the tick counter by one and calls the callback function of each
+**            timer that expires at the new tick counter value. Typically called from a
+**            periodic timer interrupt or from a task. Only handles the timers in one
+**            slot of each level, and only the levels whose range starts at the new tick
+**            counter value. Each timer therefore moves to a lower level at most
+**            TBX_CONF_TIMER_WHEEL_LEVELS times during its lifetime. The lock is held for
+**            processing one timer at a time. The callback functions are called without
+**            holding the lock. Note that this function should always be called from the
+**            same context.
+**
+****************************************************************************************/
+void TbxTimerTick(void)
+{
+  uint32_t time;
+  uint32_t shift = TBX_CONF_TIMER_WHEEL_BITS;
+  uint8_t  level = 1U;
+
+  /* Advance the tick counter. */
+  TbxLockEnter(&tbxTimerLock);
+  tbxTimerTime++;
+  time = tbxTimerTime;
+  TbxLockExit(&tbxTimerLock);
+  /* Move the timers from the slot of each higher level, whose range starts at the new
+   * tick counter value, to the lower levels. This is the case for a level, if the
+   * slot index of every lower level just wrapped around to zero.
+   */
+  while ( (level < TBX_CONF_TIMER_WHEEL_LEVELS) &&
+          (((time >> (shift - TBX_CONF_TIMER_WHEEL_BITS)) & TBX_TIMER_WHEEL_MASK) == 0U) )
+  {
+    TbxTimerProcessSlot(&tbxTimerWheel[level][(time >> shift) & TBX_TIMER_WHEEL_MASK],
+                        TBX_FALSE);
+    level++;
+    shift += TBX_CONF_TIMER_WHEEL_BITS;
+  }
+  /* All timers in the slot of the first level expire at the new tick counter value. */
+  TbxTimerProcessSlot(&tbxTimerWheel[0U][time & TBX_TIMER_WHEEL_MASK], TBX_TRUE);
+} /*** end of TbxTimerTick ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the current value of the tick counter.
+** \return    The number of times that TbxTimerTick() was called. Wraps around to zero
+**            after it reached its maximum value.
+**
+****************************************************************************************/
+uint32_t TbxTimerGetTime(void)
+{
+  uint32_t result;
+
+  /* Read the tick counter. Done with the lock, because not all architectures read a
+   * 32-bit value atomically.
+   */
+  TbxLockEnter(&tbxTimerLock);
+  result = tbxTimerTime;
+  TbxLockExit(&tbxTimerLock);
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTimerGetTime ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of ticks until TbxTimerTick() next has work to do. This
+**            is either when a timer expires or when timers move to a lower level of the
+**            timing wheel. Meant for a tickless idle mode, where the tick interrupt is
+**            suppressed until then. After waking up, call TbxTimerTick() once for each
+**            tick that passed. Note that the returned value is never later than the
+**            expire time of the first timer that expires. It can be earlier. For this
+**            reason, call this function again each time the idle mode is entered. It
+**            checks at most 2^TBX_CONF_TIMER_WHEEL_BITS slots per level.
+** \return    Number of ticks until TbxTimerTick() next has work to do, or
+**            TBX_TIMER_NO_EXPIRY if no timer is running.
+**
+****************************************************************************************/
+uint32_t TbxTimerGetNextExpiry(void)
+{
+  uint32_t result = TBX_TIMER_NO_EXPIRY;
+  uint32_t time;
+  uint32_t base;
+  uint32_t shift = 0U;
+  uint32_t offset;
+  uint32_t ticks;
+  uint8_t  found;
+
+  /* Obtain mutual exclusive access to the timing wheel. */
+  TbxLockEnter(&tbxTimerLock);
+  time = tbxTimerTime;
+  /* If TbxTimerTick() did not yet process all timers of its current tick, there is
+   * work to do right away.
+   */
+  if (tbxTimerPending != NULL)
+  {
+    result = 0U;
+  }
+  else
+  {
+    /* Check each level for its first slot with timers. For the first level, the start
+     * of the slot's range equals the expire time of its timers. For the higher levels,
+     * it is when the timers move to a lower level.
+     */
+    for (uint8_t level = 0U; level < TBX_CONF_TIMER_WHEEL_LEVELS; level++)
+    {
+      base = time >> shift;
+      found = TBX_FALSE;
+      for (offset = 1U; (offset <= TBX_TIMER_WHEEL_SLOTS) && (found == TBX_FALSE);
+           offset++)
+      {
+        if (tbxTimerWheel[level][(base + offset) & TBX_TIMER_WHEEL_MASK] != NULL)
+        {
+          /* Determine the number of ticks until the start of the slot's range. */
+          ticks = ((base + offset) << shift) - time;
+          if (ticks < result)
+          {
+            result = ticks;
+          }
+          found = TBX_TRUE;
+        }
+      }
+      shift += TBX_CONF_TIMER_WHEEL_BITS;
+    }
+  }
+  /* Release mutual exclusive access to the timing wheel. */
+  TbxLockExit(&tbxTimerLock);
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTimerGetNextExpiry ***/
+
+
+/************************************************************************************//**
+** \brief     Adds the timer to the start of the linked list of a slot. Should be called
+**            with the lock held.
+** \param     slotPtr Pointer to the slot, which points to the first timer in its linked
+**            list.
+** \param     timer Pointer to the timer to add.
+**
+****************************************************************************************/
+static void TbxTimerLink(tTbxTimer * * slotPtr,
+                         tTbxTimer   * timer)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((slotPtr != NULL) && (timer != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((slotPtr != NULL) && (timer != NULL))
+  {
+    timer->nextPtr = *slotPtr;
+    if (timer->nextPtr != NULL)
+    {
+      timer->nextPtr->prevNextPtr = &timer->nextPtr;
+    }
+    timer->prevNextPtr = slotPtr;
+    *slotPtr = timer;
+  }
+} /*** end of TbxTimerLink ***/
+
+
+/************************************************************************************//**
+** \brief     Removes the timer from the linked list of its slot. This does not require
+**            knowing the slot, because the timer keeps a pointer to the element that
+**            points to it. Should be called with the lock held.
+** \param     timer Pointer to the timer to remove.
+**
+****************************************************************************************/
+static void TbxTimerUnlink(tTbxTimer * timer)
+{
+  /* Verify parameter. */
+  TBX_ASSERT((timer != NULL) && (timer->prevNextPtr != NULL));
+
+  /* Only continue if the parameter is valid. */
+  if ((timer != NULL) && (timer->prevNextPtr != NULL))
+  {
+    *timer->prevNextPtr = timer->nextPtr;
+    if (timer->nextPtr != NULL)
+    {
+      timer->nextPtr->prevNextPtr = timer->prevNextPtr;
+    }
+    timer->nextPtr = NULL;
+    timer->prevNextPtr = NULL;
+  }
+} /*** end of TbxTimerUnlink ***/
+
+
+/************************************************************************************//**
+** \brief     Adds the timer to the slot of the timing wheel that belongs to its expire
+**            time. This is the lowest level whose range covers the number of ticks until
+**            the timer expires. Should be called with the lock held.
+** \param     timer Pointer to the timer to add.
+**
+****************************************************************************************/
+static void TbxTimerInsert(tTbxTimer * timer)
+{
+  uint32_t delta;
+  uint32_t shift = 0U;
+  uint32_t slotIdx;
+  uint8_t  level = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(timer != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (timer != NULL)
+  {
+    /* Determine the number of ticks until the timer expires. */
+    delta = timer->expireTime - tbxTimerTime;
+    /* Find the lowest level that covers this number of ticks. */
+    while ( (level < (TBX_CONF_TIMER_WHEEL_LEVELS - 1U)) &&
+            ((delta >> (shift + TBX_CONF_TIMER_WHEEL_BITS)) != 0U) )
+    {
+      level++;
+      shift += TBX_CONF_TIMER_WHEEL_BITS;
+    }
+    slotIdx = (timer->expireTime >> shift) & TBX_TIMER_WHEEL_MASK;
+#if (TBX_TIMER_WHEEL_RANGE_BITS < 32U)
+    /* Even the highest level does not cover this number of ticks? In this case add the
+     * timer to the slot of the highest level that is processed last. Once processed,
+     * the timer is added again, based on its remaining number of ticks.
+     */
+    if ((delta >> TBX_TIMER_WHEEL_RANGE_BITS) != 0U)
+    {
+      slotIdx = (tbxTimerTime >> shift) & TBX_TIMER_WHEEL_MASK;
+    }
+#endif
+    TbxTimerLink(&tbxTimerWheel[level][slotIdx], timer);
+  }
+} /*** end of TbxTimerInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Processes all timers in a slot of the timing wheel. The timers are first
+**            moved to the linked list with pending timers. Afterwards, they are
+**            processed one at a time, each time holding the lock only briefly. A timer
+**            that is stopped in the meantime, is simply no longer pending.
+** \param     slotPtr Pointer to the slot to process.
+** \param     expire TBX_TRUE if the timers in the slot expire and their callback
+**            functions should be called. TBX_FALSE if the timers move to a lower level.
+**
+****************************************************************************************/
+static void TbxTimerProcessSlot(tTbxTimer * * slotPtr,
+                                uint8_t       expire)
+{
+  tTbxTimer         * timer;
+  tTbxTimerCallback   callbackFcn = NULL;
+  void              * context = NULL;
+
+  /* Verify parameter. */
+  TBX_ASSERT(slotPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (slotPtr != NULL)
+  {
+    /* Move all timers of the slot to the linked list with pending timers. */
+    TbxLockEnter(&tbxTimerLock);
+    tbxTimerPending = *slotPtr;
+    if (tbxTimerPending != NULL)
+    {
+      tbxTimerPending->prevNextPtr = &tbxTimerPending;
+    }
+    *slotPtr = NULL;
+    TbxLockExit(&tbxTimerLock);
+    /* Process the pending timers one at a time. */
+    do
+    {
+      TbxLockEnter(&tbxTimerLock);
+      timer = tbxTimerPending;
+      if (timer != NULL)
+      {
+        TbxTimerUnlink(timer);
+        /* Timer moves to a lower level? */
+        if (expire == TBX_FALSE)
+        {
+          TbxTimerInsert(timer);
+        }
+        /* Timer expires. */
+        else
+        {
+          /* Restart the timer if it is periodic. The new expire time is based on the
+           * old one, instead of on the tick counter, to prevent drift.
+           */
+          if (timer->period > 0U)
+          {
+            timer->expireTime += timer->period;
+            TbxTimerInsert(timer);
+          }
+          callbackFcn = timer->callbackFcn;
+          context = timer->context;
+        }
+      }
+      TbxLockExit(&tbxTimerLock);
+      /* Call the callback function of the expired timer, without holding the lock. */
+      if ((timer != NULL) && (expire != TBX_FALSE) && (callbackFcn != NULL))
+      {
+        callbackFcn(timer, context);
+      }
+    }
+    while (timer != NULL);
+  }
+} /*** end of TbxTimerProcessSlot ***/
+
+
+/*********************************** end of tbx_timer.c ********************************/
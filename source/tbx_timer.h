@@ -0,0 +1,160 @@
+/************************************************************************************//**
+* \file         tbx_timer.h
+* \brief        Software timers header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_TIMER_H
+#define TBX_TIMER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_TIMER_POOL_SIZE
+/** \brief Number of timers that the dedicated memory pool for the timer objects holds.
+ *         It is the maximum number of timers that can exist at the same time. Note that
+ *         it is possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_TIMER_POOL_SIZE                 (8U)
+#endif
+
+#if ((TBX_CONF_TIMER_POOL_SIZE < 1U) || (TBX_CONF_TIMER_POOL_SIZE > 65535U))
+#error "TBX_CONF_TIMER_POOL_SIZE must be in the range 1..65535."
+#endif
+
+#ifndef TBX_CONF_TIMER_WHEEL_BITS
+/** \brief Number of tick bits that each level of the timing wheel covers. Each level has
+ *         2^TBX_CONF_TIMER_WHEEL_BITS slots. Note that it is possible to override this
+ *         value by adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_TIMER_WHEEL_BITS                (6U)
+#endif
+
+#ifndef TBX_CONF_TIMER_WHEEL_LEVELS
+/** \brief Number of levels of the timing wheel. Timers that expire further in the future
+ *         than the levels cover, are moved to the right slot later on. Each level takes
+ *         2^TBX_CONF_TIMER_WHEEL_BITS pointers of RAM. Note that it is possible to
+ *         override this value by adding this macro definition to the configuration
+ *         header file.
+ */
+#define TBX_CONF_TIMER_WHEEL_LEVELS              (4U)
+#endif
+
+#if ((TBX_CONF_TIMER_WHEEL_BITS < 1U) || (TBX_CONF_TIMER_WHEEL_BITS > 8U))
+#error "TBX_CONF_TIMER_WHEEL_BITS must be in the range 1..8."
+#endif
+
+#if ((TBX_CONF_TIMER_WHEEL_LEVELS < 1U) || \
+     ((TBX_CONF_TIMER_WHEEL_LEVELS * TBX_CONF_TIMER_WHEEL_BITS) > 32U))
+#error "TBX_CONF_TIMER_WHEEL_LEVELS must be at least 1 and cover no more than 32 bits."
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Value returned by TbxTimerGetNextExpiry() when no timer is running. */
+#define TBX_TIMER_NO_EXPIRY                      (0xFFFFFFFFU)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/* Forward declaration of the timer type, for use in the callback function type. */
+struct t_tbx_timer;
+
+/** \brief Callback function that is called when a timer expires. It is called from the
+ *         context that calls TbxTimerTick(). The timer parameter is the timer that
+ *         expired and the context parameter is the one that was passed to
+ *         TbxTimerCreate(). The timer can be started again from the callback function.
+ */
+typedef void (* tTbxTimerCallback)(struct t_tbx_timer * timer,
+                                   void               * context);
+
+/** \brief Layout of a software timer. Its pointer serves as the handle to the timer,
+ *         which is obtained after creation of the timer and which is needed in the other
+ *         functions of this module. Note that its elements should be considered private
+ *         and only be accessed internally by this software timer module.
+ */
+typedef struct t_tbx_timer
+{
+  /** \brief Pointer to the next timer in the same slot of the timing wheel. */
+  struct t_tbx_timer   * nextPtr;
+  /** \brief Pointer to the element that points to this timer. This is either the slot
+   *         itself or the nextPtr element of the previous timer in the slot. It is NULL
+   *         if the timer is not running.
+   */
+  struct t_tbx_timer * * prevNextPtr;
+  /** \brief Tick counter value at which the timer expires. */
+  uint32_t               expireTime;
+  /** \brief Number of ticks after which the timer restarts, or 0 for a one-shot timer. */
+  uint32_t               period;
+  /** \brief Function that is called when the timer expires. */
+  tTbxTimerCallback      callbackFcn;
+  /** \brief Context that is passed to the callback function. */
+  void                 * context;
+} tTbxTimer;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxTimer * TbxTimerCreate       (tTbxTimerCallback         callbackFcn,
+                                  void                    * context);
+
+void        TbxTimerDelete       (tTbxTimer               * timer);
+
+void        TbxTimerStart        (tTbxTimer               * timer,
+                                  uint32_t                  ticks,
+                                  uint32_t                  period);
+
+void        TbxTimerStop         (tTbxTimer               * timer);
+
+uint8_t     TbxTimerIsRunning    (tTbxTimer         const * timer);
+
+void        TbxTimerTick         (void);
+
+uint32_t    TbxTimerGetTime      (void);
+
+uint32_t    TbxTimerGetNextExpiry(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_TIMER_H */
+/*********************************** end of tbx_timer.h ********************************/
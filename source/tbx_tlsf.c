@@ -0,0 +1,903 @@
+/************************************************************************************//**
+* \file         tbx_tlsf.c
+* \brief        Two-level segregated fit memory allocator source file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "microtbx.h"                            /* MicroTBX global header             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Flag in the size value of a block, which marks that the block is free. */
+#define TBX_TLSF_BLOCK_FREE_FLAG                 ((size_t)1U)
+
+/** \brief Alignment of the blocks and of their sizes in bytes. */
+#define TBX_TLSF_ALIGN_SIZE                      ((size_t)1U << TBX_TLSF_ALIGN_LOG2)
+
+/** \brief Number of bytes of the header of a block. The data of the block follows
+ *         directly after it.
+ */
+#define TBX_TLSF_BLOCK_HEADER_SIZE               (offsetof(tTbxTlsfBlock, nextFreePtr))
+
+/** \brief Smallest number of data bytes of a block. It must at least fit the pointers of
+ *         the free list, while the block is free.
+ */
+#define TBX_TLSF_BLOCK_SIZE_MIN                  (sizeof(tTbxTlsfBlock) - \
+                                                  TBX_TLSF_BLOCK_HEADER_SIZE)
+
+/** \brief Largest number of data bytes of a block. */
+#define TBX_TLSF_BLOCK_SIZE_MAX                  (((size_t)1U << \
+                                                   TBX_CONF_TLSF_MAX_SIZE_LOG2) - \
+                                                  TBX_TLSF_ALIGN_SIZE)
+
+/** \brief Blocks smaller than this number of bytes are all in the first level size range,
+ *         where the second level free lists are spaced by the alignment.
+ */
+#define TBX_TLSF_SMALL_BLOCK_SIZE                ((size_t)TBX_TLSF_SL_COUNT << \
+                                                  TBX_TLSF_ALIGN_LOG2)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a block. The blocks of one piece of memory are physically adjacent.
+ *         Each block knows its size and the block that physically precedes it, which
+ *         makes it possible to merge a released block with its free neighbors in
+ *         constant time. A sentinel block with a size of zero and that is never free,
+ *         marks the end of the piece of memory.
+ */
+typedef struct t_tbx_tlsf_block
+{
+  /** \brief Pointer to the block that physically precedes this block or NULL if it is
+   *         the first block in its piece of memory.
+   */
+  struct t_tbx_tlsf_block * prevPhysPtr;
+  /** \brief Number of data bytes of the block. Bit 0 holds TBX_TLSF_BLOCK_FREE_FLAG. */
+  size_t                    size;
+  /** \brief Pointer to the next block in the free list. Only valid while the block is
+   *         free, because it is stored in the data area of the block.
+   */
+  struct t_tbx_tlsf_block * nextFreePtr;
+  /** \brief Pointer to the previous block in the free list. Only valid while the block
+   *         is free, because it is stored in the data area of the block.
+   */
+  struct t_tbx_tlsf_block * prevFreePtr;
+} tTbxTlsfBlock;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+static tTbxTlsf      * TbxTlsfGetDefault     (void);
+#endif
+
+static size_t          TbxTlsfGetAlignPadding(void          const * memPtr);
+
+static uint32_t        TbxTlsfFls            (size_t                value);
+
+static uint32_t        TbxTlsfFfs            (uint32_t              value);
+
+static void            TbxTlsfMappingInsert  (size_t                size,
+                                              uint32_t            * flIdx,
+                                              uint32_t            * slIdx);
+
+static void            TbxTlsfMappingSearch  (size_t                size,
+                                              uint32_t            * flIdx,
+                                              uint32_t            * slIdx);
+
+static tTbxTlsfBlock * TbxTlsfBlockFind      (tTbxTlsf      const * tlsf,
+                                              uint32_t              flIdx,
+                                              uint32_t              slIdx);
+
+static void            TbxTlsfBlockInsert    (tTbxTlsf            * tlsf,
+                                              tTbxTlsfBlock       * block);
+
+static void            TbxTlsfBlockRemove    (tTbxTlsf            * tlsf,
+                                              tTbxTlsfBlock       * block);
+
+static size_t          TbxTlsfBlockGetSize   (tTbxTlsfBlock const * block);
+
+static uint8_t         TbxTlsfBlockIsFree    (tTbxTlsfBlock const * block);
+
+static tTbxTlsfBlock * TbxTlsfBlockGetNext   (tTbxTlsfBlock       * block);
+
+static void            TbxTlsfLockEnter      (tTbxTlsf      const * tlsf);
+
+static void            TbxTlsfLockExit       (tTbxTlsf      const * tlsf);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+/** \brief The default TLSF allocator. Created on the heap upon its first use. */
+static tTbxTlsf * tbxTlsfDefault = NULL;
+
+/** \brief Lock object for creating the default TLSF allocator only once. */
+static tTbxLock   tbxTlsfDefaultLock = TBX_LOCK_INIT;
+#endif
+
+
+/************************************************************************************//**
+** \brief     Creates a new two-level segregated fit (TLSF) allocator in the specified
+**            memory. Contrary to the heap, memory allocated with a TLSF allocator can be
+**            released again. Contrary to the memory pools, the blocks can have any size.
+**            Both allocating and releasing take constant time and the fragmentation is
+**            bounded, because a released block is immediately merged with its free
+**            neighbors and an allocation always picks a free block from the smallest
+**            fitting size range. The control data of the allocator is stored at the
+**            start of the memory. The memory can for example be a byte array placed in a
+**            specific RAM area, or memory that was allocated from the heap or a heap
+**            region.
+** \param     memPtr Pointer to the start of the memory for the allocator.
+** \param     size The size of the memory in bytes.
+** \return    Handle to the newly created allocator if successful, NULL otherwise for
+**            example when the memory is too small.
+**
+****************************************************************************************/
+tTbxTlsf * TbxTlsfCreate(void   * memPtr,
+                         size_t   size)
+{
+  tTbxTlsf * result = NULL;
+  size_t     padding;
+  size_t     ctrlSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (memPtr != NULL) && (size > 0U) )
+  {
+    /* Determine the number of bytes to skip at the start of the memory to align the
+     * control data, and the number of bytes that the control data occupies such that
+     * the memory after it is also aligned.
+     */
+    padding = TbxTlsfGetAlignPadding(memPtr);
+    ctrlSize = (sizeof(tTbxTlsf) + (TBX_TLSF_ALIGN_SIZE - 1U)) &
+               ~(TBX_TLSF_ALIGN_SIZE - 1U);
+    /* Only continue if the memory is large enough to hold the control data. */
+    if (size > (padding + ctrlSize))
+    {
+      /* Place the control data of the allocator at the start of the memory. */
+      tTbxTlsf * tlsf = (tTbxTlsf *)(void *)&((uint8_t *)memPtr)[padding];
+      /* Initialize the allocator without any free blocks. */
+      tlsf->flBitmap = 0U;
+      for (size_t flIdx = 0U; flIdx < TBX_TLSF_FL_COUNT; flIdx++)
+      {
+        tlsf->slBitmap[flIdx] = 0U;
+        for (size_t slIdx = 0U; slIdx < TBX_TLSF_SL_COUNT; slIdx++)
+        {
+          tlsf->freeListPtr[flIdx][slIdx] = NULL;
+        }
+      }
+      tlsf->freeSize = 0U;
+      /* Initialize the lock object of the allocator. */
+      TbxLockInit(&tlsf->lock);
+      tlsf->lockPtr = &tlsf->lock;
+      /* Add the rest of the memory to the allocator. */
+      if (TbxTlsfAddMemory(tlsf, &((uint8_t *)memPtr)[padding + ctrlSize],
+                           size - padding - ctrlSize) == TBX_OK)
+      {
+        /* Update the result for success. */
+        result = tlsf;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Adds another piece of memory to a TLSF allocator. This makes it possible to
+**            have one allocator for multiple RAM areas that are not adjacent. A
+**            piece of memory that is larger than what fits in one block, as configured
+**            with TBX_CONF_TLSF_MAX_SIZE_LOG2, is split into multiple pieces. Each piece
+**            is terminated by its own sentinel block, such that a released block is
+**            never merged across the boundary of its piece. This keeps every merged
+**            block within the maximum block size.
+** \param     tlsf Handle to the TLSF allocator to operate on. NULL for the default TLSF
+**            allocator.
+** \param     memPtr Pointer to the start of the memory to add.
+** \param     size The size of the memory in bytes.
+** \return    TBX_OK if successful, TBX_ERROR otherwise for example when the memory is
+**            too small to hold at least one block.
+**
+****************************************************************************************/
+uint8_t TbxTlsfAddMemory(tTbxTlsf * tlsf,
+                         void     * memPtr,
+                         size_t     size)
+{
+  uint8_t         result = TBX_ERROR;
+  tTbxTlsf      * tlsfPtr = tlsf;
+  tTbxTlsfBlock * block;
+  tTbxTlsfBlock * sentinelBlock;
+  uint8_t       * bytePtr;
+  size_t          padding;
+  size_t          areaSize;
+  size_t          blockSize;
+
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+  /* Use the default TLSF allocator, if no allocator was specified. */
+  if (tlsfPtr == NULL)
+  {
+    tlsfPtr = TbxTlsfGetDefault();
+  }
+#endif
+
+  /* Verify parameters. */
+  TBX_ASSERT(tlsfPtr != NULL);
+  TBX_ASSERT(memPtr != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if ( (tlsfPtr != NULL) && (memPtr != NULL) && (size > 0U) )
+  {
+    /* Determine the number of bytes to skip at the start of the memory to align the
+     * first block.
+     */
+    padding = TbxTlsfGetAlignPadding(memPtr);
+    /* Only continue if the memory is large enough to hold at least one block, followed
+     * by the header of the sentinel block.
+     */
+    if (size >= (padding + (2U * TBX_TLSF_BLOCK_HEADER_SIZE) + TBX_TLSF_BLOCK_SIZE_MIN))
+    {
+      /* Determine the number of bytes available for blocks and their sentinel blocks,
+       * rounded down to the alignment.
+       */
+      areaSize = (size - padding) & ~(TBX_TLSF_ALIGN_SIZE - 1U);
+      bytePtr = &((uint8_t *)memPtr)[padding];
+      /* Obtain mutual exclusive access to the allocator. */
+      TbxTlsfLockEnter(tlsfPtr);
+      /* Carve the pieces from the memory, each with one free block. Usually just one,
+       * unless the memory is larger than the largest possible block.
+       */
+      while (areaSize >= ((2U * TBX_TLSF_BLOCK_HEADER_SIZE) + TBX_TLSF_BLOCK_SIZE_MIN))
+      {
+        blockSize = areaSize - (2U * TBX_TLSF_BLOCK_HEADER_SIZE);
+        if (blockSize > TBX_TLSF_BLOCK_SIZE_MAX)
+        {
+          blockSize = TBX_TLSF_BLOCK_SIZE_MAX;
+        }
+        block = (tTbxTlsfBlock *)(void *)bytePtr;
+        block->prevPhysPtr = NULL;
+        block->size = blockSize;
+        TbxTlsfBlockInsert(tlsfPtr, block);
+        /* Terminate the piece with the sentinel block. It is never free, so the block
+         * is never merged with what follows after it.
+         */
+        bytePtr = &bytePtr[TBX_TLSF_BLOCK_HEADER_SIZE + blockSize];
+        sentinelBlock = (tTbxTlsfBlock *)(void *)bytePtr;
+        sentinelBlock->prevPhysPtr = block;
+        sentinelBlock->size = 0U;
+        bytePtr = &bytePtr[TBX_TLSF_BLOCK_HEADER_SIZE];
+        areaSize -= (2U * TBX_TLSF_BLOCK_HEADER_SIZE) + blockSize;
+      }
+      /* Release mutual exclusive access to the allocator. */
+      TbxTlsfLockExit(tlsfPtr);
+      /* Update the result for success. */
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfAddMemory ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates the desired number of bytes with a TLSF allocator, in constant
+**            time. The start address of the allocated memory is aligned to twice the
+**            address size.
+** \param     tlsf Handle to the TLSF allocator to operate on. NULL for the default TLSF
+**            allocator.
+** \param     size The number of bytes to allocate.
+** \return    Pointer to the start of the newly allocated memory if successful, NULL
+**            otherwise.
+**
+****************************************************************************************/
+void * TbxTlsfAllocate(tTbxTlsf * tlsf,
+                       size_t     size)
+{
+  void          * result = NULL;
+  tTbxTlsf      * tlsfPtr = tlsf;
+  tTbxTlsfBlock * block;
+  tTbxTlsfBlock * remainBlock;
+  size_t          sizeWanted;
+  size_t          blockSize;
+  uint32_t        flIdx;
+  uint32_t        slIdx;
+
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+  /* Use the default TLSF allocator, if no allocator was specified. */
+  if (tlsfPtr == NULL)
+  {
+    tlsfPtr = TbxTlsfGetDefault();
+  }
+#endif
+
+  /* Verify parameters. */
+  TBX_ASSERT(tlsfPtr != NULL);
+  TBX_ASSERT(size > 0U);
+
+  /* Only continue if the parameters are valid and the size could possibly fit. */
+  if ( (tlsfPtr != NULL) && (size > 0U) && (size <= TBX_TLSF_BLOCK_SIZE_MAX) )
+  {
+    /* Align the desired size. This also makes it at least the minimum block size. */
+    sizeWanted = (size + (TBX_TLSF_ALIGN_SIZE - 1U)) & ~(TBX_TLSF_ALIGN_SIZE - 1U);
+    /* Determine the free list from where all blocks are large enough. */
+    TbxTlsfMappingSearch(sizeWanted, &flIdx, &slIdx);
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxTlsfLockEnter(tlsfPtr);
+    /* Find a free block in this or a larger size range. */
+    block = TbxTlsfBlockFind(tlsfPtr, flIdx, slIdx);
+    /* Only continue if a free block was found. */
+    if (block != NULL)
+    {
+      /* Take the block out of its free list. */
+      TbxTlsfBlockRemove(tlsfPtr, block);
+      blockSize = TbxTlsfBlockGetSize(block);
+      /* Split off the part of the block that is not needed, if it is large enough to
+       * form a block by itself, and give it back as a free block.
+       */
+      if (blockSize >= (sizeWanted + TBX_TLSF_BLOCK_HEADER_SIZE + TBX_TLSF_BLOCK_SIZE_MIN))
+      {
+        remainBlock = (tTbxTlsfBlock *)(void *)
+                      &((uint8_t *)block)[TBX_TLSF_BLOCK_HEADER_SIZE + sizeWanted];
+        remainBlock->prevPhysPtr = block;
+        remainBlock->size = blockSize - sizeWanted - TBX_TLSF_BLOCK_HEADER_SIZE;
+        TbxTlsfBlockGetNext(remainBlock)->prevPhysPtr = remainBlock;
+        block->size = sizeWanted;
+        TbxTlsfBlockInsert(tlsfPtr, remainBlock);
+      }
+      /* Set the address for the newly allocated memory. */
+      result = &((uint8_t *)block)[TBX_TLSF_BLOCK_HEADER_SIZE];
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxTlsfLockExit(tlsfPtr);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases the previously allocated memory, in constant time. The block is
+**            merged with the blocks that physically precede and follow it, if these are
+**            free.
+** \param     tlsf Handle to the TLSF allocator that the memory was allocated with. NULL
+**            for the default TLSF allocator.
+** \param     memPtr Pointer to the start of the memory. Basically, the pointer that was
+**            returned by function TbxTlsfAllocate(), when the memory was initially
+**            allocated.
+**
+****************************************************************************************/
+void TbxTlsfRelease(tTbxTlsf * tlsf,
+                    void     * memPtr)
+{
+  tTbxTlsf      * tlsfPtr = tlsf;
+  tTbxTlsfBlock * block = NULL;
+  tTbxTlsfBlock * neighborBlock;
+  size_t          blockSize;
+  size_t          neighborSize;
+
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+  /* Use the default TLSF allocator, if no allocator was specified. */
+  if (tlsfPtr == NULL)
+  {
+    tlsfPtr = TbxTlsfGetDefault();
+  }
+#endif
+
+  /* Determine the block that the memory belongs to. */
+  if (memPtr != NULL)
+  {
+    block = (tTbxTlsfBlock *)(void *)
+            &((uint8_t *)memPtr)[-(ptrdiff_t)TBX_TLSF_BLOCK_HEADER_SIZE];
+  }
+
+  /* Verify parameters. */
+  TBX_ASSERT(tlsfPtr != NULL);
+  TBX_ASSERT(block != NULL);
+
+  /* Only continue if the parameters are valid. */
+  if ( (tlsfPtr != NULL) && (block != NULL) )
+  {
+    /* Obtain mutual exclusive access to the allocator. */
+    TbxTlsfLockEnter(tlsfPtr);
+    /* Sanity check. The block should currently be allocated. */
+    TBX_ASSERT(TbxTlsfBlockIsFree(block) == TBX_FALSE);
+    /* Only continue if the sanity check passed. */
+    if (TbxTlsfBlockIsFree(block) == TBX_FALSE)
+    {
+      blockSize = TbxTlsfBlockGetSize(block);
+      /* Merge with the block that physically precedes it, if that one is free. Note
+       * that the merged block cannot become too large, because the sentinel blocks
+       * keep each piece of memory within the maximum block size.
+       */
+      neighborBlock = block->prevPhysPtr;
+      if ( (neighborBlock != NULL) && (TbxTlsfBlockIsFree(neighborBlock) == TBX_TRUE) )
+      {
+        neighborSize = TbxTlsfBlockGetSize(neighborBlock);
+        TbxTlsfBlockRemove(tlsfPtr, neighborBlock);
+        blockSize += neighborSize + TBX_TLSF_BLOCK_HEADER_SIZE;
+        neighborBlock->size = blockSize;
+        block = neighborBlock;
+      }
+      /* Merge with the block that physically follows it, if that one is free. Note
+       * that there is always a next block, because a sentinel block terminates each
+       * piece of memory.
+       */
+      neighborBlock = TbxTlsfBlockGetNext(block);
+      if (TbxTlsfBlockIsFree(neighborBlock) == TBX_TRUE)
+      {
+        neighborSize = TbxTlsfBlockGetSize(neighborBlock);
+        TbxTlsfBlockRemove(tlsfPtr, neighborBlock);
+        blockSize += neighborSize + TBX_TLSF_BLOCK_HEADER_SIZE;
+        block->size = blockSize;
+      }
+      /* Link the block that now physically follows back to the released block. */
+      TbxTlsfBlockGetNext(block)->prevPhysPtr = block;
+      /* Insert the block into its free list, such that it can be allocated again. */
+      TbxTlsfBlockInsert(tlsfPtr, block);
+    }
+    /* Release mutual exclusive access to the allocator. */
+    TbxTlsfLockExit(tlsfPtr);
+  }
+} /*** end of TbxTlsfRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of bytes in the free blocks of a TLSF allocator.
+**            Note that due to fragmentation, the largest possible allocation can be
+**            smaller.
+** \param     tlsf Handle to the TLSF allocator to operate on. NULL for the default TLSF
+**            allocator.
+** \return    Number of free bytes.
+**
+****************************************************************************************/
+size_t TbxTlsfGetFree(tTbxTlsf const * tlsf)
+{
+  size_t           result = 0U;
+  tTbxTlsf const * tlsfPtr = tlsf;
+
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+  /* Use the default TLSF allocator, if no allocator was specified. */
+  if (tlsfPtr == NULL)
+  {
+    tlsfPtr = TbxTlsfGetDefault();
+  }
+#endif
+
+  /* Verify parameter. */
+  TBX_ASSERT(tlsfPtr != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (tlsfPtr != NULL)
+  {
+    /* Read the number of free bytes with mutual exclusive access to the allocator. */
+    TbxTlsfLockEnter(tlsfPtr);
+    result = tlsfPtr->freeSize;
+    TbxTlsfLockExit(tlsfPtr);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfGetFree ***/
+
+
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Obtains the default TLSF allocator. It is created upon the first call of
+**            this function, in TBX_CONF_TLSF_HEAP_SIZE bytes allocated from the heap.
+** \return    Handle to the default TLSF allocator if successful, NULL otherwise for
+**            example when there is not enough space available on the heap.
+**
+****************************************************************************************/
+static tTbxTlsf * TbxTlsfGetDefault(void)
+{
+  void * memPtr;
+
+  /* Create the default TLSF allocator, if not yet done. */
+  TbxLockEnter(&tbxTlsfDefaultLock);
+  if (tbxTlsfDefault == NULL)
+  {
+    memPtr = TbxHeapAllocate(TBX_CONF_TLSF_HEAP_SIZE);
+    if (memPtr != NULL)
+    {
+      tbxTlsfDefault = TbxTlsfCreate(memPtr, TBX_CONF_TLSF_HEAP_SIZE);
+    }
+  }
+  TbxLockExit(&tbxTlsfDefaultLock);
+
+  /* Give the result back to the caller. */
+  return tbxTlsfDefault;
+} /*** end of TbxTlsfGetDefault ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Determines the number of bytes to add to the specified address to align it
+**            to the alignment of the blocks.
+** \param     memPtr The address to align.
+** \return    Number of bytes to add to the address to align it.
+**
+****************************************************************************************/
+static size_t TbxTlsfGetAlignPadding(void const * memPtr)
+{
+  size_t    result = 0U;
+  uintptr_t misalignment;
+
+  /* Determine by how many bytes the address is past the previous aligned address. */
+  misalignment = (uintptr_t)memPtr & (uintptr_t)(TBX_TLSF_ALIGN_SIZE - 1U);
+  /* Calculate the number of bytes to the next aligned address, if not yet aligned. */
+  if (misalignment != 0U)
+  {
+    result = TBX_TLSF_ALIGN_SIZE - (size_t)misalignment;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfGetAlignPadding ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the bit number of the most significant bit that is set. It
+**            uses a binary search, so it takes the same number of steps for all values.
+** \param     value The value to search in. Must be non-zero and fit in 32 bits.
+** \return    Bit number of the most significant bit that is set.
+**
+****************************************************************************************/
+static uint32_t TbxTlsfFls(size_t value)
+{
+  uint32_t result = 0U;
+  uint32_t bits = (uint32_t)value;
+
+  /* Halve the number of bits to search in with each step. */
+  if ((bits & 0xFFFF0000U) != 0U)
+  {
+    bits >>= 16U;
+    result += 16U;
+  }
+  if ((bits & 0x0000FF00U) != 0U)
+  {
+    bits >>= 8U;
+    result += 8U;
+  }
+  if ((bits & 0x000000F0U) != 0U)
+  {
+    bits >>= 4U;
+    result += 4U;
+  }
+  if ((bits & 0x0000000CU) != 0U)
+  {
+    bits >>= 2U;
+    result += 2U;
+  }
+  if ((bits & 0x00000002U) != 0U)
+  {
+    result += 1U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfFls ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the bit number of the least significant bit that is set.
+** \param     value The value to search in. Must be non-zero.
+** \return    Bit number of the least significant bit that is set.
+**
+****************************************************************************************/
+static uint32_t TbxTlsfFfs(uint32_t value)
+{
+  /* Isolate the least significant bit that is set and determine its bit number. */
+  return TbxTlsfFls((size_t)(value & (~value + 1U)));
+} /*** end of TbxTlsfFfs ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the free list that a free block of the specified size belongs
+**            in.
+** \param     size Number of data bytes of the block.
+** \param     flIdx Pointer to where the first level index is written to.
+** \param     slIdx Pointer to where the second level index is written to.
+**
+****************************************************************************************/
+static void TbxTlsfMappingInsert(size_t     size,
+                                 uint32_t * flIdx,
+                                 uint32_t * slIdx)
+{
+  uint32_t msb;
+
+  /* Small blocks are all in the first size range, in linear steps of the alignment. */
+  if (size < TBX_TLSF_SMALL_BLOCK_SIZE)
+  {
+    *flIdx = 0U;
+    *slIdx = (uint32_t)(size >> TBX_TLSF_ALIGN_LOG2);
+  }
+  /* Larger blocks are in a size range per power of two. The bits just below the most
+   * significant bit select the free list within the size range.
+   */
+  else
+  {
+    msb = TbxTlsfFls(size);
+    *slIdx = (uint32_t)(size >> (msb - TBX_TLSF_SL_LOG2)) ^ TBX_TLSF_SL_COUNT;
+    *flIdx = msb - (TBX_TLSF_SL_LOG2 + TBX_TLSF_ALIGN_LOG2) + 1U;
+  }
+} /*** end of TbxTlsfMappingInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the first free list that only holds free blocks of at least the
+**            specified size. The size is rounded up to the start of the next free list,
+**            unless it already is the start of a free list. This way, whichever free
+**            block the search comes up with, it is always large enough.
+** \param     size Number of data bytes that the block should at least have.
+** \param     flIdx Pointer to where the first level index is written to. Note that it
+**            is equal to or larger than TBX_TLSF_FL_COUNT, if no free list exists with
+**            blocks this large.
+** \param     slIdx Pointer to where the second level index is written to.
+**
+****************************************************************************************/
+static void TbxTlsfMappingSearch(size_t     size,
+                                 uint32_t * flIdx,
+                                 uint32_t * slIdx)
+{
+  size_t sizeRounded = size;
+
+  /* Round up the size to the start of the next free list, if it is a large block. */
+  if (sizeRounded >= TBX_TLSF_SMALL_BLOCK_SIZE)
+  {
+    sizeRounded += ((size_t)1U << (TbxTlsfFls(sizeRounded) - TBX_TLSF_SL_LOG2)) - 1U;
+  }
+  /* Determine the free list of the rounded size. */
+  TbxTlsfMappingInsert(sizeRounded, flIdx, slIdx);
+} /*** end of TbxTlsfMappingSearch ***/
+
+
+/************************************************************************************//**
+** \brief     Finds a free block in the specified free list or, if that one is empty, in
+**            the first non-empty free list after it. The bitmaps make this a constant
+**            time operation.
+** \param     tlsf Handle to the TLSF allocator to operate on.
+** \param     flIdx First level index of the free list to start at.
+** \param     slIdx Second level index of the free list to start at.
+** \return    Pointer to the free block if found, NULL otherwise.
+**
+****************************************************************************************/
+static tTbxTlsfBlock * TbxTlsfBlockFind(tTbxTlsf const * tlsf,
+                                        uint32_t         flIdx,
+                                        uint32_t         slIdx)
+{
+  tTbxTlsfBlock * result = NULL;
+  uint32_t        flFound = flIdx;
+  uint32_t        slMap = 0U;
+  uint32_t        flMap = 0U;
+
+  /* Only continue if the size range exists. */
+  if (flFound < TBX_TLSF_FL_COUNT)
+  {
+    /* Look for a non-empty free list in the same size range first. */
+    slMap = tlsf->slBitmap[flFound] & (UINT32_MAX << slIdx);
+    /* If there is none, look for a non-empty size range after it. */
+    if (slMap == 0U)
+    {
+      if ((flFound + 1U) < TBX_TLSF_FL_COUNT)
+      {
+        flMap = tlsf->flBitmap & (UINT32_MAX << (flFound + 1U));
+      }
+      if (flMap != 0U)
+      {
+        flFound = TbxTlsfFfs(flMap);
+        slMap = tlsf->slBitmap[flFound];
+      }
+    }
+    /* Take the first free block of the first non-empty free list, if any. */
+    if (slMap != 0U)
+    {
+      result = tlsf->freeListPtr[flFound][TbxTlsfFfs(slMap)];
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfBlockFind ***/
+
+
+/************************************************************************************//**
+** \brief     Inserts a block at the start of the free list that it belongs in and marks
+**            the block as free.
+** \param     tlsf Handle to the TLSF allocator to operate on.
+** \param     block Pointer to the block.
+**
+****************************************************************************************/
+static void TbxTlsfBlockInsert(tTbxTlsf      * tlsf,
+                               tTbxTlsfBlock * block)
+{
+  size_t   blockSize = TbxTlsfBlockGetSize(block);
+  uint32_t flIdx;
+  uint32_t slIdx;
+
+  /* Determine the free list that the block belongs in. */
+  TbxTlsfMappingInsert(blockSize, &flIdx, &slIdx);
+  /* Link the block at the start of the free list. */
+  block->nextFreePtr = tlsf->freeListPtr[flIdx][slIdx];
+  block->prevFreePtr = NULL;
+  if (block->nextFreePtr != NULL)
+  {
+    block->nextFreePtr->prevFreePtr = block;
+  }
+  tlsf->freeListPtr[flIdx][slIdx] = block;
+  /* Flag that the free list and its size range are no longer empty. */
+  tlsf->flBitmap |= ((uint32_t)1U << flIdx);
+  tlsf->slBitmap[flIdx] |= ((uint32_t)1U << slIdx);
+  /* Mark the block as free and update the number of free bytes. */
+  block->size = blockSize | TBX_TLSF_BLOCK_FREE_FLAG;
+  tlsf->freeSize += blockSize;
+} /*** end of TbxTlsfBlockInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Removes a block from the free list that it is in and marks the block as
+**            allocated.
+** \param     tlsf Handle to the TLSF allocator to operate on.
+** \param     block Pointer to the block.
+**
+****************************************************************************************/
+static void TbxTlsfBlockRemove(tTbxTlsf      * tlsf,
+                               tTbxTlsfBlock * block)
+{
+  size_t   blockSize = TbxTlsfBlockGetSize(block);
+  uint32_t flIdx;
+  uint32_t slIdx;
+
+  /* Determine the free list that the block is in. */
+  TbxTlsfMappingInsert(blockSize, &flIdx, &slIdx);
+  /* Unlink the block from the free list. */
+  if (block->prevFreePtr != NULL)
+  {
+    block->prevFreePtr->nextFreePtr = block->nextFreePtr;
+  }
+  else
+  {
+    tlsf->freeListPtr[flIdx][slIdx] = block->nextFreePtr;
+  }
+  if (block->nextFreePtr != NULL)
+  {
+    block->nextFreePtr->prevFreePtr = block->prevFreePtr;
+  }
+  /* Flag the free list and possibly its size range as empty, if this was its last
+   * block.
+   */
+  if (tlsf->freeListPtr[flIdx][slIdx] == NULL)
+  {
+    tlsf->slBitmap[flIdx] &= ~((uint32_t)1U << slIdx);
+    if (tlsf->slBitmap[flIdx] == 0U)
+    {
+      tlsf->flBitmap &= ~((uint32_t)1U << flIdx);
+    }
+  }
+  /* Mark the block as allocated and update the number of free bytes. */
+  block->size = blockSize;
+  tlsf->freeSize -= blockSize;
+} /*** end of TbxTlsfBlockRemove ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of data bytes of a block.
+** \param     block Pointer to the block.
+** \return    Number of data bytes of the block.
+**
+****************************************************************************************/
+static size_t TbxTlsfBlockGetSize(tTbxTlsfBlock const * block)
+{
+  /* Mask out the flag. */
+  return block->size & ~TBX_TLSF_BLOCK_FREE_FLAG;
+} /*** end of TbxTlsfBlockGetSize ***/
+
+
+/************************************************************************************//**
+** \brief     Determines if a block is free.
+** \param     block Pointer to the block.
+** \return    TBX_TRUE if the block is free, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t TbxTlsfBlockIsFree(tTbxTlsfBlock const * block)
+{
+  uint8_t result = TBX_FALSE;
+
+  /* Check the flag. */
+  if ((block->size & TBX_TLSF_BLOCK_FREE_FLAG) != 0U)
+  {
+    result = TBX_TRUE;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of TbxTlsfBlockIsFree ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the block that physically follows a block.
+** \param     block Pointer to the block.
+** \return    Pointer to the block that physically follows it.
+**
+****************************************************************************************/
+static tTbxTlsfBlock * TbxTlsfBlockGetNext(tTbxTlsfBlock * block)
+{
+  /* The next block starts directly after the data of this block. */
+  return (tTbxTlsfBlock *)(void *)
+         &((uint8_t *)block)[TBX_TLSF_BLOCK_HEADER_SIZE + TbxTlsfBlockGetSize(block)];
+} /*** end of TbxTlsfBlockGetNext ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains mutual exclusive access to the TLSF allocator.
+** \param     tlsf Handle to the TLSF allocator to operate on.
+**
+****************************************************************************************/
+static void TbxTlsfLockEnter(tTbxTlsf const * tlsf)
+{
+  /* Enter the lock object of the allocator. Note that it is accessed through its
+   * pointer, which makes this also possible for functions that only have read access to
+   * the allocator. Without native lock objects, it falls back to the global critical
+   * section.
+   */
+  TbxLockEnter(tlsf->lockPtr);
+} /*** end of TbxTlsfLockEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Releases mutual exclusive access to the TLSF allocator.
+** \param     tlsf Handle to the TLSF allocator to operate on.
+**
+****************************************************************************************/
+static void TbxTlsfLockExit(tTbxTlsf const * tlsf)
+{
+  /* Exit the lock object of the allocator. */
+  TbxLockExit(tlsf->lockPtr);
+} /*** end of TbxTlsfLockExit ***/
+
+
+/*********************************** end of tbx_tlsf.c *********************************/
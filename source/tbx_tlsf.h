@@ -0,0 +1,154 @@
+/************************************************************************************//**
+* \file         tbx_tlsf.h
+* \brief        Two-level segregated fit memory allocator header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2026 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+*
+* SPDX-License-Identifier: MIT
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+#ifndef TBX_TLSF_H
+#define TBX_TLSF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/****************************************************************************************
+* Configuration macros
+****************************************************************************************/
+#ifndef TBX_CONF_TLSF_HEAP_SIZE
+/** \brief Configure the number of bytes that the default TLSF allocator takes from the
+ *         heap, upon its first use. The default TLSF allocator is the one that is used
+ *         when passing NULL as the allocator to the TbxTlsfXxx() functions. A value of
+ *         zero disables the default TLSF allocator. Note that it is possible to override
+ *         this value by adding this macro definition to the configuration header file.
+ */
+#define TBX_CONF_TLSF_HEAP_SIZE                  (0U)
+#endif
+
+#ifndef TBX_CONF_TLSF_MAX_SIZE_LOG2
+/** \brief Configure the base two logarithm of the upper limit of the block size that a
+ *         TLSF allocator manages. Memory that is added to the allocator in one piece
+ *         larger than this limit, is split into multiple pieces, each terminated by a
+ *         sentinel block. Each increment doubles the largest possible allocation, at the
+ *         cost of 16 pointers and one 32-bit bitmap of RAM per TLSF allocator. Note that
+ *         it is possible to override this value by adding this macro definition to the
+ *         configuration header file.
+ */
+#define TBX_CONF_TLSF_MAX_SIZE_LOG2              (16U)
+#endif
+
+#if ((TBX_CONF_TLSF_MAX_SIZE_LOG2 < 10U) || (TBX_CONF_TLSF_MAX_SIZE_LOG2 > 31U))
+#error "TBX_CONF_TLSF_MAX_SIZE_LOG2 must be in the range 10..31."
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Base two logarithm of the number of second level free lists, into which each
+ *         first level size range is subdivided.
+ */
+#define TBX_TLSF_SL_LOG2                         (4U)
+
+/** \brief Number of second level free lists per first level size range. */
+#define TBX_TLSF_SL_COUNT                        (1U << TBX_TLSF_SL_LOG2)
+
+/** \brief Base two logarithm of the alignment of the blocks. The blocks are aligned to
+ *         twice the address size, which matches what malloc() guarantees.
+ */
+#define TBX_TLSF_ALIGN_LOG2                      ((sizeof(void *) > 4U) ? 4U : \
+                                                  ((sizeof(void *) > 2U) ? 3U : 2U))
+
+/** \brief Number of first level size ranges. The first one holds all blocks that are
+ *         smaller than (TBX_TLSF_SL_COUNT << TBX_TLSF_ALIGN_LOG2) bytes, in linear
+ *         steps of the alignment. Each next one covers twice the sizes of the previous.
+ */
+#define TBX_TLSF_FL_COUNT                        (TBX_CONF_TLSF_MAX_SIZE_LOG2 - \
+                                                  (TBX_TLSF_SL_LOG2 + \
+                                                   TBX_TLSF_ALIGN_LOG2) + 1U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Layout of a two-level segregated fit (TLSF) allocator. Its pointer serves as
+ *         the handle to the allocator, which is obtained after creation of the
+ *         allocator and which is needed in the other TbxTlsfXxx() functions. Note that
+ *         its elements should be considered private and only be accessed internally by
+ *         this TLSF module.
+ */
+typedef struct
+{
+  /** \brief Bitmap with one bit per first level size range. A bit is set if at least
+   *         one of the free lists of that size range holds a free block.
+   */
+  uint32_t                  flBitmap;
+  /** \brief Bitmaps with one bit per second level free list. A bit is set if that free
+   *         list holds a free block.
+   */
+  uint32_t                  slBitmap[TBX_TLSF_FL_COUNT];
+  /** \brief Heads of the free lists, indexed by first and second level. */
+  struct t_tbx_tlsf_block * freeListPtr[TBX_TLSF_FL_COUNT][TBX_TLSF_SL_COUNT];
+  /** \brief Total number of bytes in the free blocks. */
+  size_t                    freeSize;
+  /** \brief Lock object for mutual exclusive access to the allocator. */
+  tTbxLock                  lock;
+  /** \brief Pointer to the lock object. Needed for obtaining mutual exclusive access in
+   *         functions that only have read access to the allocator.
+   */
+  tTbxLock                * lockPtr;
+} tTbxTlsf;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tTbxTlsf * TbxTlsfCreate   (void           * memPtr,
+                            size_t           size);
+
+uint8_t    TbxTlsfAddMemory(tTbxTlsf       * tlsf,
+                            void           * memPtr,
+                            size_t           size);
+
+void     * TbxTlsfAllocate (tTbxTlsf       * tlsf,
+                            size_t           size);
+
+void       TbxTlsfRelease  (tTbxTlsf       * tlsf,
+                            void           * memPtr);
+
+size_t     TbxTlsfGetFree  (tTbxTlsf const * tlsf);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TBX_TLSF_H */
+/*********************************** end of tbx_tlsf.h *********************************/
@@ -53,6 +53,107 @@ extern "C" {
 #define TBX_CONF_HEAP_SIZE                       (2048U)
 
 
+/****************************************************************************************
+*   M E M O R Y   P O O L   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Largest block size in bytes that is covered by the size-class index of the
+ *         memory pools. Allocating from and releasing to such memory pools is done in
+ *         constant time. Costs one pointer of RAM per byte. Set to 0 to disable.
+ */
+#define TBX_CONF_MEMPOOL_INDEX_MAX_SIZE          (0U)
+
+/** \brief Maximum number of recently released blocks that each thread or core keeps in
+ *         its own cache, per memory pool. Only supported on the LINUX and RP2040 ports.
+ *         Set to 0 to disable.
+ */
+#define TBX_CONF_MEMPOOL_CACHE_SIZE              (0U)
+
+/** \brief Enable/disable the statistics of the memory pools, which can be read with
+ *         TbxMemPoolGetStats().
+ */
+#define TBX_CONF_MEMPOOL_STATS_ENABLE            (0U)
+
+/** \brief Number of size classes between two successive powers of two, as used by
+ *         TbxMemPoolGetSizeClass(), pvPortMalloc() and operator new. Must be zero or a
+ *         power of two. Set to 0 to disable the rounding to size classes.
+ */
+#define TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS        (4U)
+
+/** \brief Enable/disable the rounding of block sizes to size classes inside
+ *         TbxMemPoolCreate() and TbxMemPoolAllocate().
+ */
+#define TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE       (0U)
+
+
+/****************************************************************************************
+*   T L S F   A L L O C A T O R   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Number of bytes that the default TLSF allocator takes from the heap, upon its
+ *         first use. Set to 0 to disable the default TLSF allocator.
+ */
+#define TBX_CONF_TLSF_HEAP_SIZE                  (0U)
+
+/** \brief Base two logarithm of the upper limit of the block size that a TLSF allocator
+ *         manages.
+ */
+#define TBX_CONF_TLSF_MAX_SIZE_LOG2              (16U)
+
+
+/****************************************************************************************
+*   C R O S S - C O R E   C H A N N E L   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Number of released blocks that a core collects, before it returns them all at
+ *         once to the core that sent them.
+ */
+#define TBX_CONF_CHANNEL_BATCH_SIZE              (8U)
+
+
+/****************************************************************************************
+*   L I N K E D   L I S T   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Number of nodes that the memory pool for the linked list nodes is extended
+ *         with at once, when it runs out of nodes while inserting an item.
+ */
+#define TBX_CONF_LIST_GROWTH_CHUNK               (1U)
+
+
+/****************************************************************************************
+*   H A S H   M A P   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Maximum percentage of the slots of a hash map that can be in use, before the
+ *         hash map grows to twice its number of slots.
+ */
+#define TBX_CONF_HASHMAP_MAX_LOAD                (75U)
+
+
+/****************************************************************************************
+*   S O F T W A R E   T I M E R   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Number of timers that the dedicated memory pool for the timer objects holds. */
+#define TBX_CONF_TIMER_POOL_SIZE                 (8U)
+
+/** \brief Number of tick bits that each level of the timing wheel covers. */
+#define TBX_CONF_TIMER_WHEEL_BITS                (6U)
+
+/** \brief Number of levels of the timing wheel. */
+#define TBX_CONF_TIMER_WHEEL_LEVELS              (4U)
+
+
+/****************************************************************************************
+*   C R I T I C A L   S E C T I O N   M O D U L E   C O N F I G U R A T I O N
+****************************************************************************************/
+/** \brief Enable/disable the native lock objects of the port. When enabled, the heap,
+ *         the memory pools and each linked list have their own lock object. When
+ *         disabled, they all use the global critical section.
+ */
+#define TBX_CONF_LOCK_ENABLE                     (0U)
+
+/** \brief Enable/disable the profiling of the critical section, with the statistics per
+ *         call site that can be read with TbxCriticalSectionGetStats().
+ */
+#define TBX_CONF_CRITSECT_PROFILE_ENABLE         (0U)
+
+
 #ifdef __cplusplus
 }
 #endif
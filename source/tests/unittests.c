@@ -41,6 +41,20 @@
 #include "unity.h"                               /* Unity unit test framework          */
 #include "unittests.h"                           /* Unit tests header                  */
 #include <sys/time.h>                            /* Time definitions                   */
+#include <pthread.h>                             /* Posix thread utilities             */
+#include <sched.h>                               /* Scheduling utilities               */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of threads for the critical section test with multiple threads. */
+#define CRITSECT_TEST_NUM_THREADS      (4U)
+
+/** \brief Number of times that each thread increments the shared counter in the
+ *         critical section test with multiple threads.
+ */
+#define CRITSECT_TEST_ITERATIONS       (10000U)
 
 
 /****************************************************************************************
@@ -54,6 +68,20 @@ typedef struct
   uint8_t  data[8];
 } tListTestMsg;
 
+/** \brief Layout of an item used for testing the intrusive linked list module. */
+typedef struct
+{
+  uint32_t      id;
+  tTbxIListNode node;
+} tIListTestItem;
+
+/** \brief Layout of the log that the software timer tests use to record expiries. */
+typedef struct
+{
+  uint32_t count;
+  uint32_t time;
+} tTimerTestLog;
+
 
 /****************************************************************************************
 * Local data declarations
@@ -70,6 +98,27 @@ const size_t memPoolBlockSize = 16;
 /** \brief Array with block pointers allocated from the test memory pool. */
 void * memPoolAllocatedBlocks[3];
 
+/** \brief Counter that the threads of the critical section test increment. */
+volatile uint32_t critSectTestCounter = 0;
+
+/** \brief Fixed-size memory pool that is defined at compile time. */
+TBX_MEMPOOL_DEFINE(memPoolStatic, 20U, 4U);
+
+/** \brief Fixed-size memory pools that are defined at compile time, for the test in
+ *         which multiple threads allocate their first blocks at the same time.
+ */
+TBX_MEMPOOL_DEFINE(memPoolStaticThreadsA, 16U, CRITSECT_TEST_NUM_THREADS);
+TBX_MEMPOOL_DEFINE(memPoolStaticThreadsB, 16U, CRITSECT_TEST_NUM_THREADS);
+TBX_MEMPOOL_DEFINE(memPoolStaticThreadsC, 16U, CRITSECT_TEST_NUM_THREADS);
+TBX_MEMPOOL_DEFINE(memPoolStaticThreadsD, 16U, CRITSECT_TEST_NUM_THREADS);
+
+/** \brief Fixed-size memory pools for the test with multiple threads. */
+tTbxMemPoolFixed * const memPoolStaticThreads[] =
+{
+  &memPoolStaticThreadsA, &memPoolStaticThreadsB,
+  &memPoolStaticThreadsC, &memPoolStaticThreadsD
+};
+
 /** \brief Test message A for the linked list module. */
 static tListTestMsg listTestMsgA = 
 {
@@ -151,6 +200,116 @@ uint8_t compareListMsg(void const * item1, void const * item2)
 } /*** end of compareListMsg ***/
 
 
+/************************************************************************************//**
+** \brief     Message visit function used for traversing the linked lists. It adds the
+**            id of each message to the sum and stops the traversal at message B.
+** \param     item The item that is visited.
+** \param     context Pointer to the sum of the ids of the visited messages.
+** \return    TBX_TRUE to continue with the next item, TBX_FALSE to stop.
+**
+****************************************************************************************/
+uint8_t visitListMsg(void * item, void * context)
+{
+  uint8_t result = TBX_TRUE;
+  tListTestMsg const * msg = item;
+  uint32_t * idSum = context;
+
+  *idSum += msg->id;
+  if (msg == &listTestMsgB)
+  {
+    result = TBX_FALSE;
+  }
+  return result;
+} /*** end of visitListMsg ***/
+
+
+/************************************************************************************//**
+** \brief     Thread function of the critical section test with multiple threads. It
+**            increments the shared counter in the critical section, in separate read and
+**            write steps. In between, it gives the other threads the opportunity to run.
+** \param     arg Unused.
+** \return    Unused.
+**
+****************************************************************************************/
+void * critSectCountThread(void * arg)
+{
+  uint32_t idx;
+  uint32_t value;
+
+  (void)arg;
+  for (idx = 0; idx < CRITSECT_TEST_ITERATIONS; idx++)
+  {
+    TbxCriticalSectionEnter();
+    value = critSectTestCounter;
+    (void)sched_yield();
+    critSectTestCounter = value + 1U;
+    TbxCriticalSectionExit();
+  }
+  return NULL;
+} /*** end of critSectCountThread ***/
+
+
+/************************************************************************************//**
+** \brief     Thread function of the memory pool test with multiple threads. It allocates
+**            one block from each fixed-size memory pool that was defined at compile time
+**            and releases them again. Each thread starts at a different memory pool.
+** \param     arg Index of the thread.
+** \return    Unused.
+**
+****************************************************************************************/
+void * memPoolStaticThread(void * arg)
+{
+  const size_t   numPools = sizeof(memPoolStaticThreads)/sizeof(memPoolStaticThreads[0]);
+  void         * blocks[sizeof(memPoolStaticThreads)/sizeof(memPoolStaticThreads[0])];
+  size_t         idx;
+
+  for (idx = 0U; idx < numPools; idx++)
+  {
+    blocks[idx] = TbxMemPoolFixedAllocate(memPoolStaticThreads[((uintptr_t)arg + idx) % \
+                                                               numPools]);
+    (void)sched_yield();
+  }
+  for (idx = 0U; idx < numPools; idx++)
+  {
+    TbxMemPoolRelease(blocks[idx]);
+  }
+  return NULL;
+} /*** end of memPoolStaticThread ***/
+
+
+/************************************************************************************//**
+** \brief     Hash function used for the hash map tests. It maps all keys to the same few
+**            hash values, which forces long runs of occupied slots.
+** \param     key Pointer to the key bytes.
+** \param     keySize Number of key bytes.
+** \return    The hash value.
+**
+****************************************************************************************/
+uint32_t hashMapTestHash(void const * key, size_t keySize)
+{
+  uint8_t const * keyPtr = key;
+
+  return (uint32_t)keyPtr[keySize - 1U] & 0x03U;
+} /*** end of hashMapTestHash ***/
+
+
+/************************************************************************************//**
+** \brief     Callback function used for the software timer tests. It counts the
+**            expiries and stores the tick counter value of the last one.
+** \param     timer The timer that expired.
+** \param     context Pointer to the log of the timer.
+**
+****************************************************************************************/
+void timerTestCallback(tTbxTimer * timer, void * context)
+{
+  tTimerTestLog * log = context;
+
+  TBX_UNUSED_ARG(timer);
+  log->count++;
+  log->time = TbxTimerGetTime();
+} /*** end of timerTestCallback ***/
+
+
 /************************************************************************************//**
 ** \brief     Tests that verifies that the version macros are present.
 **
@@ -293,6 +452,156 @@ void test_TbxCriticalSectionEnter_ShouldNotAssertUponCritSectExit(void)
 } /*** end of test_TbxCriticalSectionEnter_ShouldNotAssertUponCritSectExit ***/
 
 
+/************************************************************************************//**
+** \brief     Tests that the critical section provides mutual exclusive access, when
+**            multiple threads enter it at the same time.
+**
+****************************************************************************************/
+void test_TbxCriticalSectionEnter_ShouldExcludeOtherThreads(void)
+{
+  pthread_t threads[CRITSECT_TEST_NUM_THREADS];
+  uint32_t  idx;
+
+  /* Let all threads increment the shared counter at the same time. */
+  critSectTestCounter = 0;
+  for (idx = 0; idx < CRITSECT_TEST_NUM_THREADS; idx++)
+  {
+    TEST_ASSERT_EQUAL(0, pthread_create(&threads[idx], NULL, critSectCountThread, NULL));
+  }
+  for (idx = 0; idx < CRITSECT_TEST_NUM_THREADS; idx++)
+  {
+    TEST_ASSERT_EQUAL(0, pthread_join(threads[idx], NULL));
+  }
+  /* No increment should have been lost. */
+  TEST_ASSERT_EQUAL_UINT32(CRITSECT_TEST_NUM_THREADS * CRITSECT_TEST_ITERATIONS,
+                           critSectTestCounter);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxCriticalSectionEnter_ShouldExcludeOtherThreads ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the lock object functions trigger an assertion upon detection of
+**            invalid function parameters.
+**
+****************************************************************************************/
+void test_TbxLockEnter_ShouldAssertOnInvalidParams(void)
+{
+  /* Attempt to enter a lock object that does not exist. */
+  TbxLockEnter(NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt to exit a lock object that does not exist. */
+  TbxLockExit(NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt to initialize a lock object that does not exist. */
+  TbxLockInit(NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxLockEnter_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that both statically and dynamically initialized lock objects can be
+**            entered in a nested manner, also while holding another lock object.
+**
+****************************************************************************************/
+void test_TbxLockEnter_CanNest(void)
+{
+  static tTbxLock staticLock = TBX_LOCK_INIT;
+  tTbxLock        dynamicLock;
+
+  /* Initialize the dynamic lock object. */
+  TbxLockInit(&dynamicLock);
+  /* Enter the static lock object twice. */
+  TbxLockEnter(&staticLock);
+  TbxLockEnter(&staticLock);
+  /* Enter the dynamic lock object, while holding the static one. */
+  TbxLockEnter(&dynamicLock);
+  TbxLockExit(&dynamicLock);
+  /* Exit the static lock object twice. */
+  TbxLockExit(&staticLock);
+  TbxLockExit(&staticLock);
+  /* It should be possible to enter both lock objects again. */
+  TbxLockEnter(&staticLock);
+  TbxLockEnter(&dynamicLock);
+  TbxLockExit(&dynamicLock);
+  TbxLockExit(&staticLock);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxLockEnter_CanNest ***/
+
+
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Tests that the profiling of the critical section records one measurement
+**            per outermost entry, under the call site of that entry.
+**
+****************************************************************************************/
+void test_TbxCriticalSectionGetStats_ShouldRecordCallSite(void)
+{
+  tTbxCritSectStats stats;
+  uint32_t          line;
+
+  /* Start with empty statistics. */
+  TbxCriticalSectionResetStats();
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxCriticalSectionGetStats(&stats));
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.count);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxCriticalSectionGetSiteStats(0U, &stats));
+  /* Enter the critical section in a nested manner. */
+  TbxCriticalSectionEnter(); line = __LINE__;
+  TbxCriticalSectionEnter();
+  TbxCriticalSectionExit();
+  TbxCriticalSectionExit();
+  /* The nested entry should not count as a separate measurement. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxCriticalSectionGetStats(&stats));
+  TEST_ASSERT_NULL(stats.file);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.count);
+  TEST_ASSERT_TRUE(stats.totalTime == stats.maxTime);
+  /* The measurement should be recorded under the call site of the outermost entry. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxCriticalSectionGetSiteStats(0U, &stats));
+  TEST_ASSERT_EQUAL_STRING(__FILE__, stats.file);
+  TEST_ASSERT_EQUAL_UINT32(line, stats.line);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.count);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxCriticalSectionGetSiteStats(1U, &stats));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxCriticalSectionGetStats_ShouldRecordCallSite ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the functions for entering the critical section remain available
+**            as functions, while profiling is enabled.
+**
+****************************************************************************************/
+void test_TbxCriticalSectionEnter_ShouldRemainCallableAsFunction(void)
+{
+  void              (* critSectEnterFcn)(void) = &(TbxCriticalSectionEnter);
+  void              (* lockEnterFcn)(tTbxLock * lock) = &(TbxLockEnter);
+  static tTbxLock   lock = TBX_LOCK_INIT;
+  tTbxCritSectStats stats;
+
+  /* Start with empty statistics. */
+  TbxCriticalSectionResetStats();
+  /* Enter the critical section and the lock object through the functions. */
+  critSectEnterFcn();
+  TbxCriticalSectionExit();
+  lockEnterFcn(&lock);
+  TbxLockExit(&lock);
+  /* The entry of the critical section should have been recorded. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxCriticalSectionGetStats(&stats));
+  TEST_ASSERT_TRUE(stats.count >= 1U);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxCriticalSectionEnter_ShouldRemainCallableAsFunction ***/
+#endif
+
+
 /************************************************************************************//**
 ** \brief     Tests that free heap size reporting works.
 ** \attention Should run before any other tests that might allocated from the heap.
@@ -428,6 +737,366 @@ void test_TbxHeapAllocate_ShouldAlignToAddressSize(void)
 } /*** end of test_TbxHeapAllocate_ShouldAlignToAddressSize ***/
 
 
+/************************************************************************************//**
+** \brief     Tests that an aligned memory allocation returns a start address that is
+**            aligned to the requested number of bytes.
+**
+****************************************************************************************/
+void test_TbxHeapAllocateAligned_ShouldAlign(void)
+{
+  void * mem;
+
+  /* Misalign the next allocation on purpose, by allocating a small block first. */
+  mem = TbxHeapAllocate(1);
+  TEST_ASSERT_NOT_NULL(mem);
+  /* Allocate memory aligned to a cache line. */
+  mem = TbxHeapAllocateAligned(10, 64);
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_EQUAL(0U, (uintptr_t)mem & 63U);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapAllocateAligned_ShouldAlign ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that an alignment that is not a power of two triggers an assertion
+**            and that nothing gets allocated.
+**
+****************************************************************************************/
+void test_TbxHeapAllocateAligned_ShouldAssertOnInvalidParams(void)
+{
+  size_t initialFreeHeap;
+  void * mem;
+
+  /* Get the initial free heap size. */
+  initialFreeHeap = TbxHeapGetFree();
+  /* Attempt allocation with an alignment of zero. */
+  mem = TbxHeapAllocateAligned(10, 0);
+  TEST_ASSERT_NULL(mem);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt allocation with an alignment that is not a power of two. */
+  mem = TbxHeapAllocateAligned(10, 12);
+  TEST_ASSERT_NULL(mem);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Should still be the same as before, because nothing should have been allocated. */
+  TEST_ASSERT_EQUAL(initialFreeHeap, TbxHeapGetFree());
+} /*** end of test_TbxHeapAllocateAligned_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that memory is allocated from the memory of a heap region and that
+**            the heap region cannot allocate more than what fits in its memory.
+**
+****************************************************************************************/
+void test_TbxHeapRegionCreate_ShouldAllocateFromRegion(void)
+{
+  static uint8_t   regionMem[128];
+  tTbxHeapRegion * region;
+  size_t           initialFreeHeap;
+  size_t           regionFree;
+  uint8_t        * mem;
+
+  /* Get the initial free heap size. */
+  initialFreeHeap = TbxHeapGetFree();
+  /* Create the heap region. */
+  region = TbxHeapRegionCreate(regionMem, sizeof(regionMem));
+  TEST_ASSERT_NOT_NULL(region);
+  regionFree = TbxHeapRegionGetFree(region);
+  TEST_ASSERT_LESS_THAN(sizeof(regionMem), regionFree);
+  /* Allocate from the heap region and make sure it is inside its memory. */
+  mem = TbxHeapRegionAllocate(region, 16, 16);
+  TEST_ASSERT_NOT_NULL(mem);
+  TEST_ASSERT_EQUAL(0U, (uintptr_t)mem & 15U);
+  TEST_ASSERT_TRUE(mem >= &regionMem[0]);
+  TEST_ASSERT_TRUE(&mem[16] <= &regionMem[sizeof(regionMem)]);
+  TEST_ASSERT_LESS_THAN(regionFree, TbxHeapRegionGetFree(region));
+  /* It should not be possible to allocate more than what is left in the region. */
+  mem = TbxHeapRegionAllocate(region, TbxHeapRegionGetFree(region) + 1U, 1);
+  TEST_ASSERT_NULL(mem);
+  /* The default heap should not be affected. */
+  TEST_ASSERT_EQUAL(initialFreeHeap, TbxHeapGetFree());
+  /* A heap region cannot be created in memory that is too small. */
+  region = TbxHeapRegionCreate(regionMem, 1);
+  TEST_ASSERT_NULL(region);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHeapRegionCreate_ShouldAllocateFromRegion ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the TLSF allocator functions trigger an assertion when called
+**            with invalid parameters.
+**
+****************************************************************************************/
+void test_TbxTlsfCreate_ShouldAssertOnInvalidParams(void)
+{
+  static uint8_t   tlsfMem[4096];
+  tTbxTlsf       * tlsf;
+
+  /* Attempt creation without memory. */
+  tlsf = TbxTlsfCreate(NULL, sizeof(tlsfMem));
+  TEST_ASSERT_NULL(tlsf);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt creation with a size of zero. */
+  tlsf = TbxTlsfCreate(tlsfMem, 0);
+  TEST_ASSERT_NULL(tlsf);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Memory that cannot even hold the control data is not an assertion. */
+  tlsf = TbxTlsfCreate(tlsfMem, 8);
+  TEST_ASSERT_NULL(tlsf);
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  /* Create a valid allocator to test the other functions with. */
+  tlsf = TbxTlsfCreate(tlsfMem, sizeof(tlsfMem));
+  TEST_ASSERT_NOT_NULL(tlsf);
+  /* Attempt allocation of zero bytes. */
+  TEST_ASSERT_NULL(TbxTlsfAllocate(tlsf, 0));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt release of a NULL pointer. */
+  TbxTlsfRelease(tlsf, NULL);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt to add memory without memory. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxTlsfAddMemory(tlsf, NULL, 128));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that blocks of different sizes can be allocated with the TLSF
+**            allocator, that they do not overlap and that all memory merges back into
+**            one free block after releasing them.
+**
+****************************************************************************************/
+void test_TbxTlsfAllocate_CanAllocateAndRelease(void)
+{
+  static uint8_t      tlsfMem[4096];
+  static const size_t allocSizes[] = { 1, 13, 100, 24, 500, 64, 7, 1000 };
+  const size_t        numAllocs = sizeof(allocSizes) / sizeof(allocSizes[0]);
+  uint8_t           * mem[sizeof(allocSizes) / sizeof(allocSizes[0])];
+  tTbxTlsf          * tlsf;
+  size_t              initialFree;
+  size_t              idx;
+  size_t              byteIdx;
+
+  /* Create the allocator. */
+  tlsf = TbxTlsfCreate(tlsfMem, sizeof(tlsfMem));
+  TEST_ASSERT_NOT_NULL(tlsf);
+  initialFree = TbxTlsfGetFree(tlsf);
+  TEST_ASSERT_LESS_THAN(sizeof(tlsfMem), initialFree);
+  /* Allocate blocks of different sizes and fill each one with its own pattern. */
+  for (idx = 0; idx < numAllocs; idx++)
+  {
+    mem[idx] = TbxTlsfAllocate(tlsf, allocSizes[idx]);
+    TEST_ASSERT_NOT_NULL(mem[idx]);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)mem[idx] & ((2U * sizeof(void *)) - 1U));
+    TEST_ASSERT_TRUE(mem[idx] >= &tlsfMem[0]);
+    TEST_ASSERT_TRUE(&mem[idx][allocSizes[idx]] <= &tlsfMem[sizeof(tlsfMem)]);
+    for (byteIdx = 0; byteIdx < allocSizes[idx]; byteIdx++)
+    {
+      mem[idx][byteIdx] = (uint8_t)idx;
+    }
+  }
+  TEST_ASSERT_LESS_THAN(initialFree, TbxTlsfGetFree(tlsf));
+  /* Make sure that the blocks did not overwrite each other. */
+  for (idx = 0; idx < numAllocs; idx++)
+  {
+    for (byteIdx = 0; byteIdx < allocSizes[idx]; byteIdx++)
+    {
+      TEST_ASSERT_EQUAL_UINT8((uint8_t)idx, mem[idx][byteIdx]);
+    }
+  }
+  /* Release every other block first and then the rest, to exercise the merging with
+   * both the preceding and the following block.
+   */
+  for (idx = 0; idx < numAllocs; idx += 2U)
+  {
+    TbxTlsfRelease(tlsf, mem[idx]);
+  }
+  for (idx = 1; idx < numAllocs; idx += 2U)
+  {
+    TbxTlsfRelease(tlsf, mem[idx]);
+  }
+  /* All memory should be free again and merged into one block. Only then can more
+   * than half of it be allocated at once, because it exceeds the largest block that
+   * was allocated. Allocating more than the free memory should fail.
+   */
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+  TEST_ASSERT_GREATER_THAN(allocSizes[numAllocs - 1U], initialFree / 2U);
+  mem[0] = TbxTlsfAllocate(tlsf, initialFree + 1U);
+  TEST_ASSERT_NULL(mem[0]);
+  mem[0] = TbxTlsfAllocate(tlsf, (initialFree / 2U) + 1U);
+  TEST_ASSERT_NOT_NULL(mem[0]);
+  TbxTlsfRelease(tlsf, mem[0]);
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfAllocate_CanAllocateAndRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that released memory is reused by the TLSF allocator and that memory
+**            larger than the largest block, is split into multiple blocks.
+**
+****************************************************************************************/
+void test_TbxTlsfAllocate_ShouldReuseReleasedMemory(void)
+{
+  static uint8_t   tlsfMem[2048];
+  static uint8_t   largeMem[((size_t)1U << TBX_CONF_TLSF_MAX_SIZE_LOG2) * 2U];
+  tTbxTlsf       * tlsf;
+  size_t           initialFree;
+  void           * memA;
+  void           * memB;
+  void           * memC;
+
+  /* Create the allocator. */
+  tlsf = TbxTlsfCreate(tlsfMem, sizeof(tlsfMem));
+  TEST_ASSERT_NOT_NULL(tlsf);
+  initialFree = TbxTlsfGetFree(tlsf);
+  /* Allocate three blocks and release the middle one. */
+  memA = TbxTlsfAllocate(tlsf, 64);
+  memB = TbxTlsfAllocate(tlsf, 64);
+  memC = TbxTlsfAllocate(tlsf, 64);
+  TEST_ASSERT_NOT_NULL(memA);
+  TEST_ASSERT_NOT_NULL(memB);
+  TEST_ASSERT_NOT_NULL(memC);
+  TbxTlsfRelease(tlsf, memB);
+  /* The next allocation of the same size should reuse its memory. */
+  TEST_ASSERT_EQUAL_PTR(memB, TbxTlsfAllocate(tlsf, 64));
+  TbxTlsfRelease(tlsf, memA);
+  TbxTlsfRelease(tlsf, memB);
+  TbxTlsfRelease(tlsf, memC);
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+  /* Add memory that is larger than the largest block. It should be split into blocks
+   * that can each be allocated.
+   */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxTlsfAddMemory(tlsf, largeMem, sizeof(largeMem)));
+  initialFree = TbxTlsfGetFree(tlsf);
+  TEST_ASSERT_GREATER_THAN(sizeof(largeMem) / 2U, initialFree);
+  memA = TbxTlsfAllocate(tlsf, sizeof(largeMem) / 4U * 3U / 2U);
+  memB = TbxTlsfAllocate(tlsf, sizeof(largeMem) / 4U * 3U / 2U);
+  TEST_ASSERT_NOT_NULL(memA);
+  TEST_ASSERT_NOT_NULL(memB);
+  /* Larger than the largest block can never be allocated. */
+  TEST_ASSERT_NULL(TbxTlsfAllocate(tlsf, sizeof(largeMem) / 2U));
+  TbxTlsfRelease(tlsf, memB);
+  TbxTlsfRelease(tlsf, memA);
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfAllocate_ShouldReuseReleasedMemory ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that memory larger than the largest block does not stay fragmented,
+**            after filling it with small blocks and releasing them in random order. As
+**            many large blocks should fit as right after adding the memory.
+**
+****************************************************************************************/
+void test_TbxTlsfRelease_ShouldNotFragmentLargeMemory(void)
+{
+  static uint8_t   tlsfMem[2048];
+  static uint8_t   largeMem[((size_t)1U << TBX_CONF_TLSF_MAX_SIZE_LOG2) * 4U];
+  static void    * smallMem[(sizeof(largeMem) / 1000U) + 8U];
+  void           * largeBlocks[8];
+  const size_t     largeSize = ((size_t)1U << TBX_CONF_TLSF_MAX_SIZE_LOG2) / 16U * 15U;
+  tTbxTlsf       * tlsf;
+  tTbxRandomCtx    randomCtx;
+  size_t           initialFree;
+  size_t           numLarge;
+  size_t           numSmall;
+  size_t           idx;
+  size_t           swapIdx;
+  void           * swapMem;
+
+  /* Create the allocator and add memory that is split into multiple blocks. */
+  tlsf = TbxTlsfCreate(tlsfMem, sizeof(tlsfMem));
+  TEST_ASSERT_NOT_NULL(tlsf);
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxTlsfAddMemory(tlsf, largeMem, sizeof(largeMem)));
+  initialFree = TbxTlsfGetFree(tlsf);
+  /* Determine how many large blocks fit in the fresh memory. */
+  numLarge = 0U;
+  while ( (numLarge < (sizeof(largeBlocks)/sizeof(largeBlocks[0]))) &&
+          ((largeBlocks[numLarge] = TbxTlsfAllocate(tlsf, largeSize)) != NULL) )
+  {
+    numLarge++;
+  }
+  TEST_ASSERT_EQUAL(4U, numLarge);
+  for (idx = 0U; idx < numLarge; idx++)
+  {
+    TbxTlsfRelease(tlsf, largeBlocks[idx]);
+  }
+  /* Fill all memory with small blocks. */
+  numSmall = 0U;
+  while ( (numSmall < (sizeof(smallMem)/sizeof(smallMem[0]))) &&
+          ((smallMem[numSmall] = TbxTlsfAllocate(tlsf, 1000U)) != NULL) )
+  {
+    numSmall++;
+  }
+  TEST_ASSERT_NULL(TbxTlsfAllocate(tlsf, 1000U));
+  /* Shuffle the small blocks and release them in this random order. */
+  TbxRandomCtxInit(&randomCtx, 12345U);
+  for (idx = numSmall - 1U; idx > 0U; idx--)
+  {
+    swapIdx = TbxRandomCtxNumberGet(&randomCtx) % (idx + 1U);
+    swapMem = smallMem[idx];
+    smallMem[idx] = smallMem[swapIdx];
+    smallMem[swapIdx] = swapMem;
+  }
+  for (idx = 0U; idx < numSmall; idx++)
+  {
+    TbxTlsfRelease(tlsf, smallMem[idx]);
+  }
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+  /* The same number of large blocks should fit again. */
+  for (idx = 0U; idx < numLarge; idx++)
+  {
+    largeBlocks[idx] = TbxTlsfAllocate(tlsf, largeSize);
+    TEST_ASSERT_NOT_NULL(largeBlocks[idx]);
+  }
+  for (idx = 0U; idx < numLarge; idx++)
+  {
+    TbxTlsfRelease(tlsf, largeBlocks[idx]);
+  }
+  TEST_ASSERT_EQUAL(initialFree, TbxTlsfGetFree(tlsf));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfRelease_ShouldNotFragmentLargeMemory ***/
+
+
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Tests that the default TLSF allocator takes its memory from the heap upon
+**            its first use.
+**
+****************************************************************************************/
+void test_TbxTlsfAllocate_CanUseDefaultAllocator(void)
+{
+  size_t   initialFree;
+  void   * mem;
+
+  /* Allocate with the default allocator. */
+  mem = TbxTlsfAllocate(NULL, 100);
+  TEST_ASSERT_NOT_NULL(mem);
+  initialFree = TbxTlsfGetFree(NULL);
+  TEST_ASSERT_LESS_THAN(TBX_CONF_TLSF_HEAP_SIZE, initialFree);
+  /* Release it again. */
+  TbxTlsfRelease(NULL, mem);
+  TEST_ASSERT_GREATER_THAN(initialFree, TbxTlsfGetFree(NULL));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTlsfAllocate_CanUseDefaultAllocator ***/
+#endif
+
+
 /************************************************************************************//**
 ** \brief     Tests that an assertion is triggered if you try to set an invalid seed
 **            initialization handler.
@@ -475,32 +1144,160 @@ void test_TbxRandomNumberGet_ShouldReturnRandomNumbers(void)
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns zero.
+** \brief     Tests that a byte array is filled with random bytes.
 **
 ****************************************************************************************/
-void test_TbxChecksumCrc16Calculate_ShouldAssertOnInvalidParams(void)
+void test_TbxRandomFill_ShouldFillBuffer(void)
 {
-  uint16_t checksum; 
-  const uint8_t sourceData[] = 
-  {
-    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 
-    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,    
-    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 
-    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F    
-  };
-  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  uint8_t  buffer[150] = { 0 };
+  uint32_t numZeroes = 0U;
 
-  /* Pass a NULL pointer for the data byte array. */
-  checksum = TbxChecksumCrc16Calculate(NULL, sourceLen);
+  /* Pass a NULL pointer for the byte array. */
+  TbxRandomFill(NULL, sizeof(buffer));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that it did not continue with the actual checksum calculation. */
-  TEST_ASSERT_EQUAL_UINT16(0, checksum);
+
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass an invalid size. */
-  checksum = TbxChecksumCrc16Calculate(sourceData, 0);
-  /* Make sure an assertion was triggered. */
+  /* Fill all but the last byte, which spans more than one chunk. */
+  TbxRandomFill(buffer, sizeof(buffer) - 1U);
+  for (size_t idx = 0U; idx < (sizeof(buffer) - 1U); idx++)
+  {
+    if (buffer[idx] == 0U)
+    {
+      numZeroes++;
+    }
+  }
+  /* Make sure that the bytes were actually filled. */
+  TEST_ASSERT_LESS_THAN(10U, numZeroes);
+  /* Make sure that the last byte was not touched. */
+  TEST_ASSERT_EQUAL_UINT8(0U, buffer[sizeof(buffer) - 1U]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxRandomFill_ShouldFillBuffer ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that caller owned generator contexts give reproducible random
+**            numbers and that the bulk fill matches them.
+**
+****************************************************************************************/
+void test_TbxRandomCtxNumberGet_ShouldBeReproducible(void)
+{
+  /* Expected numbers for seed value 12345. */
+  const uint32_t expected[] = { 0x1EEA3CC1UL, 0x1A40A62EUL, 0xFC4CD240UL, 0xDFFC5B56UL };
+  tTbxRandomCtx ctx1;
+  tTbxRandomCtx ctx2;
+  uint8_t       bytes[15];
+
+  /* Pass NULL pointers. */
+  TbxRandomCtxInit(NULL, 12345U);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  assertionCnt = 0;
+  TEST_ASSERT_EQUAL_UINT32(0U, TbxRandomCtxNumberGet(NULL));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  assertionCnt = 0;
+  TbxRandomCtxInit(&ctx1, 12345U);
+  TbxRandomCtxFill(&ctx1, NULL, sizeof(bytes));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Verify the generated numbers. */
+  TbxRandomCtxInit(&ctx1, 12345U);
+  for (size_t idx = 0U; idx < (sizeof(expected)/sizeof(expected[0])); idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(expected[idx], TbxRandomCtxNumberGet(&ctx1));
+  }
+  /* Verify that the bulk fill stores the same numbers, least significant byte first. */
+  TbxRandomCtxInit(&ctx2, 12345U);
+  TbxRandomCtxFill(&ctx2, bytes, sizeof(bytes));
+  for (size_t idx = 0U; idx < sizeof(bytes); idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(expected[idx / 4U] >> ((idx % 4U) * 8U)), bytes[idx]);
+  }
+  /* Verify that a different seed gives different numbers. */
+  TbxRandomCtxInit(&ctx2, 12346U);
+  TEST_ASSERT_NOT_EQUAL_UINT32(expected[0], TbxRandomCtxNumberGet(&ctx2));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxRandomCtxNumberGet_ShouldBeReproducible ***/
+
+
+#if (TBX_PORT_ENTROPY > 0U) && (TBX_CONF_RANDOM_ENTROPY_POOL_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Tests that entropy bytes are obtained from the pool first and directly from
+**            the hardware afterwards.
+**
+****************************************************************************************/
+void test_TbxRandomEntropyGet_ShouldUsePoolAndHardware(void)
+{
+  uint8_t  buffer[TBX_CONF_RANDOM_ENTROPY_POOL_SIZE + 40U] = { 0 };
+  uint32_t numZeroes = 0U;
+
+  /* Pass a NULL pointer for the byte array. */
+  TEST_ASSERT_EQUAL(0U, TbxRandomEntropyGet(NULL, sizeof(buffer)));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Fill the pool and verify that it is full. */
+  (void)TbxRandomEntropyCollect();
+  TEST_ASSERT_EQUAL(TBX_CONF_RANDOM_ENTROPY_POOL_SIZE, TbxRandomEntropyAvailable());
+  /* A full pool cannot be topped up. */
+  TEST_ASSERT_EQUAL(0U, TbxRandomEntropyCollect());
+  /* Draw part of the pool. */
+  TEST_ASSERT_EQUAL(10U, TbxRandomEntropyGet(buffer, 10U));
+  TEST_ASSERT_EQUAL(TBX_CONF_RANDOM_ENTROPY_POOL_SIZE - 10U, TbxRandomEntropyAvailable());
+  /* Draw more than the pool holds, such that the rest comes from the hardware. */
+  TEST_ASSERT_EQUAL(sizeof(buffer) - 10U, TbxRandomEntropyGet(&buffer[10],
+                                                              sizeof(buffer) - 10U));
+  TEST_ASSERT_EQUAL(0U, TbxRandomEntropyAvailable());
+  for (size_t idx = 0U; idx < sizeof(buffer); idx++)
+  {
+    if (buffer[idx] == 0U)
+    {
+      numZeroes++;
+    }
+  }
+  /* Make sure that the bytes were actually filled. */
+  TEST_ASSERT_LESS_THAN(10U, numZeroes);
+  /* Verify that the pool can be topped up again. */
+  TEST_ASSERT_EQUAL(TBX_CONF_RANDOM_ENTROPY_POOL_SIZE, TbxRandomEntropyCollect());
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxRandomEntropyGet_ShouldUsePoolAndHardware ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns zero.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc16Calculate_ShouldAssertOnInvalidParams(void)
+{
+  uint16_t checksum; 
+  const uint8_t sourceData[] = 
+  {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,    
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F    
+  };
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+
+  /* Pass a NULL pointer for the data byte array. */
+  checksum = TbxChecksumCrc16Calculate(NULL, sourceLen);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT16(0, checksum);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass an invalid size. */
+  checksum = TbxChecksumCrc16Calculate(sourceData, 0);
+  /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Verify that it did not continue with the actual checksum calculation. */
   TEST_ASSERT_EQUAL_UINT16(0, checksum);
@@ -536,6 +1333,183 @@ void test_TbxChecksumCrc16Calculate_ShouldReturnValidCrc16(void)
 } /*** end of test_TbxChecksumCrc16Calculate_ShouldReturnValidCrc16 ***/
 
 
+/************************************************************************************//**
+** \brief     Tests that the 16-bit CRC matches the published check value of the
+**            CRC16_CCITT_FALSE algorithm. Its length is not a multiple of the number of
+**            bytes that the table-driven methods process at a time.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc16Calculate_ShouldReturnCheckValue(void)
+{
+  const uint8_t sourceData[] = 
+  {
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
+  };
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+
+  /* Verify the correctness of the checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT16(0x29B1U, TbxChecksumCrc16Calculate(sourceData, sourceLen));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc16Calculate_ShouldReturnCheckValue ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters of the streaming CRC functions trigger an
+**            assertion.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc16Update_ShouldAssertOnInvalidParams(void)
+{
+  tTbxChecksumCrc16 ctx;
+
+  /* Initialize the context. */
+  TbxChecksumCrc16Init(&ctx, NULL);
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  /* Attempt to process data without a context. */
+  TbxChecksumCrc16Update(NULL, (uint8_t const *)"1", 1U);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt to process data without data. */
+  TbxChecksumCrc16Update(&ctx, NULL, 1U);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Processing zero bytes without data is allowed. */
+  TbxChecksumCrc16Update(&ctx, NULL, 0U);
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  /* Attempt to initialize and finalize without a context. */
+  TbxChecksumCrc16Init(NULL, NULL);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  TEST_ASSERT_EQUAL_UINT16(0U, TbxChecksumCrc16Final(NULL));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc16Update_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that processing the data in chunks with the default parameters
+**            results in the same 16-bit CRC as processing it all at once.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc16Update_ShouldMatchCalculateInChunks(void)
+{
+  tTbxChecksumCrc16 ctx;
+  uint8_t sourceData[61];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  size_t chunkLen;
+
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
+  {
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
+  }
+  /* Process the data in chunks of different lengths. */
+  for (chunkLen = 1U; chunkLen <= 13U; chunkLen++)
+  {
+    TbxChecksumCrc16Init(&ctx, NULL);
+    for (size_t idx = 0U; idx < sourceLen; idx += chunkLen)
+    {
+      TbxChecksumCrc16Update(&ctx, &sourceData[idx],
+                             ((sourceLen - idx) < chunkLen) ? (sourceLen - idx) :
+                                                              chunkLen);
+    }
+    TEST_ASSERT_EQUAL_UINT16(TbxChecksumCrc16Calculate(sourceData, sourceLen),
+                             TbxChecksumCrc16Final(&ctx));
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc16Update_ShouldMatchCalculateInChunks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that processing a large chunk of data results in the same 16-bit CRC
+**            as processing it one byte at a time, for each predefined parameter set.
+**            Large chunks can be processed by the CRC related instructions of the CPU,
+**            if the port offers hardware acceleration.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc16Update_ShouldMatchBytewiseInLargeChunk(void)
+{
+  const tTbxChecksumCrc16Params paramSets[] =
+  {
+    TBX_CHECKSUM_CRC16_CCITT_FALSE,
+    TBX_CHECKSUM_CRC16_XMODEM,
+    TBX_CHECKSUM_CRC16_KERMIT,
+    TBX_CHECKSUM_CRC16_MODBUS
+  };
+  const size_t numParamSets = sizeof(paramSets)/sizeof(paramSets[0]);
+  uint8_t sourceData[300];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  tTbxChecksumCrc16 ctxChunk;
+  tTbxChecksumCrc16 ctxBytewise;
+
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
+  {
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
+  }
+  /* Compare the results for each parameter set. */
+  for (size_t setIdx = 0U; setIdx < numParamSets; setIdx++)
+  {
+    TbxChecksumCrc16Init(&ctxChunk, &paramSets[setIdx]);
+    TbxChecksumCrc16Init(&ctxBytewise, &paramSets[setIdx]);
+    TbxChecksumCrc16Update(&ctxChunk, sourceData, sourceLen);
+    for (size_t idx = 0U; idx < sourceLen; idx++)
+    {
+      TbxChecksumCrc16Update(&ctxBytewise, &sourceData[idx], 1U);
+    }
+    TEST_ASSERT_EQUAL_UINT16(TbxChecksumCrc16Final(&ctxBytewise),
+                             TbxChecksumCrc16Final(&ctxChunk));
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc16Update_ShouldMatchBytewiseInLargeChunk ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the streaming 16-bit CRC functions match the published check
+**            values of the predefined parameter sets. This includes reflected algorithms
+**            and an algorithm with a different polynomial.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc16Final_ShouldReturnCheckValues(void)
+{
+  const tTbxChecksumCrc16Params ccittFalse = TBX_CHECKSUM_CRC16_CCITT_FALSE;
+  const tTbxChecksumCrc16Params xmodem = TBX_CHECKSUM_CRC16_XMODEM;
+  const tTbxChecksumCrc16Params kermit = TBX_CHECKSUM_CRC16_KERMIT;
+  const tTbxChecksumCrc16Params modbus = TBX_CHECKSUM_CRC16_MODBUS;
+  const uint8_t sourceData[] = 
+  {
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
+  };
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  tTbxChecksumCrc16 ctx;
+
+  /* Verify the correctness of the checksum calculation, in two chunks. */
+  TbxChecksumCrc16Init(&ctx, &ccittFalse);
+  TbxChecksumCrc16Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc16Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT16(0x29B1U, TbxChecksumCrc16Final(&ctx));
+  TbxChecksumCrc16Init(&ctx, &xmodem);
+  TbxChecksumCrc16Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc16Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT16(0x31C3U, TbxChecksumCrc16Final(&ctx));
+  TbxChecksumCrc16Init(&ctx, &kermit);
+  TbxChecksumCrc16Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc16Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT16(0x2189U, TbxChecksumCrc16Final(&ctx));
+  TbxChecksumCrc16Init(&ctx, &modbus);
+  TbxChecksumCrc16Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc16Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT16(0x4B37U, TbxChecksumCrc16Final(&ctx));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc16Final_ShouldReturnCheckValues ***/
+
+
 /************************************************************************************//**
 ** \brief     Tests that invalid parameters trigger an assertion and returns zero.
 **
@@ -599,169 +1573,424 @@ void test_TbxChecksumCrc32Calculate_ShouldReturnValidCrc32(void)
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and do not perform the
-**            actual encryption.
+** \brief     Tests that the 32-bit CRC matches the published check value of the
+**            CRC32_MPEG2 algorithm. Its length is not a multiple of the number of
+**            bytes that the table-driven methods process at a time.
 **
 ****************************************************************************************/
-void test_TbxCryptoAes256Encrypt_ShouldAssertOnInvalidParams(void)
+void test_TbxChecksumCrc32Calculate_ShouldReturnCheckValue(void)
 {
-  const uint8_t cryptoKey[] =
-  {
-    0x32, 0x72, 0x35, 0x75, 0x38, 0x78, 0x21, 0x41,
-    0x25, 0x44, 0x2A, 0x47, 0x2D, 0x4B, 0x61, 0x50,
-    0x64, 0x53, 0x67, 0x56, 0x6B, 0x59, 0x70, 0x33,
-    0x73, 0x36, 0x76, 0x39, 0x79, 0x24, 0x42, 0x3F
-  };
-  uint8_t sourceData[] = 
+  const uint8_t sourceData[] = 
   {
-    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
-    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
   };
-  uint8_t tmpBuffer[sizeof(sourceData)/sizeof(sourceData[0])];
   const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
-  uint8_t idx;
-  uint8_t dataChanged;
 
-  /* Pass a NULL pointer for the data byte array. */
-  TbxCryptoAes256Encrypt(NULL, sourceLen, cryptoKey);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify the correctness of the checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0x0376E6E7UL, TbxChecksumCrc32Calculate(sourceData, sourceLen));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc32Calculate_ShouldReturnCheckValue ***/
 
-  /* Reset the assertion counter. */
-  assertionCnt = 0;
-  /* Copy the source data to the temp buffer. */
-  for (idx = 0; idx < sourceLen; idx++)
+
+/************************************************************************************//**
+** \brief     Tests that processing the data in chunks with the default parameters
+**            results in the same 32-bit CRC as processing it all at once.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc32Update_ShouldMatchCalculateInChunks(void)
+{
+  tTbxChecksumCrc32 ctx;
+  uint8_t sourceData[61];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  size_t chunkLen;
+
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
   {
-    tmpBuffer[idx] = sourceData[idx];
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
   }
-  /* Pass a size of zero. */
-  TbxCryptoAes256Encrypt(tmpBuffer, 0, cryptoKey);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that no encryption was attempted. */
-  dataChanged = TBX_FALSE;
-  for (idx = 0; idx < sourceLen; idx++)
+  /* Process the data in chunks of different lengths. */
+  for (chunkLen = 1U; chunkLen <= 13U; chunkLen++)
   {
-    if (tmpBuffer[idx] != sourceData[idx])
+    TbxChecksumCrc32Init(&ctx, NULL);
+    for (size_t idx = 0U; idx < sourceLen; idx += chunkLen)
     {
-      dataChanged = TBX_TRUE;
-      break;
+      TbxChecksumCrc32Update(&ctx, &sourceData[idx],
+                             ((sourceLen - idx) < chunkLen) ? (sourceLen - idx) :
+                                                              chunkLen);
     }
+    TEST_ASSERT_EQUAL_UINT32(TbxChecksumCrc32Calculate(sourceData, sourceLen),
+                             TbxChecksumCrc32Final(&ctx));
   }
-  TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc32Update_ShouldMatchCalculateInChunks ***/
 
-  /* Reset the assertion counter. */
-  assertionCnt = 0;
-  /* Copy the source data to the temp buffer. */
-  for (idx = 0; idx < sourceLen; idx++)
-  {
-    tmpBuffer[idx] = sourceData[idx];
-  }
-  /* Pass a size that is not aligned to the AES256 block size. */
-  TbxCryptoAes256Encrypt(tmpBuffer, 15, cryptoKey);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that no encryption was attempted. */
-  dataChanged = TBX_FALSE;
-  for (idx = 0; idx < sourceLen; idx++)
+
+/************************************************************************************//**
+** \brief     Tests that processing a large chunk of data results in the same 32-bit CRC
+**            as processing it one byte at a time, for each predefined parameter set.
+**            Large chunks can be processed by the CRC related instructions of the CPU,
+**            if the port offers hardware acceleration.
+**
+****************************************************************************************/
+void test_TbxChecksumCrc32Update_ShouldMatchBytewiseInLargeChunk(void)
+{
+  const tTbxChecksumCrc32Params paramSets[] =
   {
-    if (tmpBuffer[idx] != sourceData[idx])
-    {
-      dataChanged = TBX_TRUE;
-      break;
-    }
-  }
-  TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
+    TBX_CHECKSUM_CRC32_MPEG2,
+    TBX_CHECKSUM_CRC32_ISO_HDLC,
+    TBX_CHECKSUM_CRC32_BZIP2,
+    TBX_CHECKSUM_CRC32_ISCSI
+  };
+  const size_t numParamSets = sizeof(paramSets)/sizeof(paramSets[0]);
+  uint8_t sourceData[300];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  tTbxChecksumCrc32 ctxChunk;
+  tTbxChecksumCrc32 ctxBytewise;
 
-  /* Reset the assertion counter. */
-  assertionCnt = 0;
-  /* Copy the source data to the temp buffer. */
-  for (idx = 0; idx < sourceLen; idx++)
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
   {
-    tmpBuffer[idx] = sourceData[idx];
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
   }
-  /* Pass a NULL pointer for the key. */
-  TbxCryptoAes256Encrypt(tmpBuffer, sourceLen, NULL);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that no encryption was attempted. */
-  dataChanged = TBX_FALSE;
-  for (idx = 0; idx < sourceLen; idx++)
+  /* Compare the results for each parameter set. */
+  for (size_t setIdx = 0U; setIdx < numParamSets; setIdx++)
   {
-    if (tmpBuffer[idx] != sourceData[idx])
+    TbxChecksumCrc32Init(&ctxChunk, &paramSets[setIdx]);
+    TbxChecksumCrc32Init(&ctxBytewise, &paramSets[setIdx]);
+    TbxChecksumCrc32Update(&ctxChunk, sourceData, sourceLen);
+    for (size_t idx = 0U; idx < sourceLen; idx++)
     {
-      dataChanged = TBX_TRUE;
-      break;
+      TbxChecksumCrc32Update(&ctxBytewise, &sourceData[idx], 1U);
     }
+    TEST_ASSERT_EQUAL_UINT32(TbxChecksumCrc32Final(&ctxBytewise),
+                             TbxChecksumCrc32Final(&ctxChunk));
   }
-  TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
-} /*** end of test_TbxCryptoAes256Encrypt_ShouldAssertOnInvalidParams ***/
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc32Update_ShouldMatchBytewiseInLargeChunk ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that data is properly encrypted.
+** \brief     Tests that the streaming 32-bit CRC functions match the published check
+**            values of the predefined parameter sets. This includes reflected algorithms
+**            and an algorithm with a different polynomial.
 **
 ****************************************************************************************/
-void test_TbxCryptoAes256Encrypt_ShouldEncrypt(void)
+void test_TbxChecksumCrc32Final_ShouldReturnCheckValues(void)
 {
-  const uint8_t cryptoKey[] =
+  const tTbxChecksumCrc32Params mpeg2 = TBX_CHECKSUM_CRC32_MPEG2;
+  const tTbxChecksumCrc32Params isoHdlc = TBX_CHECKSUM_CRC32_ISO_HDLC;
+  const tTbxChecksumCrc32Params bzip2 = TBX_CHECKSUM_CRC32_BZIP2;
+  const tTbxChecksumCrc32Params iscsi = TBX_CHECKSUM_CRC32_ISCSI;
+  const uint8_t sourceData[] = 
   {
-    0x32, 0x72, 0x35, 0x75, 0x38, 0x78, 0x21, 0x41,
-    0x25, 0x44, 0x2A, 0x47, 0x2D, 0x4B, 0x61, 0x50,
-    0x64, 0x53, 0x67, 0x56, 0x6B, 0x59, 0x70, 0x33,
-    0x73, 0x36, 0x76, 0x39, 0x79, 0x24, 0x42, 0x3F
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
   };
-  uint8_t sourceData[] = 
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  tTbxChecksumCrc32 ctx;
+
+  /* Verify the correctness of the checksum calculation, in two chunks. */
+  TbxChecksumCrc32Init(&ctx, &mpeg2);
+  TbxChecksumCrc32Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc32Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT32(0x0376E6E7UL, TbxChecksumCrc32Final(&ctx));
+  TbxChecksumCrc32Init(&ctx, &isoHdlc);
+  TbxChecksumCrc32Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc32Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT32(0xCBF43926UL, TbxChecksumCrc32Final(&ctx));
+  TbxChecksumCrc32Init(&ctx, &bzip2);
+  TbxChecksumCrc32Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc32Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT32(0xFC891918UL, TbxChecksumCrc32Final(&ctx));
+  TbxChecksumCrc32Init(&ctx, &iscsi);
+  TbxChecksumCrc32Update(&ctx, &sourceData[0], 4U);
+  TbxChecksumCrc32Update(&ctx, &sourceData[4], sourceLen - 4U);
+  TEST_ASSERT_EQUAL_UINT32(0xE3069283UL, TbxChecksumCrc32Final(&ctx));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumCrc32Final_ShouldReturnCheckValues ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and do not perform the
+**            actual checksum calculation.
+**
+****************************************************************************************/
+void test_TbxChecksumFletcher32Calculate_ShouldAssertOnInvalidParams(void)
+{
+  uint32_t checksum;
+  const uint8_t sourceData[] = 
   {
-    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
-    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
   };
-  /* Obtained using an online AES calculator using a 256 bit key and ECB:
-   * http://aes.online-domain-tools.com/
-   */
-  const uint8_t expectedData[] = 
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+
+  /* Pass a NULL pointer for the data byte array. */
+  checksum = TbxChecksumFletcher32Calculate(NULL, sourceLen);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0, checksum);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass an invalid size. */
+  checksum = TbxChecksumFletcher32Calculate(sourceData, 0);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0, checksum);
+} /*** end of test_TbxChecksumFletcher32Calculate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the Fletcher-32 checksum matches published check values, for
+**            both an odd and an even number of data bytes.
+**
+****************************************************************************************/
+void test_TbxChecksumFletcher32Calculate_ShouldReturnCheckValues(void)
+{
+  /* Verify the correctness of the checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0xF04FC729UL,
+                           TbxChecksumFletcher32Calculate((uint8_t const *)"abcde", 5U));
+  TEST_ASSERT_EQUAL_UINT32(0x56502D2AUL,
+                           TbxChecksumFletcher32Calculate((uint8_t const *)"abcdef", 6U));
+  TEST_ASSERT_EQUAL_UINT32(0xEBE19591UL,
+                           TbxChecksumFletcher32Calculate((uint8_t const *)"abcdefgh",
+                                                          8U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumFletcher32Calculate_ShouldReturnCheckValues ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that processing the data in chunks results in the same Fletcher-32
+**            checksum as processing it all at once. This includes chunks with an odd
+**            number of bytes.
+**
+****************************************************************************************/
+void test_TbxChecksumFletcher32Update_ShouldMatchCalculateInChunks(void)
+{
+  tTbxChecksumFletcher32 ctx;
+  uint8_t sourceData[301];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  size_t chunkLen;
+  size_t thisLen;
+
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
   {
-    0xC1, 0x2A, 0x81, 0xC0, 0x6C, 0xC3, 0xDB, 0x9F,
-    0x70, 0x54, 0x74, 0xB4, 0xB9, 0x3E, 0xA3, 0x1B,
-    0xF7, 0xA2, 0xEC, 0xAF, 0x39, 0x0F, 0x9D, 0x43,
-    0x00, 0x0F, 0x82, 0xF8, 0xBC, 0xFE, 0x23, 0x1A
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
+  }
+  /* Process the data in chunks of different lengths. */
+  for (chunkLen = 1U; chunkLen <= 21U; chunkLen++)
+  {
+    TbxChecksumFletcher32Init(&ctx);
+    for (size_t idx = 0U; idx < sourceLen; idx += chunkLen)
+    {
+      thisLen = ((sourceLen - idx) < chunkLen) ? (sourceLen - idx) : chunkLen;
+      TbxChecksumFletcher32Update(&ctx, &sourceData[idx], thisLen);
+    }
+    TEST_ASSERT_EQUAL_UINT32(TbxChecksumFletcher32Calculate(sourceData, sourceLen),
+                             TbxChecksumFletcher32Final(&ctx));
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumFletcher32Update_ShouldMatchCalculateInChunks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and do not perform the
+**            actual checksum calculation.
+**
+****************************************************************************************/
+void test_TbxChecksumAdler32Calculate_ShouldAssertOnInvalidParams(void)
+{
+  uint32_t checksum;
+  const uint8_t sourceData[] = 
+  {
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
   };
-  uint8_t tmpBuffer[sizeof(sourceData)/sizeof(sourceData[0])];
   const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
-  uint8_t idx;
-  uint8_t dataOkay = TBX_TRUE;
 
-  /* Copy the source data to the temp buffer. */
-  for (idx = 0; idx < sourceLen; idx++)
+  /* Pass a NULL pointer for the data byte array. */
+  checksum = TbxChecksumAdler32Calculate(NULL, sourceLen);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0, checksum);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass an invalid size. */
+  checksum = TbxChecksumAdler32Calculate(sourceData, 0);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0, checksum);
+} /*** end of test_TbxChecksumAdler32Calculate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the Adler-32 checksum matches published check values.
+**
+****************************************************************************************/
+void test_TbxChecksumAdler32Calculate_ShouldReturnCheckValues(void)
+{
+  /* Verify the correctness of the checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0x091E01DEUL,
+                           TbxChecksumAdler32Calculate((uint8_t const *)"123456789", 9U));
+  TEST_ASSERT_EQUAL_UINT32(0x11E60398UL,
+                           TbxChecksumAdler32Calculate((uint8_t const *)"Wikipedia", 9U));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumAdler32Calculate_ShouldReturnCheckValues ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that processing the data in chunks results in the same Adler-32
+**            checksum as processing it all at once. This includes chunks with an odd
+**            number of bytes.
+**
+****************************************************************************************/
+void test_TbxChecksumAdler32Update_ShouldMatchCalculateInChunks(void)
+{
+  tTbxChecksumAdler32 ctx;
+  uint8_t sourceData[301];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  size_t chunkLen;
+  size_t thisLen;
+
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
   {
-    tmpBuffer[idx] = sourceData[idx];
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
+  }
+  /* Process the data in chunks of different lengths. */
+  for (chunkLen = 1U; chunkLen <= 21U; chunkLen++)
+  {
+    TbxChecksumAdler32Init(&ctx);
+    for (size_t idx = 0U; idx < sourceLen; idx += chunkLen)
+    {
+      thisLen = ((sourceLen - idx) < chunkLen) ? (sourceLen - idx) : chunkLen;
+      TbxChecksumAdler32Update(&ctx, &sourceData[idx], thisLen);
+    }
+    TEST_ASSERT_EQUAL_UINT32(TbxChecksumAdler32Calculate(sourceData, sourceLen),
+                             TbxChecksumAdler32Final(&ctx));
   }
-  /* Perform the encryption. */
-  TbxCryptoAes256Encrypt(tmpBuffer, sourceLen, cryptoKey);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-  /* Verify that the encrypted data is as expected. */
-  for (idx = 0; idx < sourceLen; idx++)
+} /*** end of test_TbxChecksumAdler32Update_ShouldMatchCalculateInChunks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and do not perform the
+**            actual checksum calculation.
+**
+****************************************************************************************/
+void test_TbxChecksumXxHash32Calculate_ShouldAssertOnInvalidParams(void)
+{
+  uint32_t checksum;
+  const uint8_t sourceData[] = 
   {
-    if (tmpBuffer[idx] != expectedData[idx])
+    '1', '2', '3', '4', '5', '6', '7', '8', '9'
+  };
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+
+  /* Pass a NULL pointer for the data byte array. */
+  checksum = TbxChecksumXxHash32Calculate(NULL, sourceLen, 0U);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0, checksum);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass an invalid size. */
+  checksum = TbxChecksumXxHash32Calculate(sourceData, 0, 0U);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that it did not continue with the actual checksum calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0, checksum);
+} /*** end of test_TbxChecksumXxHash32Calculate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the xxHash32 hash matches published reference values. This
+**            includes data that is shorter and longer than one 16-byte stripe, an empty
+**            chunk of data and a seed.
+**
+****************************************************************************************/
+void test_TbxChecksumXxHash32Calculate_ShouldReturnCheckValues(void)
+{
+  const char longText[] = "Nobody inspects the spammish repetition";
+  const char seedText[] = "I want an unsigned 32-bit seed!";
+  tTbxChecksumXxHash32 ctx;
+
+  /* Verify the correctness of the hash calculation. */
+  TEST_ASSERT_EQUAL_UINT32(0x32D153FFUL,
+                           TbxChecksumXxHash32Calculate((uint8_t const *)"abc", 3U, 0U));
+  TEST_ASSERT_EQUAL_UINT32(0xE2293B2FUL,
+                           TbxChecksumXxHash32Calculate((uint8_t const *)longText,
+                                                        sizeof(longText) - 1U, 0U));
+  TEST_ASSERT_EQUAL_UINT32(0xF7A35AF8UL,
+                           TbxChecksumXxHash32Calculate((uint8_t const *)seedText,
+                                                        sizeof(seedText) - 1U, 0U));
+  TEST_ASSERT_EQUAL_UINT32(0xD8D4B4BAUL,
+                           TbxChecksumXxHash32Calculate((uint8_t const *)seedText,
+                                                        sizeof(seedText) - 1U, 1U));
+  /* The hash of no data at all is only possible with the streaming functions. */
+  TbxChecksumXxHash32Init(&ctx, 0U);
+  TbxChecksumXxHash32Update(&ctx, NULL, 0U);
+  TEST_ASSERT_EQUAL_UINT32(0x02CC5D05UL, TbxChecksumXxHash32Final(&ctx));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumXxHash32Calculate_ShouldReturnCheckValues ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that processing the data in chunks results in the same xxHash32 hash
+**            as processing it all at once. This includes chunks with an odd number of
+**            bytes.
+**
+****************************************************************************************/
+void test_TbxChecksumXxHash32Update_ShouldMatchCalculateInChunks(void)
+{
+  tTbxChecksumXxHash32 ctx;
+  uint8_t sourceData[301];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  size_t chunkLen;
+  size_t thisLen;
+
+  /* Fill the data with a pattern. */
+  for (size_t idx = 0U; idx < sourceLen; idx++)
+  {
+    sourceData[idx] = (uint8_t)((idx * 37U) + 11U);
+  }
+  /* Process the data in chunks of different lengths. */
+  for (chunkLen = 1U; chunkLen <= 21U; chunkLen++)
+  {
+    TbxChecksumXxHash32Init(&ctx, 0x9E3779B9UL);
+    for (size_t idx = 0U; idx < sourceLen; idx += chunkLen)
     {
-      dataOkay = TBX_FALSE;
+      thisLen = ((sourceLen - idx) < chunkLen) ? (sourceLen - idx) : chunkLen;
+      TbxChecksumXxHash32Update(&ctx, &sourceData[idx], thisLen);
     }
+    TEST_ASSERT_EQUAL_UINT32(TbxChecksumXxHash32Calculate(sourceData, sourceLen,
+                                                          0x9E3779B9UL),
+                             TbxChecksumXxHash32Final(&ctx));
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, dataOkay);
-} /*** end of test_TbxCryptoAes256Encrypt_ShouldEncrypt ***/
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxChecksumXxHash32Update_ShouldMatchCalculateInChunks ***/
 
 
 /************************************************************************************//**
 ** \brief     Tests that invalid parameters trigger an assertion and do not perform the
-**            actual decryption.
+**            actual encryption.
 **
 ****************************************************************************************/
-void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
+void test_TbxCryptoAes256Encrypt_ShouldAssertOnInvalidParams(void)
 {
   const uint8_t cryptoKey[] =
   {
@@ -772,10 +2001,10 @@ void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
   };
   uint8_t sourceData[] = 
   {
-    0xC1, 0x2A, 0x81, 0xC0, 0x6C, 0xC3, 0xDB, 0x9F,
-    0x70, 0x54, 0x74, 0xB4, 0xB9, 0x3E, 0xA3, 0x1B,
-    0xF7, 0xA2, 0xEC, 0xAF, 0x39, 0x0F, 0x9D, 0x43,
-    0x00, 0x0F, 0x82, 0xF8, 0xBC, 0xFE, 0x23, 0x1A
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
   };
   uint8_t tmpBuffer[sizeof(sourceData)/sizeof(sourceData[0])];
   const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
@@ -783,7 +2012,7 @@ void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
   uint8_t dataChanged;
 
   /* Pass a NULL pointer for the data byte array. */
-  TbxCryptoAes256Decrypt(NULL, sourceLen, cryptoKey);
+  TbxCryptoAes256Encrypt(NULL, sourceLen, cryptoKey);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
 
@@ -795,10 +2024,10 @@ void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
     tmpBuffer[idx] = sourceData[idx];
   }
   /* Pass a size of zero. */
-  TbxCryptoAes256Decrypt(tmpBuffer, 0, cryptoKey);
+  TbxCryptoAes256Encrypt(tmpBuffer, 0, cryptoKey);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that no decryption was attempted. */
+  /* Verify that no encryption was attempted. */
   dataChanged = TBX_FALSE;
   for (idx = 0; idx < sourceLen; idx++)
   {
@@ -818,10 +2047,10 @@ void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
     tmpBuffer[idx] = sourceData[idx];
   }
   /* Pass a size that is not aligned to the AES256 block size. */
-  TbxCryptoAes256Decrypt(tmpBuffer, 15, cryptoKey);
+  TbxCryptoAes256Encrypt(tmpBuffer, 15, cryptoKey);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that no decryption was attempted. */
+  /* Verify that no encryption was attempted. */
   dataChanged = TBX_FALSE;
   for (idx = 0; idx < sourceLen; idx++)
   {
@@ -841,10 +2070,10 @@ void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
     tmpBuffer[idx] = sourceData[idx];
   }
   /* Pass a NULL pointer for the key. */
-  TbxCryptoAes256Decrypt(tmpBuffer, sourceLen, NULL);
+  TbxCryptoAes256Encrypt(tmpBuffer, sourceLen, NULL);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Verify that no decryption was attempted. */
+  /* Verify that no encryption was attempted. */
   dataChanged = TBX_FALSE;
   for (idx = 0; idx < sourceLen; idx++)
   {
@@ -855,14 +2084,14 @@ void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
     }
   }
   TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
-} /*** end of test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxCryptoAes256Encrypt_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that data is properly decrypted.
+** \brief     Tests that data is properly encrypted.
 **
 ****************************************************************************************/
-void test_TbxCryptoAes256Decrypt_ShouldDecrypt(void)
+void test_TbxCryptoAes256Encrypt_ShouldEncrypt(void)
 {
   const uint8_t cryptoKey[] =
   {
@@ -872,19 +2101,22 @@ void test_TbxCryptoAes256Decrypt_ShouldDecrypt(void)
     0x73, 0x36, 0x76, 0x39, 0x79, 0x24, 0x42, 0x3F
   };
   uint8_t sourceData[] = 
-  {
-    0xC1, 0x2A, 0x81, 0xC0, 0x6C, 0xC3, 0xDB, 0x9F,
-    0x70, 0x54, 0x74, 0xB4, 0xB9, 0x3E, 0xA3, 0x1B,
-    0xF7, 0xA2, 0xEC, 0xAF, 0x39, 0x0F, 0x9D, 0x43,
-    0x00, 0x0F, 0x82, 0xF8, 0xBC, 0xFE, 0x23, 0x1A
-  };
-  const uint8_t expectedData[] = 
   {
     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
     0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
     0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
   };
+  /* Obtained using an online AES calculator using a 256 bit key and ECB:
+   * http://aes.online-domain-tools.com/
+   */
+  const uint8_t expectedData[] = 
+  {
+    0xC1, 0x2A, 0x81, 0xC0, 0x6C, 0xC3, 0xDB, 0x9F,
+    0x70, 0x54, 0x74, 0xB4, 0xB9, 0x3E, 0xA3, 0x1B,
+    0xF7, 0xA2, 0xEC, 0xAF, 0x39, 0x0F, 0x9D, 0x43,
+    0x00, 0x0F, 0x82, 0xF8, 0xBC, 0xFE, 0x23, 0x1A
+  };
   uint8_t tmpBuffer[sizeof(sourceData)/sizeof(sourceData[0])];
   const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
   uint8_t idx;
@@ -895,11 +2127,11 @@ void test_TbxCryptoAes256Decrypt_ShouldDecrypt(void)
   {
     tmpBuffer[idx] = sourceData[idx];
   }
-  /* Perform the decryption. */
-  TbxCryptoAes256Decrypt(tmpBuffer, sourceLen, cryptoKey);
+  /* Perform the encryption. */
+  TbxCryptoAes256Encrypt(tmpBuffer, sourceLen, cryptoKey);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-  /* Verify that the decrypted data is as expected. */
+  /* Verify that the encrypted data is as expected. */
   for (idx = 0; idx < sourceLen; idx++)
   {
     if (tmpBuffer[idx] != expectedData[idx])
@@ -908,288 +2140,1102 @@ void test_TbxCryptoAes256Decrypt_ShouldDecrypt(void)
     }
   }
   TEST_ASSERT_EQUAL(TBX_TRUE, dataOkay);
-} /*** end of test_TbxCryptoAes256Decrypt_ShouldDecrypt ***/
+} /*** end of test_TbxCryptoAes256Encrypt_ShouldEncrypt ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+** \brief     Tests that invalid parameters trigger an assertion and do not perform the
+**            actual decryption.
 **
 ****************************************************************************************/
-void test_TbxMemPoolCreate_ShouldAssertOnInvalidParams(void)
+void test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams(void)
 {
-  uint8_t result;
-  size_t  heapFreeBefore;
-  size_t  heapFreeAfter;
+  const uint8_t cryptoKey[] =
+  {
+    0x32, 0x72, 0x35, 0x75, 0x38, 0x78, 0x21, 0x41,
+    0x25, 0x44, 0x2A, 0x47, 0x2D, 0x4B, 0x61, 0x50,
+    0x64, 0x53, 0x67, 0x56, 0x6B, 0x59, 0x70, 0x33,
+    0x73, 0x36, 0x76, 0x39, 0x79, 0x24, 0x42, 0x3F
+  };
+  uint8_t sourceData[] = 
+  {
+    0xC1, 0x2A, 0x81, 0xC0, 0x6C, 0xC3, 0xDB, 0x9F,
+    0x70, 0x54, 0x74, 0xB4, 0xB9, 0x3E, 0xA3, 0x1B,
+    0xF7, 0xA2, 0xEC, 0xAF, 0x39, 0x0F, 0x9D, 0x43,
+    0x00, 0x0F, 0x82, 0xF8, 0xBC, 0xFE, 0x23, 0x1A
+  };
+  uint8_t tmpBuffer[sizeof(sourceData)/sizeof(sourceData[0])];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  uint8_t idx;
+  uint8_t dataChanged;
 
-  /* It should not be possible to create a memory pool with zero blocks. */
-  heapFreeBefore = TbxHeapGetFree();
-  result = TbxMemPoolCreate(0, 16);
-  heapFreeAfter = TbxHeapGetFree();
+  /* Pass a NULL pointer for the data byte array. */
+  TbxCryptoAes256Decrypt(NULL, sourceLen, cryptoKey);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Make sure an error was returned. */
-  TEST_ASSERT_EQUAL(TBX_ERROR, result);
-  /* Make sure no heap memory was allocated. */
-  TEST_ASSERT_EQUAL(heapFreeBefore, heapFreeAfter);
 
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* It should not be possible to create a memory pool of zero sized blocks. */
-  heapFreeBefore = TbxHeapGetFree();
-  result = TbxMemPoolCreate(1, 0);
-  heapFreeAfter = TbxHeapGetFree();
+  /* Copy the source data to the temp buffer. */
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    tmpBuffer[idx] = sourceData[idx];
+  }
+  /* Pass a size of zero. */
+  TbxCryptoAes256Decrypt(tmpBuffer, 0, cryptoKey);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Make sure an error was returned. */
-  TEST_ASSERT_EQUAL(TBX_ERROR, result);
-  /* Make sure no heap memory was allocated. */
-  TEST_ASSERT_EQUAL(heapFreeBefore, heapFreeAfter);
-} /*** end of test_TbxMemPoolCreate_ShouldAssertOnInvalidParams ***/
+  /* Verify that no decryption was attempted. */
+  dataChanged = TBX_FALSE;
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    if (tmpBuffer[idx] != sourceData[idx])
+    {
+      dataChanged = TBX_TRUE;
+      break;
+    }
+  }
+  TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Copy the source data to the temp buffer. */
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    tmpBuffer[idx] = sourceData[idx];
+  }
+  /* Pass a size that is not aligned to the AES256 block size. */
+  TbxCryptoAes256Decrypt(tmpBuffer, 15, cryptoKey);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that no decryption was attempted. */
+  dataChanged = TBX_FALSE;
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    if (tmpBuffer[idx] != sourceData[idx])
+    {
+      dataChanged = TBX_TRUE;
+      break;
+    }
+  }
+  TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Copy the source data to the temp buffer. */
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    tmpBuffer[idx] = sourceData[idx];
+  }
+  /* Pass a NULL pointer for the key. */
+  TbxCryptoAes256Decrypt(tmpBuffer, sourceLen, NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Verify that no decryption was attempted. */
+  dataChanged = TBX_FALSE;
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    if (tmpBuffer[idx] != sourceData[idx])
+    {
+      dataChanged = TBX_TRUE;
+      break;
+    }
+  }
+  TEST_ASSERT_EQUAL(TBX_FALSE, dataChanged);
+} /*** end of test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that it cannot create memory pools that require more memory than
-**            currently available on the heap. It should also returns TBX_ERROR.
+** \brief     Tests that data is properly decrypted.
 **
 ****************************************************************************************/
-void test_TbxMemPoolCreate_CannotAllocateMoreThanFreeHeap(void)
+void test_TbxCryptoAes256Decrypt_ShouldDecrypt(void)
 {
-  uint8_t result;
-  size_t  heapFree;
+  const uint8_t cryptoKey[] =
+  {
+    0x32, 0x72, 0x35, 0x75, 0x38, 0x78, 0x21, 0x41,
+    0x25, 0x44, 0x2A, 0x47, 0x2D, 0x4B, 0x61, 0x50,
+    0x64, 0x53, 0x67, 0x56, 0x6B, 0x59, 0x70, 0x33,
+    0x73, 0x36, 0x76, 0x39, 0x79, 0x24, 0x42, 0x3F
+  };
+  uint8_t sourceData[] = 
+  {
+    0xC1, 0x2A, 0x81, 0xC0, 0x6C, 0xC3, 0xDB, 0x9F,
+    0x70, 0x54, 0x74, 0xB4, 0xB9, 0x3E, 0xA3, 0x1B,
+    0xF7, 0xA2, 0xEC, 0xAF, 0x39, 0x0F, 0x9D, 0x43,
+    0x00, 0x0F, 0x82, 0xF8, 0xBC, 0xFE, 0x23, 0x1A
+  };
+  const uint8_t expectedData[] = 
+  {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+  };
+  uint8_t tmpBuffer[sizeof(sourceData)/sizeof(sourceData[0])];
+  const size_t sourceLen = sizeof(sourceData)/sizeof(sourceData[0]);
+  uint8_t idx;
+  uint8_t dataOkay = TBX_TRUE;
 
-  /* Try to create a memory pool with just one block, but a block size larger than what
-   * is free on the heap at this point.
-   */
-  heapFree = TbxHeapGetFree();
-  result = TbxMemPoolCreate(1, heapFree + 1);
-  /* Make sure an error was returned. */
-  TEST_ASSERT_EQUAL(TBX_ERROR, result);
-} /*** end of test_TbxMemPoolCreate_CannotAllocateMoreThanFreeHeap ***/
+  /* Copy the source data to the temp buffer. */
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    tmpBuffer[idx] = sourceData[idx];
+  }
+  /* Perform the decryption. */
+  TbxCryptoAes256Decrypt(tmpBuffer, sourceLen, cryptoKey);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  /* Verify that the decrypted data is as expected. */
+  for (idx = 0; idx < sourceLen; idx++)
+  {
+    if (tmpBuffer[idx] != expectedData[idx])
+    {
+      dataOkay = TBX_FALSE;
+    }
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, dataOkay);
+} /*** end of test_TbxCryptoAes256Decrypt_ShouldDecrypt ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a memory pool can be created.
+** \brief     Tests that invalid parameters trigger an assertion when initializing an
+**            AES256 context.
 **
 ****************************************************************************************/
-void test_TbxMemPoolCreate_CanCreatePool(void)
+void test_TbxCryptoAes256Init_ShouldAssertOnInvalidParams(void)
 {
-  uint8_t result;
-  size_t heapFreeBefore;
-  size_t heapFreeAfter;
+  const uint8_t cryptoKey[32] = { 0 };
+  const uint8_t iv[16] = { 0 };
+  tTbxCryptoAes256Ctx ctx;
 
-  /* Try to create a memory pool with 2 blocks of 16 bytes. */
-  heapFreeBefore = TbxHeapGetFree();
-  result = TbxMemPoolCreate(memPoolNumBlocks, memPoolBlockSize);
-  heapFreeAfter = TbxHeapGetFree();
+  /* Pass a NULL pointer for the context. */
+  TbxCryptoAes256Init(NULL, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
 
-  /* Make sure no error was returned. */
-  TEST_ASSERT_EQUAL(TBX_OK, result);
-  /* Make sure at least the data for the blocks was allocated from the heap. */
-  TEST_ASSERT_GREATER_OR_EQUAL(memPoolNumBlocks * memPoolBlockSize, 
-                               heapFreeBefore - heapFreeAfter);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass an invalid mode. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR + 1U, cryptoKey, iv);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass a NULL pointer for the key. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, NULL, iv);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass a NULL pointer for the initialization vector in a mode that needs it. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR, cryptoKey, NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass a NULL pointer for the initialization vector in ECB mode, which is allowed. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_ECB, cryptoKey, NULL);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolCreate_CanCreatePool ***/
+  TbxCryptoAes256Done(&ctx);
+} /*** end of test_TbxCryptoAes256Init_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+** \brief     Tests that invalid parameters trigger an assertion and do not perform the
+**            actual encryption, when encrypting with an AES256 context.
 **
 ****************************************************************************************/
-void test_TbxMemPoolAllocate_ShouldAssertOnInvalidParams(void)
+void test_TbxCryptoAes256EncryptUpdate_ShouldAssertOnInvalidParams(void)
 {
-  void * result;
+  const uint8_t cryptoKey[32] = { 0 };
+  const uint8_t iv[16] = { 0 };
+  const uint8_t sourceData[32] = { 0 };
+  uint8_t tmpBuffer[32] = { 0 };
+  tTbxCryptoAes256Ctx ctx;
+
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  /* Pass a NULL pointer for the context. */
+  TbxCryptoAes256EncryptUpdate(NULL, tmpBuffer, sizeof(tmpBuffer));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
 
-  /* Attempt to allocate zero bytes, which is not a valid size. */
-  result = TbxMemPoolAllocate(0);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass a NULL pointer for the data byte array. */
+  TbxCryptoAes256EncryptUpdate(&ctx, NULL, sizeof(tmpBuffer));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
 
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass a size that is not aligned to the AES256 block size. */
+  TbxCryptoAes256EncryptUpdate(&ctx, tmpBuffer, 15U);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Make sure a NULL pointer was returned. */
-  TEST_ASSERT_NULL(result);
-} /*** end of test_TbxMemPoolAllocate_ShouldAssertOnInvalidParams ***/
+  /* Verify that no encryption was attempted. */
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(sourceData, tmpBuffer, sizeof(tmpBuffer));
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Jump to an offset, which is not possible in CBC mode. */
+  TbxCryptoAes256SetOffset(&ctx, 16U);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TbxCryptoAes256Done(&ctx);
+} /*** end of test_TbxCryptoAes256EncryptUpdate_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a block can be allocated from the previously created memory
-**            pool. Use a block size exactly the same for which the memory pool was
-**            created.
+** \brief     Tests that data is properly encrypted in CBC mode, when it is encrypted in
+**            chunks with an AES256 context.
 **
 ****************************************************************************************/
-void test_TbxMemPoolAllocate_CanAllocateSameSize(void)
+void test_TbxCryptoAes256EncryptUpdate_ShouldEncryptCbc(void)
 {
-  /* Attempt to allocate a block inside the previously created memory pool. */
-  memPoolAllocatedBlocks[0] = TbxMemPoolAllocate(memPoolBlockSize);
-  /* Make sure a valid pointer was returned. */
-  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[0]);
+  /* Test vectors of NIST SP 800-38A, F.2.5 CBC-AES256.Encrypt. */
+  const uint8_t cryptoKey[] =
+  {
+    0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE,
+    0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+    0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7,
+    0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4
+  };
+  const uint8_t iv[] =
+  {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+  };
+  uint8_t sourceData[] =
+  {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96,
+    0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C,
+    0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11,
+    0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17,
+    0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+  };
+  const uint8_t expectedData[] =
+  {
+    0xF5, 0x8C, 0x4C, 0x04, 0xD6, 0xE5, 0xF1, 0xBA,
+    0x77, 0x9E, 0xAB, 0xFB, 0x5F, 0x7B, 0xFB, 0xD6,
+    0x9C, 0xFC, 0x4E, 0x96, 0x7E, 0xDB, 0x80, 0x8D,
+    0x67, 0x9F, 0x77, 0x7B, 0xC6, 0x70, 0x2C, 0x7D,
+    0x39, 0xF2, 0x33, 0x69, 0xA9, 0xD9, 0xBA, 0xCF,
+    0xA5, 0x30, 0xE2, 0x63, 0x04, 0x23, 0x14, 0x61,
+    0xB2, 0xEB, 0x05, 0xE2, 0xC3, 0x9B, 0xE9, 0xFC,
+    0xDA, 0x6C, 0x19, 0x07, 0x8C, 0x6A, 0x9D, 0x1B
+  };
+  tTbxCryptoAes256Ctx ctx;
+
+  /* Perform the encryption in two chunks. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[0], 16U);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[16], 48U);
+  TbxCryptoAes256Done(&ctx);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolAllocate_CanAllocateSameSize ***/
+  /* Verify that the encrypted data is as expected. */
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedData, sourceData, sizeof(expectedData));
+} /*** end of test_TbxCryptoAes256EncryptUpdate_ShouldEncryptCbc ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a block cannot be allocated from the previously created memory
-**            pool, when using a block size that is larger than for which the memory pool
-**            was created. It should automatically match it to the memory pool of the
-**            next size. This design decision was made, because you can then implement
-**            logic that automatically increases the size of a memory pool in this case.
+** \brief     Tests that data is properly decrypted in CBC mode, when it is decrypted in
+**            chunks with an AES256 context.
 **
 ****************************************************************************************/
-void test_TbxMemPoolAllocate_CannotAllocateLargerSize(void)
+void test_TbxCryptoAes256DecryptUpdate_ShouldDecryptCbc(void)
 {
-  void * result;
+  /* Test vectors of NIST SP 800-38A, F.2.6 CBC-AES256.Decrypt. */
+  const uint8_t cryptoKey[] =
+  {
+    0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE,
+    0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+    0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7,
+    0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4
+  };
+  const uint8_t iv[] =
+  {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+  };
+  uint8_t sourceData[] =
+  {
+    0xF5, 0x8C, 0x4C, 0x04, 0xD6, 0xE5, 0xF1, 0xBA,
+    0x77, 0x9E, 0xAB, 0xFB, 0x5F, 0x7B, 0xFB, 0xD6,
+    0x9C, 0xFC, 0x4E, 0x96, 0x7E, 0xDB, 0x80, 0x8D,
+    0x67, 0x9F, 0x77, 0x7B, 0xC6, 0x70, 0x2C, 0x7D,
+    0x39, 0xF2, 0x33, 0x69, 0xA9, 0xD9, 0xBA, 0xCF,
+    0xA5, 0x30, 0xE2, 0x63, 0x04, 0x23, 0x14, 0x61,
+    0xB2, 0xEB, 0x05, 0xE2, 0xC3, 0x9B, 0xE9, 0xFC,
+    0xDA, 0x6C, 0x19, 0x07, 0x8C, 0x6A, 0x9D, 0x1B
+  };
+  const uint8_t expectedData[] =
+  {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96,
+    0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C,
+    0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11,
+    0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17,
+    0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+  };
+  tTbxCryptoAes256Ctx ctx;
 
-  /* Attempt to allocate another block inside the previously created memory pool. This
-   * time with a block size slightly larger to test that it does not match it.
-   */
-  result = TbxMemPoolAllocate(memPoolBlockSize + 1);
-  /* Make sure a NULL pointer was returned. */
-  TEST_ASSERT_NULL(result);
+  /* Perform the decryption in two chunks. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  TbxCryptoAes256DecryptUpdate(&ctx, &sourceData[0], 32U);
+  TbxCryptoAes256DecryptUpdate(&ctx, &sourceData[32], 32U);
+  TbxCryptoAes256Done(&ctx);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolAllocate_CannotAllocateLargerSize ***/
+  /* Verify that the decrypted data is as expected. */
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedData, sourceData, sizeof(expectedData));
+} /*** end of test_TbxCryptoAes256DecryptUpdate_ShouldDecryptCbc ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a block can be allocated from the previously created memory
-**            pool. Use a block size that is a bit smaller than for which the memory pool
-**            was created. It should automatically match it to the memory pool of the
-**            next size.
+** \brief     Tests that data is properly encrypted in CTR mode, when it is encrypted in
+**            chunks with lengths that are not aligned to the AES256 block size.
 **
 ****************************************************************************************/
-void test_TbxMemPoolAllocate_CanAllocateSmallerSize(void)
+void test_TbxCryptoAes256EncryptUpdate_ShouldEncryptCtrInChunks(void)
 {
-  /* Attempt to allocate another block inside the previously created memory pool. This
-   * time with a block size slightly smaller to test that it matched it to the memory
-   * pool of the next size.
-   */
-  memPoolAllocatedBlocks[1] = TbxMemPoolAllocate(memPoolBlockSize - 1);
-  /* Make sure a valid pointer was returned. */
-  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[1]);
-  /* Make sure no assertion was triggered. */
-  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolAllocate_CanAllocateSmallerSize ***/
-
+  /* Test vectors of NIST SP 800-38A, F.5.5 CTR-AES256.Encrypt. */
+  const uint8_t cryptoKey[] =
+  {
+    0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE,
+    0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+    0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7,
+    0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4
+  };
+  const uint8_t iv[] =
+  {
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7,
+    0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+  };
+  uint8_t sourceData[] =
+  {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96,
+    0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C,
+    0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11,
+    0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17,
+    0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+  };
+  const uint8_t expectedData[] =
+  {
+    0x60, 0x1E, 0xC3, 0x13, 0x77, 0x57, 0x89, 0xA5,
+    0xB7, 0xA7, 0xF5, 0x04, 0xBB, 0xF3, 0xD2, 0x28,
+    0xF4, 0x43, 0xE3, 0xCA, 0x4D, 0x62, 0xB5, 0x9A,
+    0xCA, 0x84, 0xE9, 0x90, 0xCA, 0xCA, 0xF5, 0xC5,
+    0x2B, 0x09, 0x30, 0xDA, 0xA2, 0x3D, 0xE9, 0x4C,
+    0xE8, 0x70, 0x17, 0xBA, 0x2D, 0x84, 0x98, 0x8D,
+    0xDF, 0xC9, 0xC5, 0x8D, 0xB6, 0x7A, 0xAD, 0xA6,
+    0x13, 0xC2, 0xDD, 0x08, 0x45, 0x79, 0x41, 0xA6
+  };
+  tTbxCryptoAes256Ctx ctx;
+
+  /* Perform the encryption in chunks that end in the middle of a block, including a
+   * trailing partial block.
+   */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR, cryptoKey, iv);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[0], 1U);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[1], 20U);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[21], 0U);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[21], 32U);
+  TbxCryptoAes256EncryptUpdate(&ctx, &sourceData[53], 11U);
+  TbxCryptoAes256Done(&ctx);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  /* Verify that the encrypted data is as expected. */
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedData, sourceData, sizeof(expectedData));
+
+  /* Decrypt it again in one go, which is the same operation. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR, cryptoKey, iv);
+  TbxCryptoAes256DecryptUpdate(&ctx, sourceData, sizeof(sourceData));
+  TbxCryptoAes256Done(&ctx);
+  /* Verify that the data was decrypted back into its original state. */
+  TEST_ASSERT_EQUAL_UINT8(0x6B, sourceData[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x10, sourceData[63]);
+} /*** end of test_TbxCryptoAes256EncryptUpdate_ShouldEncryptCtrInChunks ***/
+
 
 /************************************************************************************//**
-** \brief     Tests that a block cannot be allocated from the previously created memory
-**            pool, when all available blocks are already allocated.
+** \brief     Tests that a part of the data can be decrypted in CTR mode, without
+**            decrypting the data before it. Also tests that the counter block wraps
+**            around.
 **
 ****************************************************************************************/
-void test_TbxMemPoolAllocate_CannotAllocateWhenFull(void)
+void test_TbxCryptoAes256SetOffset_ShouldAllowRandomAccess(void)
 {
-  void * result;
-
-  /* Attempt to allocate another block inside the previously created memory pool. Use
-   * a valid block size for the memory pool.
-   */
-  result = TbxMemPoolAllocate(memPoolBlockSize);
-  /* Make sure a NULL pointer was returned, because the previous tests already allocated
-   * all blocks from this memory pool.
-   */
-  TEST_ASSERT_NULL(result);
+  const uint8_t cryptoKey[] =
+  {
+    0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE,
+    0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+    0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7,
+    0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4
+  };
+  /* Counter block that wraps around to zero after the first block. */
+  const uint8_t iv[] =
+  {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+  };
+  const uint8_t plainData[] =
+  {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96,
+    0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C,
+    0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11,
+    0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17,
+    0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+  };
+  /* Obtained with: openssl enc -aes-256-ctr */
+  const uint8_t encryptedData[] =
+  {
+    0x50, 0xFD, 0x97, 0xC3, 0xE6, 0x1A, 0xBB, 0x48,
+    0x73, 0xFB, 0x78, 0xDF, 0x1E, 0x8E, 0x77, 0xE6,
+    0x4B, 0x45, 0x7C, 0xD6, 0x8A, 0xCC, 0xDA, 0x4A,
+    0x89, 0xFA, 0x23, 0x6C, 0x06, 0xBF, 0x26, 0x05,
+    0xA1, 0xDD, 0x02, 0x1B, 0xA8, 0x26, 0xFB, 0x0A,
+    0x25, 0x2C, 0x6D, 0xC9, 0xB4, 0x34, 0x03, 0x0B,
+    0xE1, 0x91, 0x07, 0x94, 0xAC, 0x13, 0x49, 0xC2,
+    0xD4, 0xCD, 0x7B, 0xF3, 0x9D, 0xA5, 0xFF, 0x03
+  };
+  uint8_t tmpBuffer[sizeof(encryptedData)/sizeof(encryptedData[0])];
+  const size_t sourceLen = sizeof(encryptedData)/sizeof(encryptedData[0]);
+  const size_t offsets[] = { 37U, 0U, 63U, 16U, 5U, 48U };
+  const size_t numOffsets = sizeof(offsets)/sizeof(offsets[0]);
+  tTbxCryptoAes256Ctx ctx;
+  size_t offset;
+
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR, cryptoKey, iv);
+  /* Decrypt the data from different offsets onwards, in a random order. */
+  for (size_t offsetIdx = 0U; offsetIdx < numOffsets; offsetIdx++)
+  {
+    offset = offsets[offsetIdx];
+    for (size_t idx = 0U; idx < sourceLen; idx++)
+    {
+      tmpBuffer[idx] = encryptedData[idx];
+    }
+    TbxCryptoAes256SetOffset(&ctx, offset);
+    TbxCryptoAes256DecryptUpdate(&ctx, &tmpBuffer[offset], sourceLen - offset);
+    /* Verify that the decrypted data is as expected. */
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&plainData[offset], &tmpBuffer[offset],
+                                  sourceLen - offset);
+  }
+  TbxCryptoAes256Done(&ctx);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolAllocate_CannotAllocateWhenFull ***/
+} /*** end of test_TbxCryptoAes256SetOffset_ShouldAllowRandomAccess ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a memory pool can be dynamically increased.
+** \brief     Tests that the AES256 context gives the same results as the software engine,
+**            also for data that spans multiple batches of blocks. If the port offers
+**            hardware acceleration, this compares it with the software engine.
 **
 ****************************************************************************************/
-void test_TbxMemPoolCreate_CanIncreasePoolSize(void)
+void test_TbxCryptoAes256Update_ShouldMatchSoftwareEngine(void)
 {
-  uint8_t increaseResult;
-  void * result;
+  const uint8_t cryptoKey[] =
+  {
+    0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE,
+    0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+    0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7,
+    0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4
+  };
+  /* Counter block that wraps around in its lowest byte after a few blocks. */
+  const uint8_t iv[] =
+  {
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7,
+    0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFB
+  };
+  const size_t chunkLens[] = { 7U, 150U, 16U, 1U };
+  uint8_t plainData[21U * 16U];
+  uint8_t expected[sizeof(plainData)];
+  uint8_t tmpBuffer[sizeof(plainData)];
+  uint8_t counter[16];
+  tbx_aes256_context engine;
+  tTbxCryptoAes256Ctx ctx;
+  size_t offset;
+
+  for (size_t idx = 0U; idx < sizeof(plainData); idx++)
+  {
+    plainData[idx] = (uint8_t)((idx * 7U) + 3U);
+  }
+  tbx_aes256_init(&engine, cryptoKey);
 
-  /* First double-check that the memory pool no longer has free blocks. The previous 
-   * test should have caused this.
-   */
-  result = TbxMemPoolAllocate(memPoolBlockSize);
-  /* Make sure a NULL pointer was returned, because the previous tests already allocated
-   * all blocks from this memory pool.
-   */
-  TEST_ASSERT_NULL(result);
-  
-  /* Now increase the memory pool by one. This is done by create a memory pool with the
-   * same size. Because a memory pool with the same size already exists, the existing
-   * one will simply be increased in size.
-   */
-  increaseResult = TbxMemPoolCreate(1, memPoolBlockSize);
-  /* Make sure no error was returned. */
-  TEST_ASSERT_EQUAL(TBX_OK, increaseResult);
+  /* Calculate the expected CTR result with the software engine. */
+  for (size_t idx = 0U; idx < sizeof(counter); idx++)
+  {
+    counter[idx] = iv[idx];
+  }
+  for (offset = 0U; offset < sizeof(plainData); offset += 16U)
+  {
+    uint8_t keystream[16];
 
-  /* Now one more free block should be available. Verify this by allocating it. */
-  memPoolAllocatedBlocks[2] = TbxMemPoolAllocate(memPoolBlockSize);
-  /* Make sure a valid pointer was returned. */
-  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[2]);
+    for (size_t idx = 0U; idx < 16U; idx++)
+    {
+      keystream[idx] = counter[idx];
+    }
+    tbx_aes256_encrypt_ecb(&engine, keystream);
+    for (size_t idx = 0U; idx < 16U; idx++)
+    {
+      expected[offset + idx] = plainData[offset + idx] ^ keystream[idx];
+    }
+    /* Increment the big endian counter block. */
+    for (size_t idx = 16U; idx > 0U; idx--)
+    {
+      counter[idx - 1U]++;
+      if (counter[idx - 1U] != 0U)
+      {
+        break;
+      }
+    }
+  }
+  /* Encrypt in CTR mode in chunks of varying lengths and verify the result. */
+  for (size_t idx = 0U; idx < sizeof(plainData); idx++)
+  {
+    tmpBuffer[idx] = plainData[idx];
+  }
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR, cryptoKey, iv);
+  offset = 0U;
+  for (size_t chunkIdx = 0U; offset < sizeof(plainData); chunkIdx++)
+  {
+    size_t chunkLen = chunkLens[chunkIdx % (sizeof(chunkLens)/sizeof(chunkLens[0]))];
+
+    if (chunkLen > (sizeof(plainData) - offset))
+    {
+      chunkLen = sizeof(plainData) - offset;
+    }
+    TbxCryptoAes256EncryptUpdate(&ctx, &tmpBuffer[offset], chunkLen);
+    offset += chunkLen;
+  }
+  TbxCryptoAes256Done(&ctx);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, tmpBuffer, sizeof(plainData));
 
+  /* Calculate the expected CBC result with the software engine. */
+  for (offset = 0U; offset < sizeof(plainData); offset += 16U)
+  {
+    for (size_t idx = 0U; idx < 16U; idx++)
+    {
+      expected[offset + idx] = plainData[offset + idx] ^
+                               ((offset == 0U) ? iv[idx] : expected[offset - 16U + idx]);
+    }
+    tbx_aes256_encrypt_ecb(&engine, &expected[offset]);
+  }
+  /* Encrypt in CBC mode and verify the result. */
+  for (size_t idx = 0U; idx < sizeof(plainData); idx++)
+  {
+    tmpBuffer[idx] = plainData[idx];
+  }
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  TbxCryptoAes256EncryptUpdate(&ctx, tmpBuffer, sizeof(tmpBuffer));
+  TbxCryptoAes256Done(&ctx);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, tmpBuffer, sizeof(plainData));
+  /* Decrypt in CBC mode in two chunks and verify the result. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  TbxCryptoAes256DecryptUpdate(&ctx, tmpBuffer, 3U * 16U);
+  TbxCryptoAes256DecryptUpdate(&ctx, &tmpBuffer[3U * 16U], sizeof(tmpBuffer) - (3U * 16U));
+  TbxCryptoAes256Done(&ctx);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(plainData, tmpBuffer, sizeof(plainData));
+
+  tbx_aes256_done(&engine);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolCreate_CanIncreasePoolSize ***/
+} /*** end of test_TbxCryptoAes256Update_ShouldMatchSoftwareEngine ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion.
+** \brief     Tests that encrypting and decrypting into a different array gives the same
+**            results as in place, while leaving the source data untouched.
 **
 ****************************************************************************************/
-void test_TbxMemPoolRelease_ShouldAssertOnInvalidParams(void)
+void test_TbxCryptoAes256EncryptTo_ShouldMatchInPlace(void)
 {
-  /* Pass on a NULL pointer, which should not work. */
-  TbxMemPoolRelease(NULL);
+  const uint8_t cryptoKey[32] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+  const uint8_t iv[16] = { 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7 };
+  const uint8_t modes[] =
+  {
+    TBX_CRYPTO_AES256_MODE_ECB, TBX_CRYPTO_AES256_MODE_CBC, TBX_CRYPTO_AES256_MODE_CTR
+  };
+  uint8_t plainData[10U * 16U];
+  uint8_t expected[sizeof(plainData)];
+  uint8_t encrypted[sizeof(plainData)];
+  uint8_t decrypted[sizeof(plainData)];
+  tTbxCryptoAes256Ctx ctx;
+
+  for (size_t idx = 0U; idx < sizeof(plainData); idx++)
+  {
+    plainData[idx] = (uint8_t)(idx ^ 0x5AU);
+  }
+  for (size_t modeIdx = 0U; modeIdx < sizeof(modes); modeIdx++)
+  {
+    /* Encrypt in place, to obtain the expected result. */
+    for (size_t idx = 0U; idx < sizeof(plainData); idx++)
+    {
+      expected[idx] = plainData[idx];
+    }
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], cryptoKey, iv);
+    TbxCryptoAes256EncryptUpdate(&ctx, expected, sizeof(expected));
+    TbxCryptoAes256Done(&ctx);
+    /* Encrypt into a different array in two chunks and verify the result. */
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], cryptoKey, iv);
+    TbxCryptoAes256EncryptTo(&ctx, plainData, encrypted, 16U);
+    TbxCryptoAes256EncryptTo(&ctx, &plainData[16], &encrypted[16], sizeof(plainData) - 16U);
+    TbxCryptoAes256Done(&ctx);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, encrypted, sizeof(plainData));
+    /* Decrypt into a different array in two chunks and verify the result. */
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], cryptoKey, iv);
+    TbxCryptoAes256DecryptTo(&ctx, encrypted, decrypted, 9U * 16U);
+    TbxCryptoAes256DecryptTo(&ctx, &encrypted[9U * 16U], &decrypted[9U * 16U], 16U);
+    TbxCryptoAes256Done(&ctx);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(plainData, decrypted, sizeof(plainData));
+    /* Verify that the source data was not changed. */
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, encrypted, sizeof(plainData));
+  }
+
+  /* Pass NULL pointers for the source and destination. */
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CTR, cryptoKey, iv);
+  TbxCryptoAes256EncryptTo(&ctx, NULL, encrypted, 16U);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-
   /* Reset the assertion counter. */
   assertionCnt = 0;
+  TbxCryptoAes256DecryptTo(&ctx, encrypted, NULL, 16U);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TbxCryptoAes256Done(&ctx);
+} /*** end of test_TbxCryptoAes256EncryptTo_ShouldMatchInPlace ***/
 
-  /* Next, pass a valid pointer but not one that belongs to a previously allocated
-   * block from any memory pool. Basically use the first allocated pointer and deduct
-   * a bunch of bytes to make sure it is outside of the memory pool range.
+
+/************************************************************************************//**
+** \brief     Tests that encrypting and decrypting data that is spread out over multiple
+**            segments gives the same results as for contiguous data, also when blocks
+**            are split over segments.
+**
+****************************************************************************************/
+void test_TbxCryptoAes256EncryptGather_ShouldMatchContiguous(void)
+{
+  const uint8_t cryptoKey[32] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF };
+  const uint8_t iv[16] = { 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10 };
+  const uint8_t modes[] =
+  {
+    TBX_CRYPTO_AES256_MODE_ECB, TBX_CRYPTO_AES256_MODE_CBC, TBX_CRYPTO_AES256_MODE_CTR
+  };
+  uint8_t plainData[12U * 16U];
+  uint8_t expected[sizeof(plainData)];
+  uint8_t encrypted[sizeof(plainData)];
+  uint8_t decrypted[sizeof(plainData)];
+  /* Segments of different lengths, including an empty one and ones that are shorter
+   * than a block.
    */
-  TbxMemPoolRelease(memPoolAllocatedBlocks[0] - 0x1000);
+  const tTbxCryptoSegment plainSegments[] =
+  {
+    { &plainData[0],   5U },
+    { &plainData[5],   7U },
+    { &plainData[12],  0U },
+    { &plainData[12], 37U },
+    { &plainData[49], 143U }
+  };
+  const tTbxCryptoSegment encryptedSegments[] =
+  {
+    { &encrypted[0],  64U },
+    { &encrypted[64], 15U },
+    { &encrypted[79], 113U }
+  };
+  const tTbxCryptoSegment misalignedSegments[] =
+  {
+    { &plainData[0], 16U },
+    { &plainData[16], 3U }
+  };
+  tTbxCryptoAes256Ctx ctx;
+
+  for (size_t idx = 0U; idx < sizeof(plainData); idx++)
+  {
+    plainData[idx] = (uint8_t)((idx * 13U) + 1U);
+  }
+  for (size_t modeIdx = 0U; modeIdx < sizeof(modes); modeIdx++)
+  {
+    /* Encrypt contiguous data, to obtain the expected result. */
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], cryptoKey, iv);
+    TbxCryptoAes256EncryptTo(&ctx, plainData, expected, sizeof(plainData));
+    TbxCryptoAes256Done(&ctx);
+    /* Encrypt the segments and verify the result. */
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], cryptoKey, iv);
+    TbxCryptoAes256EncryptGather(&ctx, plainSegments,
+                                 sizeof(plainSegments)/sizeof(plainSegments[0]),
+                                 encrypted);
+    TbxCryptoAes256Done(&ctx);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, encrypted, sizeof(plainData));
+    /* Decrypt differently split segments and verify the result. */
+    TbxCryptoAes256Init(&ctx, modes[modeIdx], cryptoKey, iv);
+    TbxCryptoAes256DecryptGather(&ctx, encryptedSegments,
+                                 sizeof(encryptedSegments)/sizeof(encryptedSegments[0]),
+                                 decrypted);
+    TbxCryptoAes256Done(&ctx);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(plainData, decrypted, sizeof(plainData));
+  }
+
+  /* Pass segments with a total length that is not aligned to the AES256 block size. */
+  for (size_t idx = 0U; idx < sizeof(encrypted); idx++)
+  {
+    encrypted[idx] = 0U;
+    decrypted[idx] = 0U;
+  }
+  TbxCryptoAes256Init(&ctx, TBX_CRYPTO_AES256_MODE_CBC, cryptoKey, iv);
+  TbxCryptoAes256EncryptGather(&ctx, misalignedSegments, 2U, encrypted);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolRelease_ShouldAssertOnInvalidParams ***/
+  /* Verify that no encryption was attempted. */
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(decrypted, encrypted, sizeof(encrypted));
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass a NULL pointer for the segments. */
+  TbxCryptoAes256EncryptGather(&ctx, NULL, 2U, encrypted);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TbxCryptoAes256Done(&ctx);
+} /*** end of test_TbxCryptoAes256EncryptGather_ShouldMatchContiguous ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that all previously allocated blocks can be released back to the
-**            memory pool.
+** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
 **
 ****************************************************************************************/
-void test_TbxMemPoolRelease_CanReleaseBlocks(void)
+void test_TbxMemPoolCreate_ShouldAssertOnInvalidParams(void)
 {
-  /* Release all previously allocated blocks. */
-  TbxMemPoolRelease(memPoolAllocatedBlocks[0]);
-  TbxMemPoolRelease(memPoolAllocatedBlocks[1]);
-  TbxMemPoolRelease(memPoolAllocatedBlocks[2]);
-  /* Make sure no assertion was triggered. */
-  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxMemPoolRelease_CanReleaseBlocks ***/
+  uint8_t result;
+  size_t  heapFreeBefore;
+  size_t  heapFreeAfter;
+
+  /* It should not be possible to create a memory pool with zero blocks. */
+  heapFreeBefore = TbxHeapGetFree();
+  result = TbxMemPoolCreate(0, 16);
+  heapFreeAfter = TbxHeapGetFree();
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Make sure an error was returned. */
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  /* Make sure no heap memory was allocated. */
+  TEST_ASSERT_EQUAL(heapFreeBefore, heapFreeAfter);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a memory pool of zero sized blocks. */
+  heapFreeBefore = TbxHeapGetFree();
+  result = TbxMemPoolCreate(1, 0);
+  heapFreeAfter = TbxHeapGetFree();
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Make sure an error was returned. */
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  /* Make sure no heap memory was allocated. */
+  TEST_ASSERT_EQUAL(heapFreeBefore, heapFreeAfter);
+} /*** end of test_TbxMemPoolCreate_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that all previously released blocks can be reallocated.
+** \brief     Tests that it cannot create memory pools that require more memory than
+**            currently available on the heap. It should also returns TBX_ERROR.
 **
 ****************************************************************************************/
-void test_TbxMemPoolAllocate_CanReallocate(void)
+void test_TbxMemPoolCreate_CannotAllocateMoreThanFreeHeap(void)
 {
-  void * result;
+  uint8_t result;
+  size_t  heapFree;
+
+  /* Try to create a memory pool with just one block, but a block size larger than what
+   * is free on the heap at this point.
+   */
+  heapFree = TbxHeapGetFree();
+  result = TbxMemPoolCreate(1, heapFree + 1);
+  /* Make sure an error was returned. */
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+} /*** end of test_TbxMemPoolCreate_CannotAllocateMoreThanFreeHeap ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a memory pool can be created.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreate_CanCreatePool(void)
+{
+  uint8_t result;
   size_t heapFreeBefore;
   size_t heapFreeAfter;
 
-  /* Get the current free heap size. */
+  /* Try to create a memory pool with 2 blocks of 16 bytes. */
   heapFreeBefore = TbxHeapGetFree();
+  result = TbxMemPoolCreate(memPoolNumBlocks, memPoolBlockSize);
+  heapFreeAfter = TbxHeapGetFree();
 
-  /* Attempt to allocate the first block. */
+  /* Make sure no error was returned. */
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  /* Make sure at least the data for the blocks was allocated from the heap. */
+  TEST_ASSERT_GREATER_OR_EQUAL(memPoolNumBlocks * memPoolBlockSize, 
+                               heapFreeBefore - heapFreeAfter);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolCreate_CanCreatePool ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_ShouldAssertOnInvalidParams(void)
+{
+  void * result;
+
+  /* Attempt to allocate zero bytes, which is not a valid size. */
+  result = TbxMemPoolAllocate(0);
+
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Make sure a NULL pointer was returned. */
+  TEST_ASSERT_NULL(result);
+} /*** end of test_TbxMemPoolAllocate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a block can be allocated from the previously created memory
+**            pool. Use a block size exactly the same for which the memory pool was
+**            created.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_CanAllocateSameSize(void)
+{
+  /* Attempt to allocate a block inside the previously created memory pool. */
   memPoolAllocatedBlocks[0] = TbxMemPoolAllocate(memPoolBlockSize);
   /* Make sure a valid pointer was returned. */
   TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[0]);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocate_CanAllocateSameSize ***/
 
-  /* Reset the assertion counter. */
+
+/************************************************************************************//**
+** \brief     Tests that a block cannot be allocated from the previously created memory
+**            pool, when using a block size that is larger than for which the memory pool
+**            was created. It should automatically match it to the memory pool of the
+**            next size. This design decision was made, because you can then implement
+**            logic that automatically increases the size of a memory pool in this case.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_CannotAllocateLargerSize(void)
+{
+  void * result;
+
+  /* Attempt to allocate another block inside the previously created memory pool. This
+   * time with a block size slightly larger to test that it does not match it.
+   */
+  result = TbxMemPoolAllocate(memPoolBlockSize + 1);
+  /* Make sure a NULL pointer was returned. */
+  TEST_ASSERT_NULL(result);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocate_CannotAllocateLargerSize ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a block can be allocated from the previously created memory
+**            pool. Use a block size that is a bit smaller than for which the memory pool
+**            was created. It should automatically match it to the memory pool of the
+**            next size.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_CanAllocateSmallerSize(void)
+{
+  /* Attempt to allocate another block inside the previously created memory pool. This
+   * time with a block size slightly smaller to test that it matched it to the memory
+   * pool of the next size.
+   */
+  memPoolAllocatedBlocks[1] = TbxMemPoolAllocate(memPoolBlockSize - 1);
+  /* Make sure a valid pointer was returned. */
+  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[1]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocate_CanAllocateSmallerSize ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a block cannot be allocated from the previously created memory
+**            pool, when all available blocks are already allocated.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_CannotAllocateWhenFull(void)
+{
+  void * result;
+
+  /* Attempt to allocate another block inside the previously created memory pool. Use
+   * a valid block size for the memory pool.
+   */
+  result = TbxMemPoolAllocate(memPoolBlockSize);
+  /* Make sure a NULL pointer was returned, because the previous tests already allocated
+   * all blocks from this memory pool.
+   */
+  TEST_ASSERT_NULL(result);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocate_CannotAllocateWhenFull ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a memory pool can be dynamically increased.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreate_CanIncreasePoolSize(void)
+{
+  uint8_t increaseResult;
+  void * result;
+
+  /* First double-check that the memory pool no longer has free blocks. The previous 
+   * test should have caused this.
+   */
+  result = TbxMemPoolAllocate(memPoolBlockSize);
+  /* Make sure a NULL pointer was returned, because the previous tests already allocated
+   * all blocks from this memory pool.
+   */
+  TEST_ASSERT_NULL(result);
+  
+  /* Now increase the memory pool by one. This is done by create a memory pool with the
+   * same size. Because a memory pool with the same size already exists, the existing
+   * one will simply be increased in size.
+   */
+  increaseResult = TbxMemPoolCreate(1, memPoolBlockSize);
+  /* Make sure no error was returned. */
+  TEST_ASSERT_EQUAL(TBX_OK, increaseResult);
+
+  /* Now one more free block should be available. Verify this by allocating it. */
+  memPoolAllocatedBlocks[2] = TbxMemPoolAllocate(memPoolBlockSize);
+  /* Make sure a valid pointer was returned. */
+  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[2]);
+
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolCreate_CanIncreasePoolSize ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion.
+**
+****************************************************************************************/
+void test_TbxMemPoolRelease_ShouldAssertOnInvalidParams(void)
+{
+  /* Pass on a NULL pointer, which should not work. */
+  TbxMemPoolRelease(NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Next, pass a valid pointer but not one that belongs to a previously allocated
+   * block from any memory pool. Basically use the first allocated pointer and deduct
+   * a bunch of bytes to make sure it is outside of the memory pool range.
+   */
+  TbxMemPoolRelease(memPoolAllocatedBlocks[0] - 0x1000);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolRelease_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that releasing a block that is already free triggers an assertion and
+**            does not corrupt the memory pool.
+**
+****************************************************************************************/
+void test_TbxMemPoolRelease_ShouldAssertOnDoubleRelease(void)
+{
+  void             * blocks[2] = { 0 };
+  tTbxMemPoolFixed * pool;
+
+  /* Create a new memory pool with two blocks and allocate one of them. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolCreate(2, 83));
+  blocks[0] = TbxMemPoolAllocate(83);
+  TEST_ASSERT_NOT_NULL(blocks[0]);
+  /* Release it twice. Only the second release should trigger an assertion. */
+  TbxMemPoolRelease(blocks[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  TbxMemPoolRelease(blocks[0]);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* The memory pool should still hold exactly two different free blocks. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxMemPoolAllocateBatch(83, 2, blocks));
+  TEST_ASSERT_TRUE(blocks[0] != blocks[1]);
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(83));
+  TbxMemPoolReleaseBatch(blocks, 2);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+
+  /* Do the same for a lock-free fixed-size memory pool. */
+  pool = TbxMemPoolFixedCreate(1, 83);
+  TEST_ASSERT_NOT_NULL(pool);
+  blocks[0] = TbxMemPoolFixedAllocate(pool);
+  TEST_ASSERT_NOT_NULL(blocks[0]);
+  TbxMemPoolRelease(blocks[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+  TbxMemPoolRelease(blocks[0]);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* The memory pool should still hold exactly one free block. */
+  TEST_ASSERT_EQUAL_PTR(blocks[0], TbxMemPoolFixedAllocate(pool));
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(pool));
+  TbxMemPoolRelease(blocks[0]);
+} /*** end of test_TbxMemPoolRelease_ShouldAssertOnDoubleRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that all previously allocated blocks can be released back to the
+**            memory pool.
+**
+****************************************************************************************/
+void test_TbxMemPoolRelease_CanReleaseBlocks(void)
+{
+  /* Release all previously allocated blocks. */
+  TbxMemPoolRelease(memPoolAllocatedBlocks[0]);
+  TbxMemPoolRelease(memPoolAllocatedBlocks[1]);
+  TbxMemPoolRelease(memPoolAllocatedBlocks[2]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolRelease_CanReleaseBlocks ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that all previously released blocks can be reallocated.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocate_CanReallocate(void)
+{
+  void * result;
+  size_t heapFreeBefore;
+  size_t heapFreeAfter;
+
+  /* Get the current free heap size. */
+  heapFreeBefore = TbxHeapGetFree();
+
+  /* Attempt to allocate the first block. */
+  memPoolAllocatedBlocks[0] = TbxMemPoolAllocate(memPoolBlockSize);
+  /* Make sure a valid pointer was returned. */
+  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[0]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
   assertionCnt = 0;
   /* Attempt to allocate the second block. */
   memPoolAllocatedBlocks[1] = TbxMemPoolAllocate(memPoolBlockSize);
@@ -1200,250 +3246,1313 @@ void test_TbxMemPoolAllocate_CanReallocate(void)
 
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Attempt to allocate the third block. */
-  memPoolAllocatedBlocks[2] = TbxMemPoolAllocate(memPoolBlockSize);
-  /* Make sure a valid pointer was returned. */
-  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[2]);
-  /* Make sure no assertion was triggered. */
-  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-
+  /* Attempt to allocate the third block. */
+  memPoolAllocatedBlocks[2] = TbxMemPoolAllocate(memPoolBlockSize);
+  /* Make sure a valid pointer was returned. */
+  TEST_ASSERT_NOT_NULL(memPoolAllocatedBlocks[2]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt to allocate one more block. It should fail because the memory pool is
+   * exhausted by now.
+   */
+  result = TbxMemPoolAllocate(memPoolBlockSize);
+  /* Make sure a NULL pointer was returned, because the previous tests already allocated
+   * all blocks from this memory pool.
+   */
+  TEST_ASSERT_NULL(result);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+
+  /* Get the current free heap size. */
+  heapFreeAfter = TbxHeapGetFree();
+  /* Verify that no new memory from the heap was needed. This proves that the memory
+   * pool was fully reused.
+   */
+  TEST_ASSERT_EQUAL(heapFreeBefore, heapFreeAfter);
+} /*** end of test_TbxMemPoolAllocate_CanReallocate ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that allocations are served by the best fitting memory pool, also
+**            when multiple memory pools exist and they were not created in the order of
+**            ascending block size. Only applies to memory pools for exact block sizes.
+**
+****************************************************************************************/
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE == 0U)
+void test_TbxMemPoolAllocate_ShouldSelectBestFit(void)
+{
+  uint8_t result;
+  void *  smallBlock;
+  void *  largeBlock;
+  void *  extraBlock;
+
+  /* Create two memory pools with one block each. The larger one first. */
+  result = TbxMemPoolCreate(1, 53);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  result = TbxMemPoolCreate(1, 37);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  /* A smaller size should be matched to the memory pool with block size 37. */
+  smallBlock = TbxMemPoolAllocate(30);
+  TEST_ASSERT_NOT_NULL(smallBlock);
+  /* That memory pool is now exhausted and it should not move on to the next size up. */
+  extraBlock = TbxMemPoolAllocate(37);
+  TEST_ASSERT_NULL(extraBlock);
+  /* One byte more should be matched to the memory pool with block size 53. */
+  largeBlock = TbxMemPoolAllocate(38);
+  TEST_ASSERT_NOT_NULL(largeBlock);
+  /* Release both blocks and verify they end up in the correct memory pool. */
+  TbxMemPoolRelease(smallBlock);
+  TbxMemPoolRelease(largeBlock);
+  extraBlock = TbxMemPoolAllocate(37);
+  TEST_ASSERT_EQUAL(smallBlock, extraBlock);
+  TbxMemPoolRelease(extraBlock);
+  extraBlock = TbxMemPoolAllocate(53);
+  TEST_ASSERT_EQUAL(largeBlock, extraBlock);
+  TbxMemPoolRelease(extraBlock);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocate_ShouldSelectBestFit ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Tests that the blocks of a memory pool are carved from one contiguous slab.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreate_ShouldUseOneSlab(void)
+{
+  uint8_t result;
+  size_t  blockMemSize;
+  size_t  freeHeapBefore;
+  size_t  freeHeapAfter;
+  uint8_t * blocks[4] = { 0 };
+  size_t  idx;
+
+  /* Each block holds its size followed by its data, aligned to the address size. */
+  blockMemSize = sizeof(size_t) + ((45U + (sizeof(void *) - 1U)) & ~(sizeof(void *) - 1U));
+  /* Create a new memory pool with just two blocks. */
+  result = TbxMemPoolCreate(2, 45);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  /* Extend the memory pool with two more blocks. This should consume exactly one slab
+   * of heap memory, without any per-block overhead.
+   */
+  freeHeapBefore = TbxHeapGetFree();
+  result = TbxMemPoolCreate(2, 45);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  freeHeapAfter = TbxHeapGetFree();
+  TEST_ASSERT_EQUAL(2U * blockMemSize, freeHeapBefore - freeHeapAfter);
+  /* Allocate all blocks. */
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    blocks[idx] = TbxMemPoolAllocate(45);
+    TEST_ASSERT_NOT_NULL(blocks[idx]);
+  }
+  /* The memory pool should now be exhausted. */
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(45));
+  /* Blocks of the same slab should be right next to each other. */
+  TEST_ASSERT_EQUAL(blockMemSize, (size_t)(blocks[0] - blocks[1]));
+  TEST_ASSERT_EQUAL(blockMemSize, (size_t)(blocks[2] - blocks[3]));
+  /* Release all blocks again. */
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    TbxMemPoolRelease(blocks[idx]);
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolCreate_ShouldUseOneSlab ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the blocks of a memory pool, created in a heap region, are
+**            allocated from the memory of that heap region.
+**
+****************************************************************************************/
+void test_TbxMemPoolCreateInRegion_ShouldAllocateFromRegion(void)
+{
+  static uint8_t   regionMem[256];
+  tTbxHeapRegion * region;
+  uint8_t          result;
+  uint8_t        * block;
+
+  /* Create the heap region. */
+  region = TbxHeapRegionCreate(regionMem, sizeof(regionMem));
+  TEST_ASSERT_NOT_NULL(region);
+  /* Create a new memory pool with its blocks in the heap region. */
+  result = TbxMemPoolCreateInRegion(2, 59, region);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  /* Allocate a block and make sure it is inside the memory of the heap region. */
+  block = TbxMemPoolAllocate(59);
+  TEST_ASSERT_NOT_NULL(block);
+  TEST_ASSERT_TRUE(block >= &regionMem[0]);
+  TEST_ASSERT_TRUE(&block[59] <= &regionMem[sizeof(regionMem)]);
+  /* Release the block again. */
+  TbxMemPoolRelease(block);
+  /* The heap region is too small for this many blocks. */
+  result = TbxMemPoolCreateInRegion(8, 59, region);
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolCreateInRegion_ShouldAllocateFromRegion ***/
+
+
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Tests that the statistics of a memory pool keep track of its allocations
+**            and that the iterator finds the memory pool.
+**
+****************************************************************************************/
+void test_TbxMemPoolGetStats_ShouldTrackAllocations(void)
+{
+  uint8_t          result;
+  tTbxMemPoolStats stats;
+  void           * blocks[2];
+  uint8_t          found = TBX_FALSE;
+
+  /* Create a new memory pool and extend it right away. Use a block size that is a size
+   * class of its own, such that the test also works with size classes enabled.
+   */
+  result = TbxMemPoolCreate(1, 112);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  result = TbxMemPoolCreate(1, 112);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  /* Allocate both blocks and attempt one more allocation, which should fail. */
+  blocks[0] = TbxMemPoolAllocate(112);
+  TEST_ASSERT_NOT_NULL(blocks[0]);
+  blocks[1] = TbxMemPoolAllocate(112);
+  TEST_ASSERT_NOT_NULL(blocks[1]);
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(112));
+  /* Release one block. */
+  TbxMemPoolRelease(blocks[0]);
+  /* Verify the statistics. */
+  result = TbxMemPoolGetStats(112, &stats);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  TEST_ASSERT_EQUAL(112U, stats.blockSize);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.totalBlocks);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.freeBlocks);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.highWaterMark);
+  TEST_ASSERT_EQUAL_UINT32(2U, stats.allocCount);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.allocFailCount);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.growCount);
+  /* Iterate over all memory pools and make sure this one is found. */
+  result = TbxMemPoolGetFirstStats(&stats);
+  while (result == TBX_OK)
+  {
+    if (stats.blockSize == 112U)
+    {
+      found = TBX_TRUE;
+    }
+    result = TbxMemPoolGetNextStats(&stats);
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, found);
+  /* There should not be a memory pool with this block size. */
+  result = TbxMemPoolGetStats(113, &stats);
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  /* Release the other block again. */
+  TbxMemPoolRelease(blocks[1]);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolGetStats_ShouldTrackAllocations ***/
+#endif
+
+
+/************************************************************************************//**
+** \brief     Tests that multiple blocks can be allocated and released at once and that
+**            a batch allocation either allocates all blocks or none at all.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocateBatch_CanAllocateAndRelease(void)
+{
+  uint8_t result;
+  void  * blocks[5] = { 0 };
+  size_t  idx;
+
+  /* Create a new memory pool with four blocks. */
+  result = TbxMemPoolCreate(4, 71);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  /* Allocate all four blocks at once. */
+  result = TbxMemPoolAllocateBatch(71, 4, blocks);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    TEST_ASSERT_NOT_NULL(blocks[idx]);
+  }
+  /* The memory pool should now be exhausted. */
+  TEST_ASSERT_NULL(TbxMemPoolAllocate(71));
+  /* Release all four blocks at once. */
+  TbxMemPoolReleaseBatch(blocks, 4);
+  /* A batch that is larger than the memory pool should not allocate anything. */
+  result = TbxMemPoolAllocateBatch(71, 5, blocks);
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  for (idx = 0U; idx < 5U; idx++)
+  {
+    TEST_ASSERT_NULL(blocks[idx]);
+  }
+  /* All four blocks should still be available. */
+  result = TbxMemPoolAllocateBatch(71, 4, blocks);
+  TEST_ASSERT_EQUAL(TBX_OK, result);
+  TbxMemPoolReleaseBatch(blocks, 4);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocateBatch_CanAllocateAndRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion.
+**
+****************************************************************************************/
+void test_TbxMemPoolAllocateBatch_ShouldAssertOnInvalidParams(void)
+{
+  uint8_t result;
+  void  * blocks[1];
+
+  /* It should not be possible to allocate zero blocks. */
+  result = TbxMemPoolAllocateBatch(71, 0, blocks);
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to allocate without a pointer array. */
+  result = TbxMemPoolAllocateBatch(71, 1, NULL);
+  TEST_ASSERT_EQUAL(TBX_ERROR, result);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to release without a pointer array. */
+  TbxMemPoolReleaseBatch(NULL, 1);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolAllocateBatch_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that sizes are rounded up to their size class.
+**
+****************************************************************************************/
+void test_TbxMemPoolGetSizeClass_ShouldRoundUpToSizeClass(void)
+{
+  size_t size;
+  size_t sizeClass;
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS > 0U)
+  void * blockPtr;
+#endif
+
+  /* A size class should always fit the size and its own size class is itself. */
+  for (size = 1U; size <= 4096U; size++)
+  {
+    sizeClass = TbxMemPoolGetSizeClass(size);
+    TEST_ASSERT_TRUE(sizeClass >= size);
+    TEST_ASSERT_EQUAL_UINT32(sizeClass, TbxMemPoolGetSizeClass(sizeClass));
+  }
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS == 4U)
+  /* Sizes above four times the address size are rounded up in quarter steps. */
+  TEST_ASSERT_EQUAL_UINT32(40, TbxMemPoolGetSizeClass(37));
+  TEST_ASSERT_EQUAL_UINT32(40, TbxMemPoolGetSizeClass(38));
+  TEST_ASSERT_EQUAL_UINT32(112, TbxMemPoolGetSizeClass(100));
+  TEST_ASSERT_EQUAL_UINT32(320, TbxMemPoolGetSizeClass(257));
+  TEST_ASSERT_EQUAL_UINT32(1024, TbxMemPoolGetSizeClass(1000));
+  /* Small sizes are rounded up to a multiple of the address size. */
+  TEST_ASSERT_EQUAL_UINT32(sizeof(void *), TbxMemPoolGetSizeClass(1));
+  /* Sizes that cannot be rounded up without an overflow, should stay the same. */
+  TEST_ASSERT_TRUE(TbxMemPoolGetSizeClass(SIZE_MAX) == SIZE_MAX);
+#endif
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_STEPS > 0U)
+  /* A memory pool created for the size class of one size, should also serve the other
+   * sizes in the same size class.
+   */
+  TEST_ASSERT_EQUAL(TBX_OK, TbxMemPoolCreate(1, TbxMemPoolGetSizeClass(3001)));
+  blockPtr = TbxMemPoolAllocate(TbxMemPoolGetSizeClass(3002));
+  TEST_ASSERT_NOT_NULL(blockPtr);
+  TbxMemPoolRelease(blockPtr);
+#endif
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolGetSizeClass_ShouldRoundUpToSizeClass ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion.
+**
+****************************************************************************************/
+void test_TbxMemPoolGetSizeClass_ShouldAssertOnInvalidParams(void)
+{
+  /* It should not be possible to determine the size class of a zero size. */
+  (void)TbxMemPoolGetSizeClass(0);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolGetSizeClass_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that blocks can be allocated from a lock-free fixed-size memory pool
+**            and that they can be released with the regular release functions.
+**
+****************************************************************************************/
+void test_TbxMemPoolFixedAllocate_CanAllocateAndRelease(void)
+{
+  tTbxMemPoolFixed * pool;
+  void             * blocks[3] = { 0 };
+  size_t             idx;
+
+  /* Create a new fixed-size memory pool with three blocks. */
+  pool = TbxMemPoolFixedCreate(3, 24);
+  TEST_ASSERT_NOT_NULL(pool);
+  /* Allocate all blocks. */
+  for (idx = 0U; idx < 3U; idx++)
+  {
+    blocks[idx] = TbxMemPoolFixedAllocate(pool);
+    TEST_ASSERT_NOT_NULL(blocks[idx]);
+  }
+  /* The memory pool should now be exhausted. */
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(pool));
+  /* Release one block with the regular release function and allocate it again. */
+  TbxMemPoolRelease(blocks[1]);
+  TEST_ASSERT_EQUAL_PTR(blocks[1], TbxMemPoolFixedAllocate(pool));
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(pool));
+  /* Release all blocks at once and make sure they can all be allocated again. */
+  TbxMemPoolReleaseBatch(blocks, 3);
+  for (idx = 0U; idx < 3U; idx++)
+  {
+    blocks[idx] = TbxMemPoolFixedAllocate(pool);
+    TEST_ASSERT_NOT_NULL(blocks[idx]);
+  }
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(pool));
+  TbxMemPoolReleaseBatch(blocks, 3);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolFixedAllocate_CanAllocateAndRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion.
+**
+****************************************************************************************/
+void test_TbxMemPoolFixedCreate_ShouldAssertOnInvalidParams(void)
+{
+  /* It should not be possible to create a memory pool with zero blocks. */
+  TEST_ASSERT_NULL(TbxMemPoolFixedCreate(0, 24));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to create a memory pool with too many blocks. */
+  TEST_ASSERT_NULL(TbxMemPoolFixedCreate(65536, 24));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* It should not be possible to allocate without a memory pool. */
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(NULL));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolFixedCreate_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that blocks can be allocated from a fixed-size memory pool that was
+**            defined at compile time and that they can be released again.
+**
+****************************************************************************************/
+void test_TbxMemPoolDefine_CanAllocateAndRelease(void)
+{
+  void   * blocks[4] = { 0 };
+  size_t   idx;
+
+  /* The slab should be reserved at compile time for all blocks. */
+  TEST_ASSERT_EQUAL_UINT32(4U * TBX_MEMPOOL_FIXED_BLOCK_MEM_SIZE(20U),
+                           sizeof(memPoolStaticSlab));
+  /* Allocate all blocks. They should be aligned to the address size. */
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    blocks[idx] = TbxMemPoolFixedAllocate(&memPoolStatic);
+    TEST_ASSERT_NOT_NULL(blocks[idx]);
+    TEST_ASSERT_EQUAL_UINT32(0U, (uintptr_t)blocks[idx] % sizeof(void *));
+    /* Make sure the last data byte of the block can be written. */
+    ((uint8_t *)blocks[idx])[19] = (uint8_t)idx;
+  }
+  /* The memory pool should now be exhausted. */
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(&memPoolStatic));
+  /* Release one block and allocate it again. */
+  TbxMemPoolRelease(blocks[2]);
+  TEST_ASSERT_EQUAL_PTR(blocks[2], TbxMemPoolFixedAllocate(&memPoolStatic));
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(&memPoolStatic));
+  /* Release all blocks at once and make sure they can all be allocated again. */
+  TbxMemPoolReleaseBatch(blocks, 4);
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    blocks[idx] = TbxMemPoolFixedAllocate(&memPoolStatic);
+    TEST_ASSERT_NOT_NULL(blocks[idx]);
+  }
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(&memPoolStatic));
+  TbxMemPoolReleaseBatch(blocks, 4);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolDefine_CanAllocateAndRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that multiple threads can allocate the first blocks from fixed-size
+**            memory pools that were defined at compile time, at the same time. Each
+**            memory pool is then added to the internal linked list by several threads at
+**            once, which should still make its blocks releasable.
+**
+****************************************************************************************/
+void test_TbxMemPoolDefine_CanAllocateFromMultipleThreads(void)
+{
+  pthread_t threads[CRITSECT_TEST_NUM_THREADS];
+  uintptr_t idx;
+
+  /* Let all threads allocate and release their blocks at the same time. */
+  for (idx = 0U; idx < CRITSECT_TEST_NUM_THREADS; idx++)
+  {
+    TEST_ASSERT_EQUAL(0, pthread_create(&threads[idx], NULL, memPoolStaticThread,
+                                        (void *)idx));
+  }
+  for (idx = 0U; idx < CRITSECT_TEST_NUM_THREADS; idx++)
+  {
+    TEST_ASSERT_EQUAL(0, pthread_join(threads[idx], NULL));
+  }
+  /* All blocks should have been released, so all of them can be allocated again. */
+  for (idx = 0U; idx < CRITSECT_TEST_NUM_THREADS; idx++)
+  {
+    TEST_ASSERT_NOT_NULL(TbxMemPoolFixedAllocate(&memPoolStaticThreadsA));
+  }
+  TEST_ASSERT_NULL(TbxMemPoolFixedAllocate(&memPoolStaticThreadsA));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxMemPoolDefine_CanAllocateFromMultipleThreads ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a new list can be created.
+**
+****************************************************************************************/
+void test_TbxListCreate_ReturnsValidListPointer(void)
+{
+  tTbxList * myList;
+
+  /* Attempt to create a new linked list. */
+  myList = TbxListCreate();
+  /* Make sure a valid pointer was returned. */
+  TEST_ASSERT_NOT_NULL(myList);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListCreate_ReturnsValidListPointer ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that a recreated list can reuse previously used memory.
+**
+****************************************************************************************/
+void test_TbxListCreate_CanReuseMemory(void)
+{
+  tTbxList * myList;
+  size_t freeHeapBefore2ndCreate;
+  size_t freeHeapAfter2ndDelete;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Add three items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+  /* Delete it. */
+  TbxListDelete(myList);  
+  /* Get the current amount of free heap. */
+  freeHeapBefore2ndCreate = TbxHeapGetFree();
+  /* Create another linked list. */
+  myList = TbxListCreate();
+  /* Add three items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  /* Delete it again. */
+  TbxListDelete(myList);  
+  /* Get the current amount of free heap. */
+  freeHeapAfter2ndDelete = TbxHeapGetFree();
+  /* Make sure no new heap memory was allocated for the 2nd list. */
+  TEST_ASSERT_EQUAL(freeHeapBefore2ndCreate, freeHeapAfter2ndDelete);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListCreate_CanReuseMemory ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion.
+**
+****************************************************************************************/
+void test_TbxListDelete_ShouldAssertOnInvalidParams(void)
+{
+  /* Pass on a NULL pointer, which should not work. */
+  TbxListDelete(NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxListDelete_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that an existing list can be deleted.
+**
+****************************************************************************************/
+void test_TbxListDelete_CanDelete(void)
+{
+  tTbxList * myList;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Make sure a valid pointer was returned. */
+  TEST_ASSERT_NOT_NULL(myList);
+  /* Delete the previously created linked list. */
+  TbxListDelete(myList);  
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListDelete_CanDelete ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion.
+**
+****************************************************************************************/
+void test_TbxListClear_ShouldAssertOnInvalidParams(void)
+{
+  /* Pass on a NULL pointer, which should not work. */
+  TbxListClear(NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxListClear_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that entries from a list can be cleared.
+**
+****************************************************************************************/
+void test_TbxListClear_CanEmptyList(void)
+{
+  tTbxList * myList;
+  size_t listSize;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Add two items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  /* Make sure its size is now two. */
+  listSize = TbxListGetSize(myList);
+  TEST_ASSERT_EQUAL(2, listSize);
+  /* Clear the list. */
+  TbxListClear(myList);
+  /* Make sure its size is now zero. */
+  listSize = TbxListGetSize(myList);
+  TEST_ASSERT_EQUAL(0, listSize);
+  /* Add two items again. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  /* Make sure its size is now two. */
+  listSize = TbxListGetSize(myList);
+  TEST_ASSERT_EQUAL(2, listSize);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListClear_CanEmptyList ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns 0.
+**
+****************************************************************************************/
+void test_TbxListGetSize_ShouldAssertOnInvalidParams(void)
+{
+  size_t result;
+
+  /* Pass on a NULL pointer, which should not work. */
+  result = TbxListGetSize(NULL);
+  /* Make sure it returns zero. */
+  TEST_ASSERT_EQUAL(0, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+} /*** end of test_TbxListGetSize_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that the number of entries in a list can be properly obtained.
+**
+****************************************************************************************/
+void test_TbxListGetSize_ReturnsActualSize(void)
+{
+  tTbxList * myList;
+  size_t listSize;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Make sure its size is zero. */
+  listSize = TbxListGetSize(myList);
+  TEST_ASSERT_EQUAL(0, listSize);
+  /* Add two items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  /* Make sure its size is now two. */
+  listSize = TbxListGetSize(myList);
+  TEST_ASSERT_EQUAL(2, listSize);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListGetSize_ReturnsActualSize ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+**
+****************************************************************************************/
+void test_TbxListReserve_ShouldAssertOnInvalidParams(void)
+{
+  tTbxList * myList;
+  uint8_t    result;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  result = TbxListReserve(NULL, 4);
+  /* Make sure an assertion was triggered and an error was reported. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on zero for the number of nodes, which should not work. */
+  result = TbxListReserve(myList, 0);
+  /* Make sure an assertion was triggered and an error was reported. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListReserve_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that reserved nodes can be used for inserting items, without
+**            accessing the heap.
+**
+****************************************************************************************/
+void test_TbxListReserve_ShouldPreallocateNodes(void)
+{
+  tTbxList * myList;
+  size_t     heapFree;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Reserve the nodes for three items. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxListReserve(myList, 3));
+  /* Store the currently free heap size. */
+  heapFree = TbxHeapGetFree();
+  /* Insert three items. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxListInsertItemBack(myList, &listTestMsgA));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxListInsertItemBack(myList, &listTestMsgB));
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxListInsertItemBack(myList, &listTestMsgC));
+  TEST_ASSERT_EQUAL_UINT32(3, TbxListGetSize(myList));
+  /* The heap should not have been accessed. */
+  TEST_ASSERT_EQUAL_UINT32(heapFree, TbxHeapGetFree());
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListReserve_ShouldPreallocateNodes ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+**
+****************************************************************************************/
+void test_TbxListInsertItemFront_ShouldAssertOnInvalidParams(void)
+{
+  uint8_t result;
+  tTbxList * myList;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  result = TbxListInsertItemFront(NULL, &listTestMsgA);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the item, which should not work. */
+  result = TbxListInsertItemFront(myList, NULL);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListInsertItemFront_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that an item is inserted at the front of the linked list.
+**
+****************************************************************************************/
+void test_TbxListInsertItemFront_InsertsAtCorrectLocation(void)
+{
+  tTbxList * myList;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Add an item. */
+  (void)TbxListInsertItemFront(myList, &listTestMsgA);
+  /* Make sure listTestMsgA is in the front of the list. */
+  myMsg = TbxListGetFirstItem(myList);
+  sameMsg = TBX_FALSE;
+  TEST_ASSERT_NOT_NULL(myMsg);
+  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Add another item. */
+  (void)TbxListInsertItemFront(myList, &listTestMsgB);
+  /* Make sure listTestMsgB is in the front of the list. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListInsertItemFront_InsertsAtCorrectLocation ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+**
+****************************************************************************************/
+void test_TbxListInsertItemBack_ShouldAssertOnInvalidParams(void)
+{
+  uint8_t result;
+  tTbxList * myList;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  result = TbxListInsertItemBack(NULL, &listTestMsgA);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the item, which should not work. */
+  result = TbxListInsertItemBack(myList, NULL);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListInsertItemBack_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that an item is inserted at the back of the linked list.
+**
+****************************************************************************************/
+void test_TbxListInsertItemBack_InsertsAtCorrectLocation(void)
+{
+  tTbxList * myList;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Add an item. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  /* Make sure listTestMsgA is in the back of the list. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Add another item. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  /* Make sure listTestMsgB is in the front of the list. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListInsertItemBack_InsertsAtCorrectLocation ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+**
+****************************************************************************************/
+void test_TbxListInsertItemBefore_ShouldAssertOnInvalidParams(void)
+{
+  uint8_t result;
+  tTbxList * myList;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  result = TbxListInsertItemBefore(NULL, &listTestMsgA, &listTestMsgB);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the item, which should not work. */
+  result = TbxListInsertItemBefore(myList, NULL, &listTestMsgB);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the itemRef, which should not work. */
+  result = TbxListInsertItemBefore(myList, &listTestMsgA, NULL);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListInsertItemBefore_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that an item is inserted at the expected location in the list.
+**
+****************************************************************************************/
+void test_TbxListInsertItemBefore_InsertsAtCorrectLocation(void)
+{
+  tTbxList * myList;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
+  uint8_t result;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Add two items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+  /* Add another item in the middle. */
+  result = TbxListInsertItemBefore(myList, &listTestMsgB, &listTestMsgC);
+  /* Verify the result value. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
+  /* Read back the item, which should be at the second spot in the list. */
+  myMsg = TbxListGetNextItem(myList, &listTestMsgA);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Remove the middle item. */
+  TbxListRemoveItem(myList, &listTestMsgB);
+  /* Now add the item before the first one. */
+  result = TbxListInsertItemBefore(myList, &listTestMsgB, &listTestMsgA);
+  /* Verify the result value. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
+  /* Read back the item, which should be at the start in the list. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListInsertItemBefore_InsertsAtCorrectLocation ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+**
+****************************************************************************************/
+void test_TbxListInsertItemAfter_ShouldAssertOnInvalidParams(void)
+{
+  uint8_t result;
+  tTbxList * myList;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  result = TbxListInsertItemAfter(NULL, &listTestMsgA, &listTestMsgB);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the item, which should not work. */
+  result = TbxListInsertItemAfter(myList, NULL, &listTestMsgB);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Attempt to allocate one more block. It should fail because the memory pool is
-   * exhausted by now.
-   */
-  result = TbxMemPoolAllocate(memPoolBlockSize);
-  /* Make sure a NULL pointer was returned, because the previous tests already allocated
-   * all blocks from this memory pool.
-   */
-  TEST_ASSERT_NULL(result);
-  /* Make sure no assertion was triggered. */
-  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-
-  /* Get the current free heap size. */
-  heapFreeAfter = TbxHeapGetFree();
-  /* Verify that no new memory from the heap was needed. This proves that the memory
-   * pool was fully reused.
-   */
-  TEST_ASSERT_EQUAL(heapFreeBefore, heapFreeAfter);
-} /*** end of test_TbxMemPoolAllocate_CanReallocate ***/
+  /* Pass on a NULL pointer for the itemRef, which should not work. */
+  result = TbxListInsertItemAfter(myList, &listTestMsgA, NULL);
+  /* Make sure it returns an error. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListInsertItemAfter_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a new list can be created.
+** \brief     Tests that an item is inserted at the expected location in the list.
 **
 ****************************************************************************************/
-void test_TbxListCreate_ReturnsValidListPointer(void)
+void test_TbxListInsertItemAfter_InsertsAtCorrectLocation(void)
 {
   tTbxList * myList;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
+  uint8_t result;
 
-  /* Attempt to create a new linked list. */
+  /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Make sure a valid pointer was returned. */
-  TEST_ASSERT_NOT_NULL(myList);
+  /* Add two items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+  /* Add another item in the middle. */
+  result = TbxListInsertItemAfter(myList, &listTestMsgB, &listTestMsgA);
+  /* Verify the result value. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
+  /* Read back the item, which should be at the second spot in the list. */
+  myMsg = TbxListGetPreviousItem(myList, &listTestMsgC);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Remove the middle item. */
+  TbxListRemoveItem(myList, &listTestMsgB);
+  /* Now add the item after the last one. */
+  result = TbxListInsertItemAfter(myList, &listTestMsgB, &listTestMsgC);
+  /* Verify the result value. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
+  /* Read back the item, which should be at the third spot in the list. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListCreate_ReturnsValidListPointer ***/
+} /*** end of test_TbxListInsertItemAfter_InsertsAtCorrectLocation ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that a recreated list can reuse previously used memory.
+** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListCreate_CanReuseMemory(void)
+void test_TbxListRemoveItem_ShouldAssertOnInvalidParams(void)
 {
   tTbxList * myList;
-  size_t freeHeapBefore2ndCreate;
-  size_t freeHeapAfter2ndDelete;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add three items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  (void)TbxListInsertItemBack(myList, &listTestMsgC);
-  /* Delete it. */
-  TbxListDelete(myList);  
-  /* Get the current amount of free heap. */
-  freeHeapBefore2ndCreate = TbxHeapGetFree();
-  /* Create another linked list. */
+  /* Pass on a NULL pointer for the list, which should not work. */
+  TbxListRemoveItem(NULL, &listTestMsgA);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the item, which should not work. */
+  TbxListRemoveItem(myList, NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListRemoveItem_ShouldAssertOnInvalidParams ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that items can be removed from the list.
+**
+****************************************************************************************/
+void test_TbxListRemoveItem_ShouldRemoveItem(void)
+{
+  tTbxList * myList;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
+
+  /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add three items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgC);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  /* Add two items. */
   (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  /* Delete it again. */
-  TbxListDelete(myList);  
-  /* Get the current amount of free heap. */
-  freeHeapAfter2ndDelete = TbxHeapGetFree();
-  /* Make sure no new heap memory was allocated for the 2nd list. */
-  TEST_ASSERT_EQUAL(freeHeapBefore2ndCreate, freeHeapAfter2ndDelete);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+  /* Remove the last item. */
+  TbxListRemoveItem(myList, &listTestMsgC);
+  /* Read back the last item, which should return the first one in the list. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Remove the first item. */
+  TbxListRemoveItem(myList, &listTestMsgA);
+  /* Read back the first item, which should return NULL because the list is now empty. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_NULL(myMsg);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListCreate_CanReuseMemory ***/
+} /*** end of test_TbxListRemoveItem_ShouldRemoveItem ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion.
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
 **
 ****************************************************************************************/
-void test_TbxListDelete_ShouldAssertOnInvalidParams(void)
+void test_TbxListGetFirstItem_ShouldAssertOnInvalidParams(void)
 {
+  void * result;
+
   /* Pass on a NULL pointer, which should not work. */
-  TbxListDelete(NULL);
+  result = TbxListGetFirstItem(NULL);
+  /* Make sure it returned NULL. */
+  TEST_ASSERT_NULL(result);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-} /*** end of test_TbxListDelete_ShouldAssertOnInvalidParams ***/
+} /*** end of TbxListGetFirstItem_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that an existing list can be deleted.
+** \brief     Tests that the first item of the list can be retrieved.
 **
 ****************************************************************************************/
-void test_TbxListDelete_CanDelete(void)
+void test_TbxListGetFirstItem_ShouldReturnFirstItem(void)
 {
   tTbxList * myList;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Make sure a valid pointer was returned. */
-  TEST_ASSERT_NOT_NULL(myList);
-  /* Delete the previously created linked list. */
-  TbxListDelete(myList);  
+  /* Add three items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+
+  /* Read back the first item in the list, which should be listTestMsgA. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Clear the list. */
+  TbxListClear(myList);
+  /* Read back the first item in the list, which should be NULL. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_NULL(myMsg);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListDelete_CanDelete ***/
+} /*** end of test_TbxListGetFirstItem_ShouldReturnFirstItem ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion.
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
 **
 ****************************************************************************************/
-void test_TbxListClear_ShouldAssertOnInvalidParams(void)
+void test_TbxListGetLastItem_ShouldAssertOnInvalidParams(void)
 {
+  void * result;
+
   /* Pass on a NULL pointer, which should not work. */
-  TbxListClear(NULL);
+  result = TbxListGetLastItem(NULL);
+  /* Make sure it returned NULL. */
+  TEST_ASSERT_NULL(result);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-} /*** end of test_TbxListClear_ShouldAssertOnInvalidParams ***/
+} /*** end of TbxListGetLastItem_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that entries from a list can be cleared.
+** \brief     Tests that the last item of the list can be retrieved.
 **
 ****************************************************************************************/
-void test_TbxListClear_CanEmptyList(void)
+void test_TbxListGetLastItem_ShouldReturnLastItem(void)
 {
   tTbxList * myList;
-  size_t listSize;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add two items. */
+  /* Add three items. */
   (void)TbxListInsertItemBack(myList, &listTestMsgA);
   (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  /* Make sure its size is now two. */
-  listSize = TbxListGetSize(myList);
-  TEST_ASSERT_EQUAL(2, listSize);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+
+  /* Read back the last item in the list, which should be listTestMsgC. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgC.id) && (myMsg == &listTestMsgC))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
   /* Clear the list. */
   TbxListClear(myList);
-  /* Make sure its size is now zero. */
-  listSize = TbxListGetSize(myList);
-  TEST_ASSERT_EQUAL(0, listSize);
-  /* Add two items again. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  /* Make sure its size is now two. */
-  listSize = TbxListGetSize(myList);
-  TEST_ASSERT_EQUAL(2, listSize);
+  /* Read back the last item in the list, which should be NULL. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_NULL(myMsg);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListClear_CanEmptyList ***/
+} /*** end of test_TbxListGetLastItem_ShouldReturnLastItem ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns 0.
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
 **
 ****************************************************************************************/
-void test_TbxListGetSize_ShouldAssertOnInvalidParams(void)
+void test_TbxListGetPreviousItem_ShouldAssertOnInvalidParams(void)
 {
-  size_t result;
+  void * result;
+  tTbxList * myList;
 
-  /* Pass on a NULL pointer, which should not work. */
-  result = TbxListGetSize(NULL);
-  /* Make sure it returns zero. */
-  TEST_ASSERT_EQUAL(0, result);
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  result = TbxListGetPreviousItem(NULL, &listTestMsgA);
+  /* Make sure it returns NULL. */
+  TEST_ASSERT_NULL(result);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-} /*** end of test_TbxListGetSize_ShouldAssertOnInvalidParams ***/
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the item, which should not work. */
+  result = TbxListGetPreviousItem(myList, NULL);
+  /* Make sure it returns NULL. */
+  TEST_ASSERT_NULL(result);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListGetPreviousItem_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the number of entries in a list can be properly obtained.
+** \brief     Tests that the previous item of the list can be retrieved.
 **
 ****************************************************************************************/
-void test_TbxListGetSize_ReturnsActualSize(void)
+void test_TbxListGetPreviousItem_ShouldReturnPreviousItem(void)
 {
   tTbxList * myList;
-  size_t listSize;
+  tListTestMsg * myMsg;
+  uint8_t sameMsg;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Make sure its size is zero. */
-  listSize = TbxListGetSize(myList);
-  TEST_ASSERT_EQUAL(0, listSize);
   /* Add two items. */
   (void)TbxListInsertItemBack(myList, &listTestMsgA);
   (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  /* Make sure its size is now two. */
-  listSize = TbxListGetSize(myList);
-  TEST_ASSERT_EQUAL(2, listSize);
+  /* Read back the one before the last item in the list, which should be listTestMsgA. */
+  myMsg = TbxListGetPreviousItem(myList, &listTestMsgB);
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Read back the one before the first item in the list, which should return NULL. */
+  myMsg = TbxListGetPreviousItem(myList, TbxListGetFirstItem(myList));
+  TEST_ASSERT_NULL(myMsg);
+  /* Read back one before an item not currently in the list, which should return NULL. */
+  myMsg = TbxListGetPreviousItem(myList, &listTestMsgC);
+  TEST_ASSERT_NULL(myMsg);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListGetSize_ReturnsActualSize ***/
+} /*** end of test_TbxListGetPreviousItem_ShouldReturnPreviousItem ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemFront_ShouldAssertOnInvalidParams(void)
+void test_TbxListGetNextItem_ShouldAssertOnInvalidParams(void)
 {
-  uint8_t result;
+  void * result;
   tTbxList * myList;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
   /* Pass on a NULL pointer for the list, which should not work. */
-  result = TbxListInsertItemFront(NULL, &listTestMsgA);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  result = TbxListGetNextItem(NULL, &listTestMsgA);
+  /* Make sure it returns NULL. */
+  TEST_ASSERT_NULL(result);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
   /* Pass on a NULL pointer for the item, which should not work. */
-  result = TbxListInsertItemFront(myList, NULL);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  result = TbxListGetNextItem(myList, NULL);
+  /* Make sure it returns NULL. */
+  TEST_ASSERT_NULL(result);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
-} /*** end of test_TbxListInsertItemFront_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxListGetNextItem_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that an item is inserted at the front of the linked list.
+** \brief     Tests that the next item of the list can be retrieved.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemFront_InsertsAtCorrectLocation(void)
+void test_TbxListGetNextItem_ShouldReturnNextItem(void)
 {
   tTbxList * myList;
   tListTestMsg * myMsg;
@@ -1451,21 +4560,11 @@ void test_TbxListInsertItemFront_InsertsAtCorrectLocation(void)
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add an item. */
-  (void)TbxListInsertItemFront(myList, &listTestMsgA);
-  /* Make sure listTestMsgA is in the front of the list. */
-  myMsg = TbxListGetFirstItem(myList);
-  sameMsg = TBX_FALSE;
-  TEST_ASSERT_NOT_NULL(myMsg);
-  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
-  {
-    sameMsg = TBX_TRUE;
-  }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Add another item. */
-  (void)TbxListInsertItemFront(myList, &listTestMsgB);
-  /* Make sure listTestMsgB is in the front of the list. */
-  myMsg = TbxListGetFirstItem(myList);
+  /* Add two items. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  /* Read back the one after the first item in the list, which should be listTestMsgB. */
+  myMsg = TbxListGetNextItem(myList, &listTestMsgA);
   TEST_ASSERT_NOT_NULL(myMsg);
   sameMsg = TBX_FALSE;
   if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
@@ -1473,48 +4572,55 @@ void test_TbxListInsertItemFront_InsertsAtCorrectLocation(void)
     sameMsg = TBX_TRUE;
   }
   TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Read back the one after the item in the list, which should return NULL. */
+  myMsg = TbxListGetNextItem(myList, TbxListGetLastItem(myList));
+  TEST_ASSERT_NULL(myMsg);
+  /* Read back one after an item not currently in the list, which should return NULL. */
+  myMsg = TbxListGetNextItem(myList, &listTestMsgC);
+  TEST_ASSERT_NULL(myMsg);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListInsertItemFront_InsertsAtCorrectLocation ***/
+} /*** end of test_TbxListGetNextItem_ShouldReturnNextItem ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemBack_ShouldAssertOnInvalidParams(void)
+void test_TbxListSwapItems_ShouldAssertOnInvalidParams(void)
 {
-  uint8_t result;
   tTbxList * myList;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
   /* Pass on a NULL pointer for the list, which should not work. */
-  result = TbxListInsertItemBack(NULL, &listTestMsgA);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  TbxListSwapItems(NULL, &listTestMsgA, &listTestMsgB);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for the item, which should not work. */
-  result = TbxListInsertItemBack(myList, NULL);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Pass on a NULL pointer for item1, which should not work. */
+  TbxListSwapItems(myList, NULL, &listTestMsgB);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for item2, which should not work. */
+  TbxListSwapItems(myList, &listTestMsgA, NULL);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
-} /*** end of test_TbxListInsertItemBack_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxListSwapItems_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that an item is inserted at the back of the linked list.
+** \brief     Tests that the items in the list can be swapped.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemBack_InsertsAtCorrectLocation(void)
+void test_TbxListSwapItems_ShouldSwapItems(void)
 {
   tTbxList * myList;
   tListTestMsg * myMsg;
@@ -1522,21 +4628,26 @@ void test_TbxListInsertItemBack_InsertsAtCorrectLocation(void)
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add an item. */
+  /* Add three items. */
   (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  /* Make sure listTestMsgA is in the back of the list. */
-  myMsg = TbxListGetLastItem(myList);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  (void)TbxListInsertItemBack(myList, &listTestMsgC);
+
+  /* Swap the first and the last items. */
+  TbxListSwapItems(myList, TbxListGetFirstItem(myList), TbxListGetLastItem(myList));
+  /* Read back the first item in the list, which should be listTestMsgC. */
+  myMsg = TbxListGetFirstItem(myList);
   TEST_ASSERT_NOT_NULL(myMsg);
   sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  if ((myMsg->id == listTestMsgC.id) && (myMsg == &listTestMsgC))
   {
     sameMsg = TBX_TRUE;
   }
   TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Add another item. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  /* Make sure listTestMsgB is in the front of the list. */
-  myMsg = TbxListGetLastItem(myList);
+  /* Swap the first (C) and the second (B) one. */
+  TbxListSwapItems(myList, &listTestMsgC, &listTestMsgB);
+  /* Read back the first item in the list, which should be listTestMsgB. */
+  myMsg = TbxListGetFirstItem(myList);
   TEST_ASSERT_NOT_NULL(myMsg);
   sameMsg = TBX_FALSE;
   if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
@@ -1544,656 +4655,999 @@ void test_TbxListInsertItemBack_InsertsAtCorrectLocation(void)
     sameMsg = TBX_TRUE;
   }
   TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Read back the second item in the list, which should be listTestMsgC. */
+  myMsg = TbxListGetNextItem(myList, TbxListGetFirstItem(myList));
+  TEST_ASSERT_NOT_NULL(myMsg);
+  sameMsg = TBX_FALSE;
+  if ((myMsg->id == listTestMsgC.id) && (myMsg == &listTestMsgC))
+  {
+    sameMsg = TBX_TRUE;
+  }
+  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* List now contains B -> C -> A. Remove the last one (A). */
+  TbxListRemoveItem(myList, &listTestMsgA);
+  /* Now try swapping B and A. Which shouldn't do anything because A is not in the list.
+   * Note that it also shouldn´t generate an assertion.
+   */
+  TbxListSwapItems(myList, &listTestMsgB, &listTestMsgA);
+  /* B should still be the first item. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_EQUAL(&listTestMsgB, myMsg);
+  /* C should still be the last item. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_EQUAL(&listTestMsgC, myMsg);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListInsertItemBack_InsertsAtCorrectLocation ***/
+} /*** end of test_TbxListSwapItems_ShouldSwapItems ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemBefore_ShouldAssertOnInvalidParams(void)
+void test_TbxListSortItems_ShouldAssertOnInvalidParams(void)
 {
-  uint8_t result;
   tTbxList * myList;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
   /* Pass on a NULL pointer for the list, which should not work. */
-  result = TbxListInsertItemBefore(NULL, &listTestMsgA, &listTestMsgB);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Reset the assertion counter. */
-  assertionCnt = 0;
-  /* Pass on a NULL pointer for the item, which should not work. */
-  result = TbxListInsertItemBefore(myList, NULL, &listTestMsgB);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  TbxListSortItems(NULL, compareListMsg);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for the itemRef, which should not work. */
-  result = TbxListInsertItemBefore(myList, &listTestMsgA, NULL);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
+  /* Pass on a NULL pointer for the compare function, which should not work. */
+  TbxListSortItems(myList, NULL);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
-} /*** end of test_TbxListInsertItemBefore_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxListSortItems_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that an item is inserted at the expected location in the list.
+** \brief     Tests that the items in the list can be sorted.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemBefore_InsertsAtCorrectLocation(void)
+void test_TbxListSortItems_ShouldSortItems(void)
 {
   tTbxList * myList;
   tListTestMsg * myMsg;
-  uint8_t sameMsg;
-  uint8_t result;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add two items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgC);
-  /* Add another item in the middle. */
-  result = TbxListInsertItemBefore(myList, &listTestMsgB, &listTestMsgC);
-  /* Verify the result value. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
-  /* Read back the item, which should be at the second spot in the list. */
-  myMsg = TbxListGetNextItem(myList, &listTestMsgA);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  /* Add three items. */
+  (void)TbxListInsertItemFront(myList, &listTestMsgA);
+  (void)TbxListInsertItemFront(myList, &listTestMsgB);
+  (void)TbxListInsertItemFront(myList, &listTestMsgC);
+  /* List is now C (id=789) -> B (id=456) -> A (id=123). Next sort based on id. */
+  TbxListSortItems(myList, compareListMsg);
+  /* List should now be A (id=123) -> B (id=456) -> C (id=789). */
+  /* Check the first item. */
+  myMsg = TbxListGetFirstItem(myList);
+  TEST_ASSERT_EQUAL(&listTestMsgA, myMsg);
+  TEST_ASSERT_EQUAL_UINT32(123, myMsg->id);
+  /* Check the second item. */
+  myMsg = TbxListGetNextItem(myList, TbxListGetFirstItem(myList));
+  TEST_ASSERT_EQUAL(&listTestMsgB, myMsg);
+  TEST_ASSERT_EQUAL_UINT32(456, myMsg->id);
+  /* Check the last item. */
+  myMsg = TbxListGetLastItem(myList);
+  TEST_ASSERT_EQUAL(&listTestMsgC, myMsg);
+  TEST_ASSERT_EQUAL_UINT32(789, myMsg->id);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListSortItems_ShouldSortItems ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that sorting is stable and that it also works for an empty list and
+**            for a list with many items.
+**
+****************************************************************************************/
+void test_TbxListSortItems_ShouldSortStable(void)
+{
+  tTbxList           * myList;
+  tListTestMsg       * myMsg;
+  tListTestMsg const * prevMsg = NULL;
+  tTbxListNode       * myNode;
+  static tListTestMsg  myMsgs[61];
+  size_t               idx;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Sorting an empty list should not do anything. */
+  TbxListSortItems(myList, compareListMsg);
+  TEST_ASSERT_NULL(TbxListGetFirstItem(myList));
+  /* Add the messages with only a few different ids, such that many ids are equal. The
+   * first data byte holds the insertion order.
+   */
+  for (idx = 0U; idx < (sizeof(myMsgs)/sizeof(myMsgs[0])); idx++)
   {
-    sameMsg = TBX_TRUE;
+    myMsgs[idx].id = (uint32_t)((idx * 7U) % 5U);
+    myMsgs[idx].data[0] = (uint8_t)idx;
+    (void)TbxListInsertItemBack(myList, &myMsgs[idx]);
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Remove the middle item. */
-  TbxListRemoveItem(myList, &listTestMsgB);
-  /* Now add the item before the first one. */
-  result = TbxListInsertItemBefore(myList, &listTestMsgB, &listTestMsgA);
-  /* Verify the result value. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
-  /* Read back the item, which should be at the start in the list. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  /* Sort based on id. */
+  TbxListSortItems(myList, compareListMsg);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(myMsgs)/sizeof(myMsgs[0]), TbxListGetSize(myList));
+  /* Check that the ids are ascending and that equal ids kept their insertion order.
+   * Also check that the links in both directions are correct.
+   */
+  myNode = TbxListGetFirstNode(myList);
+  while (myNode != NULL)
   {
-    sameMsg = TBX_TRUE;
+    myMsg = TbxListGetNodeItem(myNode);
+    if (prevMsg != NULL)
+    {
+      TEST_ASSERT_TRUE(myMsg->id >= prevMsg->id);
+      if (myMsg->id == prevMsg->id)
+      {
+        TEST_ASSERT_TRUE(myMsg->data[0] > prevMsg->data[0]);
+      }
+      TEST_ASSERT_EQUAL(prevMsg, TbxListGetNodeItem(TbxListGetPreviousNode(myList,
+                                                                           myNode)));
+    }
+    prevMsg = myMsg;
+    myNode = TbxListGetNextNode(myList, myNode);
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  TEST_ASSERT_EQUAL(prevMsg, TbxListGetLastItem(myList));
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListInsertItemBefore_InsertsAtCorrectLocation ***/
+} /*** end of test_TbxListSortItems_ShouldSortStable ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns TBX_ERROR.
+** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemAfter_ShouldAssertOnInvalidParams(void)
+void test_TbxListInsertItemSorted_ShouldAssertOnInvalidParams(void)
 {
-  uint8_t result;
   tTbxList * myList;
+  uint8_t    result;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
   /* Pass on a NULL pointer for the list, which should not work. */
-  result = TbxListInsertItemAfter(NULL, &listTestMsgA, &listTestMsgB);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
-  /* Make sure an assertion was triggered. */
+  result = TbxListInsertItemSorted(NULL, &listTestMsgA, compareListMsg);
+  /* Make sure an assertion was triggered and an error was reported. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
   /* Reset the assertion counter. */
   assertionCnt = 0;
   /* Pass on a NULL pointer for the item, which should not work. */
-  result = TbxListInsertItemAfter(myList, NULL, &listTestMsgB);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
-  /* Make sure an assertion was triggered. */
+  result = TbxListInsertItemSorted(myList, NULL, compareListMsg);
+  /* Make sure an assertion was triggered and an error was reported. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for the itemRef, which should not work. */
-  result = TbxListInsertItemAfter(myList, &listTestMsgA, NULL);
-  /* Make sure it returns an error. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
-  /* Make sure an assertion was triggered. */
+  /* Pass on a NULL pointer for the compare function, which should not work. */
+  result = TbxListInsertItemSorted(myList, &listTestMsgA, NULL);
+  /* Make sure an assertion was triggered and an error was reported. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, result);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
-} /*** end of test_TbxListInsertItemAfter_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxListInsertItemSorted_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that an item is inserted at the expected location in the list.
+** \brief     Tests that inserting items in a sorted manner keeps the list sorted.
 **
 ****************************************************************************************/
-void test_TbxListInsertItemAfter_InsertsAtCorrectLocation(void)
+void test_TbxListInsertItemSorted_ShouldKeepListSorted(void)
 {
   tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
-  uint8_t result;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add two items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgC);
-  /* Add another item in the middle. */
-  result = TbxListInsertItemAfter(myList, &listTestMsgB, &listTestMsgA);
-  /* Verify the result value. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
-  /* Read back the item, which should be at the second spot in the list. */
-  myMsg = TbxListGetPreviousItem(myList, &listTestMsgC);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
-  {
-    sameMsg = TBX_TRUE;
-  }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Remove the middle item. */
-  TbxListRemoveItem(myList, &listTestMsgB);
-  /* Now add the item after the last one. */
-  result = TbxListInsertItemAfter(myList, &listTestMsgB, &listTestMsgC);
-  /* Verify the result value. */
-  TEST_ASSERT_EQUAL_UINT8(TBX_OK, result);
-  /* Read back the item, which should be at the third spot in the list. */
-  myMsg = TbxListGetLastItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
-  {
-    sameMsg = TBX_TRUE;
-  }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
+  /* Insert in an order that covers the middle, start and end of the list. */
+  TEST_ASSERT_EQUAL(TBX_OK, TbxListInsertItemSorted(myList, &listTestMsgB,
+                                                    compareListMsg));
+  TEST_ASSERT_EQUAL(TBX_OK, TbxListInsertItemSorted(myList, &listTestMsgC,
+                                                    compareListMsg));
+  TEST_ASSERT_EQUAL(TBX_OK, TbxListInsertItemSorted(myList, &listTestMsgA,
+                                                    compareListMsg));
+  /* List should now be A (id=123) -> B (id=456) -> C (id=789). */
+  TEST_ASSERT_EQUAL_UINT32(3, TbxListGetSize(myList));
+  TEST_ASSERT_EQUAL(&listTestMsgA, TbxListGetFirstItem(myList));
+  TEST_ASSERT_EQUAL(&listTestMsgB, TbxListGetNextItem(myList, &listTestMsgA));
+  TEST_ASSERT_EQUAL(&listTestMsgC, TbxListGetNextItem(myList, &listTestMsgB));
+  TEST_ASSERT_EQUAL(&listTestMsgB, TbxListGetPreviousItem(myList, &listTestMsgC));
+  TEST_ASSERT_EQUAL(&listTestMsgC, TbxListGetLastItem(myList));
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListInsertItemAfter_InsertsAtCorrectLocation ***/
+} /*** end of test_TbxListInsertItemSorted_ShouldKeepListSorted ***/
 
 
 /************************************************************************************//**
 ** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListRemoveItem_ShouldAssertOnInvalidParams(void)
+void test_TbxListGetNextNode_ShouldAssertOnInvalidParams(void)
 {
   tTbxList * myList;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
   /* Pass on a NULL pointer for the list, which should not work. */
-  TbxListRemoveItem(NULL, &listTestMsgA);
+  TEST_ASSERT_NULL(TbxListGetFirstNode(NULL));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for the item, which should not work. */
-  TbxListRemoveItem(myList, NULL);
+  /* Pass on a NULL pointer for the node, which should not work. */
+  TEST_ASSERT_NULL(TbxListGetNextNode(myList, NULL));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the node, which should not work. */
+  TEST_ASSERT_NULL(TbxListRemoveNode(myList, NULL));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
-} /*** end of test_TbxListRemoveItem_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxListGetNextNode_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that items can be removed from the list.
+** \brief     Tests that the nodes of the list can be used to iterate over its items in
+**            both directions.
 **
 ****************************************************************************************/
-void test_TbxListRemoveItem_ShouldRemoveItem(void)
+void test_TbxListGetNextNode_ShouldIterateOverItems(void)
 {
-  tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
+  tTbxList     * myList;
+  tTbxListNode * myNode;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add two items. */
+  /* An empty list has no nodes. */
+  TEST_ASSERT_NULL(TbxListGetFirstNode(myList));
+  TEST_ASSERT_NULL(TbxListGetLastNode(myList));
+  /* Add three items. */
   (void)TbxListInsertItemBack(myList, &listTestMsgA);
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
   (void)TbxListInsertItemBack(myList, &listTestMsgC);
-  /* Remove the last item. */
-  TbxListRemoveItem(myList, &listTestMsgC);
-  /* Read back the last item, which should return the first one in the list. */
-  myMsg = TbxListGetLastItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  /* Iterate forward. */
+  myNode = TbxListGetFirstNode(myList);
+  TEST_ASSERT_EQUAL(&listTestMsgA, TbxListGetNodeItem(myNode));
+  myNode = TbxListGetNextNode(myList, myNode);
+  TEST_ASSERT_EQUAL(&listTestMsgB, TbxListGetNodeItem(myNode));
+  myNode = TbxListGetNextNode(myList, myNode);
+  TEST_ASSERT_EQUAL(&listTestMsgC, TbxListGetNodeItem(myNode));
+  TEST_ASSERT_NULL(TbxListGetNextNode(myList, myNode));
+  /* Iterate backward. */
+  myNode = TbxListGetLastNode(myList);
+  TEST_ASSERT_EQUAL(&listTestMsgC, TbxListGetNodeItem(myNode));
+  myNode = TbxListGetPreviousNode(myList, myNode);
+  TEST_ASSERT_EQUAL(&listTestMsgB, TbxListGetNodeItem(myNode));
+  myNode = TbxListGetPreviousNode(myList, myNode);
+  TEST_ASSERT_EQUAL(&listTestMsgA, TbxListGetNodeItem(myNode));
+  TEST_ASSERT_NULL(TbxListGetPreviousNode(myList, myNode));
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxListGetNextNode_ShouldIterateOverItems ***/
+
+
+/************************************************************************************//**
+** \brief     Tests that items can be inserted and removed at a node, while iterating
+**            over the list.
+**
+****************************************************************************************/
+void test_TbxListRemoveNode_ShouldRemoveWhileIterating(void)
+{
+  tTbxList     * myList;
+  tTbxListNode * myNode;
+
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Add one item and insert the others around its node. */
+  (void)TbxListInsertItemBack(myList, &listTestMsgB);
+  myNode = TbxListGetFirstNode(myList);
+  TEST_ASSERT_EQUAL(TBX_OK, TbxListInsertItemBeforeNode(myList, &listTestMsgA, myNode));
+  TEST_ASSERT_EQUAL(TBX_OK, TbxListInsertItemAfterNode(myList, &listTestMsgC, myNode));
+  /* List should now be A -> B -> C. */
+  TEST_ASSERT_EQUAL_UINT32(3, TbxListGetSize(myList));
+  TEST_ASSERT_EQUAL(&listTestMsgA, TbxListGetFirstItem(myList));
+  TEST_ASSERT_EQUAL(&listTestMsgB, TbxListGetNextItem(myList, &listTestMsgA));
+  TEST_ASSERT_EQUAL(&listTestMsgC, TbxListGetLastItem(myList));
+  /* Remove item B while iterating over the list. */
+  myNode = TbxListGetFirstNode(myList);
+  while (myNode != NULL)
   {
-    sameMsg = TBX_TRUE;
+    if (TbxListGetNodeItem(myNode) == &listTestMsgB)
+    {
+      myNode = TbxListRemoveNode(myList, myNode);
+    }
+    else
+    {
+      myNode = TbxListGetNextNode(myList, myNode);
+    }
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Remove the first item. */
-  TbxListRemoveItem(myList, &listTestMsgA);
-  /* Read back the first item, which should return NULL because the list is now empty. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_NULL(myMsg);
+  /* List should now be A -> C. */
+  TEST_ASSERT_EQUAL_UINT32(2, TbxListGetSize(myList));
+  TEST_ASSERT_EQUAL(&listTestMsgC, TbxListGetNextItem(myList, &listTestMsgA));
+  TEST_ASSERT_EQUAL(&listTestMsgA, TbxListGetPreviousItem(myList, &listTestMsgC));
+  /* Remove the remaining items. */
+  TEST_ASSERT_EQUAL(TbxListGetLastNode(myList),
+                    TbxListRemoveNode(myList, TbxListGetFirstNode(myList)));
+  TEST_ASSERT_NULL(TbxListRemoveNode(myList, TbxListGetFirstNode(myList)));
+  TEST_ASSERT_EQUAL_UINT32(0, TbxListGetSize(myList));
+  TEST_ASSERT_NULL(TbxListGetFirstNode(myList));
+  TEST_ASSERT_NULL(TbxListGetLastNode(myList));
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListRemoveItem_ShouldRemoveItem ***/
+} /*** end of test_TbxListRemoveNode_ShouldRemoveWhileIterating ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListGetFirstItem_ShouldAssertOnInvalidParams(void)
+void test_TbxListForEach_ShouldAssertOnInvalidParams(void)
 {
-  void * result;
+  tTbxList * myList;
+  uint32_t   idSum = 0;
 
-  /* Pass on a NULL pointer, which should not work. */
-  result = TbxListGetFirstItem(NULL);
-  /* Make sure it returned NULL. */
-  TEST_ASSERT_NULL(result);
+  /* Create a new linked list. */
+  myList = TbxListCreate();
+  /* Pass on a NULL pointer for the list, which should not work. */
+  TbxListForEach(NULL, visitListMsg, &idSum);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-} /*** end of TbxListGetFirstItem_ShouldAssertOnInvalidParams ***/
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the visit function, which should not work. */
+  TbxListForEach(myList, NULL, &idSum);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Delete the list as cleanup. */
+  TbxListDelete(myList);
+} /*** end of test_TbxListForEach_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the first item of the list can be retrieved.
+** \brief     Tests that all items in the list are visited, until the callback function
+**            requests to stop.
 **
 ****************************************************************************************/
-void test_TbxListGetFirstItem_ShouldReturnFirstItem(void)
+void test_TbxListForEach_ShouldVisitItems(void)
 {
   tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
+  uint32_t   idSum = 0;
 
   /* Create a new linked list. */
   myList = TbxListCreate();
-  /* Add three items. */
+  /* Nothing should be visited in an empty list. */
+  TbxListForEach(myList, visitListMsg, &idSum);
+  TEST_ASSERT_EQUAL_UINT32(0, idSum);
+  /* Add two items and visit them both. */
   (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
   (void)TbxListInsertItemBack(myList, &listTestMsgC);
-
-  /* Read back the first item in the list, which should be listTestMsgA. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
-  {
-    sameMsg = TBX_TRUE;
-  }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Clear the list. */
-  TbxListClear(myList);
-  /* Read back the first item in the list, which should be NULL. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_NULL(myMsg);
+  TbxListForEach(myList, visitListMsg, &idSum);
+  TEST_ASSERT_EQUAL_UINT32(123 + 789, idSum);
+  /* Insert item B in the middle. The traversal should stop after visiting it. */
+  (void)TbxListInsertItemAfter(myList, &listTestMsgB, &listTestMsgA);
+  idSum = 0;
+  TbxListForEach(myList, visitListMsg, &idSum);
+  TEST_ASSERT_EQUAL_UINT32(123 + 456, idSum);
   /* Delete the list as cleanup. */
   TbxListDelete(myList);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListGetFirstItem_ShouldReturnFirstItem ***/
+} /*** end of test_TbxListForEach_ShouldVisitItems ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+** \brief     Tests that invalid parameters trigger an assertion.
 **
 ****************************************************************************************/
-void test_TbxListGetLastItem_ShouldAssertOnInvalidParams(void)
+void test_TbxIListInsertNodeBack_ShouldAssertOnInvalidParams(void)
 {
-  void * result;
+  tTbxIList      myList;
+  tIListTestItem myItem = { 0 };
 
-  /* Pass on a NULL pointer, which should not work. */
-  result = TbxListGetLastItem(NULL);
-  /* Make sure it returned NULL. */
-  TEST_ASSERT_NULL(result);
+  /* Pass on a NULL pointer for the list, which should not work. */
+  TbxIListInit(NULL);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-} /*** end of TbxListGetLastItem_ShouldAssertOnInvalidParams ***/
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Initialize the list. */
+  TbxIListInit(&myList);
+  /* Pass on a NULL pointer for the list, which should not work. */
+  TbxIListInsertNodeBack(NULL, &myItem.node);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the node, which should not work. */
+  TbxIListInsertNodeBack(&myList, NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the reference node, which should not work. */
+  TbxIListInsertNodeAfter(&myList, &myItem.node, NULL);
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Make sure the list is still empty. */
+  TEST_ASSERT_EQUAL_UINT32(0, TbxIListGetSize(&myList));
+} /*** end of test_TbxIListInsertNodeBack_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the last item of the list can be retrieved.
+** \brief     Tests that nodes are inserted at the correct location and that the items
+**            can be obtained from their nodes.
 **
 ****************************************************************************************/
-void test_TbxListGetLastItem_ShouldReturnLastItem(void)
+void test_TbxIListInsertNodeBack_InsertsAtCorrectLocation(void)
 {
-  tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
+  tTbxIList       myList;
+  tIListTestItem  myItems[4] = { { .id = 0 }, { .id = 1 }, { .id = 2 }, { .id = 3 } };
+  tTbxIListNode * myNode;
+  uint32_t        idx;
+
+  /* Initialize the list. */
+  TbxIListInit(&myList);
+  TEST_ASSERT_NULL(TbxIListGetFirstNode(&myList));
+  TEST_ASSERT_NULL(TbxIListGetLastNode(&myList));
+  /* Build the list 0 -> 1 -> 2 -> 3, by inserting at all possible locations. */
+  TbxIListInsertNodeBack(&myList, &myItems[2].node);
+  TbxIListInsertNodeFront(&myList, &myItems[0].node);
+  TbxIListInsertNodeBefore(&myList, &myItems[1].node, &myItems[2].node);
+  TbxIListInsertNodeAfter(&myList, &myItems[3].node, &myItems[2].node);
+  TEST_ASSERT_EQUAL_UINT32(4, TbxIListGetSize(&myList));
+  /* Iterate forward. */
+  myNode = TbxIListGetFirstNode(&myList);
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    TEST_ASSERT_EQUAL(&myItems[idx], TBX_ILIST_GET_ITEM(myNode, tIListTestItem, node));
+    myNode = TbxIListGetNextNode(&myList, myNode);
+  }
+  TEST_ASSERT_NULL(myNode);
+  /* Iterate backward. */
+  myNode = TbxIListGetLastNode(&myList);
+  for (idx = 4U; idx > 0U; idx--)
+  {
+    TEST_ASSERT_EQUAL_UINT32(idx - 1U,
+                             TBX_ILIST_GET_ITEM(myNode, tIListTestItem, node)->id);
+    myNode = TbxIListGetPreviousNode(&myList, myNode);
+  }
+  TEST_ASSERT_NULL(myNode);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxIListInsertNodeBack_InsertsAtCorrectLocation ***/
 
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Add three items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  (void)TbxListInsertItemBack(myList, &listTestMsgC);
 
-  /* Read back the last item in the list, which should be listTestMsgC. */
-  myMsg = TbxListGetLastItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgC.id) && (myMsg == &listTestMsgC))
+/************************************************************************************//**
+** \brief     Tests that nodes can be removed and reinserted.
+**
+****************************************************************************************/
+void test_TbxIListRemoveNode_ShouldRemoveNodes(void)
+{
+  tTbxIList      myList;
+  tIListTestItem myItems[3] = { { .id = 0 }, { .id = 1 }, { .id = 2 } };
+  uint32_t       idx;
+
+  /* Initialize the list and add the items. */
+  TbxIListInit(&myList);
+  for (idx = 0U; idx < 3U; idx++)
   {
-    sameMsg = TBX_TRUE;
+    TbxIListInsertNodeBack(&myList, &myItems[idx].node);
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Clear the list. */
-  TbxListClear(myList);
-  /* Read back the last item in the list, which should be NULL. */
-  myMsg = TbxListGetLastItem(myList);
-  TEST_ASSERT_NULL(myMsg);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
+  /* Remove the middle one. */
+  TbxIListRemoveNode(&myList, &myItems[1].node);
+  TEST_ASSERT_EQUAL_UINT32(2, TbxIListGetSize(&myList));
+  TEST_ASSERT_EQUAL(&myItems[2].node, TbxIListGetNextNode(&myList, &myItems[0].node));
+  TEST_ASSERT_EQUAL(&myItems[0].node, TbxIListGetPreviousNode(&myList,
+                                                              &myItems[2].node));
+  /* Remove the last one and reinsert the middle one at the back. */
+  TbxIListRemoveNode(&myList, &myItems[2].node);
+  TEST_ASSERT_EQUAL(&myItems[0].node, TbxIListGetLastNode(&myList));
+  TbxIListInsertNodeBack(&myList, &myItems[1].node);
+  /* Use the list as a first-in first-out queue. */
+  TEST_ASSERT_EQUAL(&myItems[0].node, TbxIListRemoveFirstNode(&myList));
+  TEST_ASSERT_EQUAL(&myItems[1].node, TbxIListRemoveFirstNode(&myList));
+  TEST_ASSERT_NULL(TbxIListRemoveFirstNode(&myList));
+  /* The list should now be empty. */
+  TEST_ASSERT_EQUAL_UINT32(0, TbxIListGetSize(&myList));
+  TEST_ASSERT_NULL(TbxIListGetFirstNode(&myList));
+  TEST_ASSERT_NULL(TbxIListGetLastNode(&myList));
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListGetLastItem_ShouldReturnLastItem ***/
+} /*** end of test_TbxIListRemoveNode_ShouldRemoveNodes ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+** \brief     Tests that a ring buffer cannot be created with invalid parameters and that
+**            its functions do not accept invalid parameters.
 **
 ****************************************************************************************/
-void test_TbxListGetPreviousItem_ShouldAssertOnInvalidParams(void)
+void test_TbxRingBufCreate_ShouldAssertOnInvalidParams(void)
 {
-  void * result;
-  tTbxList * myList;
+  tTbxRingBuf * myRingBuf;
+  uint32_t      myElement = 0U;
 
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Pass on a NULL pointer for the list, which should not work. */
-  result = TbxListGetPreviousItem(NULL, &listTestMsgA);
-  /* Make sure it returns NULL. */
-  TEST_ASSERT_NULL(result);
+  /* Attempt to create a ring buffer with a capacity that is not a power of two. */
+  myRingBuf = TbxRingBufCreate(6U, sizeof(uint32_t));
+  /* Make sure an assertion was triggered and that no ring buffer was created. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_NULL(myRingBuf);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Attempt to create a ring buffer with a zero element size. */
+  myRingBuf = TbxRingBufCreate(8U, 0U);
+  /* Make sure an assertion was triggered and that no ring buffer was created. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_NULL(myRingBuf);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the ring buffer, which should not work. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxRingBufWrite(NULL, &myElement));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Create a ring buffer with four byte elements. */
+  myRingBuf = TbxRingBufCreate(8U, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(myRingBuf);
+  /* Pass on a NULL pointer for the element, which should not work. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxRingBufRead(myRingBuf, NULL));
+  /* Make sure an assertion was triggered. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Write bytes to a ring buffer without single byte elements, which should not work. */
+  TEST_ASSERT_EQUAL(0U, TbxRingBufWriteBytes(myRingBuf, (uint8_t *)&myElement, 1U));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for the item, which should not work. */
-  result = TbxListGetPreviousItem(myList, NULL);
-  /* Make sure it returns NULL. */
-  TEST_ASSERT_NULL(result);
+  /* Commit more elements than were reserved, which should not work. */
+  TbxRingBufReadCommit(myRingBuf, 1U);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
-} /*** end of test_TbxListGetPreviousItem_ShouldAssertOnInvalidParams ***/
+} /*** end of test_TbxRingBufCreate_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the previous item of the list can be retrieved.
+** \brief     Tests that elements are read in the same order as they were written, also
+**            when the indices wrap around the end of the storage.
 **
 ****************************************************************************************/
-void test_TbxListGetPreviousItem_ShouldReturnPreviousItem(void)
+void test_TbxRingBufWrite_ShouldBeFirstInFirstOut(void)
 {
-  tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
-
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Add two items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  /* Read back the one before the last item in the list, which should be listTestMsgA. */
-  myMsg = TbxListGetPreviousItem(myList, &listTestMsgB);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgA.id) && (myMsg == &listTestMsgA))
+  tTbxRingBuf * myRingBuf;
+  uint32_t      myElement;
+  uint32_t      writeCnt = 0U;
+  uint32_t      readCnt = 0U;
+  uint32_t      idx;
+
+  /* Create a ring buffer with four byte elements. */
+  myRingBuf = TbxRingBufCreate(4U, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(myRingBuf);
+  TEST_ASSERT_EQUAL(0U, TbxRingBufGetCount(myRingBuf));
+  TEST_ASSERT_EQUAL(4U, TbxRingBufGetFree(myRingBuf));
+  /* Reading from an empty ring buffer should not work. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxRingBufRead(myRingBuf, &myElement));
+  /* Fill the ring buffer. Writing to a full ring buffer should not work. */
+  for (idx = 0U; idx < 4U; idx++)
   {
-    sameMsg = TBX_TRUE;
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxRingBufWrite(myRingBuf, &writeCnt));
+    writeCnt++;
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Read back the one before the first item in the list, which should return NULL. */
-  myMsg = TbxListGetPreviousItem(myList, TbxListGetFirstItem(myList));
-  TEST_ASSERT_NULL(myMsg);
-  /* Read back one before an item not currently in the list, which should return NULL. */
-  myMsg = TbxListGetPreviousItem(myList, &listTestMsgC);
-  TEST_ASSERT_NULL(myMsg);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxRingBufWrite(myRingBuf, &writeCnt));
+  TEST_ASSERT_EQUAL(4U, TbxRingBufGetCount(myRingBuf));
+  TEST_ASSERT_EQUAL(0U, TbxRingBufGetFree(myRingBuf));
+  /* Repeatedly read two and write two elements, such that the indices wrap around. */
+  for (idx = 0U; idx < 10U; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxRingBufRead(myRingBuf, &myElement));
+    TEST_ASSERT_EQUAL_UINT32(readCnt++, myElement);
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxRingBufRead(myRingBuf, &myElement));
+    TEST_ASSERT_EQUAL_UINT32(readCnt++, myElement);
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxRingBufWrite(myRingBuf, &writeCnt));
+    writeCnt++;
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxRingBufWrite(myRingBuf, &writeCnt));
+    writeCnt++;
+  }
+  /* Empty the ring buffer. */
+  while (TbxRingBufRead(myRingBuf, &myElement) == TBX_OK)
+  {
+    TEST_ASSERT_EQUAL_UINT32(readCnt++, myElement);
+  }
+  TEST_ASSERT_EQUAL_UINT32(writeCnt, readCnt);
+  TEST_ASSERT_EQUAL(0U, TbxRingBufGetCount(myRingBuf));
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListGetPreviousItem_ShouldReturnPreviousItem ***/
+} /*** end of test_TbxRingBufWrite_ShouldBeFirstInFirstOut ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion and returns NULL.
+** \brief     Tests that a byte FIFO writes and reads partially, when there is not enough
+**            space or data, and that this works across the end of the storage.
 **
 ****************************************************************************************/
-void test_TbxListGetNextItem_ShouldAssertOnInvalidParams(void)
+void test_TbxRingBufWriteBytes_ShouldWrapAround(void)
 {
-  void * result;
-  tTbxList * myList;
-
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Pass on a NULL pointer for the list, which should not work. */
-  result = TbxListGetNextItem(NULL, &listTestMsgA);
-  /* Make sure it returns NULL. */
-  TEST_ASSERT_NULL(result);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Reset the assertion counter. */
-  assertionCnt = 0;
-  /* Pass on a NULL pointer for the item, which should not work. */
-  result = TbxListGetNextItem(myList, NULL);
-  /* Make sure it returns NULL. */
-  TEST_ASSERT_NULL(result);
-  /* Make sure an assertion was triggered. */
-  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
-} /*** end of test_TbxListGetNextItem_ShouldAssertOnInvalidParams ***/
+  tTbxRingBuf   * myRingBuf;
+  uint8_t const   txData[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
+  uint8_t         rxData[8] = { 0U };
+
+  /* Create a byte FIFO. */
+  myRingBuf = TbxRingBufCreate(8U, 1U);
+  TEST_ASSERT_NOT_NULL(myRingBuf);
+  /* Write and read 6 bytes, such that the next write wraps around. */
+  TEST_ASSERT_EQUAL(6U, TbxRingBufWriteBytes(myRingBuf, txData, 6U));
+  TEST_ASSERT_EQUAL(6U, TbxRingBufReadBytes(myRingBuf, rxData, sizeof(rxData)));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(txData, rxData, 6U);
+  /* Write 12 bytes. Only 8 should fit. */
+  TEST_ASSERT_EQUAL(6U, TbxRingBufWriteBytes(myRingBuf, txData, 6U));
+  TEST_ASSERT_EQUAL(2U, TbxRingBufWriteBytes(myRingBuf, txData, 6U));
+  TEST_ASSERT_EQUAL(0U, TbxRingBufGetFree(myRingBuf));
+  /* Read 3 bytes and then the rest. */
+  TEST_ASSERT_EQUAL(3U, TbxRingBufReadBytes(myRingBuf, rxData, 3U));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(&txData[0], rxData, 3U);
+  TEST_ASSERT_EQUAL(5U, TbxRingBufReadBytes(myRingBuf, rxData, sizeof(rxData)));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(&txData[3], rxData, 3U);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(&txData[0], &rxData[3], 2U);
+  TEST_ASSERT_EQUAL(0U, TbxRingBufReadBytes(myRingBuf, rxData, sizeof(rxData)));
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxRingBufWriteBytes_ShouldWrapAround ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the next item of the list can be retrieved.
+** \brief     Tests that the reserved spans are contiguous and do not cross the end of
+**            the storage.
 **
 ****************************************************************************************/
-void test_TbxListGetNextItem_ShouldReturnNextItem(void)
+void test_TbxRingBufWriteReserve_ShouldReturnContiguousSpans(void)
 {
-  tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
-
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Add two items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  /* Read back the one after the first item in the list, which should be listTestMsgB. */
-  myMsg = TbxListGetNextItem(myList, &listTestMsgA);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
-  {
-    sameMsg = TBX_TRUE;
-  }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Read back the one after the item in the list, which should return NULL. */
-  myMsg = TbxListGetNextItem(myList, TbxListGetLastItem(myList));
-  TEST_ASSERT_NULL(myMsg);
-  /* Read back one after an item not currently in the list, which should return NULL. */
-  myMsg = TbxListGetNextItem(myList, &listTestMsgC);
-  TEST_ASSERT_NULL(myMsg);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
+  tTbxRingBuf * myRingBuf;
+  uint8_t     * mySpan;
+  void        * mySpanPtr;
+  uint8_t       myByte;
+
+  /* Create a byte FIFO and move the indices to the middle of the storage. */
+  myRingBuf = TbxRingBufCreate(8U, 1U);
+  TEST_ASSERT_NOT_NULL(myRingBuf);
+  TEST_ASSERT_EQUAL(8U, TbxRingBufWriteReserve(myRingBuf, &mySpanPtr));
+  TbxRingBufWriteCommit(myRingBuf, 5U);
+  TEST_ASSERT_EQUAL(5U, TbxRingBufReadReserve(myRingBuf, &mySpanPtr));
+  TbxRingBufReadCommit(myRingBuf, 5U);
+  /* The free space is now split in two spans of 3 and 5 bytes. */
+  TEST_ASSERT_EQUAL(3U, TbxRingBufWriteReserve(myRingBuf, &mySpanPtr));
+  mySpan = mySpanPtr;
+  mySpan[0] = 10U;
+  mySpan[1] = 11U;
+  mySpan[2] = 12U;
+  TbxRingBufWriteCommit(myRingBuf, 3U);
+  TEST_ASSERT_EQUAL(5U, TbxRingBufWriteReserve(myRingBuf, &mySpanPtr));
+  mySpan = mySpanPtr;
+  mySpan[0] = 13U;
+  TbxRingBufWriteCommit(myRingBuf, 1U);
+  /* The stored bytes are also split in two spans. */
+  TEST_ASSERT_EQUAL(3U, TbxRingBufReadReserve(myRingBuf, &mySpanPtr));
+  mySpan = mySpanPtr;
+  TEST_ASSERT_EQUAL_UINT8(10U, mySpan[0]);
+  TEST_ASSERT_EQUAL_UINT8(12U, mySpan[2]);
+  TbxRingBufReadCommit(myRingBuf, 3U);
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxRingBufRead(myRingBuf, &myByte));
+  TEST_ASSERT_EQUAL_UINT8(13U, myByte);
+  TEST_ASSERT_EQUAL(0U, TbxRingBufReadReserve(myRingBuf, &mySpanPtr));
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListGetNextItem_ShouldReturnNextItem ***/
+} /*** end of test_TbxRingBufWriteReserve_ShouldReturnContiguousSpans ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion.
+** \brief     Tests that a hash map cannot be created with invalid parameters and that
+**            its functions do not accept invalid parameters.
 **
 ****************************************************************************************/
-void test_TbxListSwapItems_ShouldAssertOnInvalidParams(void)
+void test_TbxHashMapCreate_ShouldAssertOnInvalidParams(void)
 {
-  tTbxList * myList;
+  tTbxHashMap * myMap;
+  uint32_t      myKey = 1U;
 
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Pass on a NULL pointer for the list, which should not work. */
-  TbxListSwapItems(NULL, &listTestMsgA, &listTestMsgB);
+  /* Attempt to create a hash map with a zero key size, which should not work. */
+  myMap = TbxHashMapCreate(4U, 0U, NULL);
+  /* Make sure an assertion was triggered and that no hash map was created. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_NULL(myMap);
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Create a hash map with uint32_t keys. */
+  myMap = TbxHashMapCreate(4U, sizeof(uint32_t), NULL);
+  TEST_ASSERT_NOT_NULL(myMap);
+  /* Pass on a NULL pointer for the value, which should not work. */
+  TEST_ASSERT_EQUAL_UINT8(TBX_ERROR, TbxHashMapInsert(myMap, &myKey, NULL));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for item1, which should not work. */
-  TbxListSwapItems(myList, NULL, &listTestMsgB);
+  /* Pass on a NULL pointer for the key, which should not work. */
+  TEST_ASSERT_NULL(TbxHashMapFind(myMap, NULL));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for item2, which should not work. */
-  TbxListSwapItems(myList, &listTestMsgA, NULL);
+  /* Pass on a NULL pointer for the hash map, which should not work. */
+  TEST_ASSERT_NULL(TbxHashMapRemove(NULL, &myKey));
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
-} /*** end of test_TbxListSwapItems_ShouldAssertOnInvalidParams ***/
+  /* Clean up. */
+  TbxHashMapDelete(myMap);
+} /*** end of test_TbxHashMapCreate_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the items in the list can be swapped.
+** \brief     Tests that entries can be found after inserting them, also while the hash
+**            map grows, and that they can no longer be found after removing them.
 **
 ****************************************************************************************/
-void test_TbxListSwapItems_ShouldSwapItems(void)
+void test_TbxHashMapInsert_ShouldFindInsertedEntries(void)
 {
-  tTbxList * myList;
-  tListTestMsg * myMsg;
-  uint8_t sameMsg;
-
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Add three items. */
-  (void)TbxListInsertItemBack(myList, &listTestMsgA);
-  (void)TbxListInsertItemBack(myList, &listTestMsgB);
-  (void)TbxListInsertItemBack(myList, &listTestMsgC);
-
-  /* Swap the first and the last items. */
-  TbxListSwapItems(myList, TbxListGetFirstItem(myList), TbxListGetLastItem(myList));
-  /* Read back the first item in the list, which should be listTestMsgC. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgC.id) && (myMsg == &listTestMsgC))
+  tTbxHashMap * myMap;
+  uint32_t      myValues[24];
+  uint32_t      myKey;
+  uint32_t      idx;
+
+  /* Create a hash map with uint32_t keys and room for only a few entries. */
+  myMap = TbxHashMapCreate(4U, sizeof(uint32_t), NULL);
+  TEST_ASSERT_NOT_NULL(myMap);
+  /* Insert more entries than it initially has room for, such that it grows. */
+  for (idx = 0U; idx < 24U; idx++)
   {
-    sameMsg = TBX_TRUE;
+    myKey = idx * 1000U;
+    myValues[idx] = idx;
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxHashMapInsert(myMap, &myKey, &myValues[idx]));
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Swap the first (C) and the second (B) one. */
-  TbxListSwapItems(myList, &listTestMsgC, &listTestMsgB);
-  /* Read back the first item in the list, which should be listTestMsgB. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgB.id) && (myMsg == &listTestMsgB))
+  TEST_ASSERT_EQUAL(24U, TbxHashMapGetSize(myMap));
+  /* Verify that all entries can be found. */
+  for (idx = 0U; idx < 24U; idx++)
   {
-    sameMsg = TBX_TRUE;
+    myKey = idx * 1000U;
+    TEST_ASSERT_EQUAL_PTR(&myValues[idx], TbxHashMapFind(myMap, &myKey));
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* Read back the second item in the list, which should be listTestMsgC. */
-  myMsg = TbxListGetNextItem(myList, TbxListGetFirstItem(myList));
-  TEST_ASSERT_NOT_NULL(myMsg);
-  sameMsg = TBX_FALSE;
-  if ((myMsg->id == listTestMsgC.id) && (myMsg == &listTestMsgC))
+  /* Keys that were not inserted should not be found. */
+  myKey = 1U;
+  TEST_ASSERT_NULL(TbxHashMapFind(myMap, &myKey));
+  /* Inserting an existing key should only replace its value. */
+  myKey = 0U;
+  TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxHashMapInsert(myMap, &myKey, &myValues[1]));
+  TEST_ASSERT_EQUAL_PTR(&myValues[1], TbxHashMapFind(myMap, &myKey));
+  TEST_ASSERT_EQUAL(24U, TbxHashMapGetSize(myMap));
+  /* Remove every other entry. */
+  for (idx = 0U; idx < 24U; idx += 2U)
   {
-    sameMsg = TBX_TRUE;
+    myKey = idx * 1000U;
+    TEST_ASSERT_NOT_NULL(TbxHashMapRemove(myMap, &myKey));
+    TEST_ASSERT_NULL(TbxHashMapRemove(myMap, &myKey));
   }
-  TEST_ASSERT_EQUAL(TBX_TRUE, sameMsg);  
-  /* List now contains B -> C -> A. Remove the last one (A). */
-  TbxListRemoveItem(myList, &listTestMsgA);
-  /* Now try swapping B and A. Which shouldn't do anything because A is not in the list.
-   * Note that it also shouldn´t generate an assertion.
-   */
-  TbxListSwapItems(myList, &listTestMsgB, &listTestMsgA);
-  /* B should still be the first item. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_EQUAL(&listTestMsgB, myMsg);
-  /* C should still be the last item. */
-  myMsg = TbxListGetLastItem(myList);
-  TEST_ASSERT_EQUAL(&listTestMsgC, myMsg);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
+  TEST_ASSERT_EQUAL(12U, TbxHashMapGetSize(myMap));
+  /* Verify that only the remaining entries can be found. */
+  for (idx = 0U; idx < 24U; idx++)
+  {
+    myKey = idx * 1000U;
+    if ((idx % 2U) == 0U)
+    {
+      TEST_ASSERT_NULL(TbxHashMapFind(myMap, &myKey));
+    }
+    else
+    {
+      TEST_ASSERT_EQUAL_PTR(&myValues[idx], TbxHashMapFind(myMap, &myKey));
+    }
+  }
+  /* Clean up. */
+  TbxHashMapDelete(myMap);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListSwapItems_ShouldSwapItems ***/
+} /*** end of test_TbxHashMapInsert_ShouldFindInsertedEntries ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that invalid parameters trigger an assertion.
+** \brief     Tests that byte string keys and a custom hash function work, also if many
+**            keys have the same hash value.
 **
 ****************************************************************************************/
-void test_TbxListSortItems_ShouldAssertOnInvalidParams(void)
+void test_TbxHashMapInsert_ShouldSupportByteStringKeys(void)
 {
-  tTbxList * myList;
+  tTbxHashMap * myMap;
+  uint8_t       myKeys[10][6];
+  uint8_t       myValue = 0U;
+  uint8_t       idx;
+
+  /* Create a hash map with 6 byte keys, for example MAC addresses. */
+  myMap = TbxHashMapCreate(16U, 6U, hashMapTestHash);
+  TEST_ASSERT_NOT_NULL(myMap);
+  /* Insert the entries. */
+  for (idx = 0U; idx < 10U; idx++)
+  {
+    myKeys[idx][0] = 0x02U;
+    myKeys[idx][1] = 0x00U;
+    myKeys[idx][2] = 0x5EU;
+    myKeys[idx][3] = 0x10U;
+    myKeys[idx][4] = idx;
+    myKeys[idx][5] = idx;
+    TEST_ASSERT_EQUAL_UINT8(TBX_OK, TbxHashMapInsert(myMap, myKeys[idx], &myValue));
+  }
+  /* Remove one from the middle of a run and verify the others can still be found. */
+  TEST_ASSERT_EQUAL_PTR(&myValue, TbxHashMapRemove(myMap, myKeys[4]));
+  for (idx = 0U; idx < 10U; idx++)
+  {
+    if (idx == 4U)
+    {
+      TEST_ASSERT_NULL(TbxHashMapFind(myMap, myKeys[idx]));
+    }
+    else
+    {
+      TEST_ASSERT_EQUAL_PTR(&myValue, TbxHashMapFind(myMap, myKeys[idx]));
+    }
+  }
+  TEST_ASSERT_EQUAL(9U, TbxHashMapGetSize(myMap));
+  /* Clean up. */
+  TbxHashMapDelete(myMap);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxHashMapInsert_ShouldSupportByteStringKeys ***/
 
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Pass on a NULL pointer for the list, which should not work. */
-  TbxListSortItems(NULL, compareListMsg);
-  /* Make sure an assertion was triggered. */
+
+/************************************************************************************//**
+** \brief     Tests that the software timer functions assert on invalid parameters.
+**
+****************************************************************************************/
+void test_TbxTimerCreate_ShouldAssertOnInvalidParams(void)
+{
+  tTbxTimer     * myTimer;
+  tTimerTestLog   myLog = { 0U, 0U };
+
+  /* Attempt to create a timer without a callback function, which should not work. */
+  myTimer = TbxTimerCreate(NULL, &myLog);
+  /* Make sure an assertion was triggered and that no timer was created. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_NULL(myTimer);
   /* Reset the assertion counter. */
   assertionCnt = 0;
-  /* Pass on a NULL pointer for the compare function, which should not work. */
-  TbxListSortItems(myList, NULL);
+  /* Create a timer. */
+  myTimer = TbxTimerCreate(timerTestCallback, &myLog);
+  TEST_ASSERT_NOT_NULL(myTimer);
+  /* Attempt to start the timer with zero ticks, which should not work. */
+  TbxTimerStart(myTimer, 0U, 0U);
+  /* Make sure an assertion was triggered and that the timer is not running. */
+  TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
+  TEST_ASSERT_EQUAL_UINT8(TBX_FALSE, TbxTimerIsRunning(myTimer));
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Pass on a NULL pointer for the timer, which should not work. */
+  TbxTimerStart(NULL, 1U, 0U);
   /* Make sure an assertion was triggered. */
   TEST_ASSERT_GREATER_THAN_UINT32(0, assertionCnt);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
-} /*** end of test_TbxListSortItems_ShouldAssertOnInvalidParams ***/
+  /* Reset the assertion counter. */
+  assertionCnt = 0;
+  /* Clean up. */
+  TbxTimerDelete(myTimer);
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTimerCreate_ShouldAssertOnInvalidParams ***/
 
 
 /************************************************************************************//**
-** \brief     Tests that the items in the list can be sorted.
+** \brief     Tests that timers expire at exactly the right tick, also when they start in
+**            a higher level of the timing wheel, and that periodic timers do not drift.
 **
 ****************************************************************************************/
-void test_TbxListSortItems_ShouldSortItems(void)
+void test_TbxTimerTick_ShouldExpireTimersInTime(void)
 {
-  tTbxList * myList;
-  tListTestMsg * myMsg;
+  tTbxTimer     * myTimers[4];
+  tTimerTestLog   myLogs[4] = { { 0U, 0U }, { 0U, 0U }, { 0U, 0U }, { 0U, 0U } };
+  uint32_t const  myTicks[4] = { 3U, 100U, 5000U, 7U };
+  uint32_t        startTime;
+  uint32_t        idx;
+
+  /* Create the timers. */
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    myTimers[idx] = TbxTimerCreate(timerTestCallback, &myLogs[idx]);
+    TEST_ASSERT_NOT_NULL(myTimers[idx]);
+  }
+  /* Start the one-shot timers and the periodic timer. */
+  startTime = TbxTimerGetTime();
+  TbxTimerStart(myTimers[0], myTicks[0], 0U);
+  TbxTimerStart(myTimers[1], myTicks[1], 0U);
+  TbxTimerStart(myTimers[2], myTicks[2], 0U);
+  TbxTimerStart(myTimers[3], myTicks[3], myTicks[3]);
+  TEST_ASSERT_EQUAL_UINT32(myTicks[0], TbxTimerGetNextExpiry());
+  /* Run the timers, until the last one-shot timer expired. */
+  for (idx = 0U; idx < myTicks[2]; idx++)
+  {
+    TbxTimerTick();
+  }
+  /* Verify that each one-shot timer expired once and at the right tick. */
+  for (idx = 0U; idx < 3U; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(1U, myLogs[idx].count);
+    TEST_ASSERT_EQUAL_UINT32(startTime + myTicks[idx], myLogs[idx].time);
+    TEST_ASSERT_EQUAL_UINT8(TBX_FALSE, TbxTimerIsRunning(myTimers[idx]));
+  }
+  /* Verify that the periodic timer is still running and did not drift. */
+  TEST_ASSERT_EQUAL_UINT32(myTicks[2] / myTicks[3], myLogs[3].count);
+  TEST_ASSERT_EQUAL_UINT32(startTime + (myLogs[3].count * myTicks[3]), myLogs[3].time);
+  TEST_ASSERT_EQUAL_UINT8(TBX_TRUE, TbxTimerIsRunning(myTimers[3]));
+  /* Stop the periodic timer and verify that it no longer expires. */
+  TbxTimerStop(myTimers[3]);
+  TEST_ASSERT_EQUAL_UINT32(TBX_TIMER_NO_EXPIRY, TbxTimerGetNextExpiry());
+  for (idx = 0U; idx < myTicks[3]; idx++)
+  {
+    TbxTimerTick();
+  }
+  TEST_ASSERT_EQUAL_UINT32(myTicks[2] / myTicks[3], myLogs[3].count);
+  /* Clean up. */
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    TbxTimerDelete(myTimers[idx]);
+  }
+  /* Make sure no assertion was triggered. */
+  TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
+} /*** end of test_TbxTimerTick_ShouldExpireTimersInTime ***/
 
-  /* Create a new linked list. */
-  myList = TbxListCreate();
-  /* Add three items. */
-  (void)TbxListInsertItemFront(myList, &listTestMsgA);
-  (void)TbxListInsertItemFront(myList, &listTestMsgB);
-  (void)TbxListInsertItemFront(myList, &listTestMsgC);
-  /* List is now C (id=789) -> B (id=456) -> A (id=123). Next sort based on id. */
-  TbxListSortItems(myList, compareListMsg);
-  /* List should now be A (id=123) -> B (id=456) -> C (id=789). */
-  /* Check the first item. */
-  myMsg = TbxListGetFirstItem(myList);
-  TEST_ASSERT_EQUAL(&listTestMsgA, myMsg);
-  TEST_ASSERT_EQUAL_UINT32(123, myMsg->id);
-  /* Check the second item. */
-  myMsg = TbxListGetNextItem(myList, TbxListGetFirstItem(myList));
-  TEST_ASSERT_EQUAL(&listTestMsgB, myMsg);
-  TEST_ASSERT_EQUAL_UINT32(456, myMsg->id);
-  /* Check the last item. */
-  myMsg = TbxListGetLastItem(myList);
-  TEST_ASSERT_EQUAL(&listTestMsgC, myMsg);
-  TEST_ASSERT_EQUAL_UINT32(789, myMsg->id);
-  /* Delete the list as cleanup. */
-  TbxListDelete(myList);
+
+/************************************************************************************//**
+** \brief     Tests that the next expiry is never later than the expire time of the first
+**            timer that expires.
+**
+****************************************************************************************/
+void test_TbxTimerGetNextExpiry_ShouldNotBeLaterThanFirstExpiry(void)
+{
+  tTbxTimer     * myTimer;
+  tTimerTestLog   myLog = { 0U, 0U };
+  uint32_t        nextExpiry;
+  uint32_t        remaining = 300U;
+  uint32_t        idx;
+
+  /* Create a timer and start it such that it starts in a higher level. */
+  myTimer = TbxTimerCreate(timerTestCallback, &myLog);
+  TEST_ASSERT_NOT_NULL(myTimer);
+  TbxTimerStart(myTimer, remaining, 0U);
+  /* Skip ahead to each next expiry, the same way as a tickless idle mode would. */
+  while (remaining > 0U)
+  {
+    nextExpiry = TbxTimerGetNextExpiry();
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, nextExpiry);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(remaining, nextExpiry);
+    TEST_ASSERT_EQUAL_UINT32(0U, myLog.count);
+    for (idx = 0U; idx < nextExpiry; idx++)
+    {
+      TbxTimerTick();
+    }
+    remaining -= nextExpiry;
+  }
+  /* Verify that the timer expired. */
+  TEST_ASSERT_EQUAL_UINT32(1U, myLog.count);
+  TEST_ASSERT_EQUAL_UINT32(TBX_TIMER_NO_EXPIRY, TbxTimerGetNextExpiry());
+  /* Clean up. */
+  TbxTimerDelete(myTimer);
   /* Make sure no assertion was triggered. */
   TEST_ASSERT_EQUAL_UINT32(0, assertionCnt);
-} /*** end of test_TbxListSortItems_ShouldSortItems ***/
+} /*** end of test_TbxTimerGetNextExpiry_ShouldNotBeLaterThanFirstExpiry ***/
 
 
 /************************************************************************************//**
@@ -2231,26 +5685,75 @@ int runTests(void)
   /* Tests for the critical section module. */
   RUN_TEST(test_TbxCriticalSectionExit_ShouldTriggerAssertionIfNotInCritSect);
   RUN_TEST(test_TbxCriticalSectionEnter_ShouldNotAssertUponCritSectExit);
+  RUN_TEST(test_TbxCriticalSectionEnter_ShouldExcludeOtherThreads);
+  RUN_TEST(test_TbxLockEnter_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxLockEnter_CanNest);
+#if (TBX_CONF_CRITSECT_PROFILE_ENABLE > 0U)
+  RUN_TEST(test_TbxCriticalSectionGetStats_ShouldRecordCallSite);
+  RUN_TEST(test_TbxCriticalSectionEnter_ShouldRemainCallableAsFunction);
+#endif
   /* Tests for the heap module. */
   RUN_TEST(test_TbxHeapGetFree_ShouldReturnActualFreeSize);
   RUN_TEST(test_TbxHeapAllocate_ShouldReturnNotNull);
   RUN_TEST(test_TbxHeapAllocate_ShouldReturnNullIfZeroSizeAllocated);
   RUN_TEST(test_TbxHeapAllocate_ShouldReturnNullIfTooMuchAllocated);
   RUN_TEST(test_TbxHeapAllocate_ShouldAlignToAddressSize);
+  RUN_TEST(test_TbxHeapAllocateAligned_ShouldAlign);
+  RUN_TEST(test_TbxHeapAllocateAligned_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxHeapRegionCreate_ShouldAllocateFromRegion);
+  RUN_TEST(test_TbxTlsfCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxTlsfAllocate_CanAllocateAndRelease);
+  RUN_TEST(test_TbxTlsfAllocate_ShouldReuseReleasedMemory);
+  RUN_TEST(test_TbxTlsfRelease_ShouldNotFragmentLargeMemory);
+#if (TBX_CONF_TLSF_HEAP_SIZE > 0U)
+  RUN_TEST(test_TbxTlsfAllocate_CanUseDefaultAllocator);
+#endif
   /* Tests for the random number module. */
   RUN_TEST(test_TbxRandomSetSeedInitHandler_ShouldTriggerAssertionIfParamNull);
   RUN_TEST(test_TbxRandomSetSeedInitHandler_ShouldWork);
   RUN_TEST(test_TbxRandomNumberGet_ShouldReturnRandomNumbers);
+  RUN_TEST(test_TbxRandomFill_ShouldFillBuffer);
+  RUN_TEST(test_TbxRandomCtxNumberGet_ShouldBeReproducible);
+#if (TBX_PORT_ENTROPY > 0U) && (TBX_CONF_RANDOM_ENTROPY_POOL_SIZE > 0U)
+  RUN_TEST(test_TbxRandomEntropyGet_ShouldUsePoolAndHardware);
+#endif
   /* Tests for the checksum module. */
   RUN_TEST(test_TbxChecksumCrc16Calculate_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxChecksumCrc16Calculate_ShouldReturnValidCrc16);
+  RUN_TEST(test_TbxChecksumCrc16Calculate_ShouldReturnCheckValue);
+  RUN_TEST(test_TbxChecksumCrc16Update_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxChecksumCrc16Update_ShouldMatchCalculateInChunks);
+  RUN_TEST(test_TbxChecksumCrc16Update_ShouldMatchBytewiseInLargeChunk);
+  RUN_TEST(test_TbxChecksumCrc16Final_ShouldReturnCheckValues);
   RUN_TEST(test_TbxChecksumCrc32Calculate_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxChecksumCrc32Calculate_ShouldReturnValidCrc32);
+  RUN_TEST(test_TbxChecksumCrc32Calculate_ShouldReturnCheckValue);
+  RUN_TEST(test_TbxChecksumCrc32Update_ShouldMatchCalculateInChunks);
+  RUN_TEST(test_TbxChecksumCrc32Update_ShouldMatchBytewiseInLargeChunk);
+  RUN_TEST(test_TbxChecksumCrc32Final_ShouldReturnCheckValues);
+  RUN_TEST(test_TbxChecksumFletcher32Calculate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxChecksumFletcher32Calculate_ShouldReturnCheckValues);
+  RUN_TEST(test_TbxChecksumFletcher32Update_ShouldMatchCalculateInChunks);
+  RUN_TEST(test_TbxChecksumAdler32Calculate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxChecksumAdler32Calculate_ShouldReturnCheckValues);
+  RUN_TEST(test_TbxChecksumAdler32Update_ShouldMatchCalculateInChunks);
+  RUN_TEST(test_TbxChecksumXxHash32Calculate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxChecksumXxHash32Calculate_ShouldReturnCheckValues);
+  RUN_TEST(test_TbxChecksumXxHash32Update_ShouldMatchCalculateInChunks);
   /* Tests for the cryptography module. */
   RUN_TEST(test_TbxCryptoAes256Encrypt_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxCryptoAes256Encrypt_ShouldEncrypt);
   RUN_TEST(test_TbxCryptoAes256Decrypt_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxCryptoAes256Decrypt_ShouldDecrypt);
+  RUN_TEST(test_TbxCryptoAes256Init_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxCryptoAes256EncryptUpdate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxCryptoAes256EncryptUpdate_ShouldEncryptCbc);
+  RUN_TEST(test_TbxCryptoAes256DecryptUpdate_ShouldDecryptCbc);
+  RUN_TEST(test_TbxCryptoAes256EncryptUpdate_ShouldEncryptCtrInChunks);
+  RUN_TEST(test_TbxCryptoAes256SetOffset_ShouldAllowRandomAccess);
+  RUN_TEST(test_TbxCryptoAes256Update_ShouldMatchSoftwareEngine);
+  RUN_TEST(test_TbxCryptoAes256EncryptTo_ShouldMatchInPlace);
+  RUN_TEST(test_TbxCryptoAes256EncryptGather_ShouldMatchContiguous);
   /* Tests for the memory pool module. */
   RUN_TEST(test_TbxMemPoolCreate_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxMemPoolCreate_CannotAllocateMoreThanFreeHeap);
@@ -2262,8 +5765,25 @@ int runTests(void)
   RUN_TEST(test_TbxMemPoolAllocate_CannotAllocateWhenFull);
   RUN_TEST(test_TbxMemPoolCreate_CanIncreasePoolSize);
   RUN_TEST(test_TbxMemPoolRelease_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolRelease_ShouldAssertOnDoubleRelease);
   RUN_TEST(test_TbxMemPoolRelease_CanReleaseBlocks);
   RUN_TEST(test_TbxMemPoolAllocate_CanReallocate);
+#if (TBX_CONF_MEMPOOL_SIZE_CLASS_ENABLE == 0U)
+  RUN_TEST(test_TbxMemPoolAllocate_ShouldSelectBestFit);
+#endif
+  RUN_TEST(test_TbxMemPoolCreate_ShouldUseOneSlab);
+  RUN_TEST(test_TbxMemPoolCreateInRegion_ShouldAllocateFromRegion);
+#if (TBX_CONF_MEMPOOL_STATS_ENABLE > 0U)
+  RUN_TEST(test_TbxMemPoolGetStats_ShouldTrackAllocations);
+#endif
+  RUN_TEST(test_TbxMemPoolAllocateBatch_CanAllocateAndRelease);
+  RUN_TEST(test_TbxMemPoolAllocateBatch_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolGetSizeClass_ShouldRoundUpToSizeClass);
+  RUN_TEST(test_TbxMemPoolGetSizeClass_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolFixedAllocate_CanAllocateAndRelease);
+  RUN_TEST(test_TbxMemPoolFixedCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxMemPoolDefine_CanAllocateAndRelease);
+  RUN_TEST(test_TbxMemPoolDefine_CanAllocateFromMultipleThreads);
   /* Tests for the linked list module. */
   RUN_TEST(test_TbxListCreate_ReturnsValidListPointer);
   RUN_TEST(test_TbxListCreate_CanReuseMemory);
@@ -2273,6 +5793,8 @@ int runTests(void)
   RUN_TEST(test_TbxListClear_CanEmptyList);
   RUN_TEST(test_TbxListGetSize_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxListGetSize_ReturnsActualSize);
+  RUN_TEST(test_TbxListReserve_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxListReserve_ShouldPreallocateNodes);
   RUN_TEST(test_TbxListInsertItemFront_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxListInsertItemFront_InsertsAtCorrectLocation);
   RUN_TEST(test_TbxListInsertItemBack_ShouldAssertOnInvalidParams);
@@ -2295,6 +5817,31 @@ int runTests(void)
   RUN_TEST(test_TbxListSwapItems_ShouldSwapItems);
   RUN_TEST(test_TbxListSortItems_ShouldAssertOnInvalidParams);
   RUN_TEST(test_TbxListSortItems_ShouldSortItems);
+  RUN_TEST(test_TbxListSortItems_ShouldSortStable);
+  RUN_TEST(test_TbxListInsertItemSorted_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxListInsertItemSorted_ShouldKeepListSorted);
+  RUN_TEST(test_TbxListGetNextNode_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxListGetNextNode_ShouldIterateOverItems);
+  RUN_TEST(test_TbxListRemoveNode_ShouldRemoveWhileIterating);
+  RUN_TEST(test_TbxListForEach_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxListForEach_ShouldVisitItems);
+  /* Tests for the intrusive linked list module. */
+  RUN_TEST(test_TbxIListInsertNodeBack_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxIListInsertNodeBack_InsertsAtCorrectLocation);
+  RUN_TEST(test_TbxIListRemoveNode_ShouldRemoveNodes);
+  /* Tests for the ring buffer module. */
+  RUN_TEST(test_TbxRingBufCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxRingBufWrite_ShouldBeFirstInFirstOut);
+  RUN_TEST(test_TbxRingBufWriteBytes_ShouldWrapAround);
+  RUN_TEST(test_TbxRingBufWriteReserve_ShouldReturnContiguousSpans);
+  /* Tests for the hash map module. */
+  RUN_TEST(test_TbxHashMapCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxHashMapInsert_ShouldFindInsertedEntries);
+  RUN_TEST(test_TbxHashMapInsert_ShouldSupportByteStringKeys);
+  /* Tests for the software timer module. */
+  RUN_TEST(test_TbxTimerCreate_ShouldAssertOnInvalidParams);
+  RUN_TEST(test_TbxTimerTick_ShouldExpireTimersInTime);
+  RUN_TEST(test_TbxTimerGetNextExpiry_ShouldNotBeLaterThanFirstExpiry);
   /* Tests for the platform module. */
   RUN_TEST(test_TbxPlatformLittleEndian_ShouldReportLittleEndian);
 